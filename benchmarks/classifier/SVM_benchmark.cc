@@ -0,0 +1,54 @@
+#include "utils/BenchmarkHarness.h"
+
+#include <shogun/classifier/svm/LibLinear.h>
+#include <shogun/classifier/svm/LibSVM.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/kernel/GaussianKernel.h>
+#include <shogun/labels/BinaryLabels.h>
+
+using namespace shogun;
+
+/* a fixed number of epochs of the dual coordinate descent solver */
+static void BM_LibLinearEpochs(benchmark::State& state)
+{
+	const int32_t num_vec=state.range(0);
+	const int32_t num_epochs=10;
+
+	CDenseFeatures<float64_t>* feats=
+		new CDenseFeatures<float64_t>(benchmark_data(100, num_vec));
+	CBinaryLabels* labels=new CBinaryLabels(benchmark_labels(num_vec));
+
+	CLibLinear* svm=new CLibLinear(1.0, feats, labels);
+	SG_REF(svm);
+	svm->set_liblinear_solver_type(L2R_L2LOSS_SVC_DUAL);
+	svm->set_max_iterations(num_epochs);
+	svm->set_epsilon(1e-10);
+
+	run_benchmark(state, [&]() {
+		svm->train();
+	});
+
+	state.SetItemsProcessed(int64_t(state.iterations())*num_epochs*num_vec);
+	SG_UNREF(svm);
+}
+SHOGUN_BENCHMARK(BM_LibLinearEpochs)->Arg(10000)->Arg(100000);
+
+static void BM_LibSVMTrain(benchmark::State& state)
+{
+	const int32_t num_vec=state.range(0);
+
+	CDenseFeatures<float64_t>* feats=
+		new CDenseFeatures<float64_t>(benchmark_data(20, num_vec));
+	CBinaryLabels* labels=new CBinaryLabels(benchmark_labels(num_vec));
+	CGaussianKernel* kernel=new CGaussianKernel(feats, feats, 10.0);
+
+	CLibSVM* svm=new CLibSVM(1.0, kernel, labels);
+	SG_REF(svm);
+
+	run_benchmark(state, [&]() {
+		svm->train();
+	});
+
+	SG_UNREF(svm);
+}
+SHOGUN_BENCHMARK(BM_LibSVMTrain)->Arg(1000)->Arg(4000);
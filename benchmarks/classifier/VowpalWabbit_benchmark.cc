@@ -0,0 +1,71 @@
+#include "utils/BenchmarkHarness.h"
+
+#include <shogun/classifier/vw/VowpalWabbit.h>
+#include <shogun/features/streaming/StreamingVwFeatures.h>
+#include <shogun/io/streaming/StreamingVwFile.h>
+#include <shogun/mathematics/RandomStream.h>
+
+#include <stdio.h>
+
+using namespace shogun;
+
+/* examples in VW format with 100 of 1<<18 features each, of which the first
+ * 1000 are informative, written once for all thread counts */
+struct VwBenchmarkFile
+{
+	VwBenchmarkFile() : fname("shogun_benchmark_hogwild.vw"), num_examples(200000)
+	{
+		const int32_t num_features=100;
+		const int32_t dim=1<<18;
+
+		RandomStream rng(17);
+		FILE* f=fopen(fname, "w");
+		for (int32_t i=0; i<num_examples; i++)
+		{
+			float64_t label=rng.random_half_open()<0.5 ? -1.0 : 1.0;
+			fprintf(f, "%g |", label);
+			for (int32_t j=0; j<num_features; j++)
+			{
+				int32_t index=rng.random(0, dim-1);
+				float64_t value=rng.random_half_open();
+				if (index<1000)
+					value+=0.5*label;
+				fprintf(f, " %d:%g", index, value);
+			}
+			fprintf(f, "\n");
+		}
+		fclose(f);
+	}
+
+	~VwBenchmarkFile()
+	{
+		remove(fname);
+	}
+
+	const char* fname;
+	int32_t num_examples;
+};
+
+/* one pass over the file with Hogwild learner threads, parsing included */
+static void BM_VowpalWabbitHogwild(benchmark::State& state)
+{
+	static VwBenchmarkFile data;
+	const int32_t num_threads=state.range(0);
+
+	run_benchmark(state, [&]() {
+		CStreamingVwFile* file=new CStreamingVwFile(data.fname);
+		CStreamingVwFeatures* features=new CStreamingVwFeatures(file, true, 1024);
+		SG_REF(features);
+
+		CVowpalWabbit* vw=new CVowpalWabbit(features);
+		SG_REF(vw);
+		vw->set_num_learning_threads(num_threads);
+		vw->train_machine();
+
+		SG_UNREF(vw);
+		SG_UNREF(features);
+	});
+
+	state.SetItemsProcessed(int64_t(state.iterations())*data.num_examples);
+}
+SHOGUN_BENCHMARK(BM_VowpalWabbitHogwild)->Arg(1)->Arg(2)->Arg(4)->Arg(8);
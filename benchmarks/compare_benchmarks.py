@@ -0,0 +1,98 @@
+#!/usr/bin/env python
+"""
+Compare two JSON result files of shogun-benchmarks and flag regressions.
+
+    compare_benchmarks.py baseline.json new.json [--threshold 0.05]
+
+For every benchmark in both files, the median over the repetitions is
+compared (the mean if no median was reported, or the single run). A
+benchmark regressed if it got slower by more than the threshold and the
+difference exceeds the noise of both runs, i.e. twice the larger standard
+deviation. The exit code is 1 if any benchmark regressed, so the script can
+gate an upgrade.
+"""
+
+from __future__ import print_function
+
+import argparse
+import json
+import sys
+
+
+def load_results(fname, cpu_time=False):
+    """Map benchmark name to a dict of time statistics, of the cpu time or
+    of the wall clock time."""
+    with open(fname) as f:
+        data = json.load(f)
+
+    results = {}
+    for bench in data.get('benchmarks', []):
+        if bench.get('error_occurred'):
+            continue
+
+        name = bench.get('run_name', bench['name'])
+        stat = bench.get('aggregate_name', 'single') \
+            if bench.get('run_type') == 'aggregate' else 'single'
+        time_key = 'cpu_time' if cpu_time else 'real_time'
+
+        entry = results.setdefault(name, {'unit': bench.get('time_unit', 'ns')})
+        if stat == 'single':
+            entry.setdefault('runs', []).append(bench[time_key])
+        else:
+            entry[stat] = bench[time_key]
+
+    for entry in results.values():
+        runs = entry.pop('runs', [])
+        if runs and 'median' not in entry and 'mean' not in entry:
+            runs = sorted(runs)
+            entry['median'] = runs[len(runs) // 2]
+
+    return results
+
+
+def center(entry):
+    return entry.get('median', entry.get('mean'))
+
+
+parser = argparse.ArgumentParser(description=__doc__,
+                                 formatter_class=argparse.RawDescriptionHelpFormatter)
+parser.add_argument('baseline', help='results of the reference version')
+parser.add_argument('contender', help='results of the new version')
+parser.add_argument('--threshold', type=float, default=0.05,
+                    help='relative slowdown which counts as regression (default 0.05)')
+parser.add_argument('--cpu-time', action='store_true',
+                    help='compare cpu time instead of wall clock time')
+args = parser.parse_args()
+
+baseline = load_results(args.baseline, args.cpu_time)
+contender = load_results(args.contender, args.cpu_time)
+
+regressions = []
+print('%-60s %12s %12s %9s' % ('benchmark', 'baseline', 'new', 'change'))
+
+for name in sorted(set(baseline) & set(contender)):
+    old, new = baseline[name], contender[name]
+    old_time, new_time = center(old), center(new)
+    if old_time is None or new_time is None or old_time <= 0:
+        continue
+
+    change = (new_time - old_time) / old_time
+    noise = 2 * max(old.get('stddev', 0), new.get('stddev', 0))
+
+    flag = ''
+    if change > args.threshold and new_time - old_time > noise:
+        flag = '  REGRESSION'
+        regressions.append(name)
+    elif -change > args.threshold and old_time - new_time > noise:
+        flag = '  improved'
+
+    print('%-60s %10.3f%-2s %10.3f%-2s %+8.1f%%%s' % (name, old_time, old['unit'],
+          new_time, new['unit'], 100 * change, flag))
+
+for name in sorted(set(baseline) ^ set(contender)):
+    print('%-60s only in %s' % (name, 'baseline' if name in baseline else 'new results'))
+
+if regressions:
+    print('\n%d of the benchmarks regressed by more than %.0f%%' %
+          (len(regressions), 100 * args.threshold))
+    sys.exit(1)
@@ -0,0 +1,47 @@
+#include "utils/BenchmarkHarness.h"
+
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/distance/ManhattanMetric.h>
+#include <shogun/distance/CosineDistance.h>
+
+using namespace shogun;
+
+template <class D>
+static void BM_DistanceMatrix(benchmark::State& state)
+{
+	const int32_t num_vec=state.range(0);
+	CDenseFeatures<float64_t>* feats=
+		new CDenseFeatures<float64_t>(benchmark_data(50, num_vec));
+	D* distance=new D(feats, feats);
+	SG_REF(distance);
+
+	run_benchmark(state, [&]() {
+		SGMatrix<float64_t> dm=distance->get_distance_matrix();
+		benchmark::DoNotOptimize(dm.matrix);
+	});
+
+	state.SetItemsProcessed(int64_t(state.iterations())*num_vec*num_vec);
+	SG_UNREF(distance);
+}
+SHOGUN_BENCHMARK(BM_DistanceMatrix<CManhattanMetric>)->Arg(256)->Arg(1024);
+SHOGUN_BENCHMARK(BM_DistanceMatrix<CCosineDistance>)->Arg(256)->Arg(1024);
+
+/* one query against all vectors, as in CKNN and CKMeans */
+static void BM_ManhattanDistanceRow(benchmark::State& state)
+{
+	const int32_t num_vec=state.range(0);
+	CDenseFeatures<float64_t>* feats=
+		new CDenseFeatures<float64_t>(benchmark_data(50, num_vec));
+	CManhattanMetric* distance=new CManhattanMetric(feats, feats);
+	SG_REF(distance);
+
+	SGVector<float64_t> row(num_vec);
+	run_benchmark(state, [&]() {
+		distance->distance_block(0, 1, 0, num_vec, row.vector, 1);
+		benchmark::DoNotOptimize(row.vector);
+	});
+
+	state.SetItemsProcessed(int64_t(state.iterations())*num_vec);
+	SG_UNREF(distance);
+}
+SHOGUN_BENCHMARK(BM_ManhattanDistanceRow)->Arg(4096);
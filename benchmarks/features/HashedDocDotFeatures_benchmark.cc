@@ -0,0 +1,82 @@
+#include "utils/BenchmarkHarness.h"
+
+#include <shogun/features/StringFeatures.h>
+#include <shogun/features/hashed/HashedDocDotFeatures.h>
+#include <shogun/lib/NGramTokenizer.h>
+#include <shogun/lib/SGStringList.h>
+#include <shogun/mathematics/RandomStream.h>
+
+using namespace shogun;
+
+/* random documents of 2000 letters, tokenized into trigrams */
+static CHashedDocDotFeatures* benchmark_documents(int32_t num_bits,
+		int32_t num_strings)
+{
+	const int32_t str_length=2000;
+
+	RandomStream rng(12345);
+	SGStringList<char> string_list(num_strings, str_length);
+	for (index_t i=0; i<num_strings; i++)
+	{
+		string_list.strings[i]=SGString<char>(str_length);
+		for (index_t j=0; j<str_length; j++)
+			string_list.strings[i].string[j]=(char) rng.random('A', 'Z');
+	}
+
+	CStringFeatures<char>* docs=new CStringFeatures<char>(string_list, RAWBYTE);
+	CNGramTokenizer* tzer=new CNGramTokenizer(3);
+	return new CHashedDocDotFeatures(num_bits, docs, tzer);
+}
+
+/* one epoch of a linear solver, i.e. dense_dot() and add_to_dense_vec() on
+ * every document, hashing on the fly or using the hashed index */
+static void BM_HashedDocDotFeaturesEpoch(benchmark::State& state)
+{
+	const int32_t num_bits=state.range(0);
+	const bool indexed=state.range(1);
+	const int32_t num_strings=2000;
+
+	CHashedDocDotFeatures* feats=benchmark_documents(num_bits, num_strings);
+	SG_REF(feats);
+	if (indexed)
+		feats->build_index();
+
+	SGVector<float64_t> w(feats->get_dim_feature_space());
+	w.zero();
+
+	run_benchmark(state, [&]() {
+		float64_t sum=0;
+		for (index_t i=0; i<num_strings; i++)
+		{
+			sum+=feats->dense_dot(i, w.vector, w.vlen);
+			feats->add_to_dense_vec(1E-6, i, w.vector, w.vlen);
+		}
+		benchmark::DoNotOptimize(sum);
+	});
+
+	state.SetItemsProcessed(int64_t(state.iterations())*num_strings);
+	SG_UNREF(feats);
+}
+SHOGUN_BENCHMARK(BM_HashedDocDotFeaturesEpoch)
+	->Args({12, false})
+	->Args({12, true})
+	->Args({20, false})
+	->Args({20, true});
+
+/* hashing all documents into the index */
+static void BM_HashedDocDotFeaturesBuildIndex(benchmark::State& state)
+{
+	const int32_t num_bits=state.range(0);
+	const int32_t num_strings=2000;
+
+	CHashedDocDotFeatures* feats=benchmark_documents(num_bits, num_strings);
+	SG_REF(feats);
+
+	run_benchmark(state, [&]() {
+		feats->build_index();
+	});
+
+	state.SetItemsProcessed(int64_t(state.iterations())*num_strings);
+	SG_UNREF(feats);
+}
+SHOGUN_BENCHMARK(BM_HashedDocDotFeaturesBuildIndex)->Arg(12)->Arg(20);
@@ -10,9 +10,10 @@
 
 #include <shogun/base/init.h>
 #include <shogun/classifier/svm/SVMOcas.h>
-#include <shogun/features/HashedDocDotFeatures.h>
+#include <shogun/features/hashed/HashedDocDotFeatures.h>
 #include <shogun/features/DenseFeatures.h>
 #include <shogun/lib/NGramTokenizer.h>
+#include <shogun/lib/SGStringList.h>
 #include <shogun/mathematics/Math.h>
 
 using namespace shogun;
@@ -50,6 +51,7 @@ int main(int argv, char** argc)
 		CHashedDocDotFeatures* feats = new CHashedDocDotFeatures(b, string_feats, tzer);
 		feats->benchmark_dense_dot_range();
 		feats->benchmark_add_to_dense_vector();
+		SG_UNREF(feats);
 	}
 	exit_shogun();
 }
@@ -0,0 +1,101 @@
+#include "utils/BenchmarkHarness.h"
+
+#include <shogun/classifier/svm/LibLinear.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/features/SparseFeatures.h>
+#include <shogun/io/CSVFile.h>
+#include <shogun/io/LibSVMFile.h>
+#include <shogun/io/SerializableAsciiFile.h>
+#include <shogun/labels/BinaryLabels.h>
+
+#include <stdio.h>
+
+using namespace shogun;
+
+static void BM_CSVParse(benchmark::State& state)
+{
+	const int32_t num_vec=state.range(0);
+	const char* fname="shogun_benchmark_parse.csv";
+
+	CDenseFeatures<float64_t>* feats=
+		new CDenseFeatures<float64_t>(benchmark_data(50, num_vec));
+	CCSVFile* fout=new CCSVFile(fname, 'w');
+	feats->save(fout);
+	SG_UNREF(fout);
+	SG_UNREF(feats);
+
+	run_benchmark(state, [&]() {
+		CCSVFile* fin=new CCSVFile(fname, 'r');
+		SGMatrix<float64_t> data;
+		data.load(fin);
+		benchmark::DoNotOptimize(data.matrix);
+		SG_UNREF(fin);
+	});
+
+	state.SetItemsProcessed(int64_t(state.iterations())*num_vec);
+	remove(fname);
+}
+SHOGUN_BENCHMARK(BM_CSVParse)->Arg(10000);
+
+static void BM_LibSVMParse(benchmark::State& state)
+{
+	const int32_t num_vec=state.range(0);
+	const char* fname="shogun_benchmark_parse.libsvm";
+
+	/* about a tenth of the features is non-zero */
+	SGMatrix<float64_t> data=benchmark_data(500, num_vec);
+	for (index_t i=0; i<data.num_rows*data.num_cols; i++)
+	{
+		if (data.matrix[i]<1.5)
+			data.matrix[i]=0;
+	}
+
+	CSparseFeatures<float64_t>* feats=new CSparseFeatures<float64_t>(data);
+	CLibSVMFile* fout=new CLibSVMFile(fname, 'w');
+	feats->save(fout);
+	SG_UNREF(fout);
+	SG_UNREF(feats);
+
+	run_benchmark(state, [&]() {
+		CLibSVMFile* fin=new CLibSVMFile(fname, 'r');
+		CSparseFeatures<float64_t>* loaded=new CSparseFeatures<float64_t>(fin);
+		SG_UNREF(loaded);
+		SG_UNREF(fin);
+	});
+
+	state.SetItemsProcessed(int64_t(state.iterations())*num_vec);
+	remove(fname);
+}
+SHOGUN_BENCHMARK(BM_LibSVMParse)->Arg(10000);
+
+/* save and load of a trained linear model with its training data */
+static void BM_SerializationAscii(benchmark::State& state)
+{
+	const int32_t num_vec=state.range(0);
+	const char* fname="shogun_benchmark_serialization.txt";
+
+	CDenseFeatures<float64_t>* feats=
+		new CDenseFeatures<float64_t>(benchmark_data(100, num_vec));
+	CBinaryLabels* labels=new CBinaryLabels(benchmark_labels(num_vec));
+	CLibLinear* svm=new CLibLinear(1.0, feats, labels);
+	SG_REF(svm);
+	svm->train();
+
+	run_benchmark(state, [&]() {
+		CSerializableAsciiFile* fout=new CSerializableAsciiFile(fname, 'w');
+		svm->save_serializable(fout);
+		fout->close();
+		SG_UNREF(fout);
+
+		CSerializableAsciiFile* fin=new CSerializableAsciiFile(fname, 'r');
+		CLibLinear* loaded=new CLibLinear();
+		loaded->load_serializable(fin);
+		fin->close();
+		SG_UNREF(loaded);
+		SG_UNREF(fin);
+	});
+
+	SG_UNREF(svm);
+	remove(fname);
+}
+SHOGUN_BENCHMARK(BM_SerializationAscii)->Arg(2000);
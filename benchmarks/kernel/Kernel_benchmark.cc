@@ -0,0 +1,70 @@
+#include "utils/BenchmarkHarness.h"
+
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/kernel/GaussianKernel.h>
+#include <shogun/kernel/LinearKernel.h>
+
+using namespace shogun;
+
+static void BM_GaussianKernelMatrix(benchmark::State& state)
+{
+	const int32_t num_vec=state.range(0);
+	CDenseFeatures<float64_t>* feats=
+		new CDenseFeatures<float64_t>(benchmark_data(50, num_vec));
+	CGaussianKernel* kernel=new CGaussianKernel(feats, feats, 2.0);
+	SG_REF(kernel);
+
+	run_benchmark(state, [&]() {
+		SGMatrix<float64_t> km=kernel->get_kernel_matrix();
+		benchmark::DoNotOptimize(km.matrix);
+	});
+
+	state.SetItemsProcessed(int64_t(state.iterations())*num_vec*num_vec);
+	SG_UNREF(kernel);
+}
+SHOGUN_BENCHMARK(BM_GaussianKernelMatrix)->Arg(256)->Arg(1024);
+
+static void BM_LinearKernelMatrix(benchmark::State& state)
+{
+	const int32_t num_vec=state.range(0);
+	CDenseFeatures<float64_t>* feats=
+		new CDenseFeatures<float64_t>(benchmark_data(50, num_vec));
+	CLinearKernel* kernel=new CLinearKernel(feats, feats);
+	SG_REF(kernel);
+
+	run_benchmark(state, [&]() {
+		SGMatrix<float64_t> km=kernel->get_kernel_matrix();
+		benchmark::DoNotOptimize(km.matrix);
+	});
+
+	state.SetItemsProcessed(int64_t(state.iterations())*num_vec*num_vec);
+	SG_UNREF(kernel);
+}
+SHOGUN_BENCHMARK(BM_LinearKernelMatrix)->Arg(256)->Arg(1024);
+
+/* rows which are all in the kernel cache, as requested by SVMLight */
+static void BM_KernelCacheHit(benchmark::State& state)
+{
+	const int32_t num_vec=state.range(0);
+	CDenseFeatures<float64_t>* feats=
+		new CDenseFeatures<float64_t>(benchmark_data(50, num_vec));
+	CGaussianKernel* kernel=new CGaussianKernel(feats, feats, 2.0);
+	SG_REF(kernel);
+
+	const int32_t cache_mb=int32_t(int64_t(num_vec)*num_vec*sizeof(KERNELCACHE_ELEM)/(1024*1024))+1;
+	kernel->kernel_cache_init(cache_mb);
+	for (index_t i=0; i<num_vec; i++)
+		kernel->cache_kernel_row(i);
+
+	SGVector<float64_t> row(num_vec);
+	run_benchmark(state, [&]() {
+		for (index_t i=0; i<num_vec; i++)
+			kernel->get_kernel_row(i, NULL, row.vector, true);
+		benchmark::DoNotOptimize(row.vector);
+	});
+
+	state.SetItemsProcessed(int64_t(state.iterations())*num_vec*num_vec);
+	kernel->kernel_cache_cleanup();
+	SG_UNREF(kernel);
+}
+SHOGUN_BENCHMARK(BM_KernelCacheHit)->Arg(1024);
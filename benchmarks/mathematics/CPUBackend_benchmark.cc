@@ -0,0 +1,90 @@
+#include "utils/BenchmarkHarness.h"
+
+#include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/linalg/linalg.h>
+#include <shogun/mathematics/linalg/internal/implementation/CPUDispatch.h>
+
+using namespace shogun;
+
+/* the operations of the CPU backend with every instruction set, next to the
+ * Eigen3 backend as a reference */
+enum EBackendOperation
+{
+	OP_DOT,
+	OP_ADD,
+	OP_SCALE,
+	OP_SUM,
+	OP_MAX
+};
+
+template <linalg::Backend backend>
+static void BM_LinalgVector(benchmark::State& state)
+{
+	const index_t vec_len=state.range(0);
+	const EBackendOperation op=EBackendOperation(state.range(1));
+
+	/* the Eigen3 backend does not depend on the selected instruction set */
+	const linalg::CPUInstructionSet original=linalg::get_cpu_instruction_set();
+	const linalg::CPUInstructionSet isa=backend==linalg::Backend::CPU ?
+		linalg::CPUInstructionSet(state.range(2)) : original;
+	if (linalg::set_cpu_instruction_set(isa)!=isa)
+	{
+		linalg::set_cpu_instruction_set(original);
+		state.SkipWithError("instruction set not supported by this host");
+		return;
+	}
+
+	SGVector<float64_t> a(vec_len);
+	SGVector<float64_t> b(vec_len);
+	SGVector<float64_t> c(vec_len);
+	for (index_t i=0; i<vec_len; i++)
+	{
+		a[i]=CMath::sin(i);
+		b[i]=CMath::cos(i);
+	}
+
+	run_benchmark(state, [&]() {
+		switch (op)
+		{
+			case OP_DOT:
+				benchmark::DoNotOptimize(linalg::dot<backend>(a, b));
+				break;
+			case OP_ADD:
+				linalg::add<backend>(a, b, c, 0.5, 2.0);
+				break;
+			case OP_SCALE:
+				linalg::scale<backend>(a, c, 0.5);
+				break;
+			case OP_SUM:
+				benchmark::DoNotOptimize(linalg::vector_sum<backend>(a));
+				break;
+			case OP_MAX:
+				benchmark::DoNotOptimize(linalg::max<backend>(a));
+				break;
+		}
+		benchmark::ClobberMemory();
+	});
+
+	state.SetItemsProcessed(int64_t(state.iterations())*vec_len);
+	linalg::set_cpu_instruction_set(original);
+}
+
+/* vectors of 1<<20 elements for all operations and instruction sets */
+static void cpu_backend_args(benchmark::internal::Benchmark* b)
+{
+	for (int32_t op=OP_DOT; op<=OP_MAX; op++)
+	{
+		for (int32_t isa=int32_t(linalg::CPUInstructionSet::SCALAR);
+				isa<=int32_t(linalg::CPUInstructionSet::AVX512); isa++)
+			b->Args({1<<20, op, isa});
+	}
+}
+
+static void eigen3_args(benchmark::internal::Benchmark* b)
+{
+	for (int32_t op=OP_DOT; op<=OP_MAX; op++)
+		b->Args({1<<20, op});
+}
+
+SHOGUN_BENCHMARK(BM_LinalgVector<linalg::Backend::CPU>)->Apply(cpu_backend_args);
+SHOGUN_BENCHMARK(BM_LinalgVector<linalg::Backend::EIGEN3>)->Apply(eigen3_args);
@@ -0,0 +1,71 @@
+#include "utils/BenchmarkHarness.h"
+
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/labels/MulticlassLabels.h>
+#include <shogun/multiclass/tree/CARTree.h>
+
+using namespace shogun;
+
+static CMulticlassLabels* cart_labels(int32_t num_vec)
+{
+	SGVector<float64_t> lab=benchmark_labels(num_vec);
+	for (index_t i=0; i<lab.vlen; i++)
+		lab[i]=lab[i]>0 ? 1 : 0;
+
+	return new CMulticlassLabels(lab);
+}
+
+static void BM_CARTreeTrain(benchmark::State& state)
+{
+	const int32_t num_feat=20;
+	const int32_t num_vec=state.range(0);
+
+	CDenseFeatures<float64_t>* feats=
+		new CDenseFeatures<float64_t>(benchmark_data(num_feat, num_vec));
+	SG_REF(feats);
+
+	SGVector<bool> attribute_types(num_feat);
+	attribute_types.set_const(false);
+
+	CCARTree* tree=new CCARTree(attribute_types, PT_MULTICLASS);
+	SG_REF(tree);
+	tree->set_labels(cart_labels(num_vec));
+	tree->set_max_depth(10);
+
+	run_benchmark(state, [&]() {
+		tree->train(feats);
+	});
+
+	SG_UNREF(tree);
+	SG_UNREF(feats);
+}
+SHOGUN_BENCHMARK(BM_CARTreeTrain)->Arg(2000)->Arg(10000);
+
+static void BM_CARTreeApply(benchmark::State& state)
+{
+	const int32_t num_feat=20;
+	const int32_t num_vec=state.range(0);
+
+	CDenseFeatures<float64_t>* feats=
+		new CDenseFeatures<float64_t>(benchmark_data(num_feat, num_vec));
+	SG_REF(feats);
+
+	SGVector<bool> attribute_types(num_feat);
+	attribute_types.set_const(false);
+
+	CCARTree* tree=new CCARTree(attribute_types, PT_MULTICLASS);
+	SG_REF(tree);
+	tree->set_labels(cart_labels(num_vec));
+	tree->set_max_depth(10);
+	tree->train(feats);
+
+	run_benchmark(state, [&]() {
+		CMulticlassLabels* result=tree->apply_multiclass(feats);
+		SG_UNREF(result);
+	});
+
+	state.SetItemsProcessed(int64_t(state.iterations())*num_vec);
+	SG_UNREF(tree);
+	SG_UNREF(feats);
+}
+SHOGUN_BENCHMARK(BM_CARTreeApply)->Arg(10000);
@@ -0,0 +1,45 @@
+#include "utils/BenchmarkHarness.h"
+
+#include <shogun/distance/EuclideanDistance.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/labels/MulticlassLabels.h>
+#include <shogun/multiclass/KNN.h>
+
+using namespace shogun;
+
+/* queries of 1000 test vectors against the training vectors */
+static void BM_KNNQuery(benchmark::State& state)
+{
+	const int32_t num_vec=state.range(0);
+	const KNN_SOLVER solver=KNN_SOLVER(state.range(1));
+	const int32_t num_queries=1000;
+
+	SGVector<float64_t> lab=benchmark_labels(num_vec);
+	for (index_t i=0; i<lab.vlen; i++)
+		lab[i]=lab[i]>0 ? 1 : 0;
+
+	CDenseFeatures<float64_t>* train=
+		new CDenseFeatures<float64_t>(benchmark_data(10, num_vec));
+	CDenseFeatures<float64_t>* test=
+		new CDenseFeatures<float64_t>(benchmark_data(10, num_queries, 54321));
+	SG_REF(test);
+	CMulticlassLabels* labels=new CMulticlassLabels(lab);
+	CEuclideanDistance* distance=new CEuclideanDistance(train, train);
+
+	CKNN* knn=new CKNN(5, distance, labels, solver);
+	SG_REF(knn);
+	knn->train();
+
+	run_benchmark(state, [&]() {
+		CMulticlassLabels* result=knn->apply_multiclass(test);
+		SG_UNREF(result);
+	});
+
+	state.SetItemsProcessed(int64_t(state.iterations())*num_queries);
+	SG_UNREF(knn);
+	SG_UNREF(test);
+}
+SHOGUN_BENCHMARK(BM_KNNQuery)
+	->Args({10000, KNN_BRUTE})
+	->Args({10000, KNN_KDTREE})
+	->Args({10000, KNN_COVER_TREE});
@@ -1,13 +1,17 @@
 #include <shogun/base/init.h>
 #include <shogun/features/RandomFourierDotFeatures.h>
+#include <shogun/features/FastfoodDotFeatures.h>
 #include <shogun/kernel/GaussianKernel.h>
 #include <shogun/kernel/normalizer/IdentityKernelNormalizer.h>
 #include <shogun/lib/Time.h>
 
 using namespace shogun;
 
-/** Benchmark code for the RandomFourierDotFeatures class
- * Current results are after the code
+/** Benchmark code for the RandomFourierDotFeatures class, compared to the
+ * Fastfood features which compute the same approximation from structured
+ * Hadamard products instead of dense coefficients, once on the fly and once
+ * with materialized blocks of features
+ * Current results of the dense coefficients are after the code
  */
 
 int main(int argv, char** argc)
@@ -47,6 +51,18 @@ int main(int argv, char** argc)
 			rand_feats->benchmark_dense_dot_range();
 			rand_feats->benchmark_add_to_dense_vector();
 			SG_UNREF(rand_feats);
+
+			SG_SPRINT("Fastfood results for D = %d\n", D[i]);
+			CFastfoodDotFeatures* fastfood_feats =
+					new CFastfoodDotFeatures(dense_feats, D[i], params[0]);
+			fastfood_feats->benchmark_dense_dot_range();
+			fastfood_feats->benchmark_add_to_dense_vector();
+
+			SG_SPRINT("Fastfood results with materialized blocks for D = %d\n", D[i]);
+			fastfood_feats->set_materialization_cache(1024);
+			fastfood_feats->benchmark_dense_dot_range();
+			fastfood_feats->benchmark_add_to_dense_vector();
+			SG_UNREF(fastfood_feats);
 		}
 
 		SG_SPRINT("-------------------------------------------------------------------------\n");
@@ -0,0 +1,97 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include "BenchmarkHarness.h"
+
+#include <shogun/base/init.h>
+#include <shogun/io/SGIO.h>
+#include <shogun/mathematics/RandomStream.h>
+
+#include <algorithm>
+#include <string.h>
+#include <vector>
+
+namespace shogun
+{
+
+int32_t benchmark_warmup_runs=1;
+
+SGMatrix<float64_t> benchmark_data(int32_t num_feat, int32_t num_vec,
+		uint32_t seed)
+{
+	SGMatrix<float64_t> data(num_feat, num_vec);
+	RandomStream rng(seed);
+	rng.fill_normal(data.matrix, int64_t(num_feat)*num_vec);
+
+	for (index_t i=0; i<num_vec; i++)
+	{
+		const float64_t shift=i<num_vec/2 ? 1.0 : -1.0;
+		for (index_t j=0; j<num_feat; j++)
+			data(j, i)+=shift;
+	}
+
+	return data;
+}
+
+SGVector<float64_t> benchmark_labels(int32_t num_vec)
+{
+	SGVector<float64_t> labels(num_vec);
+	for (index_t i=0; i<num_vec; i++)
+		labels[i]=i<num_vec/2 ? 1.0 : -1.0;
+
+	return labels;
+}
+
+double benchmark_min(const std::vector<double>& v)
+{
+	return *std::min_element(v.begin(), v.end());
+}
+
+double benchmark_max(const std::vector<double>& v)
+{
+	return *std::max_element(v.begin(), v.end());
+}
+}
+
+using namespace shogun;
+
+/* Runs all registered benchmarks. Unless given on the command line, every
+ * benchmark is repeated five times and only the statistics over the
+ * repetitions are reported. Results are written as JSON with
+ * --benchmark_out=<file>, see compare_benchmarks.py for comparing two of
+ * them. */
+int main(int argc, char** argv)
+{
+	init_shogun_with_defaults();
+	sg_io->set_loglevel(MSG_WARN);
+
+	std::vector<char*> args;
+	args.push_back(argv[0]);
+	args.push_back(const_cast<char*>("--benchmark_repetitions=5"));
+	args.push_back(const_cast<char*>("--benchmark_report_aggregates_only=true"));
+	args.push_back(const_cast<char*>("--benchmark_out_format=json"));
+
+	/* later flags override the defaults above */
+	const char* warmup_flag="--shogun_warmup=";
+	for (int i=1; i<argc; i++)
+	{
+		if (!strncmp(argv[i], warmup_flag, strlen(warmup_flag)))
+			benchmark_warmup_runs=atoi(argv[i]+strlen(warmup_flag));
+		else
+			args.push_back(argv[i]);
+	}
+
+	int num_args=args.size();
+	benchmark::Initialize(&num_args, args.data());
+	if (benchmark::ReportUnrecognizedArguments(num_args, args.data()))
+		return 1;
+
+	benchmark::RunSpecifiedBenchmarks();
+
+	exit_shogun();
+	return 0;
+}
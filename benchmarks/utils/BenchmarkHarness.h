@@ -0,0 +1,71 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef _BENCHMARKHARNESS_H__
+#define _BENCHMARKHARNESS_H__
+
+#include <shogun/lib/config.h>
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGVector.h>
+
+#include <benchmark/benchmark.h>
+
+namespace shogun
+{
+
+/** number of untimed runs of the measured code before every benchmark,
+ * set with --shogun_warmup=N */
+extern int32_t benchmark_warmup_runs;
+
+/** run the measured code untimed benchmark_warmup_runs times, to fill
+ * caches and trigger lazy initialization, and then in the timing loop
+ *
+ * @param state benchmark state
+ * @param run the measured code
+ */
+template <class F> void run_benchmark(benchmark::State& state, F run)
+{
+	for (int32_t i=0; i<benchmark_warmup_runs; i++)
+		run();
+
+	for (auto _ : state)
+		run();
+}
+
+/** reproducible gaussian data of two classes, shifted by +1 and -1
+ *
+ * @param num_feat number of features
+ * @param num_vec number of vectors
+ * @param seed random seed
+ * @return data matrix
+ */
+SGMatrix<float64_t> benchmark_data(int32_t num_feat, int32_t num_vec,
+		uint32_t seed=12345);
+
+/** labels of benchmark_data()
+ *
+ * @param num_vec number of vectors
+ * @return +1 for the first half of the vectors and -1 for the rest
+ */
+SGVector<float64_t> benchmark_labels(int32_t num_vec);
+
+/** minimum of the repetitions, reported next to mean, median and stddev */
+double benchmark_min(const std::vector<double>& v);
+
+/** maximum of the repetitions */
+double benchmark_max(const std::vector<double>& v);
+}
+
+/** register a benchmark with the statistics of the harness, all benchmarks
+ * report milliseconds */
+#define SHOGUN_BENCHMARK(func) \
+	BENCHMARK(func) \
+		->ComputeStatistics("min", shogun::benchmark_min) \
+		->ComputeStatistics("max", shogun::benchmark_max) \
+		->Unit(benchmark::kMillisecond)
+
+#endif // _BENCHMARKHARNESS_H__
@@ -0,0 +1,25 @@
+MergeCFLAGS()
+GetCompilers()
+
+include(ExternalProject)
+ExternalProject_Add(
+	GoogleBenchmark
+	URL https://github.com/google/benchmark/archive/v1.5.0.tar.gz
+	TIMEOUT 10
+	PREFIX ${CMAKE_BINARY_DIR}/GoogleBenchmark
+	DOWNLOAD_DIR ${THIRD_PARTY_DIR}/GoogleBenchmark
+	INSTALL_COMMAND ""
+	CMAKE_ARGS	-DCMAKE_BUILD_TYPE=Release
+		-DBENCHMARK_ENABLE_TESTING=OFF
+		-DCMAKE_ARCHIVE_OUTPUT_DIRECTORY:PATH=${THIRD_PARTY_DIR}/libs/benchmark
+		-DCMAKE_CXX_FLAGS:STRING=${MERGED_CXX_FLAGS}${CMAKE_DEFINITIONS}
+		-DCMAKE_C_COMPILER:STRING=${C_COMPILER}
+		-DCMAKE_CXX_COMPILER:STRING=${CXX_COMPILER}
+)
+
+ExternalProject_Get_Property(GoogleBenchmark source_dir)
+SET(BENCHMARK_INCLUDE_DIR ${source_dir}/include)
+SET(BENCHMARK_LIBRARIES ${THIRD_PARTY_DIR}/libs/benchmark/${CMAKE_STATIC_LIBRARY_PREFIX}benchmark${CMAKE_STATIC_LIBRARY_SUFFIX})
+
+UNSET(C_COMPILER)
+UNSET(CXX_COMPILER)
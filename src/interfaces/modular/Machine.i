@@ -103,6 +103,7 @@ APPLY_REGRESSION(CLinearRidgeRegression);
 APPLY_REGRESSION(CLeastSquaresRegression);
 APPLY_REGRESSION(CLeastAngleRegression);
 #endif
+APPLY_REGRESSION(CElasticNetRegression);
 #ifdef USE_GPL_SHOGUN
 APPLY_REGRESSION(CGaussianProcessRegression);
 #endif //USE_GPL_SHOGUN
@@ -142,6 +143,7 @@ APPLY_LATENT(CLatentSVM);
 %rename(apply_generic) CLeastSquaresRegression::apply(CFeatures* data=NULL);
 %rename(apply_generic) CLeastAngleRegression::apply(CFeatures* data=NULL);
 #endif
+%rename(apply_generic) CElasticNetRegression::apply(CFeatures* data=NULL);
 %rename(apply_generic) CGaussianProcessRegression::apply(CFeatures* data=NULL);
 
 %rename(apply_generic) CStructuredOutputMachine::apply(CFeatures* data=NULL);
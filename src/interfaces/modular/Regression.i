@@ -16,6 +16,7 @@
 %rename(LinearRidgeRegression) CLinearRidgeRegression;
 %rename(LeastSquaresRegression) CLeastSquaresRegression;
 %rename(LeastAngleRegression) CLeastAngleRegression;
+%rename(ElasticNetRegression) CElasticNetRegression;
 %rename(LibSVR) CLibSVR;
 %rename(LibLinearRegression) CLibLinearRegression;
 %rename(MKL) CMKL;
@@ -33,6 +34,7 @@
 %include <shogun/regression/LinearRidgeRegression.h>
 %include <shogun/regression/LeastSquaresRegression.h>
 %include <shogun/regression/LeastAngleRegression.h>
+%include <shogun/regression/ElasticNetRegression.h>
 %include <shogun/regression/svr/LibSVR.h>
 %include <shogun/regression/svr/LibLinearRegression.h>
 %include <shogun/classifier/mkl/MKL.h>
@@ -8,6 +8,7 @@
  #include <shogun/regression/LinearRidgeRegression.h>
  #include <shogun/regression/LeastSquaresRegression.h>
  #include <shogun/regression/LeastAngleRegression.h>
+ #include <shogun/regression/ElasticNetRegression.h>
  #include <shogun/classifier/svm/SVM.h>
  #include <shogun/classifier/svm/LibSVM.h>
  #include <shogun/regression/svr/LibSVR.h>
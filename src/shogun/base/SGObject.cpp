@@ -21,6 +21,7 @@
 #include <shogun/lib/Map.h>
 #include <shogun/lib/SGVector.h>
 #include <shogun/lib/SGStringList.h>
+#include <shogun/lib/Metrics.h>
 #include <shogun/io/SerializableFile.h>
 
 #include <shogun/base/class_list.h>
@@ -45,6 +46,17 @@ namespace shogun
 	class CSGObject::Self
 	{
 	public:
+#ifdef USE_METRICS
+		Self() : metrics(NULL)
+		{
+		}
+
+		~Self()
+		{
+			delete metrics.load();
+		}
+
+#endif
 		void set(const BaseTag& tag, const Any& any)
 		{
 			map[tag] = any;
@@ -63,6 +75,10 @@ namespace shogun
 		}
 
 		ParametersMap map;
+
+#ifdef USE_METRICS
+		std::atomic<Metrics*> metrics;
+#endif
 	};
 
 	class Parallel;
@@ -775,6 +791,39 @@ CSGObject* CSGObject::clone()
 	return copy;
 }
 
+#ifdef USE_METRICS
+Metrics* CSGObject::get_metrics()
+{
+	Metrics* metrics=self->metrics.load(std::memory_order_acquire);
+	if (!metrics)
+	{
+		Metrics* created=new Metrics();
+		if (self->metrics.compare_exchange_strong(metrics, created))
+			metrics=created;
+		else
+			delete created;
+	}
+
+	return metrics;
+}
+#endif
+
+std::string CSGObject::get_metrics_json()
+{
+#ifdef USE_METRICS
+	return get_metrics()->to_json();
+#else
+	return "{}";
+#endif
+}
+
+void CSGObject::reset_metrics()
+{
+#ifdef USE_METRICS
+	get_metrics()->reset();
+#endif
+}
+
 void CSGObject::set_with_base_tag(const BaseTag& _tag, const Any& any)
 {
 	self->set(_tag, any);
@@ -35,6 +35,7 @@ class Parameter;
 class ParameterMap;
 class SGParamInfo;
 class CSerializableFile;
+class Metrics;
 
 template <class T, class K> class CMap;
 
@@ -488,6 +489,30 @@ public:
 	 */
 	virtual CSGObject* clone();
 
+#ifndef SWIG // SWIG should skip this part
+#ifdef USE_METRICS
+	/** Counters and timers of this object, e.g. kernel evaluations or
+	 * solver iterations, which are collected if shogun is built with
+	 * USE_METRICS. The metrics are created on first use.
+	 *
+	 * @return metrics of this object
+	 */
+	Metrics* get_metrics();
+#endif
+
+	/** Exports the counters and timers of this object as JSON object,
+	 * counters as their value and timers as object with the fields count
+	 * and seconds.
+	 *
+	 * @return JSON representation, an empty object if shogun is built
+	 * without USE_METRICS
+	 */
+	std::string get_metrics_json();
+
+	/** Sets all counters and timers of this object to zero */
+	void reset_metrics();
+#endif // SWIG
+
 private:
 	void set_global_objects();
 	void unset_global_objects();
@@ -144,6 +144,8 @@ bool CGaussianProcessClassification::train_machine(CFeatures* data)
 			"classification\n", m_method->get_name(), lik->get_name())
 	SG_UNREF(lik);
 
+	clear_predictive_state();
+
 	if (data)
 	{
 		// set inducing features for FITC inference method
@@ -174,9 +176,11 @@ SGVector<float64_t> CGaussianProcessClassification::get_mean_vector(
 	REQUIRE(m_method->supports_binary() || m_method->supports_multiclass(),
 		"%s with %s doesn't support classification\n", m_method->get_name(), lik->get_name())
 
+	SGVector<float64_t> mu;
+	SGVector<float64_t> s2;
+
 	SG_REF(data);
-	SGVector<float64_t> mu=get_posterior_means(data);
-	SGVector<float64_t> s2=get_posterior_variances(data);
+	get_posterior_means_and_variances(data, mu, s2);
 	SG_UNREF(data);
 
 	// evaluate mean
@@ -196,9 +200,11 @@ SGVector<float64_t> CGaussianProcessClassification::get_variance_vector(
 	REQUIRE(m_method->supports_binary() || m_method->supports_multiclass(),
 		"%s with %s doesn't support classification\n", m_method->get_name(), lik->get_name())
 
+	SGVector<float64_t> mu;
+	SGVector<float64_t> s2;
+
 	SG_REF(data);
-	SGVector<float64_t> mu=get_posterior_means(data);
-	SGVector<float64_t> s2=get_posterior_variances(data);
+	get_posterior_means_and_variances(data, mu, s2);
 	SG_UNREF(data);
 
 	// evaluate variance
@@ -218,9 +224,11 @@ SGVector<float64_t> CGaussianProcessClassification::get_probabilities(
 	REQUIRE(m_method->supports_binary() || m_method->supports_multiclass(),
 		"%s with %s doesn't support classification\n", m_method->get_name(), lik->get_name())
 
+	SGVector<float64_t> mu;
+	SGVector<float64_t> s2;
+
 	SG_REF(data);
-	SGVector<float64_t> mu=get_posterior_means(data);
-	SGVector<float64_t> s2=get_posterior_variances(data);
+	get_posterior_means_and_variances(data, mu, s2);
 	SG_UNREF(data);
 
 	// evaluate log probabilities
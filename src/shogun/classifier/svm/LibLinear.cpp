@@ -13,6 +13,7 @@
 #include <shogun/io/SGIO.h>
 #include <shogun/lib/Signal.h>
 #include <shogun/lib/Time.h>
+#include <shogun/lib/Metrics.h>
 #include <shogun/base/Parameter.h>
 #include <shogun/classifier/svm/LibLinear.h>
 #include <shogun/optimization/liblinear/tron.h>
@@ -52,6 +53,7 @@ void CLibLinear::init()
 {
 	liblinear_solver_type=L2R_L1LOSS_SVC_DUAL;
 	use_bias=false;
+	m_warm_start=false;
 	C1=1;
 	C2=1;
 	set_max_iterations();
@@ -69,6 +71,11 @@ void CLibLinear::init()
 	SG_ADD(&m_linear_term, "linear_term", "Linear Term", MS_NOT_AVAILABLE);
 	SG_ADD((machine_int_t*) &liblinear_solver_type, "liblinear_solver_type",
 			"Type of LibLinear solver.", MS_NOT_AVAILABLE);
+	SG_ADD(&m_path_weights, "path_weights",
+			"Weights of each step of the regularization path.",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_path_biases, "path_biases",
+			"Bias of each step of the regularization path.", MS_NOT_AVAILABLE);
 }
 
 CLibLinear::~CLibLinear()
@@ -77,6 +84,7 @@ CLibLinear::~CLibLinear()
 
 bool CLibLinear::train_machine(CFeatures* data)
 {
+	SG_METRIC_TIMER(this, "liblinear_train")
 	CSignal::clear_cancel();
 	ASSERT(m_labels)
 	ASSERT(m_labels->get_label_type() == LT_BINARY)
@@ -117,6 +125,12 @@ bool CLibLinear::train_machine(CFeatures* data)
 					num_vec, num_train_labels);
 		}
 	}
+	// primal solvers of a path start from the previous weights
+	SGVector<float64_t> previous_w=w;
+	float64_t previous_bias=bias;
+	bool warm_start_primal=m_warm_start && previous_w.vlen==num_feat &&
+		(liblinear_solver_type==L2R_LR || liblinear_solver_type==L2R_L2LOSS_SVC);
+
 	if (use_bias)
 		w=SGVector<float64_t>(SG_MALLOC(float64_t, num_feat+1), num_feat);
 	else
@@ -136,6 +150,12 @@ bool CLibLinear::train_machine(CFeatures* data)
 		prob.n=w.vlen;
 		memset(w.vector, 0, sizeof(float64_t)*(w.vlen+0));
 	}
+	if (warm_start_primal)
+	{
+		memcpy(w.vector, previous_w.vector, sizeof(float64_t)*w.vlen);
+		if (use_bias)
+			w.vector[w.vlen]=previous_bias;
+	}
 	prob.l=num_vec;
 	prob.x=features;
 	prob.y=SG_MALLOC(double, prob.l);
@@ -226,6 +246,65 @@ bool CLibLinear::train_machine(CFeatures* data)
 	return true;
 }
 
+bool CLibLinear::train_path(SGVector<float64_t> C_values, CFeatures* data)
+{
+	REQUIRE(C_values.vlen>0, "%s::train_path(): No regularization constants "
+		"given\n", get_name())
+	for (index_t k=0; k<C_values.vlen; k++)
+	{
+		REQUIRE(C_values[k]>0, "%s::train_path(): Regularization constant "
+			"%d (%f) has to be positive\n", get_name(), k, C_values[k])
+	}
+	if (data)
+	{
+		REQUIRE(data->has_property(FP_DOT), "%s::train_path(): Specified "
+			"features are not of type CDotFeatures\n", get_name())
+		set_features((CDotFeatures*) data);
+	}
+
+	// the first step starts from scratch, later ones from their predecessor
+	float64_t ratio=C2/C1;
+	bool success=true;
+	w=SGVector<float64_t>();
+	m_dual_alphas=SGVector<float64_t>();
+	m_warm_start=true;
+	for (index_t k=0; k<C_values.vlen && success; k++)
+	{
+		set_C(C_values[k], ratio*C_values[k]);
+		success=train();
+
+		if (k==0)
+		{
+			m_path_weights=SGMatrix<float64_t>(w.vlen, C_values.vlen);
+			m_path_weights.zero();
+			m_path_biases=SGVector<float64_t>(C_values.vlen);
+			m_path_biases.zero();
+		}
+		if (success)
+		{
+			memcpy(m_path_weights.get_column_vector(k), w.vector,
+					sizeof(float64_t)*w.vlen);
+			m_path_biases[k]=bias;
+		}
+	}
+	m_warm_start=false;
+	m_dual_alphas=SGVector<float64_t>();
+
+	return success;
+}
+
+void CLibLinear::set_path_solution(index_t step)
+{
+	REQUIRE(step>=0 && step<m_path_biases.vlen, "Path step (%d) has to be "
+		"in [0, %d]\n", step, m_path_biases.vlen-1)
+
+	SGVector<float64_t> weights(m_path_weights.num_rows);
+	memcpy(weights.vector, m_path_weights.get_column_vector(step),
+			sizeof(float64_t)*weights.vlen);
+	set_w(weights);
+	set_bias(m_path_biases[step]);
+}
+
 // A coordinate descent algorithm for
 // L1-loss and L2-loss SVM dual problems
 //
@@ -292,6 +371,9 @@ void CLibLinear::solve_l2r_l1l2_svc(
 	for(i=0; i<w_size; i++)
 		w[i] = 0;
 
+	// a path step starts from the previous alphas clipped to the new box
+	bool warm_start = m_warm_start && m_dual_alphas.vlen == l;
+
 	for(i=0; i<l; i++)
 	{
 		alpha[i] = 0;
@@ -307,6 +389,14 @@ void CLibLinear::solve_l2r_l1l2_svc(
 
 		QD[i] += prob->x->dot(i, prob->x,i);
 		index[i] = i;
+
+		if (warm_start && m_dual_alphas[i] > 0)
+		{
+			alpha[i] = CMath::min(m_dual_alphas[i], upper_bound[GETI(i)]);
+			prob->x->add_to_dense_vec(alpha[i]*y[i], i, w.vector, n);
+			if (prob->use_bias)
+				w.vector[n]+=alpha[i]*y[i];
+		}
 	}
 
 
@@ -387,6 +477,7 @@ void CLibLinear::solve_l2r_l1l2_svc(
 		}
 
 		iter++;
+		SG_METRIC_INC(this, "liblinear_iterations")
 		float64_t gap=PGmax_new - PGmin_new;
 		SG_SABS_PROGRESS(gap, -CMath::log10(gap), -CMath::log10(1), -CMath::log10(eps), 6)
 
@@ -433,8 +524,12 @@ void CLibLinear::solve_l2r_l1l2_svc(
 	SG_INFO("Objective value = %lf\n",v/2)
 	SG_INFO("nSV = %d\n",nSV)
 
+	if (m_warm_start)
+		m_dual_alphas=SGVector<float64_t>(alpha, l);
+	else
+		SG_FREE(alpha);
+
 	SG_FREE(QD);
-	SG_FREE(alpha);
 	SG_FREE(y);
 	SG_FREE(index);
 }
@@ -736,6 +831,7 @@ void CLibLinear::solve_l1r_l2_svc(
 		if(iter == 0)
 			Gmax_init = Gmax_new;
 		iter++;
+		SG_METRIC_INC(this, "liblinear_iterations")
 
 		SG_SABS_PROGRESS(Gmax_new, -CMath::log10(Gmax_new),
 				-CMath::log10(Gmax_init), -CMath::log10(eps*Gmax_init), 6);
@@ -1099,6 +1195,7 @@ void CLibLinear::solve_l1r_lr(
 		if(iter == 0)
 			Gmax_init = Gmax_new;
 		iter++;
+		SG_METRIC_INC(this, "liblinear_iterations")
 		SG_SABS_PROGRESS(Gmax_new, -CMath::log10(Gmax_new), -CMath::log10(Gmax_init), -CMath::log10(eps*Gmax_init), 6)
 
 		if(Gmax_new <= eps*Gmax_init)
@@ -1297,6 +1394,7 @@ void CLibLinear::solve_l2r_lr_dual(const liblinear_problem *prob, double eps, do
 		if(iter == 0)
 			Gmax_init = Gmax;
 		iter++;
+		SG_METRIC_INC(this, "liblinear_iterations")
 
 		SG_SABS_PROGRESS(Gmax, -CMath::log10(Gmax), -CMath::log10(Gmax_init), -CMath::log10(eps*Gmax_init), 6)
 
@@ -175,6 +175,42 @@ class CLibLinear : public CLinearMachine
 		/** set the linear term for qp */
 		void init_linear_term();
 
+		/** train for a sequence of regularization constants on the same
+		 * data
+		 *
+		 * Step k uses C1=C_values[k] and C2=C_values[k]*C2/C1. The dual
+		 * coordinate descent solvers start every step from the dual
+		 * variables of the previous step clipped to the new box, the
+		 * trust region newton solvers (L2R_LR and L2R_L2LOSS_SVC) from the
+		 * previous weights. The other solvers start from zero. The
+		 * solutions of all steps are kept and can be loaded with
+		 * set_path_solution(), after training the machine holds the one of
+		 * the last step.
+		 *
+		 * @param C_values regularization constants of the steps
+		 * @param data training data
+		 * @return whether training of all steps was successful
+		 */
+		bool train_path(SGVector<float64_t> C_values, CFeatures* data=NULL);
+
+		/** get the weights of the last trained path
+		 *
+		 * @return matrix with the weights (rows) of every step (columns)
+		 */
+		SGMatrix<float64_t> get_path_weights() const { return m_path_weights; }
+
+		/** get the biases of the last trained path
+		 *
+		 * @return bias of every step
+		 */
+		SGVector<float64_t> get_path_biases() const { return m_path_biases; }
+
+		/** load the solution of a step of the last trained path
+		 *
+		 * @param step index of the step
+		 */
+		void set_path_solution(index_t step);
+
 	protected:
 		/** train linear SVM classifier
 		 *
@@ -216,6 +252,17 @@ class CLibLinear : public CLinearMachine
 
 		/** solver type */
 		LIBLINEAR_SOLVER_TYPE liblinear_solver_type;
+
+		/** weights of each path step */
+		SGMatrix<float64_t> m_path_weights;
+		/** bias of each path step */
+		SGVector<float64_t> m_path_biases;
+
+	private:
+		/** whether training starts from the previous solution */
+		bool m_warm_start;
+		/** dual variables of the previous solution */
+		SGVector<float64_t> m_dual_alphas;
 };
 
 } /* namespace shogun  */
@@ -11,6 +11,7 @@
 #include <shogun/classifier/svm/LibSVM.h>
 #include <shogun/io/SGIO.h>
 #include <shogun/labels/BinaryLabels.h>
+#include <shogun/lib/Signal.h>
 
 using namespace shogun;
 
@@ -38,8 +39,6 @@ CLibSVM::~CLibSVM()
 
 bool CLibSVM::train_machine(CFeatures* data)
 {
-	struct svm_node* x_space;
-
 	ASSERT(m_labels && m_labels->get_num_labels())
 	ASSERT(m_labels->get_label_type() == LT_BINARY)
 
@@ -54,6 +53,83 @@ bool CLibSVM::train_machine(CFeatures* data)
 		kernel->init(data, data);
 	}
 
+	int32_t weights_label[2]={-1,+1};
+	float64_t weights[2]={1.0,get_C2()/get_C1()};
+	struct svm_node* x_space=init_problem(weights_label, weights);
+
+	model = svm_train(&problem, &param);
+
+	if (model)
+	{
+		ASSERT(model->nr_class==2)
+		ASSERT((model->l==0) || (model->l>0 && model->SV && model->sv_coef && model->sv_coef[0]))
+
+		int32_t num_sv=model->l;
+
+		create_new_model(num_sv);
+		CSVM::set_objective(model->objective);
+
+		float64_t sgn=model->label[0];
+
+		set_bias(-sgn*model->rho[0]);
+
+		for (int32_t i=0; i<num_sv; i++)
+		{
+			set_support_vector(i, (model->SV[i])->index);
+			set_alpha(i, sgn*model->sv_coef[0][i]);
+		}
+
+		// support vectors of the model point into x_space
+		free_problem(x_space);
+		svm_destroy_model(model);
+		model=NULL;
+		return true;
+	}
+	else
+	{
+		free_problem(x_space);
+		return false;
+	}
+}
+
+bool CLibSVM::train_path(SGVector<float64_t> C_values,
+		SGVector<float64_t> tube_epsilons, CFeatures* data)
+{
+	if (solver_type!=LIBSVM_C_SVC)
+		return CSVM::train_path(C_values, tube_epsilons, data);
+
+	REQUIRE(m_labels && m_labels->get_label_type()==LT_BINARY,
+		"%s::train_path(): Binary labels required\n", get_name())
+	init_path(C_values, tube_epsilons, data);
+	int32_t num_steps=C_values.vlen;
+
+	int32_t weights_label[2]={-1,+1};
+	float64_t weights[2]={1.0,get_C2()/get_C1()};
+	struct svm_node* x_space=init_problem(weights_label, weights);
+
+	SGVector<float64_t> C_pos(num_steps);
+	for (index_t k=0; k<num_steps; k++)
+		C_pos[k]=C_values[k]*weights[1];
+	SGVector<float64_t> rho(num_steps);
+	SGVector<float64_t> objectives(num_steps);
+
+	svm_train_path(&problem, &param, num_steps, C_pos.vector, C_values.vector,
+			NULL, m_path_alphas.matrix, rho.vector, objectives.vector);
+	free_problem(x_space);
+
+	for (index_t k=0; k<num_steps; k++)
+		m_path_biases[k]=-rho[k];
+
+	set_C(C_values[num_steps-1], C_pos[num_steps-1]);
+	set_path_solution(num_steps-1);
+	CSVM::set_objective(objectives[num_steps-1]);
+
+	return !CSignal::cancel_computations();
+}
+
+struct svm_node* CLibSVM::init_problem(int32_t* weights_label,
+		float64_t* weights)
+{
 	problem.l=m_labels->get_num_labels();
 	SG_INFO("%d trainlabels\n", problem.l)
 
@@ -79,7 +155,7 @@ bool CLibSVM::train_machine(CFeatures* data)
 	problem.x=SG_MALLOC(struct svm_node*, problem.l);
     problem.C=SG_MALLOC(float64_t, problem.l);
 
-	x_space=SG_MALLOC(struct svm_node, 2*problem.l);
+	struct svm_node* x_space=SG_MALLOC(struct svm_node, 2*problem.l);
 
 	for (int32_t i=0; i<problem.l; i++)
 	{
@@ -89,9 +165,6 @@ bool CLibSVM::train_machine(CFeatures* data)
 		x_space[2*i+1].index=-1;
 	}
 
-	int32_t weights_label[2]={-1,+1};
-	float64_t weights[2]={1.0,get_C2()/get_C1()};
-
 	ASSERT(kernel && kernel->has_features())
 	ASSERT(kernel->get_num_vec_lhs()==problem.l)
 
@@ -130,40 +203,14 @@ bool CLibSVM::train_machine(CFeatures* data)
 	if(error_msg)
 		SG_ERROR("Error: %s\n",error_msg)
 
-	model = svm_train(&problem, &param);
-
-	if (model)
-	{
-		ASSERT(model->nr_class==2)
-		ASSERT((model->l==0) || (model->l>0 && model->SV && model->sv_coef && model->sv_coef[0]))
-
-		int32_t num_sv=model->l;
-
-		create_new_model(num_sv);
-		CSVM::set_objective(model->objective);
-
-		float64_t sgn=model->label[0];
-
-		set_bias(-sgn*model->rho[0]);
-
-		for (int32_t i=0; i<num_sv; i++)
-		{
-			set_support_vector(i, (model->SV[i])->index);
-			set_alpha(i, sgn*model->sv_coef[0][i]);
-		}
-
-		SG_FREE(problem.x);
-		SG_FREE(problem.y);
-		SG_FREE(problem.pv);
-        SG_FREE(problem.C);
-
-
-		SG_FREE(x_space);
+	return x_space;
+}
 
-		svm_destroy_model(model);
-		model=NULL;
-		return true;
-	}
-	else
-		return false;
+void CLibSVM::free_problem(struct svm_node* x_space)
+{
+	SG_FREE(problem.x);
+	SG_FREE(problem.y);
+	SG_FREE(problem.pv);
+	SG_FREE(problem.C);
+	SG_FREE(x_space);
 }
@@ -16,6 +16,7 @@
 #include <shogun/classifier/svm/SVM.h>
 #include <shogun/classifier/mkl/MKL.h>
 #include <shogun/labels/BinaryLabels.h>
+#include <shogun/mathematics/Math.h>
 
 #include <string.h>
 
@@ -62,6 +63,12 @@ void CSVM::set_defaults(int32_t num_sv)
 			MS_NOT_AVAILABLE);
 	SG_ADD(&m_linear_term, "linear_term", "Linear term in qp.",
 			MS_NOT_AVAILABLE);
+	SG_ADD(&m_path_alphas, "path_alphas",
+			"Coefficients of each step of the regularization path.",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_path_biases, "path_biases",
+			"Bias of each step of the regularization path.",
+			MS_NOT_AVAILABLE);
 
 	callback=NULL;
 	mkl=NULL;
@@ -333,3 +340,130 @@ SGVector<float64_t> CSVM::get_linear_term()
 {
 	return m_linear_term;
 }
+
+bool CSVM::train_path(SGVector<float64_t> C_values,
+		SGVector<float64_t> tube_epsilons, CFeatures* data)
+{
+	init_path(C_values, tube_epsilons, data);
+	float64_t ratio=C2/C1;
+
+	create_new_model(0);
+	for (index_t k=0; k<C_values.vlen; k++)
+	{
+		set_C(C_values[k], ratio*C_values[k]);
+		if (tube_epsilons.vlen)
+			set_tube_epsilon(tube_epsilons[k]);
+
+		clip_alphas_to_box();
+		if (!train())
+			return false;
+
+		store_path_solution(k);
+	}
+
+	return true;
+}
+
+void CSVM::set_path_solution(index_t step)
+{
+	REQUIRE(step>=0 && step<m_path_biases.vlen, "Path step (%d) has to be "
+		"in [0, %d]\n", step, m_path_biases.vlen-1)
+
+	int32_t num_sv=0;
+	for (index_t i=0; i<m_path_alphas.num_rows; i++)
+	{
+		if (m_path_alphas(i, step)!=0)
+			num_sv++;
+	}
+
+	create_new_model(num_sv);
+	for (index_t i=0, j=0; i<m_path_alphas.num_rows; i++)
+	{
+		if (m_path_alphas(i, step)!=0)
+		{
+			set_support_vector(j, i);
+			set_alpha(j, m_path_alphas(i, step));
+			j++;
+		}
+	}
+	set_bias(m_path_biases[step]);
+}
+
+int32_t CSVM::init_path(SGVector<float64_t> C_values,
+		SGVector<float64_t> tube_epsilons, CFeatures* data)
+{
+	REQUIRE(C_values.vlen>0, "%s::train_path(): No regularization constants "
+		"given\n", get_name())
+	REQUIRE(tube_epsilons.vlen==0 || tube_epsilons.vlen==C_values.vlen,
+		"%s::train_path(): Number of tube epsilons (%d) does not match number "
+		"of regularization constants (%d)\n", get_name(), tube_epsilons.vlen,
+		C_values.vlen)
+	for (index_t k=0; k<C_values.vlen; k++)
+	{
+		REQUIRE(C_values[k]>0, "%s::train_path(): Regularization constant "
+			"%d (%f) has to be positive\n", get_name(), k, C_values[k])
+	}
+	REQUIRE(kernel, "%s::train_path(): No kernel set\n", get_name())
+	REQUIRE(m_labels, "%s::train_path(): No labels set\n", get_name())
+
+	if (data)
+	{
+		REQUIRE(m_labels->get_num_labels()==data->get_num_vectors(),
+			"%s::train_path(): Number of training vectors (%d) does not match "
+			"number of labels (%d)\n", get_name(), data->get_num_vectors(),
+			m_labels->get_num_labels())
+		kernel->init(data, data);
+	}
+
+	int32_t num_vectors=m_labels->get_num_labels();
+	REQUIRE(kernel->has_features() && kernel->get_num_vec_lhs()==num_vectors,
+		"%s::train_path(): Kernel is not initialized with the %d training "
+		"vectors\n", get_name(), num_vectors)
+
+	m_path_alphas=SGMatrix<float64_t>(num_vectors, C_values.vlen);
+	m_path_alphas.zero();
+	m_path_biases=SGVector<float64_t>(C_values.vlen);
+	m_path_biases.zero();
+
+	return num_vectors;
+}
+
+void CSVM::store_path_solution(index_t step)
+{
+	for (int32_t i=0; i<get_num_support_vectors(); i++)
+		m_path_alphas(get_support_vector(i), step)=get_alpha(i);
+	m_path_biases[step]=get_bias();
+}
+
+void CSVM::clip_alphas_to_box()
+{
+	float64_t sum_pos=0;
+	float64_t sum_neg=0;
+	for (int32_t i=0; i<get_num_support_vectors(); i++)
+	{
+		float64_t alpha=get_alpha(i);
+		if (alpha>0)
+		{
+			alpha=CMath::min(alpha, C2);
+			sum_pos+=alpha;
+		}
+		else
+		{
+			alpha=CMath::max(alpha, -C1);
+			sum_neg-=alpha;
+		}
+		set_alpha(i, alpha);
+	}
+
+	if (!get_bias_enabled() || sum_pos==sum_neg)
+		return;
+
+	bool positive_larger=sum_pos>sum_neg;
+	float64_t scale=positive_larger ? sum_neg/sum_pos : sum_pos/sum_neg;
+	for (int32_t i=0; i<get_num_support_vectors(); i++)
+	{
+		float64_t alpha=get_alpha(i);
+		if ((alpha>0 && positive_larger) || (alpha<0 && !positive_larger))
+			set_alpha(i, alpha*scale);
+	}
+}
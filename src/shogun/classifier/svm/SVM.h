@@ -202,6 +202,52 @@ class CSVM : public CKernelMachine
 		 */
 		float64_t compute_svm_primal_objective();
 
+		/** train the SVM for a sequence of regularization constants on the
+		 * same data
+		 *
+		 * Step k uses C1=C_values[k] and C2=C_values[k]*C2/C1, i.e. the
+		 * ratio of C2 and C1 is kept, and the tube epsilon tube_epsilons[k]
+		 * if tube epsilons are given. Each step is warm started from the
+		 * solution of the previous one clipped to the new box, so the whole
+		 * path usually costs a small multiple of a single training. The
+		 * solutions of all steps are kept and can be loaded with
+		 * set_path_solution(), after training the machine holds the one of
+		 * the last step.
+		 *
+		 * This implementation retrains the SVM for every step with the
+		 * previous model as starting point, which only SVMs that start from
+		 * an existing model (like CSVMLight) benefit from. CLibSVM and
+		 * CLibSVR keep their solver state and kernel cache between steps.
+		 *
+		 * @param C_values regularization constants of the steps
+		 * @param tube_epsilons tube epsilons of the steps (empty to keep the
+		 * current one)
+		 * @param data training data
+		 * @return whether training of all steps was successful
+		 */
+		virtual bool train_path(SGVector<float64_t> C_values,
+				SGVector<float64_t> tube_epsilons=SGVector<float64_t>(),
+				CFeatures* data=NULL);
+
+		/** get the coefficients of the last trained path
+		 *
+		 * @return matrix with the coefficients of all training vectors
+		 * (rows) for every step (columns)
+		 */
+		SGMatrix<float64_t> get_path_alphas() const { return m_path_alphas; }
+
+		/** get the biases of the last trained path
+		 *
+		 * @return bias of every step
+		 */
+		SGVector<float64_t> get_path_biases() const { return m_path_biases; }
+
+		/** load the solution of a step of the last trained path as model
+		 *
+		 * @param step index of the step
+		 */
+		void set_path_solution(index_t step);
+
 		/** set objective
 		 *
 		 * @param v objective
@@ -242,6 +288,29 @@ class CSVM : public CKernelMachine
 		 */
 		virtual float64_t* get_linear_term_array();
 
+		/** check the parameters of a path, initialize the kernel with the
+		 * training data and allocate the solutions of all steps
+		 *
+		 * @param C_values regularization constants of the steps
+		 * @param tube_epsilons tube epsilons of the steps
+		 * @param data training data
+		 * @return number of training vectors
+		 */
+		int32_t init_path(SGVector<float64_t> C_values,
+				SGVector<float64_t> tube_epsilons, CFeatures* data);
+
+		/** store the current model as solution of a path step
+		 *
+		 * @param step index of the step
+		 */
+		void store_path_solution(index_t step);
+
+		/** clip the alphas of the current model to the box given by C1 and
+		 * C2 and, if a bias is used, scale down the alphas of the side
+		 * with the larger sum such that they sum to zero again
+		 */
+		void clip_alphas_to_box();
+
 		/** linear term in qp */
 		SGVector<float64_t> m_linear_term;
 
@@ -264,6 +333,11 @@ class CSVM : public CKernelMachine
 		/** if shrinking shall be used */
 		bool use_shrinking;
 
+		/** coefficients of all training vectors for each path step */
+		SGMatrix<float64_t> m_path_alphas;
+		/** bias of each path step */
+		SGVector<float64_t> m_path_biases;
+
 		/** callback function svm optimizers may call when they have a new
 		 * (small) set of alphas */
 		bool (*callback) (CMKL* mkl, const float64_t* sumw, const float64_t suma);
@@ -28,6 +28,7 @@
 #include <shogun/lib/Signal.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/lib/Time.h>
+#include <shogun/lib/Metrics.h>
 #include <shogun/mathematics/lapack.h>
 
 #include <shogun/classifier/svm/SVMLight.h>
@@ -148,6 +149,8 @@ void CSVMLight::init()
 	verbosity=1;
 	opt_precision=DEF_PRECISION;
 
+	keep_kernel_cache=false;
+
 	// svm variables
 	W=NULL;
 	model=SG_MALLOC(MODEL, 1);
@@ -251,19 +254,24 @@ bool CSVMLight::train_machine(CFeatures* data)
 
 	SG_DEBUG("use_kernel_cache = %i\n", use_kernel_cache)
 
-	if (kernel->get_kernel_type() == K_COMBINED)
+	// the cache of a previous path step is reused unless it was shrunk
+	if (!keep_kernel_cache || kernel->get_kernel_type() == K_COMBINED ||
+			kernel->get_activenum_cache() != m_labels->get_num_labels())
 	{
-
-		for (index_t k_idx=0; k_idx<((CCombinedKernel*) kernel)->get_num_kernels(); k_idx++)
+		if (kernel->get_kernel_type() == K_COMBINED)
 		{
-			CKernel* kn = ((CCombinedKernel*) kernel)->get_kernel(k_idx);
-			// allocate kernel cache but clean up beforehand
-			kn->resize_kernel_cache(kn->get_cache_size());
-			SG_UNREF(kn);
+
+			for (index_t k_idx=0; k_idx<((CCombinedKernel*) kernel)->get_num_kernels(); k_idx++)
+			{
+				CKernel* kn = ((CCombinedKernel*) kernel)->get_kernel(k_idx);
+				// allocate kernel cache but clean up beforehand
+				kn->resize_kernel_cache(kn->get_cache_size());
+				SG_UNREF(kn);
+			}
 		}
-	}
 
-	kernel->resize_kernel_cache(kernel->get_cache_size());
+		kernel->resize_kernel_cache(kernel->get_cache_size());
+	}
 
 	// train the svm
 	svm_learn();
@@ -284,12 +292,25 @@ bool CSVMLight::train_machine(CFeatures* data)
 		kernel->delete_optimization() ;
 	}
 
-	if (use_kernel_cache)
+	if (use_kernel_cache && !keep_kernel_cache)
 		kernel->kernel_cache_cleanup();
 
 	return true ;
 }
 
+bool CSVMLight::train_path(SGVector<float64_t> C_values,
+		SGVector<float64_t> tube_epsilons, CFeatures* data)
+{
+	keep_kernel_cache=true;
+	bool result=CSVM::train_path(C_values, tube_epsilons, data);
+	keep_kernel_cache=false;
+
+	if (kernel)
+		kernel->kernel_cache_cleanup();
+
+	return result;
+}
+
 int32_t CSVMLight::get_runtime()
 {
   clock_t start;
@@ -637,6 +658,7 @@ int32_t CSVMLight::optimize_to_convergence(int32_t* docs, int32_t* label, int32_
   /* repeat this loop until we have convergence */
   CTime start_time;
   mkl_converged=false;
+  SG_METRIC_STOPWATCH(phase_timer)
 
 
 #ifdef CYGWIN
@@ -649,6 +671,8 @@ int32_t CSVMLight::optimize_to_convergence(int32_t* docs, int32_t* label, int32_
 	  if(use_kernel_cache)
 		  kernel->set_time(iteration);  /* for lru cache */
 
+	  SG_METRIC_INC(this, "svmlight_iterations")
+	  SG_METRIC_RESTART(phase_timer)
 	  if(verbosity>=2) t0=get_runtime();
 	  if(verbosity>=3) {
 		  SG_DEBUG("\nSelecting working set... ")
@@ -752,6 +776,7 @@ int32_t CSVMLight::optimize_to_convergence(int32_t* docs, int32_t* label, int32_
 		  SG_INFO(" %ld vectors chosen\n",choosenum)
 	  }
 
+	  SG_METRIC_LAP(this, phase_timer, "svmlight_select_working_set")
 	  if(verbosity>=2) t1=get_runtime();
 
 	  if (use_kernel_cache)
@@ -774,6 +799,7 @@ int32_t CSVMLight::optimize_to_convergence(int32_t* docs, int32_t* label, int32_
 			  kernel->cache_multiple_kernel_rows(working2dnum, choosenum);
 	  }
 
+	  SG_METRIC_LAP(this, phase_timer, "svmlight_cache_kernel_rows")
 	  if(verbosity>=2) t2=get_runtime();
 
 	  if(retrain != 2) {
@@ -782,13 +808,16 @@ int32_t CSVMLight::optimize_to_convergence(int32_t* docs, int32_t* label, int32_
 					   aicache,&qp,&epsilon_crit_org);
 	  }
 
+	  SG_METRIC_LAP(this, phase_timer, "svmlight_optimize_qp")
 	  if(verbosity>=2) t3=get_runtime();
 	  update_linear_component(docs,label,active2dnum,a,a_old,working2dnum,totdoc,
 							  lin,aicache,c);
 
+	  SG_METRIC_LAP(this, phase_timer, "svmlight_update_linear_component")
 	  if(verbosity>=2) t4=get_runtime();
 	  supvecnum=calculate_svm_model(docs,label,lin,a,a_old,c,working2dnum,active2dnum);
 
+	  SG_METRIC_LAP(this, phase_timer, "svmlight_calculate_model")
 	  if(verbosity>=2) t5=get_runtime();
 
 	  for (jj=0;(i=working2dnum[jj])>=0;jj++) {
@@ -799,6 +828,7 @@ int32_t CSVMLight::optimize_to_convergence(int32_t* docs, int32_t* label, int32_
 							   maxdiff,epsilon_crit_org,&misclassified,
 							   inconsistent,active2dnum,last_suboptimal_at,
 							   iteration);
+	  SG_METRIC_LAP(this, phase_timer, "svmlight_check_optimality")
 
 	  if(verbosity>=2) {
 		  t6=get_runtime();
@@ -828,6 +858,7 @@ int32_t CSVMLight::optimize_to_convergence(int32_t* docs, int32_t* label, int32_
 	  if ((!callback) && (!retrain) && (inactivenum>0) &&
 			  ((!learn_parm->skip_final_opt_check) || (kernel->has_property(KP_LINADD) && get_linadd_enabled())))
 	  {
+		  SG_METRIC_TIMER(this, "svmlight_reactivate_inactive_examples")
 		  t1=get_runtime();
 		  SG_DEBUG("reactivating inactive examples\n")
 
@@ -246,6 +246,22 @@ class CSVMLight : public CSVM
    */
   virtual EMachineType get_classifier_type() { return CT_LIGHT; }
 
+  /** train the SVM for a sequence of regularization constants on the
+   * same data, see CSVM::train_path
+   *
+   * Every step starts from the alphas of the previous one and the kernel
+   * cache is kept between the steps.
+   *
+   * @param C_values regularization constants of the steps
+   * @param tube_epsilons tube epsilons of the steps (empty to keep the
+   * current one)
+   * @param data training data
+   * @return whether training of all steps was successful
+   */
+  virtual bool train_path(SGVector<float64_t> C_values,
+	SGVector<float64_t> tube_epsilons=SGVector<float64_t>(),
+	CFeatures* data=NULL);
+
   /** get runtime
    *
    * @return runtime
@@ -683,6 +699,8 @@ protected:
   float64_t mymaxdiff;
   /** if kernel cache is used */
   bool use_kernel_cache;
+  /** if kernel cache is kept between trainings of a path */
+  bool keep_kernel_cache;
   /** mkl converged */
   bool mkl_converged;
 };
@@ -14,6 +14,7 @@
 
 #include <shogun/labels/Labels.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/KeyIndexSort.h>
 #include <shogun/lib/DynamicArray.h>
 #include <shogun/lib/Time.h>
 #include <shogun/base/Parallel.h>
@@ -440,7 +441,7 @@ int CWDSVMOcas::add_new_cut(
 
 int CWDSVMOcas::sort( float64_t* vals, float64_t* data, uint32_t size)
 {
-	CMath::qsort_index(vals, data, size);
+	CKeyIndexSort::sort(vals, data, size);
 	return 0;
 }
 
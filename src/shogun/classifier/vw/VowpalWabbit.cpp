@@ -41,6 +41,7 @@ CVowpalWabbit::CVowpalWabbit(CVowpalWabbit *vw)
 	: COnlineLinearMachine()
 {
 	features = vw->features;
+	SG_REF(features);
 	env = vw->env;
 	reg = new CVwRegressor(env);
 	SG_REF(env);
@@ -52,11 +53,11 @@ CVowpalWabbit::CVowpalWabbit(CVowpalWabbit *vw)
 	sum_loss_since_last_dump = 0.;
 	reg_name = vw->reg_name;
 	reg_dump_text = vw->reg_dump_text;
+	num_learning_threads = vw->num_learning_threads;
 	save_predictions = vw->save_predictions;
 	prediction_fd = vw->prediction_fd;
 
 	w = reg->weight_vectors[0];
-	reg->weight_vectors[0] = NULL;
 	copy(vw->w, vw->w+vw->w_dim, w);
 	w_dim = vw->w_dim;
 	bias = vw->bias;
@@ -64,6 +65,12 @@ CVowpalWabbit::CVowpalWabbit(CVowpalWabbit *vw)
 
 CVowpalWabbit::~CVowpalWabbit()
 {
+	// the regressor and the learners work on w, which is freed by
+	// COnlineLinearMachine
+	if (reg->weight_vectors)
+		reg->weight_vectors[0] = NULL;
+
+	SG_UNREF(features);
 	SG_UNREF(env);
 	SG_UNREF(reg);
 	SG_UNREF(learner);
@@ -80,7 +87,6 @@ void CVowpalWabbit::reinitialize_weights()
 
 	reg->init(env);
 	w = reg->weight_vectors[0];
-	reg->weight_vectors[0] = NULL;
 }
 
 void CVowpalWabbit::set_adaptive(bool adaptive_learning)
@@ -111,7 +117,6 @@ void CVowpalWabbit::load_regressor(char* file_name)
 {
 	reg->load_regressor(file_name);
 	w = reg->weight_vectors[0];
-	reg->weight_vectors[0] = NULL;
 	w_dim = 1 << env->num_bits;
 }
 
@@ -161,9 +166,43 @@ bool CVowpalWabbit::train_machine(CFeatures* feat)
 
 	CSignal::clear_cancel();
 	features->start_parser();
+	// with several learner threads, windows of examples are taken from the
+	// parser while it keeps filling the other half of its ring
+	bool hogwild = num_learning_threads > 1 && !no_training;
+	int32_t window_size = CMath::max(features->get_ring_size()/2, 1);
+	VwExample** window = hogwild ? SG_MALLOC(VwExample*, window_size) : NULL;
+
 	while (!(CSignal::cancel_computations()) && (env->passes_complete < env->num_passes))
 	{
-		while (features->get_next_example())
+		while (hogwild)
+		{
+			int32_t num_examples = 0;
+			while (num_examples < window_size && features->get_next_example())
+				window[num_examples++] = features->get_example();
+
+			if (num_examples == 0)
+				break;
+
+			// all examples of a window belong to the same pass
+			if (window[0]->pass != current_pass)
+			{
+				env->eta *= env->eta_decay_rate;
+				current_pass = window[0]->pass;
+			}
+
+			train_window(window, num_examples);
+
+			for (int32_t i = 0; i < num_examples; i++)
+			{
+				output_example(window[i]);
+				features->release_example(window[i]);
+			}
+
+			if (num_examples < window_size)
+				break;
+		}
+
+		while (!hogwild && features->get_next_example())
 		{
 			example = features->get_example();
 
@@ -191,6 +230,7 @@ bool CVowpalWabbit::train_machine(CFeatures* feat)
 			features->reset_stream();
 	}
 	features->end_parser();
+	SG_FREE(window);
 
 	if (env->l1_regularization > 0.)
 	{
@@ -229,6 +269,7 @@ float32_t CVowpalWabbit::predict_and_finalize(VwExample* ex)
 			float32_t sum_abs_x = 0.;
 			float32_t exact_norm = compute_exact_norm(ex, sum_abs_x);
 			update = (env->eta * exact_norm)/sum_abs_x;
+#pragma omp atomic
 			env->update_sum += update;
 			ex->eta_round = reg->get_update(ex->final_prediction, ex->ld->label, update, exact_norm);
 		}
@@ -237,6 +278,7 @@ float32_t CVowpalWabbit::predict_and_finalize(VwExample* ex)
 			update = (env->eta)/pow(t, env->power_t) * ex->ld->weight;
 			ex->eta_round = reg->get_update(ex->final_prediction, ex->ld->label, update, ex->total_sum_feat_sq);
 		}
+#pragma omp atomic
 		env->update_sum += update;
 	}
 
@@ -246,9 +288,13 @@ float32_t CVowpalWabbit::predict_and_finalize(VwExample* ex)
 void CVowpalWabbit::init(CStreamingVwFeatures* feat)
 {
 	features = feat;
+	SG_REF(features);
 
 	if (feat)
+	{
 		env = feat->get_env();
+		SG_REF(env);
+	}
 	else
 	{
 		env=new CVwEnvironment();
@@ -264,11 +310,11 @@ void CVowpalWabbit::init(CStreamingVwFeatures* feat)
 	sum_loss_since_last_dump = 0.;
 	reg_name = NULL;
 	reg_dump_text = true;
+	num_learning_threads = 1;
 	save_predictions = false;
 	prediction_fd = -1;
 
 	w = reg->weight_vectors[0];
-	reg->weight_vectors[0] = NULL;
 	w_dim = 1 << env->num_bits;
 	bias = 0.;
 }
@@ -316,7 +362,7 @@ float32_t CVowpalWabbit::inline_predict(VwExample* &ex)
 
 	float32_t* weights = reg->weight_vectors[thread_num];
 	vw_size_t thread_mask = env->thread_mask;
-	prediction += features->dense_dot(weights, 0);
+	prediction += features->dense_dot(ex, weights);
 
 	for (int32_t k = 0; k < env->pairs.get_num_elements(); k++)
 	{
@@ -346,6 +392,20 @@ float32_t CVowpalWabbit::finalize_prediction(float32_t ret)
 	return ret;
 }
 
+void CVowpalWabbit::train_window(VwExample** window, int32_t num_examples)
+{
+#pragma omp parallel for num_threads(num_learning_threads) schedule(dynamic, 16)
+	for (int32_t i = 0; i < num_examples; i++)
+	{
+		VwExample* example = window[i];
+
+		predict_and_finalize(example);
+
+		learner->train(example, example->eta_round);
+		example->eta_round = 0.;
+	}
+}
+
 void CVowpalWabbit::output_example(VwExample* &example)
 {
 	if (!quiet)
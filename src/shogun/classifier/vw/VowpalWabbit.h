@@ -36,6 +36,12 @@ namespace shogun
  *
  * For more details, refer to the tutorial at
  * https://github.com/JohnLangford/vowpal_wabbit/wiki/v5.1_tutorial.pdf
+ *
+ * Training can optionally use several learner threads in the lock-free
+ * Hogwild fashion (Niu et al., 2011), see set_num_learning_threads(). The
+ * threads take examples from the parser in windows of half its ring size
+ * and update the shared weight vector without locking, so the result
+ * depends on scheduling and is not reproducible between runs.
  */
 class CVowpalWabbit: public COnlineLinearMachine
 {
@@ -108,6 +114,25 @@ public:
 		env->num_passes = passes;
 	}
 
+	/**
+	 * Set the number of threads that learn from the examples concurrently,
+	 * updating the weights without locking (Hogwild). One thread, the
+	 * default, trains sequentially and reproducibly.
+	 *
+	 * @param num_threads number of learner threads
+	 */
+	void set_num_learning_threads(int32_t num_threads)
+	{
+		REQUIRE(num_threads>0, "Number of learning threads (%d) must be "
+			"positive\n", num_threads);
+		num_learning_threads = num_threads;
+	}
+
+	/**
+	 * @return number of threads that learn from the examples concurrently
+	 */
+	int32_t get_num_learning_threads() { return num_learning_threads; }
+
 	/**
 	 * Load regressor from a dump file
 	 *
@@ -250,6 +275,15 @@ private:
 	 */
 	virtual void output_example(VwExample* &ex);
 
+	/**
+	 * Learn from a window of examples using num_learning_threads threads
+	 * that update the weights concurrently
+	 *
+	 * @param window examples, held by the parser until released
+	 * @param num_examples number of examples in the window
+	 */
+	virtual void train_window(VwExample** window, int32_t num_examples);
+
 	/**
 	 * Print statistics like VW
 	 *
@@ -306,6 +340,9 @@ private:
 	/// Whether to save regressor as readable text or not
 	bool reg_dump_text;
 
+	/// Number of threads that learn concurrently
+	int32_t num_learning_threads;
+
 	/// Whether to save predictions or not
 	bool save_predictions;
 	/// Descriptor of prediction file
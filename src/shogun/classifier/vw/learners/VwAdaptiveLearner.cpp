@@ -14,6 +14,7 @@
  */
 
 #include <shogun/classifier/vw/learners/VwAdaptiveLearner.h>
+#include <shogun/classifier/vw/vw_math.h>
 
 using namespace shogun;
 
@@ -48,9 +49,8 @@ void CVwAdaptiveLearner::train(VwExample* &ex, float32_t update)
 		for (VwFeature *f = ex->atomics[*i].begin; f != ex->atomics[*i].end; f++)
 		{
 			float32_t* w = &weights[f->weight_index & thread_mask];
-			w[1] += g * f->x * f->x;
-			float32_t t = f->x * CMath::invsqrt(w[1]);
-			w[0] += update * t;
+			float32_t t = f->x * CMath::invsqrt(hogwild_add(&w[1], g * f->x * f->x));
+			hogwild_add(&w[0], update * t);
 		}
 	}
 
@@ -77,8 +77,7 @@ void CVwAdaptiveLearner::quad_update(float32_t* weights, VwFeature& page_feature
 	for (VwFeature* elem = offer_features.begin; elem != offer_features.end; elem++)
 	{
 		float32_t* w = &weights[(halfhash + elem->weight_index) & mask];
-		w[1] += update2 * elem->x * elem->x;
-		float32_t t = elem->x * CMath::invsqrt(w[1]);
-		w[0] += update * t;
+		float32_t t = elem->x * CMath::invsqrt(hogwild_add(&w[1], update2 * elem->x * elem->x));
+		hogwild_add(&w[0], update * t);
 	}
 }
@@ -14,6 +14,7 @@
  */
 
 #include <shogun/classifier/vw/learners/VwNonAdaptiveLearner.h>
+#include <shogun/classifier/vw/vw_math.h>
 
 using namespace shogun;
 
@@ -43,7 +44,7 @@ void CVwNonAdaptiveLearner::train(VwExample* &ex, float32_t update)
 	for (vw_size_t* i = ex->indices.begin; i != ex->indices.end; i++)
 	{
 		for (VwFeature* f = ex->atomics[*i].begin; f != ex->atomics[*i].end; f++)
-			weights[f->weight_index & thread_mask] += update * f->x;
+			hogwild_add(&weights[f->weight_index & thread_mask], update * f->x);
 	}
 
 	for (int32_t k = 0; k < env->pairs.get_num_elements(); k++)
@@ -63,5 +64,5 @@ void CVwNonAdaptiveLearner::quad_update(float32_t* weights, VwFeature& page_feat
 	vw_size_t halfhash = quadratic_constant * page_feature.weight_index;
 	update *= page_feature.x;
 	for (VwFeature* elem = offer_features.begin; elem != offer_features.end; elem++)
-		weights[(halfhash + elem->weight_index) & mask] += update * elem->x;
+		hogwild_add(&weights[(halfhash + elem->weight_index) & mask], update * elem->x);
 }
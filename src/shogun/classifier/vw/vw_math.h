@@ -40,6 +40,30 @@ inline float32_t real_weight(float32_t w,float32_t gravity)
 	return wprime;
 }
 
+/**
+ * Add a value to a weight which may be updated by other
+ * learner threads at the same time (Hogwild). The weight is
+ * loaded and stored atomically, but the addition is not, so
+ * concurrent updates to the same weight may get lost.
+ *
+ * @param weight weight to update
+ * @param value value to add
+ *
+ * @return updated weight
+ */
+inline float32_t hogwild_add(float32_t* weight, float32_t value)
+{
+#ifdef __GNUC__
+	float32_t result;
+	__atomic_load(weight, &result, __ATOMIC_RELAXED);
+	result += value;
+	__atomic_store(weight, &result, __ATOMIC_RELAXED);
+	return result;
+#else
+	return *weight += value;
+#endif
+}
+
 /**
  * Dot product of feature vector with the weight vector
  * with an offset added to the feature indices.
@@ -16,6 +16,7 @@
 #include <shogun/distance/EuclideanDistance.h>
 #include <shogun/base/Parameter.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/KeyIndexSort.h>
 #include <shogun/mathematics/lapack.h>
 #include <shogun/labels/MulticlassLabels.h>
 #include <shogun/multiclass/KNN.h>
@@ -275,8 +276,8 @@ float64_t CGMM::train_smem(int32_t max_iter, int32_t max_cand, float64_t min_cov
 				counter++;
 			}
 		}
-		CMath::qsort_backward_index(split_crit, split_ind, int32_t(m_components.size()));
-		CMath::qsort_backward_index(merge_crit, merge_ind, int32_t(m_components.size()*(m_components.size()-1)/2));
+		CKeyIndexSort::sort_backward(split_crit, split_ind, int32_t(m_components.size()));
+		CKeyIndexSort::sort_backward(merge_crit, merge_ind, int32_t(m_components.size()*(m_components.size()-1)/2));
 
 		bool better_found=false;
 		int32_t candidates_checked=0;
@@ -13,6 +13,7 @@
 #include <shogun/labels/Labels.h>
 #include <shogun/features/Features.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/KeyIndexSort.h>
 #include <shogun/base/Parallel.h>
 
 #ifdef HAVE_PTHREAD
@@ -89,9 +90,9 @@ bool CHierarchical::train_machine(CFeatures* data)
 	int32_t offs=0;
 	for (int32_t i=0; i<num; i++)
 	{
+		distance->distance_block(i, 1, i+1, num-i-1, &distances[offs], 1);
 		for (int32_t j=i+1; j<num; j++)
 		{
-			distances[offs]=distance->distance(i,j);
 			index[offs].idx1=i;
 			index[offs].idx2=j;
 			offs++;					//offs=i*(i+1)/2+j
@@ -99,7 +100,7 @@ bool CHierarchical::train_machine(CFeatures* data)
 		SG_PROGRESS(i, 0, num-1)
 	}
 
-	CMath::qsort_index<float64_t,pair>(distances, index, (num-1)*num/2);
+	CKeyIndexSort::sort<float64_t,pair>(distances, index, (num-1)*num/2);
 	//CMath::display_vector(distances, (num-1)*num/2, "dists");
 
 	int32_t k=-1;
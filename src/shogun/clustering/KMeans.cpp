@@ -75,9 +75,14 @@ void CKMeans::Lloyd_KMeans(SGMatrix<float64_t> centers, int32_t num_centers)
 
 		distance->precompute_rhs();
 
-#pragma omp parallel for firstprivate(lhs_size, dim, num_centers) \
+#pragma omp parallel firstprivate(lhs_size, dim, num_centers) \
 		shared(centers, cluster_assignments, weights_set) \
 		reduction(+:changed) if (!fixed_centers)
+		{
+		/* distances of a point to all centers */
+		SGVector<float64_t> dists(num_centers);
+
+#pragma omp for
 		/* Assigment step : Assign each point to nearest cluster */
 		for (int32_t i=0; i<lhs_size; i++)
 		{ 
@@ -85,11 +90,12 @@ void CKMeans::Lloyd_KMeans(SGMatrix<float64_t> centers, int32_t num_centers)
 			int32_t min_cluster, j;
 			float64_t min_dist, dist;
 			
+			distance->distance_block(i, 1, 0, num_centers, dists.vector, 1);
 			min_cluster=0;
-		   	min_dist=distance->distance(i,0);
+		   	min_dist=dists[0];
 			for (j=1; j<num_centers; j++)
 			{
-				dist=distance->distance(i,j);
+				dist=dists[j];
 				if (dist<min_dist)
 				{
 					min_dist=dist;
@@ -145,6 +151,7 @@ void CKMeans::Lloyd_KMeans(SGMatrix<float64_t> centers, int32_t num_centers)
 				cluster_assignments[i] = min_cluster;
 			}
 		}
+		}
 		if(changed==0)
 			break;
 
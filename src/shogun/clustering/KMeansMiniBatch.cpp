@@ -108,7 +108,7 @@ void CKMeansMiniBatch::minibatch_KMeans()
 		for (int32_t j=0; j<batch_size; j++)
 		{
 			int32_t near=ncent[j];
-			SGVector<float64_t> c_alive=rhs_mus->get_feature_vector(near);
+			SGSpan<float64_t> c_alive=rhs_mus->get_feature_vector_view(near);
 			SGVector<float64_t> x=lhs->get_feature_vector(M[j]);
 			v[near]+=1.0;
 			float64_t eta=1.0/v[near];
@@ -87,12 +87,32 @@ CFeatures* CHashedDocConverter::apply(CFeatures* features)
 	CStringFeatures<char>* s_features = (CStringFeatures<char>*) features;
 
 	int32_t dim = CMath::pow(2, num_bits);
-	SGSparseMatrix<float64_t> matrix(dim,features->get_num_vectors());
-	for (index_t vec_idx=0; vec_idx<s_features->get_num_vectors(); vec_idx++)
+	int32_t num_vectors = s_features->get_num_vectors();
+	SGSparseMatrix<float64_t> matrix(dim, num_vectors);
+
+	/** the documents are hashed in parallel, every thread uses its own
+	 * converter since the tokenizer keeps the state of the current text */
+	#pragma omp parallel
 	{
-		SGVector<char> doc = s_features->get_feature_vector(vec_idx);
-		matrix[vec_idx] = apply(doc);
-		s_features->free_feature_vector(doc, vec_idx);
+		CHashedDocConverter* converter = new CHashedDocConverter(tokenizer->get_copy(),
+				num_bits, should_normalize, ngrams, tokens_to_skip);
+
+		#pragma omp for schedule(dynamic, 16)
+		for (index_t vec_idx=0; vec_idx<num_vectors; vec_idx++)
+		{
+			/** string features that compute or preprocess their vectors on
+			 * access are not thread-safe, only the hashing is parallel */
+			SGVector<char> doc;
+			#pragma omp critical (hashed_doc_fetch)
+			doc = s_features->get_feature_vector(vec_idx);
+
+			matrix[vec_idx] = converter->apply(doc);
+
+			#pragma omp critical (hashed_doc_fetch)
+			s_features->free_feature_vector(doc, vec_idx);
+		}
+
+		SG_UNREF(converter);
 	}
 
 	return (CFeatures*) new CSparseFeatures<float64_t>(matrix);
@@ -101,9 +121,9 @@ CFeatures* CHashedDocConverter::apply(CFeatures* features)
 SGSparseVector<float64_t> CHashedDocConverter::apply(SGVector<char> document)
 {
 	ASSERT(document.size()>0)
-	const int32_t array_size = 1024*1024;
-	/** the array will contain all the hashes generated from the tokens */
-	CDynamicArray<uint32_t> hashed_indices(array_size);
+	/** the array will contain all the hashes generated from the tokens,
+	 * there are usually not many more of them than characters */
+	CDynamicArray<uint32_t> hashed_indices(document.size());
 
 	/** this vector will maintain the current n+k active tokens
 	 * in a circular manner */
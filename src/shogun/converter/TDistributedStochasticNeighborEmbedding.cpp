@@ -20,6 +20,7 @@ CTDistributedStochasticNeighborEmbedding::CTDistributedStochasticNeighborEmbeddi
 	// Default values
 	m_perplexity = 30.0;
 	m_theta = 0.5;
+	m_interpolation = false;
 	init();
 }
 
@@ -27,6 +28,8 @@ void CTDistributedStochasticNeighborEmbedding::init()
 {
 	SG_ADD(&m_perplexity, "perplexity", "perplexity", MS_NOT_AVAILABLE);
 	SG_ADD(&m_theta, "theta", "learning rate", MS_NOT_AVAILABLE);
+	SG_ADD(&m_interpolation, "interpolation",
+		"FFT-accelerated interpolation of repulsive forces", MS_NOT_AVAILABLE);
 }
 
 CTDistributedStochasticNeighborEmbedding::~CTDistributedStochasticNeighborEmbedding()
@@ -59,11 +62,22 @@ float64_t CTDistributedStochasticNeighborEmbedding::get_perplexity() const
 	return m_perplexity;
 }
 
+void CTDistributedStochasticNeighborEmbedding::set_interpolation(const bool interpolation)
+{
+	m_interpolation = interpolation;
+}
+
+bool CTDistributedStochasticNeighborEmbedding::get_interpolation() const
+{
+	return m_interpolation;
+}
+
 CFeatures* CTDistributedStochasticNeighborEmbedding::apply(CFeatures* features)
 {
 	TAPKEE_PARAMETERS_FOR_SHOGUN parameters;
 	parameters.sne_theta = m_theta;
 	parameters.sne_perplexity = m_perplexity;
+	parameters.sne_interpolation = m_interpolation;
 	parameters.features = (CDotFeatures*)features;
 
 	parameters.method = SHOGUN_TDISTRIBUTED_STOCHASTIC_NEIGHBOR_EMBEDDING;
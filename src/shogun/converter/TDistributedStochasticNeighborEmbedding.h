@@ -23,6 +23,13 @@ namespace shogun
  *
  * Uses implementation from the Tapkee library.
  *
+ * With theta=0 the exact gradient is computed. Otherwise, the repulsive
+ * forces are approximated by Barnes-Hut or, if enabled with
+ * set_interpolation, by FFT-accelerated interpolation on a grid
+ * (FIt-SNE), which scales to millions of vectors. Both approximations
+ * embed into two dimensions. The gradient phases and the nearest neighbor
+ * search of the input similarities run in parallel.
+ *
  */
 class CTDistributedStochasticNeighborEmbedding : public CEmbeddingConverter
 {
@@ -67,6 +74,19 @@ public:
 	 */
 	float64_t get_perplexity() const;
 
+	/** setter for the approximation of the repulsive forces
+	 *
+	 * @param interpolation whether to use FFT-accelerated interpolation
+	 * instead of Barnes-Hut if theta is positive
+	 */
+	void set_interpolation(const bool interpolation);
+
+	/** getter for the approximation of the repulsive forces
+	 *
+	 * @return whether FFT-accelerated interpolation is used
+	 */
+	bool get_interpolation() const;
+
 private:
 
 	/** default init */
@@ -80,6 +100,9 @@ private:
 	/** perplexity */
 	float64_t m_perplexity;
 
+	/** interpolation of the repulsive forces */
+	bool m_interpolation;
+
 }; /* class CTDistributedStochasticNeighborEmbedding */
 
 } /* namespace shogun */
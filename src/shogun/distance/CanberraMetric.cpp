@@ -12,6 +12,7 @@
 #include <shogun/lib/common.h>
 #include <shogun/io/SGIO.h>
 #include <shogun/distance/CanberraMetric.h>
+#include <shogun/distance/DenseDistanceEngine.h>
 #include <shogun/features/Features.h>
 
 using namespace shogun;
@@ -73,3 +74,11 @@ float64_t CCanberraMetric::compute(int32_t idx_a, int32_t idx_b)
 
 	return result;
 }
+
+void CCanberraMetric::compute_block(int32_t start_a, int32_t num_a,
+		int32_t start_b, int32_t num_b, float64_t* result, int32_t ld)
+{
+	DenseDistanceEngine::compute_block(D_CANBERRA, 0,
+		(CDenseFeatures<float64_t>*) lhs, start_a, num_a,
+		(CDenseFeatures<float64_t>*) rhs, start_b, num_b, result, ld);
+}
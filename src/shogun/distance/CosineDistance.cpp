@@ -12,6 +12,7 @@
 #include <shogun/lib/common.h>
 #include <shogun/io/SGIO.h>
 #include <shogun/distance/CosineDistance.h>
+#include <shogun/distance/DenseDistanceEngine.h>
 #include <shogun/features/Features.h>
 
 using namespace shogun;
@@ -80,3 +81,11 @@ float64_t CCosineDistance::compute(int32_t idx_a, int32_t idx_b)
 	else
 		return s ;
 }
+
+void CCosineDistance::compute_block(int32_t start_a, int32_t num_a,
+		int32_t start_b, int32_t num_b, float64_t* result, int32_t ld)
+{
+	DenseDistanceEngine::compute_block(D_COSINE, 0,
+		(CDenseFeatures<float64_t>*) lhs, start_a, num_a,
+		(CDenseFeatures<float64_t>*) rhs, start_b, num_b, result, ld);
+}
@@ -76,6 +76,11 @@ class CCosineDistance: public CDenseDistance<float64_t>
 		/// idx_{a,b} denote the index of the feature vectors
 		/// in the corresponding feature object
 		virtual float64_t compute(int32_t idx_a, int32_t idx_b);
+
+		/// compute distances of a block of feature vectors with the
+		/// DenseDistanceEngine, see CDistance::distance_block()
+		virtual void compute_block(int32_t start_a, int32_t num_a,
+				int32_t start_b, int32_t num_b, float64_t* result, int32_t ld);
 };
 
 } // namespace shogun
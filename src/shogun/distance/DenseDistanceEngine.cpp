@@ -0,0 +1,671 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <shogun/lib/config.h>
+#include <shogun/lib/common.h>
+#include <shogun/io/SGIO.h>
+#include <shogun/distance/DenseDistanceEngine.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/mathematics/linalg/internal/implementation/CPUDispatch.h>
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+/* the tiles are instantiated once per instruction set with the matching
+ * target attribute, in the same way as the kernels of the linalg CPU
+ * backend in CPUDispatch.cpp */
+#if defined(HAVE_SSE2) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SG_DISTANCE_DISPATCH_X86
+#define SG_DISTANCE_INLINE inline __attribute__((always_inline))
+#define SG_DISTANCE_TARGET(ISA) __attribute__((target(ISA)))
+#else
+#define SG_DISTANCE_INLINE inline
+#endif
+
+/** number of rhs vectors of a register tile */
+#define DISTANCE_TILE_SIZE 4
+
+/** number of vectors whose pointers are fetched together */
+#define DISTANCE_CHUNK_SIZE 64
+
+using namespace shogun;
+
+namespace
+{
+
+/** sets all lanes of v to x */
+template <class V>
+SG_DISTANCE_INLINE void set_all(V& v, float64_t x)
+{
+	const V zero={};
+	v=zero+x;
+}
+
+/** computes the absolute values of the lanes of x */
+template <class V>
+SG_DISTANCE_INLINE void set_abs(V& v, const V& x)
+{
+	const V zero={};
+	v=x<zero ? -x : x;
+}
+
+/** applies the scalar update of metric M to every lane of the vectors, for
+ * metrics which need functions like log or pow */
+template <class M, class V>
+SG_DISTANCE_INLINE void update_lanes(const M& metric, V* acc, const V& a,
+		const V& b)
+{
+	for (int32_t l=0; l<int32_t(sizeof(V)/sizeof(float64_t)); l++)
+	{
+		float64_t s[M::num_acc];
+		for (int32_t k=0; k<M::num_acc; k++)
+			s[k]=acc[k][l];
+
+		metric.update(s, a[l], b[l]);
+
+		for (int32_t k=0; k<M::num_acc; k++)
+			acc[k][l]=s[k];
+	}
+}
+
+/*
+ * The metric functors. init() and update() are used with scalars and with
+ * vectors, where update() processes one element per lane. The lanes of
+ * every accumulator are merged with combine() before finalize() turns the
+ * accumulators into the distance. The scalar operations follow the
+ * compute() methods of the distances.
+ */
+
+struct ManhattanMetric
+{
+	enum { num_acc=1 };
+
+	template <class V>
+	SG_DISTANCE_INLINE void init(V* acc) const
+	{
+		set_all(acc[0], 0);
+	}
+
+	template <class V>
+	SG_DISTANCE_INLINE void update(V* acc, const V& a, const V& b) const
+	{
+		V d;
+		set_abs(d, a-b);
+		acc[0]+=d;
+	}
+
+	static SG_DISTANCE_INLINE float64_t combine(float64_t x, float64_t y)
+	{
+		return x+y;
+	}
+
+	SG_DISTANCE_INLINE float64_t finalize(const float64_t* acc) const
+	{
+		return acc[0];
+	}
+};
+
+struct ChebyshewMetric
+{
+	enum { num_acc=1 };
+
+	template <class V>
+	SG_DISTANCE_INLINE void init(V* acc) const
+	{
+		set_all(acc[0], DBL_MIN);
+	}
+
+	template <class V>
+	SG_DISTANCE_INLINE void update(V* acc, const V& a, const V& b) const
+	{
+		V d;
+		set_abs(d, a-b);
+		acc[0]=d>acc[0] ? d : acc[0];
+	}
+
+	static SG_DISTANCE_INLINE float64_t combine(float64_t x, float64_t y)
+	{
+		return y>x ? y : x;
+	}
+
+	SG_DISTANCE_INLINE float64_t finalize(const float64_t* acc) const
+	{
+		return acc[0];
+	}
+};
+
+struct CanberraMetric
+{
+	enum { num_acc=1 };
+
+	template <class V>
+	SG_DISTANCE_INLINE void init(V* acc) const
+	{
+		set_all(acc[0], 0);
+	}
+
+	template <class V>
+	SG_DISTANCE_INLINE void update(V* acc, const V& a, const V& b) const
+	{
+		const V zero={};
+		V abs_a, abs_b, t;
+		set_abs(abs_a, a);
+		set_abs(abs_b, b);
+		set_abs(t, a-abs_b);
+		V s=abs_a+abs_b;
+		t/=s;
+		acc[0]+=s!=zero ? t : zero;
+	}
+
+	static SG_DISTANCE_INLINE float64_t combine(float64_t x, float64_t y)
+	{
+		return x+y;
+	}
+
+	SG_DISTANCE_INLINE float64_t finalize(const float64_t* acc) const
+	{
+		return acc[0];
+	}
+};
+
+struct ChiSquareDistance
+{
+	enum { num_acc=1 };
+
+	template <class V>
+	SG_DISTANCE_INLINE void init(V* acc) const
+	{
+		set_all(acc[0], 0);
+	}
+
+	template <class V>
+	SG_DISTANCE_INLINE void update(V* acc, const V& a, const V& b) const
+	{
+		const V zero={};
+		V abs_a, abs_b;
+		set_abs(abs_a, a);
+		set_abs(abs_b, b);
+		V s=abs_a+abs_b;
+		V d=a-b;
+		V t=d*d/s;
+		acc[0]+=s!=zero ? t : zero;
+	}
+
+	static SG_DISTANCE_INLINE float64_t combine(float64_t x, float64_t y)
+	{
+		return x+y;
+	}
+
+	SG_DISTANCE_INLINE float64_t finalize(const float64_t* acc) const
+	{
+		return acc[0];
+	}
+};
+
+struct BrayCurtisDistance
+{
+	enum { num_acc=2 };
+
+	template <class V>
+	SG_DISTANCE_INLINE void init(V* acc) const
+	{
+		set_all(acc[0], 0);
+		set_all(acc[1], 0);
+	}
+
+	template <class V>
+	SG_DISTANCE_INLINE void update(V* acc, const V& a, const V& b) const
+	{
+		V d;
+		set_abs(d, a-b);
+		acc[0]+=d;
+		set_abs(d, a+b);
+		acc[1]+=d;
+	}
+
+	static SG_DISTANCE_INLINE float64_t combine(float64_t x, float64_t y)
+	{
+		return x+y;
+	}
+
+	SG_DISTANCE_INLINE float64_t finalize(const float64_t* acc) const
+	{
+		if (acc[1]==0)
+			return 0;
+
+		return acc[0]/acc[1];
+	}
+};
+
+struct JensenMetric
+{
+	enum { num_acc=1 };
+
+	template <class V>
+	SG_DISTANCE_INLINE void init(V* acc) const
+	{
+		set_all(acc[0], 0);
+	}
+
+	SG_DISTANCE_INLINE void update(float64_t* acc, float64_t a, float64_t b) const
+	{
+		float64_t s=0.5*(a+b);
+		if (s>0)
+		{
+			if (a>0)
+				acc[0]+=a*log(a/s);
+			if (b>0)
+				acc[0]+=b*log(b/s);
+		}
+	}
+
+	template <class V>
+	SG_DISTANCE_INLINE void update(V* acc, const V& a, const V& b) const
+	{
+		update_lanes(*this, acc, a, b);
+	}
+
+	static SG_DISTANCE_INLINE float64_t combine(float64_t x, float64_t y)
+	{
+		return x+y;
+	}
+
+	SG_DISTANCE_INLINE float64_t finalize(const float64_t* acc) const
+	{
+		return acc[0];
+	}
+};
+
+struct MinkowskiMetric
+{
+	enum { num_acc=1 };
+
+	MinkowskiMetric(float64_t k) : m_k(k) { }
+
+	template <class V>
+	SG_DISTANCE_INLINE void init(V* acc) const
+	{
+		set_all(acc[0], 0);
+	}
+
+	SG_DISTANCE_INLINE void update(float64_t* acc, float64_t a, float64_t b) const
+	{
+		acc[0]+=pow(fabs(a-b), m_k);
+	}
+
+	template <class V>
+	SG_DISTANCE_INLINE void update(V* acc, const V& a, const V& b) const
+	{
+		update_lanes(*this, acc, a, b);
+	}
+
+	static SG_DISTANCE_INLINE float64_t combine(float64_t x, float64_t y)
+	{
+		return x+y;
+	}
+
+	SG_DISTANCE_INLINE float64_t finalize(const float64_t* acc) const
+	{
+		return pow(acc[0], 1/m_k);
+	}
+
+	/** exponent */
+	float64_t m_k;
+};
+
+struct TanimotoDistance
+{
+	enum { num_acc=3 };
+
+	template <class V>
+	SG_DISTANCE_INLINE void init(V* acc) const
+	{
+		set_all(acc[0], 0);
+		set_all(acc[1], 0);
+		set_all(acc[2], 0);
+	}
+
+	template <class V>
+	SG_DISTANCE_INLINE void update(V* acc, const V& a, const V& b) const
+	{
+		acc[0]+=a*b;
+		acc[1]+=a*a;
+		acc[2]+=b*b;
+	}
+
+	static SG_DISTANCE_INLINE float64_t combine(float64_t x, float64_t y)
+	{
+		return x+y;
+	}
+
+	SG_DISTANCE_INLINE float64_t finalize(const float64_t* acc) const
+	{
+		float64_t s=acc[1]+acc[2]-acc[0];
+		if (s==0)
+			return 0;
+
+		return acc[0]/s;
+	}
+};
+
+struct CosineDistance
+{
+	enum { num_acc=3 };
+
+	template <class V>
+	SG_DISTANCE_INLINE void init(V* acc) const
+	{
+		set_all(acc[0], 0);
+		set_all(acc[1], 0);
+		set_all(acc[2], 0);
+	}
+
+	template <class V>
+	SG_DISTANCE_INLINE void update(V* acc, const V& a, const V& b) const
+	{
+		acc[0]+=a*b;
+		acc[1]+=a*a;
+		acc[2]+=b*b;
+	}
+
+	static SG_DISTANCE_INLINE float64_t combine(float64_t x, float64_t y)
+	{
+		return x+y;
+	}
+
+	SG_DISTANCE_INLINE float64_t finalize(const float64_t* acc) const
+	{
+		float64_t s=sqrt(acc[1])*sqrt(acc[2]);
+		if (s==0)
+			return 0;
+
+		s=1-acc[0]/s;
+		if (s<0)
+			return 0;
+
+		return s;
+	}
+};
+
+/** One pair at a time in the order of the compute() methods */
+namespace scalar
+{
+
+template <class M>
+void block(const M& metric, const float64_t* const* a, int32_t num_a,
+		const float64_t* const* b, int32_t num_b, int32_t dim,
+		float64_t* result, int64_t ld)
+{
+	for (int32_t j=0; j<num_b; j++)
+	{
+		for (int32_t i=0; i<num_a; i++)
+		{
+			float64_t s[M::num_acc];
+			metric.init(s);
+			for (int32_t d=0; d<dim; d++)
+				metric.update(s, a[i][d], b[j][d]);
+
+			result[i+j*ld]=metric.finalize(s);
+		}
+	}
+}
+
+}
+
+#ifdef SG_DISTANCE_DISPATCH_X86
+/** Width independent tiles, W is the number of lanes of a register */
+namespace simd
+{
+
+template <int W>
+struct reg
+{
+	typedef float64_t type __attribute__((vector_size(W*sizeof(float64_t))));
+};
+
+template <class V>
+SG_DISTANCE_INLINE void load(V& v, const float64_t* p)
+{
+	memcpy(&v, p, sizeof(V));
+}
+
+/** distances of x and the T vectors y, stored with stride ld */
+template <class M, int W, int T>
+SG_DISTANCE_INLINE void tile(const M& metric, const float64_t* x,
+		const float64_t* const* y, int32_t dim, float64_t* result, int64_t ld)
+{
+	typedef typename reg<W>::type vec;
+	vec acc[T][M::num_acc];
+	for (int32_t t=0; t<T; t++)
+		metric.init(acc[t]);
+
+	int32_t d=0;
+	for (; d+W<=dim; d+=W)
+	{
+		vec va, vb;
+		load(va, x+d);
+		for (int32_t t=0; t<T; t++)
+		{
+			load(vb, y[t]+d);
+			metric.update(acc[t], va, vb);
+		}
+	}
+
+	for (int32_t t=0; t<T; t++)
+	{
+		float64_t s[M::num_acc];
+		for (int32_t k=0; k<M::num_acc; k++)
+		{
+			s[k]=acc[t][k][0];
+			for (int32_t l=1; l<W; l++)
+				s[k]=M::combine(s[k], acc[t][k][l]);
+		}
+
+		for (int32_t i=d; i<dim; i++)
+			metric.update(s, x[i], y[t][i]);
+
+		result[t*ld]=metric.finalize(s);
+	}
+}
+
+template <class M, int W>
+SG_DISTANCE_INLINE void block(const M& metric, const float64_t* const* a,
+		int32_t num_a, const float64_t* const* b, int32_t num_b, int32_t dim,
+		float64_t* result, int64_t ld)
+{
+	for (int32_t i=0; i<num_a; i++)
+	{
+		int32_t j=0;
+		for (; j+DISTANCE_TILE_SIZE<=num_b; j+=DISTANCE_TILE_SIZE)
+		{
+			tile<M,W,DISTANCE_TILE_SIZE>(metric, a[i], b+j, dim,
+					result+i+j*ld, ld);
+		}
+		for (; j<num_b; j++)
+			tile<M,W,1>(metric, a[i], b+j, dim, result+i+j*ld, ld);
+	}
+}
+
+}
+
+/** Defines the block entry point of one instruction set */
+#define SG_DEFINE_DISTANCE_KERNELS(NAME, ISA, BYTES) \
+namespace NAME \
+{ \
+template <class M> SG_DISTANCE_TARGET(ISA) \
+void block(const M& metric, const float64_t* const* a, int32_t num_a, \
+	const float64_t* const* b, int32_t num_b, int32_t dim, \
+	float64_t* result, int64_t ld) \
+{ \
+	simd::block<M,BYTES/sizeof(float64_t)>(metric, a, num_a, b, num_b, dim, \
+		result, ld); \
+} \
+}
+
+SG_DEFINE_DISTANCE_KERNELS(sse2, "sse2", 16)
+SG_DEFINE_DISTANCE_KERNELS(avx2, "avx2,fma", 32)
+SG_DEFINE_DISTANCE_KERNELS(avx512, "avx512f", 64)
+
+#undef SG_DEFINE_DISTANCE_KERNELS
+#endif // SG_DISTANCE_DISPATCH_X86
+
+template <class M>
+void run_block(const M& metric, const float64_t* const* a, int32_t num_a,
+		const float64_t* const* b, int32_t num_b, int32_t dim,
+		float64_t* result, int64_t ld)
+{
+	switch (linalg::get_cpu_instruction_set())
+	{
+#ifdef SG_DISTANCE_DISPATCH_X86
+	case linalg::CPUInstructionSet::AVX512:
+		avx512::block(metric, a, num_a, b, num_b, dim, result, ld);
+		break;
+	case linalg::CPUInstructionSet::AVX2:
+		avx2::block(metric, a, num_a, b, num_b, dim, result, ld);
+		break;
+	case linalg::CPUInstructionSet::SSE2:
+		sse2::block(metric, a, num_a, b, num_b, dim, result, ld);
+		break;
+#endif // SG_DISTANCE_DISPATCH_X86
+	default:
+		scalar::block(metric, a, num_a, b, num_b, dim, result, ld);
+		break;
+	}
+}
+
+/** feature vectors of a chunk, fetched once for all distances of the
+ * chunk and freed when the chunk goes out of scope */
+class VectorChunk
+{
+public:
+	VectorChunk(CDenseFeatures<float64_t>* feats, int32_t start, int32_t num)
+		: m_feats(feats), m_start(start), m_num(num), m_dim(0)
+	{
+		ASSERT(num<=DISTANCE_CHUNK_SIZE)
+		for (int32_t i=0; i<num; i++)
+		{
+			int32_t len;
+			m_vectors[i]=feats->get_feature_vector(start+i, len, m_free[i]);
+			ASSERT(i==0 || len==m_dim)
+			m_dim=len;
+		}
+	}
+
+	~VectorChunk()
+	{
+		for (int32_t i=0; i<m_num; i++)
+			m_feats->free_feature_vector(m_vectors[i], m_start+i, m_free[i]);
+	}
+
+	const float64_t* const* vectors() const { return m_vectors; }
+
+	int32_t dim() const { return m_dim; }
+
+private:
+	CDenseFeatures<float64_t>* m_feats;
+	int32_t m_start;
+	int32_t m_num;
+	int32_t m_dim;
+	float64_t* m_vectors[DISTANCE_CHUNK_SIZE];
+	bool m_free[DISTANCE_CHUNK_SIZE];
+};
+
+template <class M>
+void compute_features_block(const M& metric, CDenseFeatures<float64_t>* lhs,
+		int32_t start_a, int32_t num_a, CDenseFeatures<float64_t>* rhs,
+		int32_t start_b, int32_t num_b, float64_t* result, int64_t ld)
+{
+	for (int32_t i=0; i<num_a; i+=DISTANCE_CHUNK_SIZE)
+	{
+		int32_t len_a=CMath::min(DISTANCE_CHUNK_SIZE, num_a-i);
+		VectorChunk a(lhs, start_a+i, len_a);
+
+		for (int32_t j=0; j<num_b; j+=DISTANCE_CHUNK_SIZE)
+		{
+			int32_t len_b=CMath::min(DISTANCE_CHUNK_SIZE, num_b-j);
+			VectorChunk b(rhs, start_b+j, len_b);
+			ASSERT(a.dim()==b.dim())
+
+			run_block(metric, a.vectors(), len_a, b.vectors(), len_b, a.dim(),
+					result+i+j*ld, ld);
+		}
+	}
+}
+
+}
+
+bool DenseDistanceEngine::supports(EDistanceType type)
+{
+	switch (type)
+	{
+	case D_MANHATTAN:
+	case D_CHEBYSHEW:
+	case D_CANBERRA:
+	case D_CHISQUARE:
+	case D_BRAYCURTIS:
+	case D_JENSEN:
+	case D_MINKOWSKI:
+	case D_TANIMOTO:
+	case D_COSINE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void DenseDistanceEngine::compute_block(EDistanceType type, float64_t param,
+		CDenseFeatures<float64_t>* lhs, int32_t start_a, int32_t num_a,
+		CDenseFeatures<float64_t>* rhs, int32_t start_b, int32_t num_b,
+		float64_t* result, int32_t ld)
+{
+	ASSERT(lhs)
+	ASSERT(rhs)
+
+	switch (type)
+	{
+	case D_MANHATTAN:
+		compute_features_block(ManhattanMetric(), lhs, start_a, num_a, rhs,
+				start_b, num_b, result, ld);
+		break;
+	case D_CHEBYSHEW:
+		compute_features_block(ChebyshewMetric(), lhs, start_a, num_a, rhs,
+				start_b, num_b, result, ld);
+		break;
+	case D_CANBERRA:
+		compute_features_block(CanberraMetric(), lhs, start_a, num_a, rhs,
+				start_b, num_b, result, ld);
+		break;
+	case D_CHISQUARE:
+		compute_features_block(ChiSquareDistance(), lhs, start_a, num_a, rhs,
+				start_b, num_b, result, ld);
+		break;
+	case D_BRAYCURTIS:
+		compute_features_block(BrayCurtisDistance(), lhs, start_a, num_a, rhs,
+				start_b, num_b, result, ld);
+		break;
+	case D_JENSEN:
+		compute_features_block(JensenMetric(), lhs, start_a, num_a, rhs,
+				start_b, num_b, result, ld);
+		break;
+	case D_MINKOWSKI:
+		compute_features_block(MinkowskiMetric(param), lhs, start_a, num_a, rhs,
+				start_b, num_b, result, ld);
+		break;
+	case D_TANIMOTO:
+		compute_features_block(TanimotoDistance(), lhs, start_a, num_a, rhs,
+				start_b, num_b, result, ld);
+		break;
+	case D_COSINE:
+		compute_features_block(CosineDistance(), lhs, start_a, num_a, rhs,
+				start_b, num_b, result, ld);
+		break;
+	default:
+		SG_SERROR("DenseDistanceEngine: distance type %d is not supported\n",
+				type);
+	}
+}
@@ -0,0 +1,67 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef _DENSEDISTANCEENGINE_H___
+#define _DENSEDISTANCEENGINE_H___
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/common.h>
+#include <shogun/distance/Distance.h>
+
+namespace shogun
+{
+template <class ST> class CDenseFeatures;
+
+/** @brief Computes blocks of distances between real valued dense feature
+ * vectors.
+ *
+ * Every supported metric is a compile time functor which the engine runs
+ * over tiles of one lhs vector and several rhs vectors at once, so that a
+ * chunk of the lhs vector is loaded once per tile and the accumulators of
+ * the tile stay in registers. The rhs vectors are processed in chunks which
+ * stay in cache while all lhs vectors of the block pass by. The inner loops
+ * are vectorized for the instruction set selected by the linalg CPU backend,
+ * see linalg::get_cpu_instruction_set(); with the scalar instruction set
+ * the results are identical to the compute() methods of the distances.
+ *
+ * Supported are D_MANHATTAN, D_CHEBYSHEW, D_CANBERRA, D_CHISQUARE,
+ * D_BRAYCURTIS, D_JENSEN, D_MINKOWSKI, D_TANIMOTO and D_COSINE. The engine
+ * does not create threads, callers split the blocks among threads.
+ */
+class DenseDistanceEngine
+{
+public:
+	/** @return whether the engine implements the distance type
+	 *
+	 * @param type distance type
+	 */
+	static bool supports(EDistanceType type);
+
+	/** compute the distances of lhs vectors start_a,...,start_a+num_a-1
+	 * and rhs vectors start_b,...,start_b+num_b-1, the indices are not
+	 * checked
+	 *
+	 * @param type distance type, see supports()
+	 * @param param parameter of the distance, k of D_MINKOWSKI
+	 * @param lhs left hand side features
+	 * @param start_a index of the first lhs vector
+	 * @param num_a number of lhs vectors
+	 * @param rhs right hand side features
+	 * @param start_b index of the first rhs vector
+	 * @param num_b number of rhs vectors
+	 * @param result distance of lhs vector start_a+i and rhs vector
+	 * start_b+j is stored in result[i+j*ld]
+	 * @param ld leading dimension of result
+	 */
+	static void compute_block(EDistanceType type, float64_t param,
+			CDenseFeatures<float64_t>* lhs, int32_t start_a, int32_t num_a,
+			CDenseFeatures<float64_t>* rhs, int32_t start_b, int32_t num_b,
+			float64_t* result, int32_t ld);
+};
+}
+#endif /* _DENSEDISTANCEENGINE_H___ */
@@ -30,6 +30,9 @@
 
 using namespace shogun;
 
+/** number of rows of the distance matrix which are computed together */
+static const int32_t DISTANCE_STRIP_SIZE=16;
+
 /** distance thread parameters */
 template <class T> struct D_THREAD_PARAM
 {
@@ -239,6 +242,41 @@ float64_t CDistance::distance(int32_t idx_a, int32_t idx_b)
 	return compute(idx_a, idx_b);
 }
 
+void CDistance::distance_block(int32_t start_a, int32_t num_a,
+		int32_t start_b, int32_t num_b, float64_t* result, int32_t ld)
+{
+	/* like distance(), check against the current size of the features,
+	 * which may have changed since init() */
+	int32_t num_vec_lhs=lhs ? lhs->get_num_vectors() : get_num_vec_lhs();
+	int32_t num_vec_rhs=rhs ? rhs->get_num_vectors() : get_num_vec_rhs();
+
+	REQUIRE(start_a>=0 && num_a>=0 && start_a+num_a<=num_vec_lhs &&
+			start_b>=0 && num_b>=0 && start_b+num_b<=num_vec_rhs,
+			"lhs block [%d,%d) must be in [0,%d] and rhs block [%d,%d) must be "
+			"in [0,%d]\n", start_a, start_a+num_a, num_vec_lhs,
+			start_b, start_b+num_b, num_vec_rhs)
+	REQUIRE(result, "No result buffer given\n")
+
+	if (ld==0)
+		ld=num_a;
+	REQUIRE(ld>=num_a, "Leading dimension (%d) must be at least %d\n", ld, num_a)
+
+	if (precompute_matrix)
+		CDistance::compute_block(start_a, num_a, start_b, num_b, result, ld);
+	else
+		compute_block(start_a, num_a, start_b, num_b, result, ld);
+}
+
+void CDistance::compute_block(int32_t start_a, int32_t num_a, int32_t start_b,
+		int32_t num_b, float64_t* result, int32_t ld)
+{
+	for (int32_t j=0; j<num_b; j++)
+	{
+		for (int32_t i=0; i<num_a; i++)
+			result[i+int64_t(j)*ld]=distance(start_a+i, start_b+j);
+	}
+}
+
 void CDistance::do_precompute_matrix()
 {
 	int32_t num_left=lhs->get_num_vectors();
@@ -293,38 +331,52 @@ template <class T> void* CDistance::get_distance_matrix_helper(void* p)
 	int64_t total_end=params->total_end;
 	int64_t total=total_start;
 
-	for (int32_t i=i_start; i<i_end; i++)
+	/* rows are computed in strips, so that distances which implement
+	 * compute_block() get whole blocks */
+	float64_t* strip=SG_MALLOC(float64_t, int64_t(DISTANCE_STRIP_SIZE)*n);
+
+	for (int32_t i=i_start; i<i_end; i+=DISTANCE_STRIP_SIZE)
 	{
+		int32_t num_rows=CMath::min(DISTANCE_STRIP_SIZE, i_end-i);
 		int32_t j_start=0;
 
 		if (symmetric)
 			j_start=i;
 
-		for (int32_t j=j_start; j<n; j++)
+		k->distance_block(i, num_rows, j_start, n-j_start, strip, num_rows);
+
+		for (int32_t r=0; r<num_rows; r++)
 		{
-			float64_t v=k->distance(i,j);
-			result[i+j*m]=v;
+			int64_t row=i+r;
+			int32_t j=j_start;
 
-			if (symmetric && i!=j)
-				result[j+i*m]=v;
+			/* only the upper triangle of the strip is used */
+			if (symmetric)
+				j=row;
 
-			if (verbose)
+			for (; j<n; j++)
 			{
-				total++;
+				T v=strip[r+int64_t(j-j_start)*num_rows];
+				result[row+int64_t(j)*m]=v;
 
-				if (symmetric && i!=j)
+				if (symmetric && row!=j)
+				{
+					result[j+row*m]=v;
 					total++;
-
-				if (total%100 == 0)
-					SG_OBJ_PROGRESS(k, total, total_start, total_end)
-
-				if (CSignal::cancel_computations())
-					break;
+				}
+				total++;
 			}
 		}
 
+		if (verbose)
+			SG_OBJ_PROGRESS(k, total, total_start, total_end)
+
+		if (CSignal::cancel_computations())
+			break;
 	}
 
+	SG_FREE(strip);
+
 	return NULL;
 }
 
@@ -108,6 +108,25 @@ class CDistance : public CSGObject
 		 */
 		virtual float64_t distance(int32_t idx_a, int32_t idx_b);
 
+		/** get distance function for the consecutive lhs feature vectors
+		 * start_a,...,start_a+num_a-1 and rhs feature vectors
+		 * start_b,...,start_b+num_b-1
+		 *
+		 * Distances which implement compute_block() compute the whole
+		 * block at once, which is considerably faster than calling
+		 * distance() for every pair.
+		 *
+		 * @param start_a index of the first lhs feature vector
+		 * @param num_a number of lhs feature vectors
+		 * @param start_b index of the first rhs feature vector
+		 * @param num_b number of rhs feature vectors
+		 * @param result distance of lhs vector start_a+i and rhs vector
+		 * start_b+j is stored in result[i+j*ld]
+		 * @param ld leading dimension of result, 0 for num_a
+		 */
+		void distance_block(int32_t start_a, int32_t num_a, int32_t start_b,
+				int32_t num_b, float64_t* result, int32_t ld=0);
+
 		/** get distance function for lhs feature vector a
 		 *  and rhs feature vector b. The computation of the
 		 *  distance stops if the intermediate result is
@@ -351,6 +370,23 @@ class CDistance : public CSGObject
 		/// in the corresponding feature object
 		virtual float64_t compute(int32_t idx_a, int32_t idx_b)=0;
 
+		/** compute distance function for a block of lhs and rhs feature
+		 * vectors, see distance_block(), the indices are already checked
+		 *
+		 * The default implementation calls distance() for every pair.
+		 * Implementations are not used while the distance matrix is
+		 * precomputed.
+		 *
+		 * @param start_a index of the first lhs feature vector
+		 * @param num_a number of lhs feature vectors
+		 * @param start_b index of the first rhs feature vector
+		 * @param num_b number of rhs feature vectors
+		 * @param result distances, see distance_block()
+		 * @param ld leading dimension of result
+		 */
+		virtual void compute_block(int32_t start_a, int32_t num_a,
+				int32_t start_b, int32_t num_b, float64_t* result, int32_t ld);
+
 		/// matrix precomputation
 		void do_precompute_matrix();
 
@@ -68,6 +68,18 @@ float64_t CKernelDistance::compute(int32_t idx_a, int32_t idx_b)
 	return exp(-result/width);
 }
 
+void CKernelDistance::compute_block(int32_t start_a, int32_t num_a,
+		int32_t start_b, int32_t num_b, float64_t* result, int32_t ld)
+{
+	SGVector<float64_t> row(num_b);
+	for (int32_t i=0; i<num_a; i++)
+	{
+		kernel->kernel_row_block(start_a+i, start_b, num_b, row.vector);
+		for (int32_t j=0; j<num_b; j++)
+			result[i+int64_t(j)*ld]=exp(-row[j]/width);
+	}
+}
+
 void CKernelDistance::init()
 {
 	kernel = NULL;
@@ -105,6 +105,19 @@ class CKernelDistance: public CDistance
 		 */
 		float64_t compute(int32_t idx_a, int32_t idx_b);
 
+		/** compute distances of a block of feature vectors from blocks of
+		 * kernel values, see CKernel::kernel_row_block()
+		 *
+		 * @param start_a index of the first lhs feature vector
+		 * @param num_a number of lhs feature vectors
+		 * @param start_b index of the first rhs feature vector
+		 * @param num_b number of rhs feature vectors
+		 * @param result distances, see CDistance::distance_block()
+		 * @param ld leading dimension of result
+		 */
+		virtual void compute_block(int32_t start_a, int32_t num_a,
+				int32_t start_b, int32_t num_b, float64_t* result, int32_t ld);
+
 	private:
 		void init();
 
@@ -15,6 +15,7 @@
 #include <shogun/base/Parameter.h>
 
 #include <shogun/distance/MinkowskiMetric.h>
+#include <shogun/distance/DenseDistanceEngine.h>
 #include <shogun/features/Features.h>
 
 using namespace shogun;
@@ -90,3 +91,11 @@ void CMinkowskiMetric::init()
 	k = 2.0;
 	SG_ADD(&k, "k", "L_k norm.", MS_AVAILABLE);
 }
+
+void CMinkowskiMetric::compute_block(int32_t start_a, int32_t num_a,
+		int32_t start_b, int32_t num_b, float64_t* result, int32_t ld)
+{
+	DenseDistanceEngine::compute_block(D_MINKOWSKI, k,
+		(CDenseFeatures<float64_t>*) lhs, start_a, num_a,
+		(CDenseFeatures<float64_t>*) rhs, start_b, num_b, result, ld);
+}
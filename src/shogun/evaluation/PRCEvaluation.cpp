@@ -12,6 +12,7 @@
 #include <shogun/labels/RegressionLabels.h>
 #include <shogun/labels/BinaryLabels.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/KeyIndexSort.h>
 
 using namespace shogun;
 
@@ -45,7 +46,7 @@ float64_t CPRCEvaluation::evaluate(CLabels* predicted, CLabels* ground_truth)
 		idxs[i] = i;
 
 	// sort indexes by labels ascending
-	CMath::qsort_backward_index(labels,idxs,length);
+	CKeyIndexSort::sort_backward(labels,idxs,length);
 
 	// clean and initialize graph and auPRC
 	SG_FREE(labels);
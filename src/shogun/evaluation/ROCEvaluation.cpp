@@ -10,6 +10,7 @@
 
 #include <shogun/evaluation/ROCEvaluation.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/KeyIndexSort.h>
 
 using namespace shogun;
 
@@ -54,7 +55,7 @@ float64_t CROCEvaluation::evaluate_roc(CLabels* predicted, CLabels* ground_truth
 	for(i=0; i<length; i++)
 		idxs[i] = i;
 
-	CMath::qsort_backward_index(labels,idxs.vector,idxs.vlen);
+	CKeyIndexSort::sort_backward(labels,idxs.vector,idxs.vlen);
 
 	// number of different predicted labels
 	int32_t diff_count=1;
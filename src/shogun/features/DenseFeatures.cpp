@@ -15,11 +15,16 @@
 #include <shogun/preprocessor/DensePreprocessor.h>
 #include <shogun/io/SGIO.h>
 #include <shogun/base/Parameter.h>
+#include <shogun/lib/Metrics.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/eigen3.h>
 
 #include <string.h>
 
+/* size in MB of the cache of vectors preprocessed on the fly if no cache
+ * size is set */
+#define DEFAULT_PREPROCESSED_CACHE_SIZE 64
+
 namespace shogun {
 
 template<class ST> CDenseFeatures<ST>::CDenseFeatures(int32_t size) : CDotFeatures(size)
@@ -96,8 +101,24 @@ template<class ST> ST* CDenseFeatures<ST>::get_feature_vector(int32_t num, int32
 
 	if (feature_matrix.matrix)
 	{
+		if (m_notify_access)
+			on_feature_vector_access(real_num);
+
+		if (!preprocess_on_get ||
+				get_num_preprocessed()==get_num_preprocessors())
+		{
+			dofree = false;
+			return &feature_matrix.matrix[real_num * int64_t(num_features)];
+		}
+
+		// the block might be evicted from the cache by another thread, so
+		// it is locked until free_feature_vector() is called
+		const int32_t block_size = m_preprocessing_block_size;
+		SGMatrix<ST> block = get_preprocessed_block(real_num / block_size, true);
+
+		len = block.num_rows;
 		dofree = false;
-		return &feature_matrix.matrix[real_num * int64_t(num_features)];
+		return block.get_column_vector(real_num % block_size);
 	}
 
 	ST* feat = NULL;
@@ -108,9 +129,15 @@ template<class ST> ST* CDenseFeatures<ST>::get_feature_vector(int32_t num, int32
 		feat = feature_cache->lock_entry(real_num);
 
 		if (feat)
+		{
+			SG_METRIC_INC(this, "feature_cache_hits")
 			return feat;
+		}
 		else
+		{
+			SG_METRIC_INC(this, "feature_cache_misses")
 			feat = feature_cache->set_entry(real_num);
+		}
 	}
 
 	if (!feat)
@@ -119,33 +146,13 @@ template<class ST> ST* CDenseFeatures<ST>::get_feature_vector(int32_t num, int32
 
 	if (get_num_preprocessors())
 	{
-		int32_t tmp_len = len;
-		ST* tmp_feat_before = feat;
-		ST* tmp_feat_after = NULL;
+		SGMatrix<ST> applied = preprocess_block(
+				SGMatrix<ST>(feat, len, 1, false), true);
 
-		for (int32_t i = 0; i < get_num_preprocessors(); i++)
-		{
-			CDensePreprocessor<ST>* p =
-					(CDensePreprocessor<ST>*) get_preprocessor(i);
-			// temporary hack
-			SGVector<ST> applied = p->apply_to_feature_vector(
-					SGVector<ST>(tmp_feat_before, tmp_len));
-			tmp_feat_after = applied.vector;
-			SG_UNREF(p);
+		if (applied.matrix != feat)
+			memcpy(feat, applied.matrix, sizeof(ST) * applied.num_rows);
 
-			if (i != 0) // delete feature vector, except for the the first one, i.e., feat
-				SG_FREE(tmp_feat_before);
-			tmp_feat_before = tmp_feat_after;
-		}
-
-		// note: tmp_feat_after should be checked as it is used by memcpy
-		if (tmp_feat_after)
-		{
-			memcpy(feat, tmp_feat_after, sizeof(ST) * tmp_len);
-			SG_FREE(tmp_feat_after);
-
-			len = tmp_len;
-		}
+		len = applied.num_rows;
 	}
 	return feat;
 }
@@ -189,11 +196,50 @@ template<class ST> SGVector<ST> CDenseFeatures<ST>::get_feature_vector(int32_t n
 	return SGVector<ST>(vector, vlen, do_free);
 }
 
+template<class ST> SGSpan<ST> CDenseFeatures<ST>::get_feature_vector_view(int32_t num)
+{
+	REQUIRE(num>=0 && num<get_num_vectors(), "Index out of bounds (number of "
+			"vectors %d, you requested %d)\n", get_num_vectors(), num)
+	REQUIRE(feature_matrix.matrix, "The feature matrix of %s is not in "
+			"memory, use get_feature_vector()\n", get_name())
+	REQUIRE(!preprocess_on_get ||
+			get_num_preprocessed()==get_num_preprocessors(), "%s applies "
+			"preprocessors on the fly, use get_feature_vector()\n", get_name())
+
+	int32_t real_num=m_subset_stack->subset_idx_conversion(num);
+
+	if (m_notify_access)
+		on_feature_vector_access(real_num);
+
+	return SGSpan<ST>(&feature_matrix.matrix[real_num*int64_t(num_features)],
+			num_features);
+}
+
+template<class ST> SGMatrixView<ST> CDenseFeatures<ST>::get_feature_matrix_view()
+{
+	REQUIRE(!m_subset_stack->has_subsets(), "A view of the feature matrix "
+			"of %s is not possible with subset\n", get_name())
+	REQUIRE(feature_matrix.matrix, "The feature matrix of %s is not in "
+			"memory\n", get_name())
+	REQUIRE(!preprocess_on_get ||
+			get_num_preprocessed()==get_num_preprocessors(), "%s applies "
+			"preprocessors on the fly\n", get_name())
+
+	return SGMatrixView<ST>(feature_matrix);
+}
+
 template<class ST> void CDenseFeatures<ST>::free_feature_vector(ST* feat_vec, int32_t num, bool dofree)
 {
 	if (feature_cache)
 		feature_cache->unlock_entry(m_subset_stack->subset_idx_conversion(num));
 
+	if (preprocess_on_get && feature_matrix.matrix &&
+			get_num_preprocessed()!=get_num_preprocessors())
+	{
+		int32_t real_num = m_subset_stack->subset_idx_conversion(num);
+		m_preprocessed_cache.unlock_block(real_num / m_preprocessing_block_size);
+	}
+
 	if (dofree)
 		SG_FREE(feat_vec);
 }
@@ -301,6 +347,7 @@ template<class ST> void CDenseFeatures<ST>::set_feature_matrix(SGMatrix<ST> matr
 	feature_matrix = matrix;
 	num_features = matrix.num_rows;
 	num_vectors = matrix.num_cols;
+	reset_preprocessed_cache();
 }
 
 template<class ST> ST* CDenseFeatures<ST>::get_feature_matrix(int32_t &num_feat, int32_t &num_vec)
@@ -386,6 +433,13 @@ template<class ST> bool CDenseFeatures<ST>::apply_preprocessor(bool force_prepro
 
 	if (feature_matrix.matrix && get_num_preprocessors())
 	{
+		if (supports_parallel_preprocessing(force_preprocessing))
+		{
+			bool success = apply_preprocessor_pipeline(force_preprocessing);
+			reset_preprocessed_cache();
+			return success;
+		}
+
 		for (int32_t i = 0; i < get_num_preprocessors(); i++)
 		{
 			if ((!is_preprocessed(i) || force_preprocessing))
@@ -405,6 +459,7 @@ template<class ST> bool CDenseFeatures<ST>::apply_preprocessor(bool force_prepro
 			}
 		}
 
+		reset_preprocessed_cache();
 		return true;
 	}
 	else
@@ -419,6 +474,192 @@ template<class ST> bool CDenseFeatures<ST>::apply_preprocessor(bool force_prepro
 	}
 }
 
+template<class ST> void CDenseFeatures<ST>::add_preprocessor(CPreprocessor* p)
+{
+	CDotFeatures::add_preprocessor(p);
+	reset_preprocessed_cache();
+}
+
+template<class ST> void CDenseFeatures<ST>::del_preprocessor(int32_t num)
+{
+	CDotFeatures::del_preprocessor(num);
+	reset_preprocessed_cache();
+}
+
+template<class ST> void CDenseFeatures<ST>::enable_on_the_fly_preprocessing()
+{
+	preprocess_on_get = true;
+	reset_preprocessed_cache();
+}
+
+template<class ST> void CDenseFeatures<ST>::disable_on_the_fly_preprocessing()
+{
+	preprocess_on_get = false;
+	reset_preprocessed_cache();
+}
+
+template<class ST> void CDenseFeatures<ST>::set_preprocessing_block_size(int32_t block_size)
+{
+	REQUIRE(block_size > 0, "Block size (%d) has to be positive\n", block_size)
+
+	m_preprocessing_block_size = block_size;
+	reset_preprocessed_cache();
+}
+
+template<class ST> int32_t CDenseFeatures<ST>::get_preprocessing_block_size() const
+{
+	return m_preprocessing_block_size;
+}
+
+template<class ST> void CDenseFeatures<ST>::reset_preprocessed_cache()
+{
+	if (!preprocess_on_get || !feature_matrix.matrix)
+	{
+		m_preprocessed_cache.resize(0);
+		return;
+	}
+
+	const int32_t block_size = m_preprocessing_block_size;
+	const int32_t num_blocks = (num_vectors + block_size - 1) / block_size;
+
+	int32_t cache_size = get_cache_size();
+	if (cache_size <= 0)
+		cache_size = DEFAULT_PREPROCESSED_CACHE_SIZE;
+
+	int64_t block_bytes = int64_t(block_size) * num_features * sizeof(ST);
+	int32_t capacity = CMath::min(int64_t(num_blocks), CMath::max(int64_t(1),
+			int64_t(cache_size) * 1024 * 1024 / block_bytes));
+
+	m_preprocessed_cache.resize(num_blocks, capacity);
+}
+
+template<class ST> SGMatrix<ST> CDenseFeatures<ST>::preprocess_block(
+		SGMatrix<ST> block, bool all_preprocessors) const
+{
+	for (int32_t i = 0; i < get_num_preprocessors(); i++)
+	{
+		if (!all_preprocessors && is_preprocessed(i))
+			continue;
+
+		CDensePreprocessor<ST>* p =
+				(CDensePreprocessor<ST>*) get_preprocessor(i);
+
+		if (p->supports_parallel_blocks())
+			block = p->apply_to_feature_block(block);
+		else
+		{
+			m_preprocessing_lock.lock();
+			block = p->apply_to_feature_block(block);
+			m_preprocessing_lock.unlock();
+		}
+
+		SG_UNREF(p);
+	}
+
+	return block;
+}
+
+template<class ST> bool CDenseFeatures<ST>::supports_parallel_preprocessing(
+		bool all_preprocessors) const
+{
+	for (int32_t i = 0; i < get_num_preprocessors(); i++)
+	{
+		if (!all_preprocessors && is_preprocessed(i))
+			continue;
+
+		CDensePreprocessor<ST>* p =
+				(CDensePreprocessor<ST>*) get_preprocessor(i);
+		bool supported = p->supports_parallel_blocks();
+		SG_UNREF(p);
+
+		if (!supported)
+			return false;
+	}
+
+	return true;
+}
+
+template<class ST> SGMatrix<ST> CDenseFeatures<ST>::get_preprocessed_block(
+		int32_t block, bool lock) const
+{
+	SGMatrix<ST> result = lock ? m_preprocessed_cache.lock_block(block) :
+			m_preprocessed_cache.get_block(block);
+	if (result.matrix)
+		return result;
+
+	const int32_t first = block * m_preprocessing_block_size;
+	const int32_t num = CMath::min(m_preprocessing_block_size, num_vectors - first);
+
+	SGMatrix<ST> vectors(num_features, num);
+	memcpy(vectors.matrix, feature_matrix.get_column_vector(first),
+			sizeof(ST) * int64_t(num_features) * num);
+
+	return m_preprocessed_cache.set_block(block,
+			preprocess_block(vectors, false), lock);
+}
+
+template<class ST> bool CDenseFeatures<ST>::apply_preprocessor_pipeline(
+		bool force_preprocessing)
+{
+	const int32_t block_size = m_preprocessing_block_size;
+	const int32_t num_blocks = (num_vectors + block_size - 1) / block_size;
+
+	SG_DEBUG("preprocessing %d blocks of %d vectors\n", num_blocks, block_size)
+
+	/* blocks are processed in place if the dimension does not change,
+	 * which the first block tells */
+	SGMatrix<ST> result = feature_matrix;
+	if (num_blocks > 0)
+	{
+		const int32_t num = CMath::min(block_size, num_vectors);
+		SGMatrix<ST> applied = preprocess_block(SGMatrix<ST>(
+				feature_matrix.matrix, num_features, num, false),
+				force_preprocessing);
+
+		if (applied.num_rows != num_features)
+			result = SGMatrix<ST>(applied.num_rows, num_vectors);
+
+		if (applied.matrix != result.matrix)
+		{
+			memcpy(result.matrix, applied.matrix,
+					sizeof(ST) * int64_t(result.num_rows) * num);
+		}
+	}
+
+#pragma omp parallel for schedule(dynamic)
+	for (int32_t b = 1; b < num_blocks; b++)
+	{
+		const int32_t first = b * block_size;
+		const int32_t num = CMath::min(block_size, num_vectors - first);
+
+		SGMatrix<ST> block(feature_matrix.get_column_vector(first),
+				num_features, num, false);
+		SGMatrix<ST> applied = preprocess_block(block, force_preprocessing);
+
+		if (applied.matrix != result.get_column_vector(first))
+		{
+			memcpy(result.get_column_vector(first), applied.matrix,
+					sizeof(ST) * int64_t(result.num_rows) * num);
+		}
+	}
+
+	for (int32_t i = 0; i < get_num_preprocessors(); i++)
+	{
+		if (!is_preprocessed(i) || force_preprocessing)
+		{
+			CPreprocessor* p = get_preprocessor(i);
+			SG_INFO("preprocessing using preproc %s\n", p->get_name())
+			SG_UNREF(p);
+			set_preprocessed(i);
+		}
+	}
+
+	if (result.matrix != feature_matrix.matrix)
+		set_feature_matrix(result);
+
+	return true;
+}
+
 template<class ST> int32_t CDenseFeatures<ST>::get_num_vectors() const
 {
 	return m_subset_stack->has_subsets() ? m_subset_stack->get_size() : num_vectors;
@@ -472,7 +713,14 @@ template<class ST> bool CDenseFeatures<ST>::reshape(int32_t p_num_features, int3
 		return false;
 }
 
-template<class ST> int32_t CDenseFeatures<ST>::get_dim_feature_space() const { return num_features; }
+template<class ST> int32_t CDenseFeatures<ST>::get_dim_feature_space() const
+{
+	if (preprocess_on_get && feature_matrix.matrix && num_vectors &&
+			get_num_preprocessed()!=get_num_preprocessors())
+		return get_preprocessed_block(0).num_rows;
+
+	return num_features;
+}
 
 template<class ST> float64_t CDenseFeatures<ST>::dot(int32_t vec_idx1, CDotFeatures* df,
 		int32_t vec_idx2)
@@ -499,22 +747,20 @@ template<class ST> float64_t CDenseFeatures<ST>::dot(int32_t vec_idx1, CDotFeatu
 template<class ST> void CDenseFeatures<ST>::add_to_dense_vec(float64_t alpha, int32_t vec_idx1,
 		float64_t* vec2, int32_t vec2_len, bool abs_val)
 {
-	ASSERT(vec2_len == num_features)
-
 	int32_t vlen;
 	bool vfree;
 	ST* vec1 = get_feature_vector(vec_idx1, vlen, vfree);
 
-	ASSERT(vlen == num_features)
+	ASSERT(vlen == vec2_len)
 
 	if (abs_val)
 	{
-		for (int32_t i = 0; i < num_features; i++)
+		for (int32_t i = 0; i < vlen; i++)
 			vec2[i] += alpha * CMath::abs(vec1[i]);
 	}
 	else
 	{
-		for (int32_t i = 0; i < num_features; i++)
+		for (int32_t i = 0; i < vlen; i++)
 			vec2[i] += alpha * vec1[i];
 	}
 
@@ -525,22 +771,20 @@ template<>
 void CDenseFeatures<float64_t>::add_to_dense_vec(float64_t alpha, int32_t vec_idx1,
 		float64_t* vec2, int32_t vec2_len, bool abs_val)
 {
-	ASSERT(vec2_len == num_features)
-
 	int32_t vlen;
 	bool vfree;
 	float64_t* vec1 = get_feature_vector(vec_idx1, vlen, vfree);
 
-	ASSERT(vlen == num_features)
+	ASSERT(vlen == vec2_len)
 
 	if (abs_val)
 	{
-		for (int32_t i = 0; i < num_features; i++)
+		for (int32_t i = 0; i < vlen; i++)
 			vec2[i] += alpha * CMath::abs(vec1[i]);
 	}
 	else
 	{
-		SGVector<float64_t>::vec1_plus_scalar_times_vec2(vec2, alpha, vec1, num_features);
+		SGVector<float64_t>::vec1_plus_scalar_times_vec2(vec2, alpha, vec1, vlen);
 	}
 
 	free_feature_vector(vec1, vec_idx1, vfree);
@@ -548,7 +792,7 @@ void CDenseFeatures<float64_t>::add_to_dense_vec(float64_t alpha, int32_t vec_id
 
 template<class ST> int32_t CDenseFeatures<ST>::get_nnz_features_for_vector(int32_t num)
 {
-	return num_features;
+	return get_dim_feature_space();
 }
 
 template<class ST> void* CDenseFeatures<ST>::get_feature_iterator(int32_t vector_index)
@@ -667,6 +911,9 @@ template<class ST> void CDenseFeatures<ST>::init()
 
 	feature_matrix = SGMatrix<ST>();
 	feature_cache = NULL;
+	preprocess_on_get = false;
+	m_preprocessing_block_size = 256;
+	m_notify_access = false;
 
 	set_generic<ST>();
 
@@ -675,6 +922,10 @@ template<class ST> void CDenseFeatures<ST>::init()
 	SG_ADD(&num_features, "num_features", "Number of features.", MS_NOT_AVAILABLE);
 	SG_ADD(&feature_matrix, "feature_matrix",
 			"Matrix of feature vectors / 1 vector per column.", MS_NOT_AVAILABLE);
+	SG_ADD(&preprocess_on_get, "preprocess_on_get",
+			"Whether preprocessors are applied on the fly.", MS_NOT_AVAILABLE);
+	SG_ADD(&m_preprocessing_block_size, "preprocessing_block_size",
+			"Number of vectors which are preprocessed together.", MS_NOT_AVAILABLE);
 }
 
 #define GET_FEATURE_TYPE(f_type, sg_type)	\
@@ -701,16 +952,14 @@ GET_FEATURE_TYPE(F_LONGREAL, floatmax_t)
 template<> float64_t CDenseFeatures<bool>::dense_dot(int32_t vec_idx1,
 		const float64_t* vec2, int32_t vec2_len)
 {
-	ASSERT(vec2_len == num_features)
-
 	int32_t vlen;
 	bool vfree;
 	bool* vec1 = get_feature_vector(vec_idx1, vlen, vfree);
 
-	ASSERT(vlen == num_features)
+	ASSERT(vlen == vec2_len)
 	float64_t result = 0;
 
-	for (int32_t i = 0; i < num_features; i++)
+	for (int32_t i = 0; i < vlen; i++)
 		result += vec1[i] ? vec2[i] : 0;
 
 	free_feature_vector(vec1, vec_idx1, vfree);
@@ -721,16 +970,14 @@ template<> float64_t CDenseFeatures<bool>::dense_dot(int32_t vec_idx1,
 template<> float64_t CDenseFeatures<char>::dense_dot(int32_t vec_idx1,
 		const float64_t* vec2, int32_t vec2_len)
 {
-	ASSERT(vec2_len == num_features)
-
 	int32_t vlen;
 	bool vfree;
 	char* vec1 = get_feature_vector(vec_idx1, vlen, vfree);
 
-	ASSERT(vlen == num_features)
+	ASSERT(vlen == vec2_len)
 	float64_t result = 0;
 
-	for (int32_t i = 0; i < num_features; i++)
+	for (int32_t i = 0; i < vlen; i++)
 		result += vec1[i] * vec2[i];
 
 	free_feature_vector(vec1, vec_idx1, vfree);
@@ -741,16 +988,14 @@ template<> float64_t CDenseFeatures<char>::dense_dot(int32_t vec_idx1,
 template<> float64_t CDenseFeatures<int8_t>::dense_dot(int32_t vec_idx1,
 		const float64_t* vec2, int32_t vec2_len)
 {
-	ASSERT(vec2_len == num_features)
-
 	int32_t vlen;
 	bool vfree;
 	int8_t* vec1 = get_feature_vector(vec_idx1, vlen, vfree);
 
-	ASSERT(vlen == num_features)
+	ASSERT(vlen == vec2_len)
 	float64_t result = 0;
 
-	for (int32_t i = 0; i < num_features; i++)
+	for (int32_t i = 0; i < vlen; i++)
 		result += vec1[i] * vec2[i];
 
 	free_feature_vector(vec1, vec_idx1, vfree);
@@ -761,16 +1006,14 @@ template<> float64_t CDenseFeatures<int8_t>::dense_dot(int32_t vec_idx1,
 template<> float64_t CDenseFeatures<uint8_t>::dense_dot(
 		int32_t vec_idx1, const float64_t* vec2, int32_t vec2_len)
 {
-	ASSERT(vec2_len == num_features)
-
 	int32_t vlen;
 	bool vfree;
 	uint8_t* vec1 = get_feature_vector(vec_idx1, vlen, vfree);
 
-	ASSERT(vlen == num_features)
+	ASSERT(vlen == vec2_len)
 	float64_t result = 0;
 
-	for (int32_t i = 0; i < num_features; i++)
+	for (int32_t i = 0; i < vlen; i++)
 		result += vec1[i] * vec2[i];
 
 	free_feature_vector(vec1, vec_idx1, vfree);
@@ -781,16 +1024,14 @@ template<> float64_t CDenseFeatures<uint8_t>::dense_dot(
 template<> float64_t CDenseFeatures<int16_t>::dense_dot(
 		int32_t vec_idx1, const float64_t* vec2, int32_t vec2_len)
 {
-	ASSERT(vec2_len == num_features)
-
 	int32_t vlen;
 	bool vfree;
 	int16_t* vec1 = get_feature_vector(vec_idx1, vlen, vfree);
 
-	ASSERT(vlen == num_features)
+	ASSERT(vlen == vec2_len)
 	float64_t result = 0;
 
-	for (int32_t i = 0; i < num_features; i++)
+	for (int32_t i = 0; i < vlen; i++)
 		result += vec1[i] * vec2[i];
 
 	free_feature_vector(vec1, vec_idx1, vfree);
@@ -801,16 +1042,14 @@ template<> float64_t CDenseFeatures<int16_t>::dense_dot(
 template<> float64_t CDenseFeatures<uint16_t>::dense_dot(
 		int32_t vec_idx1, const float64_t* vec2, int32_t vec2_len)
 {
-	ASSERT(vec2_len == num_features)
-
 	int32_t vlen;
 	bool vfree;
 	uint16_t* vec1 = get_feature_vector(vec_idx1, vlen, vfree);
 
-	ASSERT(vlen == num_features)
+	ASSERT(vlen == vec2_len)
 	float64_t result = 0;
 
-	for (int32_t i = 0; i < num_features; i++)
+	for (int32_t i = 0; i < vlen; i++)
 		result += vec1[i] * vec2[i];
 
 	free_feature_vector(vec1, vec_idx1, vfree);
@@ -821,16 +1060,14 @@ template<> float64_t CDenseFeatures<uint16_t>::dense_dot(
 template<> float64_t CDenseFeatures<int32_t>::dense_dot(
 		int32_t vec_idx1, const float64_t* vec2, int32_t vec2_len)
 {
-	ASSERT(vec2_len == num_features)
-
 	int32_t vlen;
 	bool vfree;
 	int32_t* vec1 = get_feature_vector(vec_idx1, vlen, vfree);
 
-	ASSERT(vlen == num_features)
+	ASSERT(vlen == vec2_len)
 	float64_t result = 0;
 
-	for (int32_t i = 0; i < num_features; i++)
+	for (int32_t i = 0; i < vlen; i++)
 		result += vec1[i] * vec2[i];
 
 	free_feature_vector(vec1, vec_idx1, vfree);
@@ -841,16 +1078,14 @@ template<> float64_t CDenseFeatures<int32_t>::dense_dot(
 template<> float64_t CDenseFeatures<uint32_t>::dense_dot(
 		int32_t vec_idx1, const float64_t* vec2, int32_t vec2_len)
 {
-	ASSERT(vec2_len == num_features)
-
 	int32_t vlen;
 	bool vfree;
 	uint32_t* vec1 = get_feature_vector(vec_idx1, vlen, vfree);
 
-	ASSERT(vlen == num_features)
+	ASSERT(vlen == vec2_len)
 	float64_t result = 0;
 
-	for (int32_t i = 0; i < num_features; i++)
+	for (int32_t i = 0; i < vlen; i++)
 		result += vec1[i] * vec2[i];
 
 	free_feature_vector(vec1, vec_idx1, vfree);
@@ -861,16 +1096,14 @@ template<> float64_t CDenseFeatures<uint32_t>::dense_dot(
 template<> float64_t CDenseFeatures<int64_t>::dense_dot(
 		int32_t vec_idx1, const float64_t* vec2, int32_t vec2_len)
 {
-	ASSERT(vec2_len == num_features)
-
 	int32_t vlen;
 	bool vfree;
 	int64_t* vec1 = get_feature_vector(vec_idx1, vlen, vfree);
 
-	ASSERT(vlen == num_features)
+	ASSERT(vlen == vec2_len)
 	float64_t result = 0;
 
-	for (int32_t i = 0; i < num_features; i++)
+	for (int32_t i = 0; i < vlen; i++)
 		result += vec1[i] * vec2[i];
 
 	free_feature_vector(vec1, vec_idx1, vfree);
@@ -881,16 +1114,14 @@ template<> float64_t CDenseFeatures<int64_t>::dense_dot(
 template<> float64_t CDenseFeatures<uint64_t>::dense_dot(
 		int32_t vec_idx1, const float64_t* vec2, int32_t vec2_len)
 {
-	ASSERT(vec2_len == num_features)
-
 	int32_t vlen;
 	bool vfree;
 	uint64_t* vec1 = get_feature_vector(vec_idx1, vlen, vfree);
 
-	ASSERT(vlen == num_features)
+	ASSERT(vlen == vec2_len)
 	float64_t result = 0;
 
-	for (int32_t i = 0; i < num_features; i++)
+	for (int32_t i = 0; i < vlen; i++)
 		result += vec1[i] * vec2[i];
 
 	free_feature_vector(vec1, vec_idx1, vfree);
@@ -901,16 +1132,14 @@ template<> float64_t CDenseFeatures<uint64_t>::dense_dot(
 template<> float64_t CDenseFeatures<float32_t>::dense_dot(
 		int32_t vec_idx1, const float64_t* vec2, int32_t vec2_len)
 {
-	ASSERT(vec2_len == num_features)
-
 	int32_t vlen;
 	bool vfree;
 	float32_t* vec1 = get_feature_vector(vec_idx1, vlen, vfree);
 
-	ASSERT(vlen == num_features)
+	ASSERT(vlen == vec2_len)
 	float64_t result = 0;
 
-	for (int32_t i = 0; i < num_features; i++)
+	for (int32_t i = 0; i < vlen; i++)
 		result += vec1[i] * vec2[i];
 
 	free_feature_vector(vec1, vec_idx1, vfree);
@@ -921,14 +1150,12 @@ template<> float64_t CDenseFeatures<float32_t>::dense_dot(
 template<> float64_t CDenseFeatures<float64_t>::dense_dot(
 		int32_t vec_idx1, const float64_t* vec2, int32_t vec2_len)
 {
-	ASSERT(vec2_len == num_features)
-
 	int32_t vlen;
 	bool vfree;
 	float64_t* vec1 = get_feature_vector(vec_idx1, vlen, vfree);
 
-	ASSERT(vlen == num_features)
-	float64_t result = CMath::dot(vec1, vec2, num_features);
+	ASSERT(vlen == vec2_len)
+	float64_t result = CMath::dot(vec1, vec2, vlen);
 
 	free_feature_vector(vec1, vec_idx1, vfree);
 
@@ -938,16 +1165,14 @@ template<> float64_t CDenseFeatures<float64_t>::dense_dot(
 template<> float64_t CDenseFeatures<floatmax_t>::dense_dot(
 		int32_t vec_idx1, const float64_t* vec2, int32_t vec2_len)
 {
-	ASSERT(vec2_len == num_features)
-
 	int32_t vlen;
 	bool vfree;
 	floatmax_t* vec1 = get_feature_vector(vec_idx1, vlen, vfree);
 
-	ASSERT(vlen == num_features)
+	ASSERT(vlen == vec2_len)
 	float64_t result = 0;
 
-	for (int32_t i = 0; i < num_features; i++)
+	for (int32_t i = 0; i < vlen; i++)
 		result += vec1[i] * vec2[i];
 
 	free_feature_vector(vec1, vec_idx1, vfree);
@@ -18,12 +18,16 @@
 
 #include <shogun/lib/common.h>
 #include <shogun/lib/Cache.h>
+#include <shogun/lib/BlockCache.h>
+#include <shogun/lib/Lock.h>
 #include <shogun/io/File.h>
 #include <shogun/features/DotFeatures.h>
 #include <shogun/features/StringFeatures.h>
 #include <shogun/lib/DataType.h>
 
 #include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGSpan.h>
+#include <shogun/lib/SGMatrixView.h>
 
 namespace shogun {
 template<class ST> class CStringFeatures;
@@ -123,6 +127,10 @@ public:
 	 * initialized, else return preprocessed compute_feature_vector (not
 	 * implemented)
 	 *
+	 * With on-the-fly preprocessing, preprocessors which were not applied
+	 * to the matrix yet are applied to the block of vectors containing
+	 * num, see enable_on_the_fly_preprocessing().
+	 *
 	 * @param num index of feature vector
 	 * @param len length is returned by reference
 	 * @param dofree whether returned vector must be freed by
@@ -149,6 +157,32 @@ public:
 	 */
 	SGVector<ST> get_feature_vector(int32_t num);
 
+#ifndef SWIG // SWIG should skip this part
+	/** get a view of feature vector num, which neither copies nor
+	 * allocates nor counts references
+	 *
+	 * possible with subset
+	 *
+	 * Requires the feature matrix in memory and no preprocessors applied on
+	 * the fly, use get_feature_vector() otherwise. The view is valid as long
+	 * as the feature matrix is not changed.
+	 *
+	 * @param num index of vector
+	 * @return view of the feature vector
+	 */
+	SGSpan<ST> get_feature_vector_view(int32_t num);
+
+	/** get a view of the feature matrix
+	 *
+	 * not possible with subset
+	 *
+	 * Same requirements as get_feature_vector_view().
+	 *
+	 * @return view of the feature matrix
+	 */
+	SGMatrixView<ST> get_feature_matrix_view();
+#endif // SWIG
+
 	/** free feature vector
 	 *
 	 * possible with subset
@@ -291,6 +325,47 @@ public:
 	 */
 	virtual bool apply_preprocessor(bool force_preprocessing = false);
 
+	/** add preprocessor, drops all vectors preprocessed on the fly
+	 *
+	 * @param p preprocessor to add
+	 */
+	virtual void add_preprocessor(CPreprocessor* p);
+
+	/** delete preprocessor, drops all vectors preprocessed on the fly
+	 *
+	 * @param num index of preprocessor in list
+	 */
+	virtual void del_preprocessor(int32_t num);
+
+	/** apply the preprocessors which were not applied to the feature
+	 * matrix yet whenever a feature vector is requested, instead of
+	 * preprocessing the whole matrix by apply_preprocessor().
+	 *
+	 * The vectors are preprocessed in blocks of
+	 * get_preprocessing_block_size() consecutive vectors, which are kept in
+	 * a thread-safe cache of at most get_cache_size() MB (64 MB if 0),
+	 * so get_feature_vector() may be called from several threads. The block
+	 * of a vector stays in memory until free_feature_vector() is called.
+	 *
+	 * get_num_features() keeps returning the dimension of the matrix,
+	 * while get_dim_feature_space() and the dot product operations use
+	 * the dimension of the preprocessed vectors.
+	 */
+	void enable_on_the_fly_preprocessing();
+
+	/** disable on-the-fly preprocessing and drop its cache */
+	void disable_on_the_fly_preprocessing();
+
+	/** set the number of vectors which are preprocessed together, both by
+	 * apply_preprocessor() and on the fly
+	 *
+	 * @param block_size number of vectors in a block
+	 */
+	void set_preprocessing_block_size(int32_t block_size);
+
+	/** @return number of vectors which are preprocessed together */
+	int32_t get_preprocessing_block_size() const;
+
 	/** get number of feature vectors
 	 *
 	 * @return number of feature vectors
@@ -537,6 +612,52 @@ protected:
 	virtual ST* compute_feature_vector(int32_t num, int32_t& len,
 			ST* target = NULL);
 
+	/** pass a block of feature vectors through the preprocessors
+	 *
+	 * @param block feature vectors, may be overwritten
+	 * @param all_preprocessors whether to apply all preprocessors, or only
+	 * those which were not applied to the feature matrix yet
+	 * @return preprocessed feature vectors
+	 */
+	SGMatrix<ST> preprocess_block(SGMatrix<ST> block, bool all_preprocessors) const;
+
+	/** whether all preprocessors, or those which were not applied yet,
+	 * support parallel block processing
+	 *
+	 * @param all_preprocessors whether to check all preprocessors
+	 * @return whether blocks can be preprocessed in parallel
+	 */
+	bool supports_parallel_preprocessing(bool all_preprocessors) const;
+
+	/** get a block of vectors preprocessed on the fly, from the cache if
+	 * possible
+	 *
+	 * @param block index of the block in the feature matrix
+	 * @param lock whether to lock the block in the cache, it has to be
+	 * unlocked again then
+	 * @return preprocessed vectors of the block
+	 */
+	SGMatrix<ST> get_preprocessed_block(int32_t block, bool lock=false) const;
+
+	/** apply the preprocessors to the feature matrix in parallel blocks,
+	 * every block passes the whole chain of preprocessors at once
+	 *
+	 * @param force_preprocessing whether to apply all preprocessors
+	 * @return if applying was successful
+	 */
+	bool apply_preprocessor_pipeline(bool force_preprocessing);
+
+	/** resize and clear the cache of vectors preprocessed on the fly */
+	void reset_preprocessed_cache();
+
+	/** called by get_feature_vector() with the index of every vector
+	 * served from the feature matrix if m_notify_access is set, e.g. for
+	 * readahead of a matrix which is backed by a file
+	 *
+	 * @param real_num index of the vector in the feature matrix
+	 */
+	virtual void on_feature_vector_access(int32_t real_num) { }
+
 private:
 	void init();
 
@@ -555,6 +676,21 @@ protected:
 
 	/** feature cache */
 	CCache<ST>* feature_cache;
+
+	/** preprocess on-the-fly? */
+	bool preprocess_on_get;
+
+	/** number of vectors which are preprocessed together */
+	int32_t m_preprocessing_block_size;
+
+	/** blocks of vectors preprocessed on the fly */
+	mutable CBlockCache<ST> m_preprocessed_cache;
+
+	/** serializes preprocessors which do not support parallel blocks */
+	mutable CLock m_preprocessing_lock;
+
+	/** whether on_feature_vector_access() is called */
+	bool m_notify_access;
 };
 }
 #endif // _DENSEFEATURES__H__
@@ -0,0 +1,379 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <shogun/features/FastfoodDotFeatures.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/RandomStream.h>
+
+#include <math.h>
+#ifdef __AVX__
+#include <immintrin.h>
+#endif
+
+/* FFHT defines its functions in the header, internal linkage keeps them
+ * from clashing with the copy compiled into the LSH code of CKNN. Only the
+ * double precision transform is used, so the unused ones are not warned on */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+namespace
+{
+#include <shogun/lib/external/falconn/ffht/fht_header_only.h>
+}
+#pragma GCC diagnostic pop
+
+#include <typeinfo>
+
+using namespace shogun;
+
+/* the AVX transform works on 32 byte aligned buffers */
+#define FASTFOOD_ALIGNMENT 32
+
+CFastfoodDotFeatures::CFastfoodDotFeatures()
+: CDotFeatures()
+{
+	init(NULL, 0, 1.0);
+}
+
+CFastfoodDotFeatures::CFastfoodDotFeatures(CDotFeatures* features, int32_t D,
+		float64_t width)
+: CDotFeatures()
+{
+	REQUIRE(features, "No features provided\n")
+	REQUIRE(D>0, "Number of random features (%d) has to be positive\n", D)
+	REQUIRE(width>0, "Kernel width (%f) has to be positive\n", width)
+
+	init(features, D, width);
+
+	/* FFHT handles transforms of at least 8 elements */
+	m_padded_dim=8;
+	while (m_padded_dim<feats->get_dim_feature_space())
+		m_padded_dim*=2;
+	m_num_blocks=(num_samples+m_padded_dim-1)/m_padded_dim;
+
+	generate_random_parameters();
+}
+
+CFastfoodDotFeatures::CFastfoodDotFeatures(const CFastfoodDotFeatures& orig)
+: CDotFeatures(orig)
+{
+	init(orig.feats, orig.num_samples, orig.m_width);
+
+	m_padded_dim=orig.m_padded_dim;
+	m_num_blocks=orig.m_num_blocks;
+	m_signs=orig.m_signs;
+	m_permutation=orig.m_permutation;
+	m_gaussian=orig.m_gaussian;
+	m_scaling=orig.m_scaling;
+	m_phase=orig.m_phase;
+
+	set_materialization_cache(orig.m_materialization_block_size,
+			orig.m_materialization_budget);
+}
+
+CFeatures* CFastfoodDotFeatures::duplicate() const
+{
+	return new CFastfoodDotFeatures(*this);
+}
+
+CFastfoodDotFeatures::~CFastfoodDotFeatures()
+{
+	SG_UNREF(feats);
+}
+
+void CFastfoodDotFeatures::init(CDotFeatures* features, int32_t D,
+		float64_t width)
+{
+	feats=features;
+	SG_REF(feats);
+
+	num_samples=D;
+	m_width=width;
+	m_padded_dim=0;
+	m_num_blocks=0;
+	m_materialization_block_size=0;
+	m_materialization_budget=0;
+
+	SG_ADD((CSGObject**) &feats, "feats", "Features to work on",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&num_samples, "num_samples", "Number of random features",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_width, "width", "Width of the gaussian kernel",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_padded_dim, "padded_dim", "Padded input dimension",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_num_blocks, "num_blocks", "Number of Hadamard blocks",
+			MS_NOT_AVAILABLE);
+	m_parameters->add(&m_signs, "signs", "Random signs");
+	m_parameters->add(&m_permutation, "permutation", "Random permutations");
+	m_parameters->add(&m_gaussian, "gaussian", "Gaussian diagonals");
+	m_parameters->add(&m_scaling, "scaling", "Scaling diagonals");
+	m_parameters->add(&m_phase, "phase", "Random phases");
+	SG_ADD(&m_materialization_block_size, "materialization_block_size",
+			"Number of vectors in a cached block", MS_NOT_AVAILABLE);
+	SG_ADD(&m_materialization_budget, "materialization_budget",
+			"Maximal bytes of cached blocks", MS_NOT_AVAILABLE);
+}
+
+void CFastfoodDotFeatures::generate_random_parameters()
+{
+	const int32_t n=m_padded_dim;
+	const int64_t size=int64_t(m_num_blocks)*n;
+
+	m_signs=SGVector<float64_t>(size);
+	m_permutation=SGVector<index_t>(size);
+	m_gaussian=SGVector<float64_t>(size);
+	m_scaling=SGVector<float64_t>(size);
+	m_phase=SGVector<float64_t>(num_samples);
+
+	/* the transforms are orthonormal, so sqrt(n)/sigma goes into the
+	 * scaling, where sigma=sqrt(width/2) is the standard deviation of the
+	 * kernel's spectral density */
+	const float64_t factor=CMath::sqrt(2.0*n/m_width);
+	const uint64_t seed=CMath::random();
+
+#pragma omp parallel for
+	for (int32_t b=0; b<m_num_blocks; b++)
+	{
+		RandomStream rng(seed, b);
+		float64_t* signs=m_signs.vector+int64_t(b)*n;
+		index_t* permutation=m_permutation.vector+int64_t(b)*n;
+		float64_t* gaussian=m_gaussian.vector+int64_t(b)*n;
+		float64_t* scaling=m_scaling.vector+int64_t(b)*n;
+
+		for (int32_t i=0; i<n; i++)
+		{
+			signs[i]=(rng.random_32() & 1) ? 1.0 : -1.0;
+			permutation[i]=i;
+		}
+		rng.permute(permutation, n);
+
+		rng.fill_normal(gaussian, n);
+		float64_t gaussian_norm=0;
+		for (int32_t i=0; i<n; i++)
+			gaussian_norm+=CMath::sq(gaussian[i]);
+		gaussian_norm=CMath::sqrt(gaussian_norm);
+
+		/* the row lengths of a gaussian matrix are chi distributed with n
+		 * degrees of freedom */
+		float64_t* chi=SG_MALLOC(float64_t, n);
+		for (int32_t i=0; i<n; i++)
+		{
+			rng.fill_normal(chi, n);
+			float64_t length=0;
+			for (int32_t j=0; j<n; j++)
+				length+=CMath::sq(chi[j]);
+			scaling[i]=factor*CMath::sqrt(length)/gaussian_norm;
+		}
+		SG_FREE(chi);
+
+		const int32_t first=b*n;
+		const int32_t count=CMath::min(n, num_samples-first);
+		rng.fill_uniform(m_phase.vector+first, count, 0, 2*CMath::PI);
+	}
+
+	m_materialization_cache.clear();
+}
+
+void CFastfoodDotFeatures::compute_features(int32_t num, float64_t* result)
+{
+	const int32_t n=m_padded_dim;
+	SGVector<float64_t> x=feats->get_computed_dot_feature_vector(num);
+	const float64_t constant=CMath::sqrt(2.0/num_samples);
+
+	float64_t* memory=SG_MALLOC(float64_t, 2*n+FASTFOOD_ALIGNMENT/sizeof(float64_t));
+	float64_t* input=(float64_t*) (((uintptr_t) memory+FASTFOOD_ALIGNMENT-1) &
+			~uintptr_t(FASTFOOD_ALIGNMENT-1));
+	float64_t* projection=input+n;
+
+	for (int32_t b=0; b<m_num_blocks; b++)
+	{
+		const int64_t offset=int64_t(b)*n;
+		const float64_t* signs=m_signs.vector+offset;
+		const index_t* permutation=m_permutation.vector+offset;
+		const float64_t* gaussian=m_gaussian.vector+offset;
+		const float64_t* scaling=m_scaling.vector+offset;
+
+		/* H B x */
+		for (int32_t i=0; i<x.vlen; i++)
+			input[i]=signs[i]*x[i];
+		for (int32_t i=x.vlen; i<n; i++)
+			input[i]=0;
+		FHTDouble(input, n, n);
+
+		/* H G Pi H B x */
+		for (int32_t i=0; i<n; i++)
+			projection[i]=gaussian[i]*input[permutation[i]];
+		FHTDouble(projection, n, n);
+
+		const int32_t first=b*n;
+		const int32_t count=CMath::min(n, num_samples-first);
+		for (int32_t i=0; i<count; i++)
+		{
+			result[first+i]=constant*
+				CMath::cos(scaling[i]*projection[i]+m_phase[first+i]);
+		}
+	}
+
+	SG_FREE(memory);
+}
+
+void CFastfoodDotFeatures::set_materialization_cache(int32_t block_size,
+		int64_t memory_budget)
+{
+	REQUIRE(block_size>=0, "Block size (%d) has to be non-negative\n",
+			block_size)
+	REQUIRE(memory_budget>=0, "Memory budget (%ld) has to be non-negative\n",
+			memory_budget)
+
+	m_materialization_block_size=block_size;
+	m_materialization_budget=memory_budget;
+
+	if (!block_size || !feats)
+	{
+		m_materialization_cache.resize(0);
+		return;
+	}
+
+	const int32_t num_vectors=get_num_vectors();
+	const int32_t num_blocks=(num_vectors+block_size-1)/block_size;
+
+	int32_t capacity=0;
+	if (memory_budget>0)
+	{
+		const int64_t block_bytes=int64_t(block_size)*num_samples*sizeof(float64_t);
+		capacity=int32_t(CMath::max(int64_t(1), memory_budget/block_bytes));
+	}
+
+	m_materialization_cache.resize(num_blocks, capacity);
+}
+
+int32_t CFastfoodDotFeatures::get_materialization_block_size() const
+{
+	return m_materialization_block_size;
+}
+
+const float64_t* CFastfoodDotFeatures::get_features(int32_t num,
+		float64_t* buffer, SGMatrix<float64_t>& block)
+{
+	if (!m_materialization_block_size)
+	{
+		compute_features(num, buffer);
+		return buffer;
+	}
+
+	const int32_t block_size=m_materialization_block_size;
+	const int32_t b=num/block_size;
+
+	block=m_materialization_cache.get_block(b);
+	if (!block.matrix)
+	{
+		const int32_t first=b*block_size;
+		const int32_t count=CMath::min(block_size, get_num_vectors()-first);
+
+		SGMatrix<float64_t> features(num_samples, count);
+		for (int32_t i=0; i<count; i++)
+			compute_features(first+i, features.get_column_vector(i));
+
+		block=m_materialization_cache.set_block(b, features);
+	}
+
+	return block.get_column_vector(num%block_size);
+}
+
+int32_t CFastfoodDotFeatures::get_dim_feature_space() const
+{
+	return num_samples;
+}
+
+float64_t CFastfoodDotFeatures::dot(int32_t vec_idx1, CDotFeatures* df,
+		int32_t vec_idx2)
+{
+	ASSERT(typeid(*this) == typeid(*df));
+	CFastfoodDotFeatures* other=(CFastfoodDotFeatures*) df;
+	ASSERT(get_dim_feature_space()==other->get_dim_feature_space());
+
+	SGVector<float64_t> buffer1(num_samples);
+	SGVector<float64_t> buffer2(num_samples);
+	SGMatrix<float64_t> block1;
+	SGMatrix<float64_t> block2;
+
+	const float64_t* vec1=get_features(vec_idx1, buffer1.vector, block1);
+	const float64_t* vec2=other->get_features(vec_idx2, buffer2.vector, block2);
+
+	return CMath::dot(vec1, vec2, num_samples);
+}
+
+float64_t CFastfoodDotFeatures::dense_dot(int32_t vec_idx1,
+		const float64_t* vec2, int32_t vec2_len)
+{
+	ASSERT(vec2_len == get_dim_feature_space());
+
+	SGVector<float64_t> buffer(num_samples);
+	SGMatrix<float64_t> block;
+	const float64_t* vec1=get_features(vec_idx1, buffer.vector, block);
+
+	return CMath::dot(vec1, vec2, num_samples);
+}
+
+void CFastfoodDotFeatures::add_to_dense_vec(float64_t alpha,
+		int32_t vec_idx1, float64_t* vec2, int32_t vec2_len, bool abs_val)
+{
+	ASSERT(vec2_len == get_dim_feature_space());
+
+	SGVector<float64_t> buffer(num_samples);
+	SGMatrix<float64_t> block;
+	const float64_t* vec1=get_features(vec_idx1, buffer.vector, block);
+
+	if (abs_val)
+	{
+		for (int32_t i=0; i<num_samples; i++)
+			vec2[i]+=CMath::abs(alpha*vec1[i]);
+	}
+	else
+	{
+		for (int32_t i=0; i<num_samples; i++)
+			vec2[i]+=alpha*vec1[i];
+	}
+}
+
+int32_t CFastfoodDotFeatures::get_nnz_features_for_vector(int32_t num)
+{
+	return num_samples;
+}
+
+void* CFastfoodDotFeatures::get_feature_iterator(int32_t vector_index)
+{
+	SG_NOTIMPLEMENTED;
+	return NULL;
+}
+
+bool CFastfoodDotFeatures::get_next_feature(int32_t& index, float64_t& value,
+		void* iterator)
+{
+	SG_NOTIMPLEMENTED;
+	return false;
+}
+
+void CFastfoodDotFeatures::free_feature_iterator(void* iterator)
+{
+	SG_NOTIMPLEMENTED;
+}
+
+EFeatureType CFastfoodDotFeatures::get_feature_type() const
+{
+	return F_DREAL;
+}
+
+EFeatureClass CFastfoodDotFeatures::get_feature_class() const
+{
+	return C_DENSE;
+}
+
+int32_t CFastfoodDotFeatures::get_num_vectors() const
+{
+	return feats ? feats->get_num_vectors() : 0;
+}
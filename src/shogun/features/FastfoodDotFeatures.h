@@ -0,0 +1,211 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef _FASTFOOD_DOTFEATURES__H__
+#define _FASTFOOD_DOTFEATURES__H__
+
+#include <shogun/lib/config.h>
+
+#include <shogun/features/DotFeatures.h>
+#include <shogun/lib/BlockCache.h>
+
+namespace shogun
+{
+
+/** @brief Fastfood approximation of random fourier features for the
+ * gaussian kernel \f$k(x,y)=\exp(-\|x-y\|^2/\tau)\f$.
+ *
+ * Instead of a dense matrix of gaussian coefficients as in
+ * CRandomFourierDotFeatures, the input is zero padded to the next power of
+ * two \f$n\f$ and the random projection is composed of \f$D/n\f$ blocks
+ * \f[ V = \frac{1}{\sigma\sqrt{n}} S H G \Pi H B, \f]
+ * where \f$H\f$ is the Walsh-Hadamard matrix, \f$B\f$ a diagonal matrix of
+ * random signs, \f$\Pi\f$ a random permutation, \f$G\f$ a diagonal gaussian
+ * matrix and \f$S\f$ a diagonal scaling which gives the rows the length
+ * distribution of gaussian vectors. The features are
+ * \f$z(x) = \sqrt{2/D}\cos(Vx + b)\f$.
+ *
+ * The products with \f$H\f$ use the fast Hadamard transform of FFHT, so all
+ * \f$D\f$ features of a vector are computed in \f$O(D\log n)\f$ time from
+ * \f$O(D)\f$ parameters, whereas the dense coefficients need \f$O(Dn)\f$
+ * for both.
+ *
+ * Optionally, the features of blocks of consecutive vectors are kept in a
+ * cache bounded by a memory budget, which pays off when the vectors are
+ * accessed repeatedly, e.g. by iterative solvers.
+ *
+ * For more details, see
+ * Le, Q., Sarlos, T. and Smola, A. (2013). Fastfood - Approximating Kernel
+ * Expansions in Loglinear Time. ICML.
+ */
+class CFastfoodDotFeatures : public CDotFeatures
+{
+public:
+	/** default constructor */
+	CFastfoodDotFeatures();
+
+	/** constructor that draws new random parameters
+	 *
+	 * @param features the features to use as a base
+	 * @param D dimensionality of the new feature space
+	 * @param width width of the gaussian kernel to approximate
+	 */
+	CFastfoodDotFeatures(CDotFeatures* features, int32_t D, float64_t width);
+
+	/** copy constructor, shares the random parameters */
+	CFastfoodDotFeatures(const CFastfoodDotFeatures& orig);
+
+	/** duplicate */
+	virtual CFeatures* duplicate() const;
+
+	/** destructor */
+	virtual ~CFastfoodDotFeatures();
+
+	/** obtain the dimensionality of the feature space
+	 *
+	 * @return dimensionality
+	 */
+	virtual int32_t get_dim_feature_space() const;
+
+	/** compute dot product between vector1 and vector2,
+	 * appointed by their indices
+	 *
+	 * @param vec_idx1 index of first vector
+	 * @param df DotFeatures (of same kind) to compute dot product with
+	 * @param vec_idx2 index of second vector
+	 */
+	virtual float64_t dot(int32_t vec_idx1, CDotFeatures* df,
+			int32_t vec_idx2);
+
+	/** compute dot product between vector1 and a dense vector
+	 *
+	 * @param vec_idx1 index of first vector
+	 * @param vec2 pointer to real valued vector
+	 * @param vec2_len length of real valued vector
+	 */
+	virtual float64_t dense_dot(int32_t vec_idx1, const float64_t* vec2,
+			int32_t vec2_len);
+
+	/** add vector 1 multiplied with alpha to dense vector2
+	 *
+	 * @param alpha scalar alpha
+	 * @param vec_idx1 index of first vector
+	 * @param vec2 pointer to real valued vector
+	 * @param vec2_len length of real valued vector
+	 * @param abs_val if true add the absolute value
+	 */
+	virtual void add_to_dense_vec(float64_t alpha, int32_t vec_idx1,
+			float64_t* vec2, int32_t vec2_len, bool abs_val = false);
+
+	/** get number of non-zero features in vector
+	 *
+	 * @param num which vector
+	 * @return number of non-zero features in vector
+	 */
+	virtual int32_t get_nnz_features_for_vector(int32_t num);
+
+	/** not implemented */
+	virtual void* get_feature_iterator(int32_t vector_index);
+
+	/** not implemented */
+	virtual bool get_next_feature(int32_t& index, float64_t& value,
+			void* iterator);
+
+	/** not implemented */
+	virtual void free_feature_iterator(void* iterator);
+
+	/** @return feature type F_DREAL */
+	virtual EFeatureType get_feature_type() const;
+
+	/** @return feature class C_DENSE */
+	virtual EFeatureClass get_feature_class() const;
+
+	/** @return number of feature vectors */
+	virtual int32_t get_num_vectors() const;
+
+	/** compute all features of a vector
+	 *
+	 * @param num index of the vector
+	 * @param result memory for get_dim_feature_space() features
+	 */
+	void compute_features(int32_t num, float64_t* result);
+
+	/** cache the features of blocks of consecutive vectors
+	 *
+	 * @param block_size number of vectors in a block, disables the cache if 0
+	 * @param memory_budget maximal bytes of cached blocks, unlimited if 0
+	 */
+	void set_materialization_cache(int32_t block_size,
+			int64_t memory_budget=0);
+
+	/** @return number of vectors in a cached block, 0 if disabled */
+	int32_t get_materialization_block_size() const;
+
+	/** @return object name */
+	virtual const char* get_name() const { return "FastfoodDotFeatures"; }
+
+protected:
+	/** draw the random parameters of all blocks, every block from its own
+	 * random stream */
+	void generate_random_parameters();
+
+	/** get the features of a vector, from the cache if enabled
+	 *
+	 * @param num index of the vector
+	 * @param buffer memory for the features if they are computed
+	 * @param block keeps the cached block alive while it is used
+	 * @return the features, either buffer or a column of a cached block
+	 */
+	const float64_t* get_features(int32_t num, float64_t* buffer,
+			SGMatrix<float64_t>& block);
+
+private:
+	void init(CDotFeatures* features, int32_t D, float64_t width);
+
+protected:
+	/** the features to work on */
+	CDotFeatures* feats;
+
+	/** dimensionality of the new feature space */
+	int32_t num_samples;
+
+	/** width of the gaussian kernel */
+	float64_t m_width;
+
+	/** input dimension padded to a power of two */
+	int32_t m_padded_dim;
+
+	/** number of Hadamard blocks */
+	int32_t m_num_blocks;
+
+	/** random signs B of all blocks */
+	SGVector<float64_t> m_signs;
+
+	/** random permutations Pi of all blocks */
+	SGVector<index_t> m_permutation;
+
+	/** gaussian diagonals G of all blocks */
+	SGVector<float64_t> m_gaussian;
+
+	/** scaling diagonals S of all blocks, including the kernel width */
+	SGVector<float64_t> m_scaling;
+
+	/** random phases b */
+	SGVector<float64_t> m_phase;
+
+	/** number of vectors in a cached block, 0 if disabled */
+	int32_t m_materialization_block_size;
+
+	/** maximal bytes of cached blocks, unlimited if 0 */
+	int64_t m_materialization_budget;
+
+	/** cached blocks of features */
+	CBlockCache<float64_t> m_materialization_cache;
+};
+}
+
+#endif // _FASTFOOD_DOTFEATURES__H__
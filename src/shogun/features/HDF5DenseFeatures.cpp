@@ -0,0 +1,175 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <shogun/features/HDF5DenseFeatures.h>
+
+#ifdef HAVE_HDF5
+#include <shogun/io/HDF5File.h>
+#include <shogun/mathematics/Math.h>
+
+#include <string.h>
+
+namespace shogun
+{
+
+template <class ST> CHDF5DenseFeatures<ST>::CHDF5DenseFeatures()
+: CDenseFeatures<ST>()
+{
+	init();
+}
+
+template <class ST> CHDF5DenseFeatures<ST>::CHDF5DenseFeatures(
+		const char* fname, const char* name)
+: CDenseFeatures<ST>()
+{
+	init();
+
+	m_file=new CHDF5File(const_cast<char*>(fname), 'r', name);
+	SG_REF(m_file);
+
+	int32_t num_feat=0;
+	int32_t num_vec=0;
+	m_file->get_matrix_dims(num_feat, num_vec);
+
+	REQUIRE(num_feat>0, "Matrix %s in %s has no features\n", name, fname)
+	SG_SINFO("found %d vectors of dimension %d\n", num_vec, num_feat)
+
+	this->num_features=num_feat;
+	this->num_vectors=num_vec;
+
+	set_block_size(CMath::max(int64_t(1),
+			int64_t(4*1024*1024/(int64_t(num_feat)*sizeof(ST)))));
+}
+
+template <class ST> CHDF5DenseFeatures<ST>::CHDF5DenseFeatures(
+		const CHDF5DenseFeatures& orig)
+: CDenseFeatures<ST>(orig)
+{
+	init();
+
+	m_file=orig.m_file;
+	SG_REF(m_file);
+
+	this->num_features=orig.num_features;
+	this->num_vectors=orig.num_vectors;
+	m_memory_budget=orig.m_memory_budget;
+	set_block_size(orig.m_block_size);
+}
+
+template <class ST> CHDF5DenseFeatures<ST>::~CHDF5DenseFeatures()
+{
+	SG_UNREF(m_file);
+}
+
+template <class ST> CFeatures* CHDF5DenseFeatures<ST>::duplicate() const
+{
+	return new CHDF5DenseFeatures<ST>(*this);
+}
+
+template <class ST> void CHDF5DenseFeatures<ST>::set_block_size(int32_t num_vec)
+{
+	REQUIRE(num_vec>0, "Block size (%d) has to be positive\n", num_vec)
+
+	m_block_size=num_vec;
+	reset_block_cache();
+}
+
+template <class ST> int32_t CHDF5DenseFeatures<ST>::get_block_size() const
+{
+	return m_block_size;
+}
+
+template <class ST> void CHDF5DenseFeatures<ST>::set_memory_budget(int64_t bytes)
+{
+	REQUIRE(bytes>=0, "Memory budget (%ld) has to be non-negative\n", bytes)
+
+	m_memory_budget=bytes;
+	reset_block_cache();
+}
+
+template <class ST> int64_t CHDF5DenseFeatures<ST>::get_memory_budget() const
+{
+	return m_memory_budget;
+}
+
+template <class ST> void CHDF5DenseFeatures<ST>::reset_block_cache()
+{
+	const int32_t num_blocks=(this->num_vectors+m_block_size-1)/m_block_size;
+
+	int32_t capacity=0;
+	if (m_memory_budget>0)
+	{
+		const int64_t block_bytes=int64_t(m_block_size)*this->num_features*sizeof(ST);
+		capacity=int32_t(CMath::max(int64_t(1), m_memory_budget/block_bytes));
+	}
+
+	/* with a budget, a single shard evicts strictly in the order the
+	 * blocks were read */
+	m_block_cache.resize(num_blocks, capacity, capacity ? 1 : 16);
+}
+
+template <class ST> SGMatrix<ST> CHDF5DenseFeatures<ST>::read_block(int32_t block)
+{
+	const int32_t first_vec=block*m_block_size;
+	const int32_t num_vec=CMath::min(m_block_size, this->num_vectors-first_vec);
+
+	SGMatrix<ST> result(this->num_features, num_vec);
+
+	m_file_lock.lock();
+	m_file->get_matrix_block(result.matrix, first_vec, num_vec);
+	m_file_lock.unlock();
+
+	return result;
+}
+
+template <class ST> ST* CHDF5DenseFeatures<ST>::compute_feature_vector(
+		int32_t num, int32_t& len, ST* target)
+{
+	REQUIRE(m_file, "No file to read features from\n")
+
+	const int32_t real_num=this->m_subset_stack->subset_idx_conversion(num);
+	const int32_t b=real_num/m_block_size;
+
+	SGMatrix<ST> block=m_block_cache.get_block(b);
+	if (!block.matrix)
+		block=m_block_cache.set_block(b, read_block(b));
+
+	len=this->num_features;
+	if (!target)
+		target=SG_MALLOC(ST, len);
+
+	memcpy(target, block.get_column_vector(real_num%m_block_size), sizeof(ST)*len);
+	return target;
+}
+
+template <class ST> void CHDF5DenseFeatures<ST>::init()
+{
+	m_file=NULL;
+	m_block_size=1;
+	m_memory_budget=0;
+
+	this->m_parameters->add(&m_block_size, "block_size",
+			"Number of vectors read together");
+	this->m_parameters->add(&m_memory_budget, "memory_budget",
+			"Maximal bytes of cached blocks");
+}
+
+/* CHDF5File reads the types below */
+template class CHDF5DenseFeatures<bool>;
+template class CHDF5DenseFeatures<char>;
+template class CHDF5DenseFeatures<uint8_t>;
+template class CHDF5DenseFeatures<int16_t>;
+template class CHDF5DenseFeatures<uint16_t>;
+template class CHDF5DenseFeatures<int32_t>;
+template class CHDF5DenseFeatures<uint32_t>;
+template class CHDF5DenseFeatures<int64_t>;
+template class CHDF5DenseFeatures<uint64_t>;
+template class CHDF5DenseFeatures<float32_t>;
+template class CHDF5DenseFeatures<float64_t>;
+template class CHDF5DenseFeatures<floatmax_t>;
+}
+#endif // HAVE_HDF5
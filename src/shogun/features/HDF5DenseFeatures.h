@@ -0,0 +1,127 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef _HDF5DENSEFEATURES__H__
+#define _HDF5DENSEFEATURES__H__
+
+#include <shogun/lib/config.h>
+
+#ifdef HAVE_HDF5
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/lib/BlockCache.h>
+#include <shogun/lib/Lock.h>
+
+namespace shogun
+{
+class CHDF5File;
+
+#define IGNORE_IN_CLASSLIST
+
+/** @brief Dense features read block-wise from a matrix in a HDF5 file.
+ *
+ * The feature matrix is not loaded. Instead, blocks of get_block_size()
+ * consecutive feature vectors are read with hyperslab selections when one
+ * of their vectors is requested, and are cached. With a memory budget, the
+ * oldest blocks are dropped from the cache once the budget is exceeded.
+ * The blocks are read in the order the vectors are accessed, so sequential
+ * passes over the data, as done by most linear and online methods, read
+ * every block only once.
+ *
+ * get_feature_matrix() is not available for these features, and as the
+ * HDF5 file does not read int8 matrices, neither is ST=int8_t.
+ */
+IGNORE_IN_CLASSLIST template <class ST> class CHDF5DenseFeatures : public CDenseFeatures<ST>
+{
+	public:
+	/** default constructor */
+	CHDF5DenseFeatures();
+
+	/** constructor
+	 *
+	 * @param fname name of the HDF5 file
+	 * @param name name of the matrix in the file
+	 */
+	CHDF5DenseFeatures(const char* fname, const char* name);
+
+	/** copy constructor, shares the file and the cached blocks are not
+	 * copied */
+	CHDF5DenseFeatures(const CHDF5DenseFeatures& orig);
+
+	/** destructor */
+	virtual ~CHDF5DenseFeatures();
+
+	/** duplicate feature object, shares the file
+	 *
+	 * @return feature object
+	 */
+	virtual CFeatures* duplicate() const;
+
+	/** set the number of vectors which are read together
+	 *
+	 * @param num_vec number of vectors in a block
+	 */
+	void set_block_size(int32_t num_vec);
+
+	/** @return number of vectors which are read together */
+	int32_t get_block_size() const;
+
+	/** set the maximal amount of cached blocks
+	 *
+	 * @param bytes budget in bytes, unlimited if 0
+	 */
+	void set_memory_budget(int64_t bytes);
+
+	/** @return maximal amount of cached blocks */
+	int64_t get_memory_budget() const;
+
+	/** @return object name */
+	virtual const char* get_name() const { return "HDF5DenseFeatures"; }
+
+	protected:
+	/** copy a feature vector from its (cached) block
+	 *
+	 * @param num index of the vector
+	 * @param len dimension of the vector (returned by reference)
+	 * @param target memory for the vector, allocated if NULL
+	 * @return feature vector
+	 */
+	virtual ST* compute_feature_vector(int32_t num, int32_t& len,
+			ST* target=NULL);
+
+	/** read a block of feature vectors from the file
+	 *
+	 * @param block index of the block
+	 * @return the block
+	 */
+	SGMatrix<ST> read_block(int32_t block);
+
+	/** reallocate the block cache */
+	void reset_block_cache();
+
+	private:
+	/** initialize members */
+	void init();
+
+	protected:
+	/** HDF5 file */
+	CHDF5File* m_file;
+
+	/** number of vectors in a block */
+	int32_t m_block_size;
+
+	/** maximal number of bytes of cached blocks, unlimited if 0 */
+	int64_t m_memory_budget;
+
+	/** cached blocks */
+	CBlockCache<ST> m_block_cache;
+
+	/** serializes the reads, the HDF5 library is not thread-safe */
+	CLock m_file_lock;
+};
+}
+#endif // HAVE_HDF5
+#endif // _HDF5DENSEFEATURES__H__
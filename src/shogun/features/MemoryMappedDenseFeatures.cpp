@@ -0,0 +1,212 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <shogun/features/MemoryMappedDenseFeatures.h>
+#include <shogun/mathematics/Math.h>
+
+#include <limits>
+
+namespace shogun
+{
+
+template <class ST> CMemoryMappedDenseFeatures<ST>::CMemoryMappedDenseFeatures()
+: CDenseFeatures<ST>()
+{
+	init();
+}
+
+template <class ST> CMemoryMappedDenseFeatures<ST>::CMemoryMappedDenseFeatures(
+		const char* fname, int32_t num_feat, int64_t offset)
+: CDenseFeatures<ST>()
+{
+	init();
+
+	REQUIRE(num_feat>0, "Number of features (%d) has to be positive\n", num_feat)
+	REQUIRE(offset>=0 && offset%sizeof(ST)==0, "Offset (%ld) has to be a "
+			"multiple of the size of the feature type (%d)\n", offset, sizeof(ST))
+
+	/* copy-on-write, so preprocessors may work on the matrix in place
+	 * without modifying the file */
+	m_file=new CMemoryMappedFile<ST>(fname, 'c');
+	SG_REF(m_file);
+	m_offset=offset;
+
+	REQUIRE(m_file->get_size()>=uint64_t(offset), "File %s is smaller than "
+			"the offset (%ld bytes)\n", fname, offset)
+
+	const int64_t vector_bytes=int64_t(num_feat)*sizeof(ST);
+	const int64_t num_vec=(m_file->get_size()-offset)/vector_bytes;
+
+	REQUIRE(int64_t(m_file->get_size()-offset)==num_vec*vector_bytes,
+			"Size of file %s (%ld bytes without offset) is not a multiple of "
+			"the size of a feature vector (%ld bytes)\n", fname,
+			m_file->get_size()-offset, vector_bytes)
+	REQUIRE(num_vec<=std::numeric_limits<int32_t>::max(), "File %s contains "
+			"%ld vectors, at most %d are supported\n", fname, num_vec,
+			std::numeric_limits<int32_t>::max())
+
+	SG_SINFO("mapped %ld vectors of dimension %d\n", num_vec, num_feat)
+
+	ST* matrix=(ST*) ((char*) m_file->get_map()+offset);
+	CDenseFeatures<ST>::set_feature_matrix(SGMatrix<ST>(matrix, num_feat, num_vec, false));
+
+	m_file->advise_sequential();
+	set_readahead(CMath::max(int64_t(1), int64_t(16*1024*1024)/vector_bytes));
+}
+
+template <class ST> CMemoryMappedDenseFeatures<ST>::CMemoryMappedDenseFeatures(
+		const CMemoryMappedDenseFeatures& orig)
+: CDenseFeatures<ST>(orig)
+{
+	init();
+
+	m_file=orig.m_file;
+	SG_REF(m_file);
+	m_offset=orig.m_offset;
+	m_memory_budget=orig.m_memory_budget;
+	set_readahead(orig.m_readahead);
+}
+
+template <class ST> CMemoryMappedDenseFeatures<ST>::~CMemoryMappedDenseFeatures()
+{
+	/* the matrix must not outlive the mapping */
+	CDenseFeatures<ST>::free_feature_matrix();
+	SG_FREE(m_resident_chunks);
+	SG_UNREF(m_file);
+}
+
+template <class ST> CFeatures* CMemoryMappedDenseFeatures<ST>::duplicate() const
+{
+	return new CMemoryMappedDenseFeatures<ST>(*this);
+}
+
+template <class ST> CFeatures* CMemoryMappedDenseFeatures<ST>::shallow_subset_copy()
+{
+	CMemoryMappedDenseFeatures<ST>* shallow_copy_features=
+		new CMemoryMappedDenseFeatures<ST>(*this);
+	SG_REF(shallow_copy_features);
+
+	return shallow_copy_features;
+}
+
+template <class ST> void CMemoryMappedDenseFeatures<ST>::set_readahead(int32_t num_vec)
+{
+	REQUIRE(num_vec>0, "Readahead (%d) has to be positive\n", num_vec)
+
+	m_readahead=num_vec;
+	reset_chunks();
+}
+
+template <class ST> int32_t CMemoryMappedDenseFeatures<ST>::get_readahead() const
+{
+	return m_readahead;
+}
+
+template <class ST> void CMemoryMappedDenseFeatures<ST>::set_memory_budget(int64_t bytes)
+{
+	REQUIRE(bytes>=0, "Memory budget (%ld) has to be non-negative\n", bytes)
+
+	m_memory_budget=bytes;
+	reset_chunks();
+}
+
+template <class ST> int64_t CMemoryMappedDenseFeatures<ST>::get_memory_budget() const
+{
+	return m_memory_budget;
+}
+
+template <class ST> int64_t CMemoryMappedDenseFeatures<ST>::get_chunk_bytes() const
+{
+	return int64_t(m_readahead)*this->num_features*sizeof(ST);
+}
+
+template <class ST> void CMemoryMappedDenseFeatures<ST>::reset_chunks()
+{
+	m_chunk_lock.lock();
+
+	SG_FREE(m_resident_chunks);
+	m_resident_chunks=NULL;
+	m_max_resident=0;
+	m_num_resident=0;
+	m_next_release=0;
+	m_last_chunk=-1;
+
+	if (m_file && m_memory_budget>0)
+	{
+		/* the chunk which is read ahead counts as well */
+		m_max_resident=CMath::max(int64_t(1), m_memory_budget/get_chunk_bytes()-1);
+		m_resident_chunks=SG_MALLOC(int32_t, m_max_resident);
+	}
+
+	this->m_notify_access=(m_file!=NULL);
+
+	m_chunk_lock.unlock();
+}
+
+template <class ST> void CMemoryMappedDenseFeatures<ST>::on_feature_vector_access(int32_t real_num)
+{
+	const int32_t chunk=real_num/m_readahead;
+
+	/* vectors of the current chunk do not need any bookkeeping */
+	m_chunk_lock.lock();
+	if (chunk!=m_last_chunk)
+	{
+		m_last_chunk=chunk;
+
+		const int64_t chunk_bytes=get_chunk_bytes();
+		m_file->prefetch(m_offset+(chunk+1)*chunk_bytes, chunk_bytes);
+
+		if (m_resident_chunks)
+		{
+			if (m_num_resident==m_max_resident)
+			{
+				int32_t oldest=m_resident_chunks[m_next_release];
+				if (oldest!=chunk && oldest!=chunk+1)
+					m_file->release(m_offset+oldest*chunk_bytes, chunk_bytes);
+
+				m_resident_chunks[m_next_release]=chunk;
+				m_next_release=(m_next_release+1)%m_max_resident;
+			}
+			else
+				m_resident_chunks[m_num_resident++]=chunk;
+		}
+	}
+	m_chunk_lock.unlock();
+}
+
+template <class ST> void CMemoryMappedDenseFeatures<ST>::init()
+{
+	m_file=NULL;
+	m_offset=0;
+	m_readahead=1;
+	m_memory_budget=0;
+	m_last_chunk=-1;
+	m_resident_chunks=NULL;
+	m_max_resident=0;
+	m_num_resident=0;
+	m_next_release=0;
+
+	this->m_parameters->add(&m_readahead, "readahead",
+			"Number of vectors read ahead together");
+	this->m_parameters->add(&m_memory_budget, "memory_budget",
+			"Maximal bytes kept in memory");
+}
+
+template class CMemoryMappedDenseFeatures<bool>;
+template class CMemoryMappedDenseFeatures<char>;
+template class CMemoryMappedDenseFeatures<int8_t>;
+template class CMemoryMappedDenseFeatures<uint8_t>;
+template class CMemoryMappedDenseFeatures<int16_t>;
+template class CMemoryMappedDenseFeatures<uint16_t>;
+template class CMemoryMappedDenseFeatures<int32_t>;
+template class CMemoryMappedDenseFeatures<uint32_t>;
+template class CMemoryMappedDenseFeatures<int64_t>;
+template class CMemoryMappedDenseFeatures<uint64_t>;
+template class CMemoryMappedDenseFeatures<float32_t>;
+template class CMemoryMappedDenseFeatures<float64_t>;
+template class CMemoryMappedDenseFeatures<floatmax_t>;
+}
@@ -0,0 +1,139 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef _MEMORYMAPPEDDENSEFEATURES__H__
+#define _MEMORYMAPPEDDENSEFEATURES__H__
+
+#include <shogun/lib/config.h>
+
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/io/MemoryMappedFile.h>
+#include <shogun/lib/Lock.h>
+
+namespace shogun
+{
+template <class T> class CMemoryMappedFile;
+
+/** @brief Dense features backed by a memory mapped binary file.
+ *
+ * The file contains the feature matrix in column-major order, i.e. one
+ * feature vector after the other, without any header (or with a header of
+ * known size, which is skipped). The feature matrix of CDenseFeatures points
+ * into the mapping, so get_feature_vector() and get_feature_matrix() return
+ * views of the file without copying, and all algorithms working on
+ * CDenseFeatures or CDotFeatures can train on matrices larger than the main
+ * memory. The file is mapped copy-on-write: the matrix may be modified, e.g.
+ * by preprocessors applied in place, but the file itself is never written.
+ *
+ * The file is split into chunks of get_readahead() vectors. When a vector
+ * of a new chunk is accessed, the following chunk is read ahead
+ * asynchronously. With a memory budget, the oldest chunks are dropped from
+ * the resident memory once more than the budget was accessed; they are read
+ * from the file again when needed.
+ */
+template <class ST> class CMemoryMappedDenseFeatures : public CDenseFeatures<ST>
+{
+	public:
+	/** default constructor */
+	CMemoryMappedDenseFeatures();
+
+	/** constructor
+	 *
+	 * @param fname name of the file containing the feature matrix
+	 * @param num_feat dimension of the feature vectors
+	 * @param offset size of the header in bytes, a multiple of sizeof(ST)
+	 */
+	CMemoryMappedDenseFeatures(const char* fname, int32_t num_feat,
+			int64_t offset=0);
+
+	/** copy constructor, shares the mapping */
+	CMemoryMappedDenseFeatures(const CMemoryMappedDenseFeatures& orig);
+
+	/** destructor */
+	virtual ~CMemoryMappedDenseFeatures();
+
+	/** duplicate feature object, shares the mapping
+	 *
+	 * @return feature object
+	 */
+	virtual CFeatures* duplicate() const;
+
+#ifndef SWIG // SWIG should skip this part
+	virtual CFeatures* shallow_subset_copy();
+#endif
+
+	/** set the number of vectors which are read ahead together
+	 *
+	 * @param num_vec number of vectors in a chunk
+	 */
+	void set_readahead(int32_t num_vec);
+
+	/** @return number of vectors which are read ahead together */
+	int32_t get_readahead() const;
+
+	/** set the maximal amount of the file which is kept in memory
+	 *
+	 * @param bytes budget in bytes, unlimited if 0
+	 */
+	void set_memory_budget(int64_t bytes);
+
+	/** @return maximal amount of the file which is kept in memory */
+	int64_t get_memory_budget() const;
+
+	/** @return object name */
+	virtual const char* get_name() const { return "MemoryMappedDenseFeatures"; }
+
+	protected:
+	/** read ahead and enforce the memory budget
+	 *
+	 * @param real_num index of the accessed vector
+	 */
+	virtual void on_feature_vector_access(int32_t real_num);
+
+	/** @return size of a chunk in bytes */
+	int64_t get_chunk_bytes() const;
+
+	/** reset the bookkeeping of resident chunks */
+	void reset_chunks();
+
+	private:
+	/** initialize members */
+	void init();
+
+	protected:
+	/** memory mapped file */
+	CMemoryMappedFile<ST>* m_file;
+
+	/** size of the header in bytes */
+	int64_t m_offset;
+
+	/** number of vectors in a chunk */
+	int32_t m_readahead;
+
+	/** maximal number of bytes kept in memory, unlimited if 0 */
+	int64_t m_memory_budget;
+
+	/** last accessed chunk */
+	int32_t m_last_chunk;
+
+	/** resident chunks in the order of access */
+	int32_t* m_resident_chunks;
+
+	/** maximal number of resident chunks */
+	int32_t m_max_resident;
+
+	/** number of resident chunks */
+	int32_t m_num_resident;
+
+	/** next resident chunk to release */
+	int32_t m_next_release;
+
+	/** protects the bookkeeping of resident chunks */
+	CLock m_chunk_lock;
+};
+}
+#endif // _MEMORYMAPPEDDENSEFEATURES__H__
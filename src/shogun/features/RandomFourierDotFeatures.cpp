@@ -10,6 +10,7 @@
 
 #include <shogun/base/Parameter.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/RandomStream.h>
 #include <shogun/features/RandomFourierDotFeatures.h>
 
 namespace shogun {
@@ -82,6 +83,29 @@ float64_t CRandomFourierDotFeatures::post_dot(float64_t dot_result, index_t par_
 	return CMath::cos(dot_result) * constant;
 }
 
+SGMatrix<float64_t> CRandomFourierDotFeatures::generate_random_coefficients()
+{
+	REQUIRE(kernel==GAUSSIAN, "Unknown kernel\n")
+
+	const index_t dim=feats->get_dim_feature_space();
+	const float64_t sigma=CMath::sqrt(2.0/kernel_params[0]);
+	const uint64_t seed=CMath::random();
+
+	SGMatrix<float64_t> random_params(dim+1, num_samples);
+
+#pragma omp parallel for
+	for (index_t sample=0; sample<num_samples; sample++)
+	{
+		float64_t* vec=random_params.get_column_vector(sample);
+
+		RandomStream rng(seed, sample);
+		rng.fill_normal(vec, dim, 0.0, sigma);
+		vec[dim]=rng.random(0.0, 2*CMath::PI);
+	}
+
+	return random_params;
+}
+
 SGVector<float64_t> CRandomFourierDotFeatures::generate_random_parameter_vector()
 {
 	SGVector<float64_t> vec(feats->get_dim_feature_space()+1);
@@ -103,6 +103,14 @@ protected:
 	 */
 	virtual float64_t post_dot(float64_t dot_result, index_t par_idx);
 
+	/** generates all parameter vectors in parallel, every sample from its
+	 * own random stream, so the coefficients do not depend on the number of
+	 * threads
+	 *
+	 * @return the parameter vectors in a matrix
+	 */
+	virtual SGMatrix<float64_t> generate_random_coefficients();
+
 	/** Generates a random parameter vector, subclasses must override this
 	 *
 	 * @return a random parameter vector
@@ -197,7 +197,7 @@ public:
 	 *
 	 * @return the parameter vectors in a matrix
 	 */
-	SGMatrix<float64_t> generate_random_coefficients();
+	virtual SGMatrix<float64_t> generate_random_coefficients();
 
 	/** returns the random function parameters that were generated through the function p
 	 *
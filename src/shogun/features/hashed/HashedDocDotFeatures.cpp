@@ -13,6 +13,8 @@
 #include <shogun/lib/Hash.h>
 #include <shogun/mathematics/Math.h>
 
+#include <limits>
+
 namespace shogun
 {
 CHashedDocDotFeatures::CHashedDocDotFeatures(int32_t hash_bits, CStringFeatures<char>* docs,
@@ -32,6 +34,12 @@ CHashedDocDotFeatures::CHashedDocDotFeatures(const CHashedDocDotFeatures& orig)
 {
 	init(orig.num_bits, orig.doc_collection, orig.tokenizer, orig.should_normalize,
 			orig.ngrams, orig.tokens_to_skip);
+
+	index_offsets = orig.index_offsets;
+	index_lengths = orig.index_lengths;
+	index_scales = orig.index_scales;
+	index_features = orig.index_features;
+	index_counts = orig.index_counts;
 }
 
 CHashedDocDotFeatures::CHashedDocDotFeatures(CFile* loader)
@@ -89,6 +97,32 @@ float64_t CHashedDocDotFeatures::dot(int32_t vec_idx1, CDotFeatures* df, int32_t
 
 	CHashedDocDotFeatures* hddf = (CHashedDocDotFeatures*) df;
 
+	if (is_indexed(vec_idx1) && hddf->is_indexed(vec_idx2))
+	{
+		/** both documents are sorted by hashed index */
+		index_t i = index_offsets[vec_idx1];
+		index_t i_end = i + index_lengths[vec_idx1];
+		index_t j = hddf->index_offsets[vec_idx2];
+		index_t j_end = j + hddf->index_lengths[vec_idx2];
+
+		float64_t result = 0;
+		while (i<i_end && j<j_end)
+		{
+			if (index_features[i]<hddf->index_features[j])
+				i++;
+			else if (index_features[i]>hddf->index_features[j])
+				j++;
+			else
+			{
+				result += (float64_t) index_counts[i] * hddf->index_counts[j];
+				i++;
+				j++;
+			}
+		}
+
+		return result * index_scales[vec_idx1] * hddf->index_scales[vec_idx2];
+	}
+
 	SGVector<char> sv1 = doc_collection->get_feature_vector(vec_idx1);
 	SGVector<char> sv2 = hddf->doc_collection->get_feature_vector(vec_idx2);
 
@@ -114,6 +148,18 @@ float64_t CHashedDocDotFeatures::dense_dot(int32_t vec_idx1, const float64_t* ve
 {
 	ASSERT(vec2_len == CMath::pow(2,num_bits))
 
+	if (is_indexed(vec_idx1))
+	{
+		const uint32_t* features = index_features.vector + index_offsets[vec_idx1];
+		const uint32_t* counts = index_counts.vector + index_offsets[vec_idx1];
+
+		float64_t result = 0;
+		for (index_t i=0; i<index_lengths[vec_idx1]; i++)
+			result += counts[i] * vec2[features[i]];
+
+		return result * index_scales[vec_idx1];
+	}
+
 	SGVector<char> sv = doc_collection->get_feature_vector(vec_idx1);
 
 	/** this vector will maintain the current n+k active tokens
@@ -191,6 +237,18 @@ void CHashedDocDotFeatures::add_to_dense_vec(float64_t alpha, int32_t vec_idx1,
 	if (abs_val)
 		alpha = CMath::abs(alpha);
 
+	if (is_indexed(vec_idx1))
+	{
+		const uint32_t* features = index_features.vector + index_offsets[vec_idx1];
+		const uint32_t* counts = index_counts.vector + index_offsets[vec_idx1];
+		const float64_t value = alpha * index_scales[vec_idx1];
+
+		for (index_t i=0; i<index_lengths[vec_idx1]; i++)
+			vec2[features[i]] += counts[i] * value;
+
+		return;
+	}
+
 	SGVector<char> sv = doc_collection->get_feature_vector(vec_idx1);
 	const float64_t value = should_normalize ? alpha / CMath::sqrt((float64_t) sv.size()) : alpha;
 
@@ -266,14 +324,138 @@ uint32_t CHashedDocDotFeatures::calculate_token_hash(char* token,
 	return hash & ((1 << num_bits) - 1);
 }
 
+int32_t CHashedDocDotFeatures::build_index(int64_t memory_budget)
+{
+	REQUIRE(doc_collection, "No document collection set\n")
+	free_index();
+
+	int32_t num_docs = get_num_vectors();
+	SGVector<int32_t> lengths(num_docs);
+	SGVector<float64_t> scales(num_docs);
+
+	/** first pass, find the number of distinct hashed indices of every document */
+	#pragma omp parallel
+	{
+		CHashedDocConverter* converter = new CHashedDocConverter(tokenizer->get_copy(),
+				num_bits, false, ngrams, tokens_to_skip);
+
+		#pragma omp for schedule(dynamic, 16)
+		for (index_t i=0; i<num_docs; i++)
+		{
+			/** the document collection is not thread-safe if it computes or
+			 * preprocesses its vectors on access, only the hashing is parallel */
+			SGVector<char> sv;
+			#pragma omp critical (hashed_doc_fetch)
+			sv = doc_collection->get_feature_vector(i);
+
+			lengths[i] = 0;
+			scales[i] = 1;
+			if (sv.vlen>0)
+			{
+				lengths[i] = converter->apply(sv).num_feat_entries;
+				if (should_normalize)
+					scales[i] = 1.0 / CMath::sqrt((float64_t) sv.size());
+			}
+
+			#pragma omp critical (hashed_doc_fetch)
+			doc_collection->free_feature_vector(sv, i);
+		}
+
+		SG_UNREF(converter);
+	}
+
+	/** decide which documents fit in the budget */
+	SGVector<index_t> offsets(num_docs);
+	const int64_t entry_size = sizeof(uint32_t) * 2;
+	int64_t num_entries = 0;
+	int32_t num_indexed = 0;
+	for (index_t i=0; i<num_docs; i++)
+	{
+		int64_t new_num_entries = num_entries + lengths[i];
+		if (new_num_entries>std::numeric_limits<index_t>::max() ||
+				(memory_budget>=0 && new_num_entries*entry_size>memory_budget))
+		{
+			offsets[i] = -1;
+			continue;
+		}
+
+		offsets[i] = num_entries;
+		num_entries = new_num_entries;
+		num_indexed++;
+	}
+
+	SGVector<uint32_t> features(num_entries);
+	SGVector<uint32_t> counts(num_entries);
+
+	/** second pass, fill in the hashed indices of the selected documents */
+	#pragma omp parallel
+	{
+		CHashedDocConverter* converter = new CHashedDocConverter(tokenizer->get_copy(),
+				num_bits, false, ngrams, tokens_to_skip);
+
+		#pragma omp for schedule(dynamic, 16)
+		for (index_t i=0; i<num_docs; i++)
+		{
+			if (offsets[i]<0 || lengths[i]==0)
+				continue;
+
+			SGVector<char> sv;
+			#pragma omp critical (hashed_doc_fetch)
+			sv = doc_collection->get_feature_vector(i);
+
+			SGSparseVector<float64_t> hashed_doc = converter->apply(sv);
+			ASSERT(hashed_doc.num_feat_entries==lengths[i])
+			for (index_t j=0; j<lengths[i]; j++)
+			{
+				features[offsets[i]+j] = hashed_doc.features[j].feat_index;
+				counts[offsets[i]+j] = hashed_doc.features[j].entry;
+			}
+
+			#pragma omp critical (hashed_doc_fetch)
+			doc_collection->free_feature_vector(sv, i);
+		}
+
+		SG_UNREF(converter);
+	}
+
+	index_offsets = offsets;
+	index_lengths = lengths;
+	index_scales = scales;
+	index_features = features;
+	index_counts = counts;
+
+	SG_DEBUG("Indexed %d of %d documents using %d entries\n", num_indexed,
+			num_docs, (int32_t) num_entries);
+
+	return num_indexed;
+}
+
+void CHashedDocDotFeatures::free_index()
+{
+	index_offsets = SGVector<index_t>();
+	index_lengths = SGVector<int32_t>();
+	index_scales = SGVector<float64_t>();
+	index_features = SGVector<uint32_t>();
+	index_counts = SGVector<uint32_t>();
+}
+
+bool CHashedDocDotFeatures::is_indexed(int32_t vec_idx) const
+{
+	return index_offsets.vlen>0 && index_offsets[vec_idx]>=0;
+}
+
 void CHashedDocDotFeatures::set_doc_collection(CStringFeatures<char>* docs)
 {
 	SG_UNREF(doc_collection);
 	doc_collection = docs;
+	free_index();
 }
 
 int32_t CHashedDocDotFeatures::get_nnz_features_for_vector(int32_t num)
 {
+	if (is_indexed(num))
+		return index_lengths[num];
+
 	SGVector<char> sv = doc_collection->get_feature_vector(num);
 	int32_t num_nnz_features = sv.size();
 	doc_collection->free_feature_vector(sv, num);
@@ -109,6 +109,7 @@ public:
 
 	/** get number of non-zero features in vector
 	 *
+	 * exact for indexed documents, otherwise the length of the document
 	 * (in case accurate estimates are too expensive overestimating is OK)
 	 *
 	 * @param num which vector
@@ -192,6 +193,34 @@ public:
 	static uint32_t calculate_token_hash(char* token, int32_t length,
 			int32_t num_bits, uint32_t seed);
 
+	/** Hash every document once and store the result in a compressed
+	 * sparse row index of (hashed index, count) pairs, so that dot(),
+	 * dense_dot() and add_to_dense_vec() do not need to tokenize and
+	 * hash the documents again on every epoch.
+	 *
+	 * The documents are hashed in parallel and are then added to the
+	 * index in order, skipping those that would exceed the given memory
+	 * budget. The documents that were skipped are hashed on the fly.
+	 *
+	 * The index refers to the current document collection and its
+	 * subset, so it has to be rebuilt if any of them changes.
+	 *
+	 * @param memory_budget maximum number of bytes used by the index
+	 * entries, negative for no limit
+	 * @return number of documents stored in the index
+	 */
+	int32_t build_index(int64_t memory_budget=-1);
+
+	/** free the hashed index, documents are hashed on the fly afterwards */
+	void free_index();
+
+	/** check whether a document is served by the hashed index
+	 *
+	 * @param vec_idx index of the document
+	 * @return true if the document is stored in the index
+	 */
+	bool is_indexed(int32_t vec_idx) const;
+
 private:
 	void init(int32_t hash_bits, CStringFeatures<char>* docs, CTokenizer* tzer,
 		bool normalize, int32_t n_grams, int32_t skips);
@@ -214,6 +243,21 @@ protected:
 
 	/** tokens to skip when combining tokens */
 	int32_t tokens_to_skip;
+
+	/** offset of each document in the index, -1 if not indexed */
+	SGVector<index_t> index_offsets;
+
+	/** number of distinct hashed indices of each indexed document */
+	SGVector<int32_t> index_lengths;
+
+	/** normalization factor of each indexed document */
+	SGVector<float64_t> index_scales;
+
+	/** sorted hashed indices of the indexed documents */
+	SGVector<uint32_t> index_features;
+
+	/** number of occurrences of each hashed index */
+	SGVector<uint32_t> index_counts;
 };
 }
 
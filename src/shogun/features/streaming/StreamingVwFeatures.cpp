@@ -69,6 +69,7 @@ void CStreamingVwFeatures::reset_stream()
 		parser.exit_parser();
 		parser.init(working_file, has_labels, parser.get_ring_size());
 		parser.set_free_vector_after_release(false);
+		parser.set_hold_examples(true);
 		parser.start_parser();
 	}
 	else
@@ -156,6 +157,7 @@ void CStreamingVwFeatures::init(CStreamingVwFile* file, bool is_labelled, int32_
 	working_file = file;
 	parser.init(file, is_labelled, size);
 	parser.set_free_vector_after_release(false);
+	parser.set_hold_examples(true);
 	seekable=false;
 
 	// Get environment from the StreamingVwFile
@@ -170,6 +172,7 @@ void CStreamingVwFeatures::init(CStreamingVwCacheFile* file, bool is_labelled, i
 	working_file = file;
 	parser.init(file, is_labelled, size);
 	parser.set_free_vector_after_release(false);
+	parser.set_hold_examples(true);
 	seekable=true;
 
 	// Get environment from the StreamingVwFile
@@ -279,22 +282,32 @@ float64_t CStreamingVwFeatures::get_label()
 }
 
 void CStreamingVwFeatures::release_example()
+{
+	release_example(current_example);
+}
+
+void CStreamingVwFeatures::release_example(VwExample* ex)
 {
 	env->example_number++;
-	env->weighted_examples += current_example->ld->weight;
+	env->weighted_examples += ex->ld->weight;
 
-	if (current_example->ld->label == FLT_MAX)
+	if (ex->ld->label == FLT_MAX)
 		env->weighted_labels += 0;
 	else
-		env->weighted_labels += current_example->ld->label * current_example->ld->weight;
+		env->weighted_labels += ex->ld->label * ex->ld->weight;
 
-	env->total_features += current_example->num_features;
-	env->sum_loss += current_example->loss;
+	env->total_features += ex->num_features;
+	env->sum_loss += ex->loss;
 
-	current_example->reset_members();
+	ex->reset_members();
 	parser.finalize_example();
 }
 
+int32_t CStreamingVwFeatures::get_ring_size()
+{
+	return parser.get_ring_size();
+}
+
 int32_t CStreamingVwFeatures::get_dim_feature_space() const
 {
 	return current_length;
@@ -176,6 +176,23 @@ public:
 	 */
 	virtual void release_example();
 
+	/**
+	 * Release the given example. Several examples obtained through
+	 * get_next_example() and get_example() can be held at a time, as long
+	 * as there are fewer of them than get_ring_size(). They have to be
+	 * released in the order they were obtained.
+	 *
+	 * @param ex example to release
+	 */
+	virtual void release_example(VwExample* ex);
+
+	/**
+	 * Return the number of examples the parser can hold at a time
+	 *
+	 * @return size of the parser's ring
+	 */
+	virtual int32_t get_ring_size();
+
 	/**
 	 * Expand the vector passed so that it its length is equal to
 	 * the dimensionality of the features. The previous values are
@@ -155,6 +155,87 @@ void CHDF5File::fname(sg_type*& matrix, int32_t& num_feat, int32_t& num_vec)		\
 	}																				\
 }
 
+#define GET_MATRIX_BLOCK(fname, sg_type, datatype)									\
+void CHDF5File::fname(sg_type* block, int32_t first_vec, int32_t num_vec)			\
+{																					\
+	if (!h5file)																	\
+		SG_ERROR("File invalid.\n")												\
+																					\
+	int32_t* dims;																	\
+	int32_t ndims;																	\
+	int64_t nelements;																\
+	hid_t dataset = H5Dopen2(h5file, variable_name, H5P_DEFAULT);					\
+	if (dataset<0)																	\
+		SG_ERROR("Error opening data set\n")										\
+	hid_t dtype = H5Dget_type(dataset);												\
+	H5T_class_t t_class=H5Tget_class(dtype);										\
+	TSGDataType t datatype; hid_t h5_type=get_compatible_type(t_class, &t);	        \
+	if (h5_type==-1)																\
+	{																				\
+		H5Dclose(dataset);															\
+		SG_ERROR("No compatible datatype found\n")									\
+	}																				\
+	get_dims(dataset, dims, ndims, nelements);										\
+	if (ndims!=2)																	\
+		SG_ERROR("Error not a 2-dimensional matrix\n")								\
+	if (first_vec<0 || num_vec<0 || first_vec+num_vec>dims[1])						\
+		SG_ERROR("Vectors %d to %d out of range (%d vectors)\n",					\
+				first_vec, first_vec+num_vec-1, dims[1])							\
+	hid_t filespace = H5Dget_space(dataset);										\
+	hsize_t count = hsize_t(dims[0])*num_vec;										\
+	hid_t memspace = H5Screate_simple(1, &count, NULL);								\
+	herr_t status = -1;																\
+	if (select_matrix_columns(filespace, dims, first_vec, num_vec))				\
+		status = H5Dread(dataset, h5_type, memspace, filespace, H5P_DEFAULT, block);	\
+	H5Sclose(memspace);																\
+	H5Sclose(filespace);															\
+	H5Dclose(dataset);																\
+	H5Tclose(dtype);																\
+	SG_FREE(dims);																	\
+	if (status<0)																	\
+		SG_ERROR("Error reading dataset\n")										\
+}
+
+GET_MATRIX_BLOCK(get_matrix_block, bool, (CT_MATRIX, ST_NONE, PT_BOOL))
+GET_MATRIX_BLOCK(get_matrix_block, char, (CT_MATRIX, ST_NONE, PT_CHAR))
+GET_MATRIX_BLOCK(get_matrix_block, uint8_t, (CT_MATRIX, ST_NONE, PT_UINT8))
+GET_MATRIX_BLOCK(get_matrix_block, int32_t, (CT_MATRIX, ST_NONE, PT_INT32))
+GET_MATRIX_BLOCK(get_matrix_block, uint32_t, (CT_MATRIX, ST_NONE, PT_INT32))
+GET_MATRIX_BLOCK(get_matrix_block, int64_t, (CT_MATRIX, ST_NONE, PT_INT64))
+GET_MATRIX_BLOCK(get_matrix_block, uint64_t, (CT_MATRIX, ST_NONE, PT_INT64))
+GET_MATRIX_BLOCK(get_matrix_block, int16_t, (CT_MATRIX, ST_NONE, PT_INT16))
+GET_MATRIX_BLOCK(get_matrix_block, uint16_t, (CT_MATRIX, ST_NONE, PT_INT16))
+GET_MATRIX_BLOCK(get_matrix_block, float32_t, (CT_MATRIX, ST_NONE, PT_FLOAT32))
+GET_MATRIX_BLOCK(get_matrix_block, float64_t, (CT_MATRIX, ST_NONE, PT_FLOAT64))
+GET_MATRIX_BLOCK(get_matrix_block, floatmax_t, (CT_MATRIX, ST_NONE, PT_FLOATMAX))
+#undef GET_MATRIX_BLOCK
+
+void CHDF5File::get_matrix_dims(int32_t& num_feat, int32_t& num_vec)
+{
+	if (!h5file)
+		SG_ERROR("File invalid.\n")
+
+	int32_t* dims;
+	int32_t ndims;
+	int64_t nelements;
+	hid_t dataset = H5Dopen2(h5file, variable_name, H5P_DEFAULT);
+	if (dataset<0)
+		SG_ERROR("Error opening data set\n")
+
+	get_dims(dataset, dims, ndims, nelements);
+	H5Dclose(dataset);
+
+	if (ndims!=2)
+	{
+		SG_FREE(dims);
+		SG_ERROR("Error not a 2-dimensional matrix\n")
+	}
+
+	num_feat=dims[0];
+	num_vec=dims[1];
+	SG_FREE(dims);
+}
+
 GET_MATRIX(get_matrix, bool, (CT_MATRIX, ST_NONE, PT_BOOL))
 GET_MATRIX(get_matrix, char, (CT_MATRIX, ST_NONE, PT_CHAR))
 GET_MATRIX(get_matrix, uint8_t, (CT_MATRIX, ST_NONE, PT_UINT8))
@@ -425,6 +506,62 @@ void CHDF5File::get_dims(hid_t dataset, int32_t*& dims, int32_t& ndims, int64_t&
 	H5Sclose(dataspace);
 }
 
+bool CHDF5File::select_matrix_columns(hid_t dataspace, const int32_t* dims,
+		int32_t first_vec, int32_t num_vec)
+{
+	/* element k of the flattened matrix is at (k/dims[1], k%dims[1]) in
+	 * the dataset */
+	const hsize_t width=dims[1];
+	const hsize_t begin=hsize_t(first_vec)*dims[0];
+	const hsize_t end=hsize_t(first_vec+num_vec)*dims[0];
+
+	if (begin==end)
+		return H5Sselect_none(dataspace)>=0;
+
+	hsize_t first_row=begin/width;
+	hsize_t last_row=(end-1)/width;
+
+	H5S_seloper_t op=H5S_SELECT_SET;
+	herr_t status=0;
+
+	if (first_row==last_row)
+	{
+		hsize_t start[2]={first_row, begin%width};
+		hsize_t count[2]={1, end-begin};
+		return H5Sselect_hyperslab(dataspace, op, start, NULL, count, NULL)>=0;
+	}
+
+	/* tail of the first row */
+	if (begin%width)
+	{
+		hsize_t start[2]={first_row, begin%width};
+		hsize_t count[2]={1, width-begin%width};
+		status|=H5Sselect_hyperslab(dataspace, op, start, NULL, count, NULL);
+		op=H5S_SELECT_OR;
+		first_row++;
+	}
+
+	/* full rows */
+	hsize_t full_end=end%width ? last_row : last_row+1;
+	if (full_end>first_row)
+	{
+		hsize_t start[2]={first_row, 0};
+		hsize_t count[2]={full_end-first_row, width};
+		status|=H5Sselect_hyperslab(dataspace, op, start, NULL, count, NULL);
+		op=H5S_SELECT_OR;
+	}
+
+	/* head of the last row */
+	if (end%width)
+	{
+		hsize_t start[2]={last_row, 0};
+		hsize_t count[2]={1, end%width};
+		status|=H5Sselect_hyperslab(dataspace, op, start, NULL, count, NULL);
+	}
+
+	return status>=0;
+}
+
 void CHDF5File::create_group_hierarchy()
 {
 	char* vname=get_strdup(variable_name);
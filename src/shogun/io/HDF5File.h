@@ -106,6 +106,34 @@ public:
 			uint16_t*& matrix, int32_t& num_feat, int32_t& num_vec);
 	//@}
 
+	/** get the dimensions of a matrix without reading it
+	 *
+	 * @param num_feat number of features (returned by reference)
+	 * @param num_vec number of vectors (returned by reference)
+	 */
+	void get_matrix_dims(int32_t& num_feat, int32_t& num_vec);
+
+	/** @name Matrix Block Access Functions
+	 *
+	 * Functions to read consecutive feature vectors of a matrix without
+	 * reading the whole matrix, using hyperslab selections. The block has
+	 * to have room for num_feat*num_vec elements.
+	 */
+	//@{
+	void get_matrix_block(bool* block, int32_t first_vec, int32_t num_vec);
+	void get_matrix_block(uint8_t* block, int32_t first_vec, int32_t num_vec);
+	void get_matrix_block(char* block, int32_t first_vec, int32_t num_vec);
+	void get_matrix_block(int32_t* block, int32_t first_vec, int32_t num_vec);
+	void get_matrix_block(uint32_t* block, int32_t first_vec, int32_t num_vec);
+	void get_matrix_block(int64_t* block, int32_t first_vec, int32_t num_vec);
+	void get_matrix_block(uint64_t* block, int32_t first_vec, int32_t num_vec);
+	void get_matrix_block(float32_t* block, int32_t first_vec, int32_t num_vec);
+	void get_matrix_block(float64_t* block, int32_t first_vec, int32_t num_vec);
+	void get_matrix_block(floatmax_t* block, int32_t first_vec, int32_t num_vec);
+	void get_matrix_block(int16_t* block, int32_t first_vec, int32_t num_vec);
+	void get_matrix_block(uint16_t* block, int32_t first_vec, int32_t num_vec);
+	//@}
+
 
 	/** @name Sparse Matrix Access Functions
 	 *
@@ -379,6 +407,20 @@ protected:
 	/** create a group hierarchy in the hdf5 file h5file according to name */
 	void create_group_hierarchy();
 
+	/** select the elements of consecutive feature vectors of a matrix.
+	 * Matrices are stored column by column in a dataset of dimensions
+	 * num_feat x num_vec, so the vectors are a contiguous range of the
+	 * flattened dataset, which is selected as up to three hyperslabs.
+	 *
+	 * @param dataspace dataspace of the matrix
+	 * @param dims dimensions of the matrix
+	 * @param first_vec index of the first vector
+	 * @param num_vec number of vectors
+	 * @return whether the selection succeeded
+	 */
+	bool select_matrix_columns(hid_t dataspace, const int32_t* dims,
+			int32_t first_vec, int32_t num_vec);
+
 protected:
 	/** hdf5 file handle */
 	hid_t h5file;
@@ -15,6 +15,7 @@
 
 #include <shogun/io/SGIO.h>
 #include <shogun/base/SGObject.h>
+#include <shogun/mathematics/Math.h>
 
 #include <stdio.h>
 #include <string.h>
@@ -50,10 +51,14 @@ template <class T> class CMemoryMappedFile : public CSGObject
 
 		/** constructor
 		 *
-		 * open a memory mapped file for read or read/write mode
+		 * open a memory mapped file for read, read/write or copy-on-write
+		 * mode
 		 *
 		 * @param fname name of file, zero terminated string
-		 * @param flag determines read or read write mode (can be 'r' or 'w')
+		 * @param flag determines read, read write or copy-on-write mode (can
+		 *   be 'r', 'w' or 'c'). In copy-on-write mode the mapping may be
+		 *   modified, but the modifications are private and never written
+		 *   back to the file.
 		 * @param fsize overestimate of expected file size (in bytes)
 		 *   when opened in write  mode; Underestimating the file size will
 		 *   result in an error to occur upon writing. In case the exact file
@@ -64,7 +69,8 @@ template <class T> class CMemoryMappedFile : public CSGObject
 		CMemoryMappedFile(const char* fname, char flag='r', int64_t fsize=0)
 		: CSGObject()
 		{
-			REQUIRE(flag=='w' || flag=='r', "Only 'r' and 'w' flags are allowed")
+			REQUIRE(flag=='w' || flag=='r' || flag=='c',
+					"Only 'r', 'w' and 'c' flags are allowed")
 
 			last_written_byte=0;
 			rw=flag;
@@ -79,6 +85,8 @@ template <class T> class CMemoryMappedFile : public CSGObject
 				mmap_prot=PROT_READ|PROT_WRITE;
 				mmap_flags=MAP_SHARED;
 			}
+			else if (rw=='c')
+				mmap_prot=PROT_READ|PROT_WRITE;
 
 			fd = open(fname, open_flags, S_IRWXU | S_IRWXG | S_IRWXO);
 			if (fd == -1)
@@ -259,10 +267,65 @@ template <class T> class CMemoryMappedFile : public CSGObject
 		  return ((T*)address)[index];
 		}
 
+		/** tell the kernel that the file will be read sequentially, which
+		 * enables aggressive readahead
+		 */
+		void advise_sequential()
+		{
+			madvise(address, length, MADV_SEQUENTIAL);
+		}
+
+		/** start reading a range of the file into memory asynchronously
+		 *
+		 * @param offs offset in bytes
+		 * @param len length in bytes
+		 */
+		void prefetch(uint64_t offs, uint64_t len)
+		{
+			advise(offs, len, MADV_WILLNEED);
+		}
+
+		/** drop the pages of a range from the resident memory, they are
+		 * read again from the file when accessed. Only for read mode, as
+		 * writes to the range might be lost. In copy-on-write mode the
+		 * pages are reclaimed instead where supported, which keeps the
+		 * modified pages in swap.
+		 *
+		 * @param offs offset in bytes
+		 * @param len length in bytes
+		 */
+		void release(uint64_t offs, uint64_t len)
+		{
+			if (rw=='r')
+				advise(offs, len, MADV_DONTNEED);
+#ifdef MADV_PAGEOUT
+			else if (rw=='c')
+				advise(offs, len, MADV_PAGEOUT);
+#endif
+		}
+
 		/** @return object name */
 		virtual const char* get_name() const { return "MemoryMappedFile"; }
 
 	protected:
+		/** madvise a byte range, extended to whole pages
+		 *
+		 * @param offs offset in bytes
+		 * @param len length in bytes
+		 * @param advice advice for madvise
+		 */
+		void advise(uint64_t offs, uint64_t len, int advice)
+		{
+			if (offs>=length)
+				return;
+
+			const uint64_t page=sysconf(_SC_PAGESIZE);
+			uint64_t begin=offs/page*page;
+			uint64_t end=CMath::min(offs+len, length);
+
+			madvise((char*) address+begin, end-begin, advice);
+		}
+
 		/** file descriptor */
 		int fd;
 		/** size of file */
@@ -0,0 +1,1648 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: Chunks.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_Chunks_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_Chunks_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_Chunks_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_Chunks_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_Chunks_2eproto;
+namespace shogun {
+class BoolChunk;
+struct BoolChunkDefaultTypeInternal;
+extern BoolChunkDefaultTypeInternal _BoolChunk_default_instance_;
+class Float32Chunk;
+struct Float32ChunkDefaultTypeInternal;
+extern Float32ChunkDefaultTypeInternal _Float32Chunk_default_instance_;
+class Float64Chunk;
+struct Float64ChunkDefaultTypeInternal;
+extern Float64ChunkDefaultTypeInternal _Float64Chunk_default_instance_;
+class Int32Chunk;
+struct Int32ChunkDefaultTypeInternal;
+extern Int32ChunkDefaultTypeInternal _Int32Chunk_default_instance_;
+class Int64Chunk;
+struct Int64ChunkDefaultTypeInternal;
+extern Int64ChunkDefaultTypeInternal _Int64Chunk_default_instance_;
+class UInt32Chunk;
+struct UInt32ChunkDefaultTypeInternal;
+extern UInt32ChunkDefaultTypeInternal _UInt32Chunk_default_instance_;
+class UInt64Chunk;
+struct UInt64ChunkDefaultTypeInternal;
+extern UInt64ChunkDefaultTypeInternal _UInt64Chunk_default_instance_;
+}  // namespace shogun
+PROTOBUF_NAMESPACE_OPEN
+template<> ::shogun::BoolChunk* Arena::CreateMaybeMessage<::shogun::BoolChunk>(Arena*);
+template<> ::shogun::Float32Chunk* Arena::CreateMaybeMessage<::shogun::Float32Chunk>(Arena*);
+template<> ::shogun::Float64Chunk* Arena::CreateMaybeMessage<::shogun::Float64Chunk>(Arena*);
+template<> ::shogun::Int32Chunk* Arena::CreateMaybeMessage<::shogun::Int32Chunk>(Arena*);
+template<> ::shogun::Int64Chunk* Arena::CreateMaybeMessage<::shogun::Int64Chunk>(Arena*);
+template<> ::shogun::UInt32Chunk* Arena::CreateMaybeMessage<::shogun::UInt32Chunk>(Arena*);
+template<> ::shogun::UInt64Chunk* Arena::CreateMaybeMessage<::shogun::UInt64Chunk>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace shogun {
+
+// ===================================================================
+
+class BoolChunk final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:shogun.BoolChunk) */ {
+ public:
+  inline BoolChunk() : BoolChunk(nullptr) {}
+  ~BoolChunk() override;
+  explicit PROTOBUF_CONSTEXPR BoolChunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BoolChunk(const BoolChunk& from);
+  BoolChunk(BoolChunk&& from) noexcept
+    : BoolChunk() {
+    *this = ::std::move(from);
+  }
+
+  inline BoolChunk& operator=(const BoolChunk& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BoolChunk& operator=(BoolChunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BoolChunk& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BoolChunk* internal_default_instance() {
+    return reinterpret_cast<const BoolChunk*>(
+               &_BoolChunk_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(BoolChunk& a, BoolChunk& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BoolChunk* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BoolChunk* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BoolChunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BoolChunk>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BoolChunk& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BoolChunk& from) {
+    BoolChunk::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BoolChunk* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "shogun.BoolChunk";
+  }
+  protected:
+  explicit BoolChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 1,
+  };
+  // repeated bool data = 1 [packed = true];
+  int data_size() const;
+  private:
+  int _internal_data_size() const;
+  public:
+  void clear_data();
+  private:
+  bool _internal_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      _internal_data() const;
+  void _internal_add_data(bool value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      _internal_mutable_data();
+  public:
+  bool data(int index) const;
+  void set_data(int index, bool value);
+  void add_data(bool value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      mutable_data();
+
+  // @@protoc_insertion_point(class_scope:shogun.BoolChunk)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool > data_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Chunks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Int32Chunk final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:shogun.Int32Chunk) */ {
+ public:
+  inline Int32Chunk() : Int32Chunk(nullptr) {}
+  ~Int32Chunk() override;
+  explicit PROTOBUF_CONSTEXPR Int32Chunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Int32Chunk(const Int32Chunk& from);
+  Int32Chunk(Int32Chunk&& from) noexcept
+    : Int32Chunk() {
+    *this = ::std::move(from);
+  }
+
+  inline Int32Chunk& operator=(const Int32Chunk& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Int32Chunk& operator=(Int32Chunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Int32Chunk& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Int32Chunk* internal_default_instance() {
+    return reinterpret_cast<const Int32Chunk*>(
+               &_Int32Chunk_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Int32Chunk& a, Int32Chunk& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Int32Chunk* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Int32Chunk* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Int32Chunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Int32Chunk>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Int32Chunk& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Int32Chunk& from) {
+    Int32Chunk::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Int32Chunk* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "shogun.Int32Chunk";
+  }
+  protected:
+  explicit Int32Chunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 1,
+  };
+  // repeated int32 data = 1 [packed = true];
+  int data_size() const;
+  private:
+  int _internal_data_size() const;
+  public:
+  void clear_data();
+  private:
+  int32_t _internal_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_data() const;
+  void _internal_add_data(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_data();
+  public:
+  int32_t data(int index) const;
+  void set_data(int index, int32_t value);
+  void add_data(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_data();
+
+  // @@protoc_insertion_point(class_scope:shogun.Int32Chunk)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > data_;
+    mutable std::atomic<int> _data_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Chunks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UInt32Chunk final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:shogun.UInt32Chunk) */ {
+ public:
+  inline UInt32Chunk() : UInt32Chunk(nullptr) {}
+  ~UInt32Chunk() override;
+  explicit PROTOBUF_CONSTEXPR UInt32Chunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UInt32Chunk(const UInt32Chunk& from);
+  UInt32Chunk(UInt32Chunk&& from) noexcept
+    : UInt32Chunk() {
+    *this = ::std::move(from);
+  }
+
+  inline UInt32Chunk& operator=(const UInt32Chunk& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UInt32Chunk& operator=(UInt32Chunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UInt32Chunk& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UInt32Chunk* internal_default_instance() {
+    return reinterpret_cast<const UInt32Chunk*>(
+               &_UInt32Chunk_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(UInt32Chunk& a, UInt32Chunk& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UInt32Chunk* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UInt32Chunk* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UInt32Chunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UInt32Chunk>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UInt32Chunk& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UInt32Chunk& from) {
+    UInt32Chunk::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UInt32Chunk* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "shogun.UInt32Chunk";
+  }
+  protected:
+  explicit UInt32Chunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 1,
+  };
+  // repeated uint32 data = 1 [packed = true];
+  int data_size() const;
+  private:
+  int _internal_data_size() const;
+  public:
+  void clear_data();
+  private:
+  uint32_t _internal_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_data() const;
+  void _internal_add_data(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_data();
+  public:
+  uint32_t data(int index) const;
+  void set_data(int index, uint32_t value);
+  void add_data(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_data();
+
+  // @@protoc_insertion_point(class_scope:shogun.UInt32Chunk)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > data_;
+    mutable std::atomic<int> _data_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Chunks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Int64Chunk final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:shogun.Int64Chunk) */ {
+ public:
+  inline Int64Chunk() : Int64Chunk(nullptr) {}
+  ~Int64Chunk() override;
+  explicit PROTOBUF_CONSTEXPR Int64Chunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Int64Chunk(const Int64Chunk& from);
+  Int64Chunk(Int64Chunk&& from) noexcept
+    : Int64Chunk() {
+    *this = ::std::move(from);
+  }
+
+  inline Int64Chunk& operator=(const Int64Chunk& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Int64Chunk& operator=(Int64Chunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Int64Chunk& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Int64Chunk* internal_default_instance() {
+    return reinterpret_cast<const Int64Chunk*>(
+               &_Int64Chunk_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(Int64Chunk& a, Int64Chunk& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Int64Chunk* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Int64Chunk* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Int64Chunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Int64Chunk>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Int64Chunk& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Int64Chunk& from) {
+    Int64Chunk::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Int64Chunk* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "shogun.Int64Chunk";
+  }
+  protected:
+  explicit Int64Chunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 1,
+  };
+  // repeated int64 data = 1 [packed = true];
+  int data_size() const;
+  private:
+  int _internal_data_size() const;
+  public:
+  void clear_data();
+  private:
+  int64_t _internal_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_data() const;
+  void _internal_add_data(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_data();
+  public:
+  int64_t data(int index) const;
+  void set_data(int index, int64_t value);
+  void add_data(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_data();
+
+  // @@protoc_insertion_point(class_scope:shogun.Int64Chunk)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > data_;
+    mutable std::atomic<int> _data_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Chunks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UInt64Chunk final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:shogun.UInt64Chunk) */ {
+ public:
+  inline UInt64Chunk() : UInt64Chunk(nullptr) {}
+  ~UInt64Chunk() override;
+  explicit PROTOBUF_CONSTEXPR UInt64Chunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UInt64Chunk(const UInt64Chunk& from);
+  UInt64Chunk(UInt64Chunk&& from) noexcept
+    : UInt64Chunk() {
+    *this = ::std::move(from);
+  }
+
+  inline UInt64Chunk& operator=(const UInt64Chunk& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UInt64Chunk& operator=(UInt64Chunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UInt64Chunk& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UInt64Chunk* internal_default_instance() {
+    return reinterpret_cast<const UInt64Chunk*>(
+               &_UInt64Chunk_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(UInt64Chunk& a, UInt64Chunk& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UInt64Chunk* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UInt64Chunk* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UInt64Chunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UInt64Chunk>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UInt64Chunk& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UInt64Chunk& from) {
+    UInt64Chunk::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UInt64Chunk* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "shogun.UInt64Chunk";
+  }
+  protected:
+  explicit UInt64Chunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 1,
+  };
+  // repeated uint64 data = 1 [packed = true];
+  int data_size() const;
+  private:
+  int _internal_data_size() const;
+  public:
+  void clear_data();
+  private:
+  uint64_t _internal_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_data() const;
+  void _internal_add_data(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_data();
+  public:
+  uint64_t data(int index) const;
+  void set_data(int index, uint64_t value);
+  void add_data(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_data();
+
+  // @@protoc_insertion_point(class_scope:shogun.UInt64Chunk)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > data_;
+    mutable std::atomic<int> _data_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Chunks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Float32Chunk final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:shogun.Float32Chunk) */ {
+ public:
+  inline Float32Chunk() : Float32Chunk(nullptr) {}
+  ~Float32Chunk() override;
+  explicit PROTOBUF_CONSTEXPR Float32Chunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Float32Chunk(const Float32Chunk& from);
+  Float32Chunk(Float32Chunk&& from) noexcept
+    : Float32Chunk() {
+    *this = ::std::move(from);
+  }
+
+  inline Float32Chunk& operator=(const Float32Chunk& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Float32Chunk& operator=(Float32Chunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Float32Chunk& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Float32Chunk* internal_default_instance() {
+    return reinterpret_cast<const Float32Chunk*>(
+               &_Float32Chunk_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(Float32Chunk& a, Float32Chunk& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Float32Chunk* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Float32Chunk* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Float32Chunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Float32Chunk>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Float32Chunk& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Float32Chunk& from) {
+    Float32Chunk::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Float32Chunk* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "shogun.Float32Chunk";
+  }
+  protected:
+  explicit Float32Chunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 1,
+  };
+  // repeated float data = 1 [packed = true];
+  int data_size() const;
+  private:
+  int _internal_data_size() const;
+  public:
+  void clear_data();
+  private:
+  float _internal_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_data() const;
+  void _internal_add_data(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_data();
+  public:
+  float data(int index) const;
+  void set_data(int index, float value);
+  void add_data(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_data();
+
+  // @@protoc_insertion_point(class_scope:shogun.Float32Chunk)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > data_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Chunks_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Float64Chunk final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:shogun.Float64Chunk) */ {
+ public:
+  inline Float64Chunk() : Float64Chunk(nullptr) {}
+  ~Float64Chunk() override;
+  explicit PROTOBUF_CONSTEXPR Float64Chunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Float64Chunk(const Float64Chunk& from);
+  Float64Chunk(Float64Chunk&& from) noexcept
+    : Float64Chunk() {
+    *this = ::std::move(from);
+  }
+
+  inline Float64Chunk& operator=(const Float64Chunk& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Float64Chunk& operator=(Float64Chunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Float64Chunk& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Float64Chunk* internal_default_instance() {
+    return reinterpret_cast<const Float64Chunk*>(
+               &_Float64Chunk_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(Float64Chunk& a, Float64Chunk& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Float64Chunk* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Float64Chunk* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Float64Chunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Float64Chunk>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Float64Chunk& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Float64Chunk& from) {
+    Float64Chunk::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Float64Chunk* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "shogun.Float64Chunk";
+  }
+  protected:
+  explicit Float64Chunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 1,
+  };
+  // repeated double data = 1 [packed = true];
+  int data_size() const;
+  private:
+  int _internal_data_size() const;
+  public:
+  void clear_data();
+  private:
+  double _internal_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_data() const;
+  void _internal_add_data(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_data();
+  public:
+  double data(int index) const;
+  void set_data(int index, double value);
+  void add_data(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_data();
+
+  // @@protoc_insertion_point(class_scope:shogun.Float64Chunk)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > data_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Chunks_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// BoolChunk
+
+// repeated bool data = 1 [packed = true];
+inline int BoolChunk::_internal_data_size() const {
+  return _impl_.data_.size();
+}
+inline int BoolChunk::data_size() const {
+  return _internal_data_size();
+}
+inline void BoolChunk::clear_data() {
+  _impl_.data_.Clear();
+}
+inline bool BoolChunk::_internal_data(int index) const {
+  return _impl_.data_.Get(index);
+}
+inline bool BoolChunk::data(int index) const {
+  // @@protoc_insertion_point(field_get:shogun.BoolChunk.data)
+  return _internal_data(index);
+}
+inline void BoolChunk::set_data(int index, bool value) {
+  _impl_.data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:shogun.BoolChunk.data)
+}
+inline void BoolChunk::_internal_add_data(bool value) {
+  _impl_.data_.Add(value);
+}
+inline void BoolChunk::add_data(bool value) {
+  _internal_add_data(value);
+  // @@protoc_insertion_point(field_add:shogun.BoolChunk.data)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+BoolChunk::_internal_data() const {
+  return _impl_.data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+BoolChunk::data() const {
+  // @@protoc_insertion_point(field_list:shogun.BoolChunk.data)
+  return _internal_data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+BoolChunk::_internal_mutable_data() {
+  return &_impl_.data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+BoolChunk::mutable_data() {
+  // @@protoc_insertion_point(field_mutable_list:shogun.BoolChunk.data)
+  return _internal_mutable_data();
+}
+
+// -------------------------------------------------------------------
+
+// Int32Chunk
+
+// repeated int32 data = 1 [packed = true];
+inline int Int32Chunk::_internal_data_size() const {
+  return _impl_.data_.size();
+}
+inline int Int32Chunk::data_size() const {
+  return _internal_data_size();
+}
+inline void Int32Chunk::clear_data() {
+  _impl_.data_.Clear();
+}
+inline int32_t Int32Chunk::_internal_data(int index) const {
+  return _impl_.data_.Get(index);
+}
+inline int32_t Int32Chunk::data(int index) const {
+  // @@protoc_insertion_point(field_get:shogun.Int32Chunk.data)
+  return _internal_data(index);
+}
+inline void Int32Chunk::set_data(int index, int32_t value) {
+  _impl_.data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:shogun.Int32Chunk.data)
+}
+inline void Int32Chunk::_internal_add_data(int32_t value) {
+  _impl_.data_.Add(value);
+}
+inline void Int32Chunk::add_data(int32_t value) {
+  _internal_add_data(value);
+  // @@protoc_insertion_point(field_add:shogun.Int32Chunk.data)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Int32Chunk::_internal_data() const {
+  return _impl_.data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+Int32Chunk::data() const {
+  // @@protoc_insertion_point(field_list:shogun.Int32Chunk.data)
+  return _internal_data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Int32Chunk::_internal_mutable_data() {
+  return &_impl_.data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+Int32Chunk::mutable_data() {
+  // @@protoc_insertion_point(field_mutable_list:shogun.Int32Chunk.data)
+  return _internal_mutable_data();
+}
+
+// -------------------------------------------------------------------
+
+// UInt32Chunk
+
+// repeated uint32 data = 1 [packed = true];
+inline int UInt32Chunk::_internal_data_size() const {
+  return _impl_.data_.size();
+}
+inline int UInt32Chunk::data_size() const {
+  return _internal_data_size();
+}
+inline void UInt32Chunk::clear_data() {
+  _impl_.data_.Clear();
+}
+inline uint32_t UInt32Chunk::_internal_data(int index) const {
+  return _impl_.data_.Get(index);
+}
+inline uint32_t UInt32Chunk::data(int index) const {
+  // @@protoc_insertion_point(field_get:shogun.UInt32Chunk.data)
+  return _internal_data(index);
+}
+inline void UInt32Chunk::set_data(int index, uint32_t value) {
+  _impl_.data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:shogun.UInt32Chunk.data)
+}
+inline void UInt32Chunk::_internal_add_data(uint32_t value) {
+  _impl_.data_.Add(value);
+}
+inline void UInt32Chunk::add_data(uint32_t value) {
+  _internal_add_data(value);
+  // @@protoc_insertion_point(field_add:shogun.UInt32Chunk.data)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+UInt32Chunk::_internal_data() const {
+  return _impl_.data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+UInt32Chunk::data() const {
+  // @@protoc_insertion_point(field_list:shogun.UInt32Chunk.data)
+  return _internal_data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+UInt32Chunk::_internal_mutable_data() {
+  return &_impl_.data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+UInt32Chunk::mutable_data() {
+  // @@protoc_insertion_point(field_mutable_list:shogun.UInt32Chunk.data)
+  return _internal_mutable_data();
+}
+
+// -------------------------------------------------------------------
+
+// Int64Chunk
+
+// repeated int64 data = 1 [packed = true];
+inline int Int64Chunk::_internal_data_size() const {
+  return _impl_.data_.size();
+}
+inline int Int64Chunk::data_size() const {
+  return _internal_data_size();
+}
+inline void Int64Chunk::clear_data() {
+  _impl_.data_.Clear();
+}
+inline int64_t Int64Chunk::_internal_data(int index) const {
+  return _impl_.data_.Get(index);
+}
+inline int64_t Int64Chunk::data(int index) const {
+  // @@protoc_insertion_point(field_get:shogun.Int64Chunk.data)
+  return _internal_data(index);
+}
+inline void Int64Chunk::set_data(int index, int64_t value) {
+  _impl_.data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:shogun.Int64Chunk.data)
+}
+inline void Int64Chunk::_internal_add_data(int64_t value) {
+  _impl_.data_.Add(value);
+}
+inline void Int64Chunk::add_data(int64_t value) {
+  _internal_add_data(value);
+  // @@protoc_insertion_point(field_add:shogun.Int64Chunk.data)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+Int64Chunk::_internal_data() const {
+  return _impl_.data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+Int64Chunk::data() const {
+  // @@protoc_insertion_point(field_list:shogun.Int64Chunk.data)
+  return _internal_data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+Int64Chunk::_internal_mutable_data() {
+  return &_impl_.data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+Int64Chunk::mutable_data() {
+  // @@protoc_insertion_point(field_mutable_list:shogun.Int64Chunk.data)
+  return _internal_mutable_data();
+}
+
+// -------------------------------------------------------------------
+
+// UInt64Chunk
+
+// repeated uint64 data = 1 [packed = true];
+inline int UInt64Chunk::_internal_data_size() const {
+  return _impl_.data_.size();
+}
+inline int UInt64Chunk::data_size() const {
+  return _internal_data_size();
+}
+inline void UInt64Chunk::clear_data() {
+  _impl_.data_.Clear();
+}
+inline uint64_t UInt64Chunk::_internal_data(int index) const {
+  return _impl_.data_.Get(index);
+}
+inline uint64_t UInt64Chunk::data(int index) const {
+  // @@protoc_insertion_point(field_get:shogun.UInt64Chunk.data)
+  return _internal_data(index);
+}
+inline void UInt64Chunk::set_data(int index, uint64_t value) {
+  _impl_.data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:shogun.UInt64Chunk.data)
+}
+inline void UInt64Chunk::_internal_add_data(uint64_t value) {
+  _impl_.data_.Add(value);
+}
+inline void UInt64Chunk::add_data(uint64_t value) {
+  _internal_add_data(value);
+  // @@protoc_insertion_point(field_add:shogun.UInt64Chunk.data)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+UInt64Chunk::_internal_data() const {
+  return _impl_.data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+UInt64Chunk::data() const {
+  // @@protoc_insertion_point(field_list:shogun.UInt64Chunk.data)
+  return _internal_data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+UInt64Chunk::_internal_mutable_data() {
+  return &_impl_.data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+UInt64Chunk::mutable_data() {
+  // @@protoc_insertion_point(field_mutable_list:shogun.UInt64Chunk.data)
+  return _internal_mutable_data();
+}
+
+// -------------------------------------------------------------------
+
+// Float32Chunk
+
+// repeated float data = 1 [packed = true];
+inline int Float32Chunk::_internal_data_size() const {
+  return _impl_.data_.size();
+}
+inline int Float32Chunk::data_size() const {
+  return _internal_data_size();
+}
+inline void Float32Chunk::clear_data() {
+  _impl_.data_.Clear();
+}
+inline float Float32Chunk::_internal_data(int index) const {
+  return _impl_.data_.Get(index);
+}
+inline float Float32Chunk::data(int index) const {
+  // @@protoc_insertion_point(field_get:shogun.Float32Chunk.data)
+  return _internal_data(index);
+}
+inline void Float32Chunk::set_data(int index, float value) {
+  _impl_.data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:shogun.Float32Chunk.data)
+}
+inline void Float32Chunk::_internal_add_data(float value) {
+  _impl_.data_.Add(value);
+}
+inline void Float32Chunk::add_data(float value) {
+  _internal_add_data(value);
+  // @@protoc_insertion_point(field_add:shogun.Float32Chunk.data)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Float32Chunk::_internal_data() const {
+  return _impl_.data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Float32Chunk::data() const {
+  // @@protoc_insertion_point(field_list:shogun.Float32Chunk.data)
+  return _internal_data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Float32Chunk::_internal_mutable_data() {
+  return &_impl_.data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Float32Chunk::mutable_data() {
+  // @@protoc_insertion_point(field_mutable_list:shogun.Float32Chunk.data)
+  return _internal_mutable_data();
+}
+
+// -------------------------------------------------------------------
+
+// Float64Chunk
+
+// repeated double data = 1 [packed = true];
+inline int Float64Chunk::_internal_data_size() const {
+  return _impl_.data_.size();
+}
+inline int Float64Chunk::data_size() const {
+  return _internal_data_size();
+}
+inline void Float64Chunk::clear_data() {
+  _impl_.data_.Clear();
+}
+inline double Float64Chunk::_internal_data(int index) const {
+  return _impl_.data_.Get(index);
+}
+inline double Float64Chunk::data(int index) const {
+  // @@protoc_insertion_point(field_get:shogun.Float64Chunk.data)
+  return _internal_data(index);
+}
+inline void Float64Chunk::set_data(int index, double value) {
+  _impl_.data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:shogun.Float64Chunk.data)
+}
+inline void Float64Chunk::_internal_add_data(double value) {
+  _impl_.data_.Add(value);
+}
+inline void Float64Chunk::add_data(double value) {
+  _internal_add_data(value);
+  // @@protoc_insertion_point(field_add:shogun.Float64Chunk.data)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+Float64Chunk::_internal_data() const {
+  return _impl_.data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+Float64Chunk::data() const {
+  // @@protoc_insertion_point(field_list:shogun.Float64Chunk.data)
+  return _internal_data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+Float64Chunk::_internal_mutable_data() {
+  return &_impl_.data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+Float64Chunk::mutable_data() {
+  // @@protoc_insertion_point(field_mutable_list:shogun.Float64Chunk.data)
+  return _internal_mutable_data();
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace shogun
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_Chunks_2eproto
@@ -0,0 +1,1324 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: Headers.proto
+
+#include "Headers.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace shogun {
+PROTOBUF_CONSTEXPR VectorHeader::VectorHeader(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.len_)*/uint64_t{0u}
+  , /*decltype(_impl_.num_messages_)*/0u} {}
+struct VectorHeaderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VectorHeaderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VectorHeaderDefaultTypeInternal() {}
+  union {
+    VectorHeader _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VectorHeaderDefaultTypeInternal _VectorHeader_default_instance_;
+PROTOBUF_CONSTEXPR MatrixHeader::MatrixHeader(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.num_cols_)*/uint64_t{0u}
+  , /*decltype(_impl_.num_rows_)*/uint64_t{0u}
+  , /*decltype(_impl_.num_messages_)*/0u} {}
+struct MatrixHeaderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MatrixHeaderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MatrixHeaderDefaultTypeInternal() {}
+  union {
+    MatrixHeader _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MatrixHeaderDefaultTypeInternal _MatrixHeader_default_instance_;
+PROTOBUF_CONSTEXPR SparseMatrixHeader::SparseMatrixHeader(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.num_feat_entries_)*/{}
+  , /*decltype(_impl_.num_vectors_)*/uint64_t{0u}
+  , /*decltype(_impl_.num_features_)*/uint64_t{0u}} {}
+struct SparseMatrixHeaderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SparseMatrixHeaderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SparseMatrixHeaderDefaultTypeInternal() {}
+  union {
+    SparseMatrixHeader _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SparseMatrixHeaderDefaultTypeInternal _SparseMatrixHeader_default_instance_;
+PROTOBUF_CONSTEXPR StringListHeader::StringListHeader(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.str_len_)*/{}
+  , /*decltype(_impl_.num_str_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_string_len_)*/uint64_t{0u}} {}
+struct StringListHeaderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StringListHeaderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StringListHeaderDefaultTypeInternal() {}
+  union {
+    StringListHeader _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StringListHeaderDefaultTypeInternal _StringListHeader_default_instance_;
+}  // namespace shogun
+static ::_pb::Metadata file_level_metadata_Headers_2eproto[4];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_Headers_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_Headers_2eproto = nullptr;
+
+const uint32_t TableStruct_Headers_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::shogun::VectorHeader, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::shogun::VectorHeader, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::shogun::VectorHeader, _impl_.len_),
+  PROTOBUF_FIELD_OFFSET(::shogun::VectorHeader, _impl_.num_messages_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::shogun::MatrixHeader, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::shogun::MatrixHeader, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::shogun::MatrixHeader, _impl_.num_cols_),
+  PROTOBUF_FIELD_OFFSET(::shogun::MatrixHeader, _impl_.num_rows_),
+  PROTOBUF_FIELD_OFFSET(::shogun::MatrixHeader, _impl_.num_messages_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::shogun::SparseMatrixHeader, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::shogun::SparseMatrixHeader, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::shogun::SparseMatrixHeader, _impl_.num_vectors_),
+  PROTOBUF_FIELD_OFFSET(::shogun::SparseMatrixHeader, _impl_.num_features_),
+  PROTOBUF_FIELD_OFFSET(::shogun::SparseMatrixHeader, _impl_.num_feat_entries_),
+  0,
+  1,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::shogun::StringListHeader, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::shogun::StringListHeader, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::shogun::StringListHeader, _impl_.num_str_),
+  PROTOBUF_FIELD_OFFSET(::shogun::StringListHeader, _impl_.max_string_len_),
+  PROTOBUF_FIELD_OFFSET(::shogun::StringListHeader, _impl_.str_len_),
+  0,
+  1,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::shogun::VectorHeader)},
+  { 10, 19, -1, sizeof(::shogun::MatrixHeader)},
+  { 22, 31, -1, sizeof(::shogun::SparseMatrixHeader)},
+  { 34, 43, -1, sizeof(::shogun::StringListHeader)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::shogun::_VectorHeader_default_instance_._instance,
+  &::shogun::_MatrixHeader_default_instance_._instance,
+  &::shogun::_SparseMatrixHeader_default_instance_._instance,
+  &::shogun::_StringListHeader_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_Headers_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\rHeaders.proto\022\006shogun\"1\n\014VectorHeader\022"
+  "\013\n\003len\030\001 \002(\004\022\024\n\014num_messages\030\002 \002(\r\"H\n\014Ma"
+  "trixHeader\022\020\n\010num_cols\030\001 \002(\004\022\020\n\010num_rows"
+  "\030\002 \002(\004\022\024\n\014num_messages\030\003 \002(\r\"Y\n\022SparseMa"
+  "trixHeader\022\023\n\013num_vectors\030\001 \002(\004\022\024\n\014num_f"
+  "eatures\030\002 \002(\004\022\030\n\020num_feat_entries\030\003 \003(\004\""
+  "L\n\020StringListHeader\022\017\n\007num_str\030\001 \002(\004\022\026\n\016"
+  "max_string_len\030\002 \002(\004\022\017\n\007str_len\030\003 \003(\004"
+  ;
+static ::_pbi::once_flag descriptor_table_Headers_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_Headers_2eproto = {
+    false, false, 317, descriptor_table_protodef_Headers_2eproto,
+    "Headers.proto",
+    &descriptor_table_Headers_2eproto_once, nullptr, 0, 4,
+    schemas, file_default_instances, TableStruct_Headers_2eproto::offsets,
+    file_level_metadata_Headers_2eproto, file_level_enum_descriptors_Headers_2eproto,
+    file_level_service_descriptors_Headers_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_Headers_2eproto_getter() {
+  return &descriptor_table_Headers_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_Headers_2eproto(&descriptor_table_Headers_2eproto);
+namespace shogun {
+
+// ===================================================================
+
+class VectorHeader::_Internal {
+ public:
+  using HasBits = decltype(std::declval<VectorHeader>()._impl_._has_bits_);
+  static void set_has_len(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_num_messages(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+VectorHeader::VectorHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:shogun.VectorHeader)
+}
+VectorHeader::VectorHeader(const VectorHeader& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  VectorHeader* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.len_){}
+    , decltype(_impl_.num_messages_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.len_, &from._impl_.len_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.num_messages_) -
+    reinterpret_cast<char*>(&_impl_.len_)) + sizeof(_impl_.num_messages_));
+  // @@protoc_insertion_point(copy_constructor:shogun.VectorHeader)
+}
+
+inline void VectorHeader::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.len_){uint64_t{0u}}
+    , decltype(_impl_.num_messages_){0u}
+  };
+}
+
+VectorHeader::~VectorHeader() {
+  // @@protoc_insertion_point(destructor:shogun.VectorHeader)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void VectorHeader::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void VectorHeader::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void VectorHeader::Clear() {
+// @@protoc_insertion_point(message_clear_start:shogun.VectorHeader)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.len_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.num_messages_) -
+        reinterpret_cast<char*>(&_impl_.len_)) + sizeof(_impl_.num_messages_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* VectorHeader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 len = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_len(&has_bits);
+          _impl_.len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 num_messages = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_num_messages(&has_bits);
+          _impl_.num_messages_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* VectorHeader::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:shogun.VectorHeader)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 len = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_len(), target);
+  }
+
+  // required uint32 num_messages = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_num_messages(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:shogun.VectorHeader)
+  return target;
+}
+
+size_t VectorHeader::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:shogun.VectorHeader)
+  size_t total_size = 0;
+
+  if (_internal_has_len()) {
+    // required uint64 len = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_len());
+  }
+
+  if (_internal_has_num_messages()) {
+    // required uint32 num_messages = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_num_messages());
+  }
+
+  return total_size;
+}
+size_t VectorHeader::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:shogun.VectorHeader)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 len = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_len());
+
+    // required uint32 num_messages = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_num_messages());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData VectorHeader::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    VectorHeader::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*VectorHeader::GetClassData() const { return &_class_data_; }
+
+
+void VectorHeader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<VectorHeader*>(&to_msg);
+  auto& from = static_cast<const VectorHeader&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:shogun.VectorHeader)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.len_ = from._impl_.len_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.num_messages_ = from._impl_.num_messages_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VectorHeader::CopyFrom(const VectorHeader& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:shogun.VectorHeader)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool VectorHeader::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void VectorHeader::InternalSwap(VectorHeader* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(VectorHeader, _impl_.num_messages_)
+      + sizeof(VectorHeader::_impl_.num_messages_)
+      - PROTOBUF_FIELD_OFFSET(VectorHeader, _impl_.len_)>(
+          reinterpret_cast<char*>(&_impl_.len_),
+          reinterpret_cast<char*>(&other->_impl_.len_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata VectorHeader::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Headers_2eproto_getter, &descriptor_table_Headers_2eproto_once,
+      file_level_metadata_Headers_2eproto[0]);
+}
+
+// ===================================================================
+
+class MatrixHeader::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MatrixHeader>()._impl_._has_bits_);
+  static void set_has_num_cols(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_num_rows(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_num_messages(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+MatrixHeader::MatrixHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:shogun.MatrixHeader)
+}
+MatrixHeader::MatrixHeader(const MatrixHeader& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MatrixHeader* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.num_cols_){}
+    , decltype(_impl_.num_rows_){}
+    , decltype(_impl_.num_messages_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.num_cols_, &from._impl_.num_cols_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.num_messages_) -
+    reinterpret_cast<char*>(&_impl_.num_cols_)) + sizeof(_impl_.num_messages_));
+  // @@protoc_insertion_point(copy_constructor:shogun.MatrixHeader)
+}
+
+inline void MatrixHeader::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.num_cols_){uint64_t{0u}}
+    , decltype(_impl_.num_rows_){uint64_t{0u}}
+    , decltype(_impl_.num_messages_){0u}
+  };
+}
+
+MatrixHeader::~MatrixHeader() {
+  // @@protoc_insertion_point(destructor:shogun.MatrixHeader)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MatrixHeader::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void MatrixHeader::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MatrixHeader::Clear() {
+// @@protoc_insertion_point(message_clear_start:shogun.MatrixHeader)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.num_cols_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.num_messages_) -
+        reinterpret_cast<char*>(&_impl_.num_cols_)) + sizeof(_impl_.num_messages_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MatrixHeader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 num_cols = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_num_cols(&has_bits);
+          _impl_.num_cols_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 num_rows = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_num_rows(&has_bits);
+          _impl_.num_rows_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 num_messages = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_num_messages(&has_bits);
+          _impl_.num_messages_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MatrixHeader::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:shogun.MatrixHeader)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 num_cols = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_num_cols(), target);
+  }
+
+  // required uint64 num_rows = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_num_rows(), target);
+  }
+
+  // required uint32 num_messages = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_num_messages(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:shogun.MatrixHeader)
+  return target;
+}
+
+size_t MatrixHeader::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:shogun.MatrixHeader)
+  size_t total_size = 0;
+
+  if (_internal_has_num_cols()) {
+    // required uint64 num_cols = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_cols());
+  }
+
+  if (_internal_has_num_rows()) {
+    // required uint64 num_rows = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_rows());
+  }
+
+  if (_internal_has_num_messages()) {
+    // required uint32 num_messages = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_num_messages());
+  }
+
+  return total_size;
+}
+size_t MatrixHeader::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:shogun.MatrixHeader)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required uint64 num_cols = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_cols());
+
+    // required uint64 num_rows = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_rows());
+
+    // required uint32 num_messages = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_num_messages());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MatrixHeader::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MatrixHeader::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MatrixHeader::GetClassData() const { return &_class_data_; }
+
+
+void MatrixHeader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MatrixHeader*>(&to_msg);
+  auto& from = static_cast<const MatrixHeader&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:shogun.MatrixHeader)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.num_cols_ = from._impl_.num_cols_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.num_rows_ = from._impl_.num_rows_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.num_messages_ = from._impl_.num_messages_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MatrixHeader::CopyFrom(const MatrixHeader& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:shogun.MatrixHeader)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MatrixHeader::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void MatrixHeader::InternalSwap(MatrixHeader* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MatrixHeader, _impl_.num_messages_)
+      + sizeof(MatrixHeader::_impl_.num_messages_)
+      - PROTOBUF_FIELD_OFFSET(MatrixHeader, _impl_.num_cols_)>(
+          reinterpret_cast<char*>(&_impl_.num_cols_),
+          reinterpret_cast<char*>(&other->_impl_.num_cols_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MatrixHeader::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Headers_2eproto_getter, &descriptor_table_Headers_2eproto_once,
+      file_level_metadata_Headers_2eproto[1]);
+}
+
+// ===================================================================
+
+class SparseMatrixHeader::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SparseMatrixHeader>()._impl_._has_bits_);
+  static void set_has_num_vectors(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_num_features(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+SparseMatrixHeader::SparseMatrixHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:shogun.SparseMatrixHeader)
+}
+SparseMatrixHeader::SparseMatrixHeader(const SparseMatrixHeader& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SparseMatrixHeader* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.num_feat_entries_){from._impl_.num_feat_entries_}
+    , decltype(_impl_.num_vectors_){}
+    , decltype(_impl_.num_features_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.num_vectors_, &from._impl_.num_vectors_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.num_features_) -
+    reinterpret_cast<char*>(&_impl_.num_vectors_)) + sizeof(_impl_.num_features_));
+  // @@protoc_insertion_point(copy_constructor:shogun.SparseMatrixHeader)
+}
+
+inline void SparseMatrixHeader::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.num_feat_entries_){arena}
+    , decltype(_impl_.num_vectors_){uint64_t{0u}}
+    , decltype(_impl_.num_features_){uint64_t{0u}}
+  };
+}
+
+SparseMatrixHeader::~SparseMatrixHeader() {
+  // @@protoc_insertion_point(destructor:shogun.SparseMatrixHeader)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SparseMatrixHeader::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.num_feat_entries_.~RepeatedField();
+}
+
+void SparseMatrixHeader::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SparseMatrixHeader::Clear() {
+// @@protoc_insertion_point(message_clear_start:shogun.SparseMatrixHeader)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.num_feat_entries_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.num_vectors_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.num_features_) -
+        reinterpret_cast<char*>(&_impl_.num_vectors_)) + sizeof(_impl_.num_features_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SparseMatrixHeader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 num_vectors = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_num_vectors(&has_bits);
+          _impl_.num_vectors_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 num_features = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_num_features(&has_bits);
+          _impl_.num_features_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 num_feat_entries = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_num_feat_entries(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<24>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 26) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_num_feat_entries(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SparseMatrixHeader::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:shogun.SparseMatrixHeader)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 num_vectors = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_num_vectors(), target);
+  }
+
+  // required uint64 num_features = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_num_features(), target);
+  }
+
+  // repeated uint64 num_feat_entries = 3;
+  for (int i = 0, n = this->_internal_num_feat_entries_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_num_feat_entries(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:shogun.SparseMatrixHeader)
+  return target;
+}
+
+size_t SparseMatrixHeader::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:shogun.SparseMatrixHeader)
+  size_t total_size = 0;
+
+  if (_internal_has_num_vectors()) {
+    // required uint64 num_vectors = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_vectors());
+  }
+
+  if (_internal_has_num_features()) {
+    // required uint64 num_features = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_features());
+  }
+
+  return total_size;
+}
+size_t SparseMatrixHeader::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:shogun.SparseMatrixHeader)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 num_vectors = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_vectors());
+
+    // required uint64 num_features = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_features());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 num_feat_entries = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.num_feat_entries_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_num_feat_entries_size());
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SparseMatrixHeader::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SparseMatrixHeader::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SparseMatrixHeader::GetClassData() const { return &_class_data_; }
+
+
+void SparseMatrixHeader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SparseMatrixHeader*>(&to_msg);
+  auto& from = static_cast<const SparseMatrixHeader&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:shogun.SparseMatrixHeader)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.num_feat_entries_.MergeFrom(from._impl_.num_feat_entries_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.num_vectors_ = from._impl_.num_vectors_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.num_features_ = from._impl_.num_features_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SparseMatrixHeader::CopyFrom(const SparseMatrixHeader& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:shogun.SparseMatrixHeader)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SparseMatrixHeader::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SparseMatrixHeader::InternalSwap(SparseMatrixHeader* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.num_feat_entries_.InternalSwap(&other->_impl_.num_feat_entries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SparseMatrixHeader, _impl_.num_features_)
+      + sizeof(SparseMatrixHeader::_impl_.num_features_)
+      - PROTOBUF_FIELD_OFFSET(SparseMatrixHeader, _impl_.num_vectors_)>(
+          reinterpret_cast<char*>(&_impl_.num_vectors_),
+          reinterpret_cast<char*>(&other->_impl_.num_vectors_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SparseMatrixHeader::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Headers_2eproto_getter, &descriptor_table_Headers_2eproto_once,
+      file_level_metadata_Headers_2eproto[2]);
+}
+
+// ===================================================================
+
+class StringListHeader::_Internal {
+ public:
+  using HasBits = decltype(std::declval<StringListHeader>()._impl_._has_bits_);
+  static void set_has_num_str(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_max_string_len(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+StringListHeader::StringListHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:shogun.StringListHeader)
+}
+StringListHeader::StringListHeader(const StringListHeader& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StringListHeader* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.str_len_){from._impl_.str_len_}
+    , decltype(_impl_.num_str_){}
+    , decltype(_impl_.max_string_len_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.num_str_, &from._impl_.num_str_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_string_len_) -
+    reinterpret_cast<char*>(&_impl_.num_str_)) + sizeof(_impl_.max_string_len_));
+  // @@protoc_insertion_point(copy_constructor:shogun.StringListHeader)
+}
+
+inline void StringListHeader::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.str_len_){arena}
+    , decltype(_impl_.num_str_){uint64_t{0u}}
+    , decltype(_impl_.max_string_len_){uint64_t{0u}}
+  };
+}
+
+StringListHeader::~StringListHeader() {
+  // @@protoc_insertion_point(destructor:shogun.StringListHeader)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StringListHeader::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.str_len_.~RepeatedField();
+}
+
+void StringListHeader::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StringListHeader::Clear() {
+// @@protoc_insertion_point(message_clear_start:shogun.StringListHeader)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.str_len_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.num_str_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.max_string_len_) -
+        reinterpret_cast<char*>(&_impl_.num_str_)) + sizeof(_impl_.max_string_len_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StringListHeader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 num_str = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_num_str(&has_bits);
+          _impl_.num_str_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 max_string_len = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_max_string_len(&has_bits);
+          _impl_.max_string_len_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 str_len = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_str_len(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<24>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 26) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_str_len(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StringListHeader::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:shogun.StringListHeader)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 num_str = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_num_str(), target);
+  }
+
+  // required uint64 max_string_len = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_max_string_len(), target);
+  }
+
+  // repeated uint64 str_len = 3;
+  for (int i = 0, n = this->_internal_str_len_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_str_len(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:shogun.StringListHeader)
+  return target;
+}
+
+size_t StringListHeader::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:shogun.StringListHeader)
+  size_t total_size = 0;
+
+  if (_internal_has_num_str()) {
+    // required uint64 num_str = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_str());
+  }
+
+  if (_internal_has_max_string_len()) {
+    // required uint64 max_string_len = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max_string_len());
+  }
+
+  return total_size;
+}
+size_t StringListHeader::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:shogun.StringListHeader)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 num_str = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_str());
+
+    // required uint64 max_string_len = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max_string_len());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 str_len = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.str_len_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_str_len_size());
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StringListHeader::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StringListHeader::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StringListHeader::GetClassData() const { return &_class_data_; }
+
+
+void StringListHeader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StringListHeader*>(&to_msg);
+  auto& from = static_cast<const StringListHeader&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:shogun.StringListHeader)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.str_len_.MergeFrom(from._impl_.str_len_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.num_str_ = from._impl_.num_str_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.max_string_len_ = from._impl_.max_string_len_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StringListHeader::CopyFrom(const StringListHeader& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:shogun.StringListHeader)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StringListHeader::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void StringListHeader::InternalSwap(StringListHeader* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.str_len_.InternalSwap(&other->_impl_.str_len_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StringListHeader, _impl_.max_string_len_)
+      + sizeof(StringListHeader::_impl_.max_string_len_)
+      - PROTOBUF_FIELD_OFFSET(StringListHeader, _impl_.num_str_)>(
+          reinterpret_cast<char*>(&_impl_.num_str_),
+          reinterpret_cast<char*>(&other->_impl_.num_str_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StringListHeader::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Headers_2eproto_getter, &descriptor_table_Headers_2eproto_once,
+      file_level_metadata_Headers_2eproto[3]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace shogun
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::shogun::VectorHeader*
+Arena::CreateMaybeMessage< ::shogun::VectorHeader >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::shogun::VectorHeader >(arena);
+}
+template<> PROTOBUF_NOINLINE ::shogun::MatrixHeader*
+Arena::CreateMaybeMessage< ::shogun::MatrixHeader >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::shogun::MatrixHeader >(arena);
+}
+template<> PROTOBUF_NOINLINE ::shogun::SparseMatrixHeader*
+Arena::CreateMaybeMessage< ::shogun::SparseMatrixHeader >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::shogun::SparseMatrixHeader >(arena);
+}
+template<> PROTOBUF_NOINLINE ::shogun::StringListHeader*
+Arena::CreateMaybeMessage< ::shogun::StringListHeader >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::shogun::StringListHeader >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
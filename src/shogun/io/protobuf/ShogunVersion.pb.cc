@@ -0,0 +1,382 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ShogunVersion.proto
+
+#include "ShogunVersion.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace shogun {
+PROTOBUF_CONSTEXPR ShogunVersion::ShogunVersion(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.version_)*/0
+  , /*decltype(_impl_.data_type_)*/1} {}
+struct ShogunVersionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ShogunVersionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ShogunVersionDefaultTypeInternal() {}
+  union {
+    ShogunVersion _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ShogunVersionDefaultTypeInternal _ShogunVersion_default_instance_;
+}  // namespace shogun
+static ::_pb::Metadata file_level_metadata_ShogunVersion_2eproto[1];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_ShogunVersion_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ShogunVersion_2eproto = nullptr;
+
+const uint32_t TableStruct_ShogunVersion_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::shogun::ShogunVersion, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::shogun::ShogunVersion, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::shogun::ShogunVersion, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::shogun::ShogunVersion, _impl_.data_type_),
+  0,
+  1,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::shogun::ShogunVersion)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::shogun::_ShogunVersion_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_ShogunVersion_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\023ShogunVersion.proto\022\006shogun\"\262\001\n\rShogun"
+  "Version\022\017\n\007version\030\001 \002(\005\0223\n\tdata_type\030\002 "
+  "\002(\0162 .shogun.ShogunVersion.SGDataType\"[\n"
+  "\nSGDataType\022\n\n\006VECTOR\020\001\022\n\n\006MATRIX\020\002\022\021\n\rS"
+  "PARSE_VECTOR\020\003\022\021\n\rSPARSE_MATRIX\020\004\022\017\n\013STR"
+  "ING_LIST\020\005"
+  ;
+static ::_pbi::once_flag descriptor_table_ShogunVersion_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ShogunVersion_2eproto = {
+    false, false, 210, descriptor_table_protodef_ShogunVersion_2eproto,
+    "ShogunVersion.proto",
+    &descriptor_table_ShogunVersion_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_ShogunVersion_2eproto::offsets,
+    file_level_metadata_ShogunVersion_2eproto, file_level_enum_descriptors_ShogunVersion_2eproto,
+    file_level_service_descriptors_ShogunVersion_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ShogunVersion_2eproto_getter() {
+  return &descriptor_table_ShogunVersion_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ShogunVersion_2eproto(&descriptor_table_ShogunVersion_2eproto);
+namespace shogun {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ShogunVersion_SGDataType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_ShogunVersion_2eproto);
+  return file_level_enum_descriptors_ShogunVersion_2eproto[0];
+}
+bool ShogunVersion_SGDataType_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ShogunVersion_SGDataType ShogunVersion::VECTOR;
+constexpr ShogunVersion_SGDataType ShogunVersion::MATRIX;
+constexpr ShogunVersion_SGDataType ShogunVersion::SPARSE_VECTOR;
+constexpr ShogunVersion_SGDataType ShogunVersion::SPARSE_MATRIX;
+constexpr ShogunVersion_SGDataType ShogunVersion::STRING_LIST;
+constexpr ShogunVersion_SGDataType ShogunVersion::SGDataType_MIN;
+constexpr ShogunVersion_SGDataType ShogunVersion::SGDataType_MAX;
+constexpr int ShogunVersion::SGDataType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+class ShogunVersion::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ShogunVersion>()._impl_._has_bits_);
+  static void set_has_version(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_data_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+ShogunVersion::ShogunVersion(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:shogun.ShogunVersion)
+}
+ShogunVersion::ShogunVersion(const ShogunVersion& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ShogunVersion* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.data_type_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.data_type_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.data_type_));
+  // @@protoc_insertion_point(copy_constructor:shogun.ShogunVersion)
+}
+
+inline void ShogunVersion::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.version_){0}
+    , decltype(_impl_.data_type_){1}
+  };
+}
+
+ShogunVersion::~ShogunVersion() {
+  // @@protoc_insertion_point(destructor:shogun.ShogunVersion)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ShogunVersion::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ShogunVersion::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ShogunVersion::Clear() {
+// @@protoc_insertion_point(message_clear_start:shogun.ShogunVersion)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    _impl_.version_ = 0;
+    _impl_.data_type_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ShogunVersion::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int32 version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_version(&has_bits);
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .shogun.ShogunVersion.SGDataType data_type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::shogun::ShogunVersion_SGDataType_IsValid(val))) {
+            _internal_set_data_type(static_cast<::shogun::ShogunVersion_SGDataType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ShogunVersion::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:shogun.ShogunVersion)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int32 version = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_version(), target);
+  }
+
+  // required .shogun.ShogunVersion.SGDataType data_type = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_data_type(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:shogun.ShogunVersion)
+  return target;
+}
+
+size_t ShogunVersion::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:shogun.ShogunVersion)
+  size_t total_size = 0;
+
+  if (_internal_has_version()) {
+    // required int32 version = 1;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_version());
+  }
+
+  if (_internal_has_data_type()) {
+    // required .shogun.ShogunVersion.SGDataType data_type = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_data_type());
+  }
+
+  return total_size;
+}
+size_t ShogunVersion::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:shogun.ShogunVersion)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required int32 version = 1;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_version());
+
+    // required .shogun.ShogunVersion.SGDataType data_type = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_data_type());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ShogunVersion::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ShogunVersion::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ShogunVersion::GetClassData() const { return &_class_data_; }
+
+
+void ShogunVersion::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ShogunVersion*>(&to_msg);
+  auto& from = static_cast<const ShogunVersion&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:shogun.ShogunVersion)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.version_ = from._impl_.version_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.data_type_ = from._impl_.data_type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ShogunVersion::CopyFrom(const ShogunVersion& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:shogun.ShogunVersion)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ShogunVersion::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ShogunVersion::InternalSwap(ShogunVersion* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.version_, other->_impl_.version_);
+  swap(_impl_.data_type_, other->_impl_.data_type_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ShogunVersion::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ShogunVersion_2eproto_getter, &descriptor_table_ShogunVersion_2eproto_once,
+      file_level_metadata_ShogunVersion_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace shogun
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::shogun::ShogunVersion*
+Arena::CreateMaybeMessage< ::shogun::ShogunVersion >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::shogun::ShogunVersion >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
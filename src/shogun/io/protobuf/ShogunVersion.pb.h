@@ -0,0 +1,387 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ShogunVersion.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ShogunVersion_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ShogunVersion_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_ShogunVersion_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_ShogunVersion_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ShogunVersion_2eproto;
+namespace shogun {
+class ShogunVersion;
+struct ShogunVersionDefaultTypeInternal;
+extern ShogunVersionDefaultTypeInternal _ShogunVersion_default_instance_;
+}  // namespace shogun
+PROTOBUF_NAMESPACE_OPEN
+template<> ::shogun::ShogunVersion* Arena::CreateMaybeMessage<::shogun::ShogunVersion>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace shogun {
+
+enum ShogunVersion_SGDataType : int {
+  ShogunVersion_SGDataType_VECTOR = 1,
+  ShogunVersion_SGDataType_MATRIX = 2,
+  ShogunVersion_SGDataType_SPARSE_VECTOR = 3,
+  ShogunVersion_SGDataType_SPARSE_MATRIX = 4,
+  ShogunVersion_SGDataType_STRING_LIST = 5
+};
+bool ShogunVersion_SGDataType_IsValid(int value);
+constexpr ShogunVersion_SGDataType ShogunVersion_SGDataType_SGDataType_MIN = ShogunVersion_SGDataType_VECTOR;
+constexpr ShogunVersion_SGDataType ShogunVersion_SGDataType_SGDataType_MAX = ShogunVersion_SGDataType_STRING_LIST;
+constexpr int ShogunVersion_SGDataType_SGDataType_ARRAYSIZE = ShogunVersion_SGDataType_SGDataType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ShogunVersion_SGDataType_descriptor();
+template<typename T>
+inline const std::string& ShogunVersion_SGDataType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ShogunVersion_SGDataType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ShogunVersion_SGDataType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ShogunVersion_SGDataType_descriptor(), enum_t_value);
+}
+inline bool ShogunVersion_SGDataType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ShogunVersion_SGDataType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ShogunVersion_SGDataType>(
+    ShogunVersion_SGDataType_descriptor(), name, value);
+}
+// ===================================================================
+
+class ShogunVersion final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:shogun.ShogunVersion) */ {
+ public:
+  inline ShogunVersion() : ShogunVersion(nullptr) {}
+  ~ShogunVersion() override;
+  explicit PROTOBUF_CONSTEXPR ShogunVersion(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ShogunVersion(const ShogunVersion& from);
+  ShogunVersion(ShogunVersion&& from) noexcept
+    : ShogunVersion() {
+    *this = ::std::move(from);
+  }
+
+  inline ShogunVersion& operator=(const ShogunVersion& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ShogunVersion& operator=(ShogunVersion&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ShogunVersion& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ShogunVersion* internal_default_instance() {
+    return reinterpret_cast<const ShogunVersion*>(
+               &_ShogunVersion_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ShogunVersion& a, ShogunVersion& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ShogunVersion* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ShogunVersion* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ShogunVersion* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ShogunVersion>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ShogunVersion& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ShogunVersion& from) {
+    ShogunVersion::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ShogunVersion* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "shogun.ShogunVersion";
+  }
+  protected:
+  explicit ShogunVersion(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ShogunVersion_SGDataType SGDataType;
+  static constexpr SGDataType VECTOR =
+    ShogunVersion_SGDataType_VECTOR;
+  static constexpr SGDataType MATRIX =
+    ShogunVersion_SGDataType_MATRIX;
+  static constexpr SGDataType SPARSE_VECTOR =
+    ShogunVersion_SGDataType_SPARSE_VECTOR;
+  static constexpr SGDataType SPARSE_MATRIX =
+    ShogunVersion_SGDataType_SPARSE_MATRIX;
+  static constexpr SGDataType STRING_LIST =
+    ShogunVersion_SGDataType_STRING_LIST;
+  static inline bool SGDataType_IsValid(int value) {
+    return ShogunVersion_SGDataType_IsValid(value);
+  }
+  static constexpr SGDataType SGDataType_MIN =
+    ShogunVersion_SGDataType_SGDataType_MIN;
+  static constexpr SGDataType SGDataType_MAX =
+    ShogunVersion_SGDataType_SGDataType_MAX;
+  static constexpr int SGDataType_ARRAYSIZE =
+    ShogunVersion_SGDataType_SGDataType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  SGDataType_descriptor() {
+    return ShogunVersion_SGDataType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& SGDataType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, SGDataType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function SGDataType_Name.");
+    return ShogunVersion_SGDataType_Name(enum_t_value);
+  }
+  static inline bool SGDataType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      SGDataType* value) {
+    return ShogunVersion_SGDataType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVersionFieldNumber = 1,
+    kDataTypeFieldNumber = 2,
+  };
+  // required int32 version = 1;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  int32_t version() const;
+  void set_version(int32_t value);
+  private:
+  int32_t _internal_version() const;
+  void _internal_set_version(int32_t value);
+  public:
+
+  // required .shogun.ShogunVersion.SGDataType data_type = 2;
+  bool has_data_type() const;
+  private:
+  bool _internal_has_data_type() const;
+  public:
+  void clear_data_type();
+  ::shogun::ShogunVersion_SGDataType data_type() const;
+  void set_data_type(::shogun::ShogunVersion_SGDataType value);
+  private:
+  ::shogun::ShogunVersion_SGDataType _internal_data_type() const;
+  void _internal_set_data_type(::shogun::ShogunVersion_SGDataType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:shogun.ShogunVersion)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t version_;
+    int data_type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ShogunVersion_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ShogunVersion
+
+// required int32 version = 1;
+inline bool ShogunVersion::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ShogunVersion::has_version() const {
+  return _internal_has_version();
+}
+inline void ShogunVersion::clear_version() {
+  _impl_.version_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t ShogunVersion::_internal_version() const {
+  return _impl_.version_;
+}
+inline int32_t ShogunVersion::version() const {
+  // @@protoc_insertion_point(field_get:shogun.ShogunVersion.version)
+  return _internal_version();
+}
+inline void ShogunVersion::_internal_set_version(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.version_ = value;
+}
+inline void ShogunVersion::set_version(int32_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:shogun.ShogunVersion.version)
+}
+
+// required .shogun.ShogunVersion.SGDataType data_type = 2;
+inline bool ShogunVersion::_internal_has_data_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ShogunVersion::has_data_type() const {
+  return _internal_has_data_type();
+}
+inline void ShogunVersion::clear_data_type() {
+  _impl_.data_type_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::shogun::ShogunVersion_SGDataType ShogunVersion::_internal_data_type() const {
+  return static_cast< ::shogun::ShogunVersion_SGDataType >(_impl_.data_type_);
+}
+inline ::shogun::ShogunVersion_SGDataType ShogunVersion::data_type() const {
+  // @@protoc_insertion_point(field_get:shogun.ShogunVersion.data_type)
+  return _internal_data_type();
+}
+inline void ShogunVersion::_internal_set_data_type(::shogun::ShogunVersion_SGDataType value) {
+  assert(::shogun::ShogunVersion_SGDataType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.data_type_ = value;
+}
+inline void ShogunVersion::set_data_type(::shogun::ShogunVersion_SGDataType value) {
+  _internal_set_data_type(value);
+  // @@protoc_insertion_point(field_set:shogun.ShogunVersion.data_type)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace shogun
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::shogun::ShogunVersion_SGDataType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::shogun::ShogunVersion_SGDataType>() {
+  return ::shogun::ShogunVersion_SGDataType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ShogunVersion_2eproto
@@ -17,6 +17,7 @@
 #ifdef HAVE_PTHREAD
 
 #include <shogun/io/SGIO.h>
+#include <shogun/lib/Metrics.h>
 #include <shogun/io/streaming/StreamingFile.h>
 #include <shogun/io/streaming/ParseBuffer.h>
 #include <pthread.h>
@@ -73,6 +74,10 @@ namespace shogun
  * The parsing thread should be joined with a call to end_parser().
  * exit_parser() may be used to cancel the parse thread if needed.
  *
+ * If shogun is built with USE_METRICS, the number of parsed examples and
+ * the time spent parsing and waiting for free examples in the ring are
+ * recorded in the metrics of the input CStreamingFile.
+ *
  * Options are provided for automatic SG_FREEing of example objects
  * after each finalize_example() and also on CInputParser destruction.
  * They are set through the set_free_vector* functions.
@@ -186,6 +191,17 @@ public:
      */
     void set_free_vector_after_release(bool free_vec);
 
+    /**
+     * Sets whether examples are held until they are finalized. If so,
+     * get_next_example() moves on to the next example right away, and
+     * several examples can be used at a time. They have to be finalized in
+     * the order they were obtained. Otherwise, the same example is returned
+     * until it is finalized.
+     *
+     * @param hold whether to hold examples, false by default
+     */
+    void set_hold_examples(bool hold);
+
     /**
      * Sets whether to free all vectors that were
      * allocated in the ring upon destruction of the ring.
@@ -346,6 +362,9 @@ protected:
     /// Whether to SG_FREE() vector after it is used
     bool free_after_release;
 
+    /// Whether examples are held until they are finalized
+    bool hold_examples;
+
     /// Size of the ring of examples
     int32_t ring_size;
 
@@ -416,6 +435,7 @@ template <class T>
     current_feature_vector = NULL;
 
     free_after_release=true;
+    hold_examples=false;
     ring_size=size;
 }
 
@@ -425,6 +445,12 @@ template <class T>
     free_after_release=free_vec;
 }
 
+template <class T>
+    void CInputParser<T>::set_hold_examples(bool hold)
+{
+    hold_examples=hold;
+}
+
 template <class T>
     void CInputParser<T>::set_free_vectors_on_destruct(bool destroy)
 {
@@ -521,6 +547,7 @@ template <class T> void* CInputParser<T>::main_parse_loop(void* params)
 #ifdef HAVE_PTHREAD
     CInputParser* this_obj = (CInputParser *) params;
     this->input_source = this_obj->input_source;
+    SG_METRIC_STOPWATCH(parse_timer)
 
     while (1)
 	{
@@ -534,7 +561,9 @@ template <class T> void* CInputParser<T>::main_parse_loop(void* params)
 
 		pthread_testcancel();
 
+		SG_METRIC_RESTART(parse_timer)
 		current_example = examples_ring->get_free_example();
+		SG_METRIC_LAP(input_source, parse_timer, "parser_wait_for_free_example")
 		current_feature_vector = current_example->fv;
 		current_len = current_example->length;
 		current_label = current_example->label;
@@ -543,6 +572,7 @@ template <class T> void* CInputParser<T>::main_parse_loop(void* params)
 			get_vector_and_label(current_feature_vector, current_len, current_label);
 		else
 			get_vector_only(current_feature_vector,	current_len);
+		SG_METRIC_LAP(input_source, parse_timer, "parser_parse")
 
 		if (current_len < 0)
 		{
@@ -558,6 +588,7 @@ template <class T> void* CInputParser<T>::main_parse_loop(void* params)
 		current_example->length = current_len;
 
 		examples_ring->copy_example(current_example);
+		SG_METRIC_INC(input_source, "parser_examples")
 
 		pthread_mutex_lock(&examples_state_lock);
 		number_of_vectors_parsed++;
@@ -592,7 +623,10 @@ template <class T> Example<T>* CInputParser<T>::retrieve_example()
         return NULL;
     }
 
-    ex = examples_ring->get_unused_example();
+    if (hold_examples)
+        ex = examples_ring->hold_unused_example();
+    else
+        ex = examples_ring->get_unused_example();
     number_of_vectors_read++;
 
     return ex;
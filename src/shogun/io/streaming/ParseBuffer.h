@@ -15,19 +15,23 @@
 #include <shogun/lib/common.h>
 #ifdef HAVE_PTHREAD
 
+#include <shogun/base/SGObject.h>
 #include <shogun/lib/DataType.h>
 #include <pthread.h>
+#include <float.h>
 
 namespace shogun
 {
 
 /// Specifies whether location is empty,
-/// contains an unused example or a used example.
+/// contains an unused example, an example which
+/// was read but not released yet, or a used example.
 enum E_IS_EXAMPLE_USED
 {
 	E_EMPTY = 1,
 	E_NOT_USED = 2,
-	E_USED = 3
+	E_USED = 3,
+	E_IN_USE = 4
 };
 
 /** @brief Class Example is the container type for
@@ -92,7 +96,8 @@ public:
 	{
 		pthread_mutex_lock(write_lock);
 		pthread_mutex_lock(&ex_in_use_mutex[ex_write_index]);
-		while (ex_used[ex_write_index] == E_NOT_USED)
+		while (ex_used[ex_write_index] == E_NOT_USED ||
+				ex_used[ex_write_index] == E_IN_USE)
 			pthread_cond_wait(&ex_in_use_cond[ex_write_index], &ex_in_use_mutex[ex_write_index]);
 		Example<T>* ex=&ex_ring[ex_write_index];
 		pthread_mutex_unlock(&ex_in_use_mutex[ex_write_index]);
@@ -125,6 +130,18 @@ public:
 	 */
 	Example<T>* get_unused_example();
 
+	/**
+	 * Returns the next example from the buffer if unused, or NULL.
+	 * Unlike get_unused_example(), the 'read' position moves on to the
+	 * following example, so several examples can be held by the caller
+	 * at a time. They have to be released through finalize_example() in
+	 * the order they were read, and are not overwritten or returned again
+	 * before.
+	 *
+	 * @return unused example object at next 'read' position or NULL.
+	 */
+	Example<T>* hold_unused_example();
+
 	/**
 	 * Copies an example into the buffer, waiting for the
 	 * destination example to be used if necessary.
@@ -136,7 +153,8 @@ public:
 	int32_t copy_example(Example<T>* ex);
 
 	/**
-	 * Mark the example in 'read' position as 'used'.
+	 * Mark the example in 'read' position as 'used', or the oldest held
+	 * example if there is one.
 	 *
 	 * It will then be free to be overwritten.
 	 *
@@ -189,6 +207,15 @@ protected:
 		ex_read_index=(ex_read_index + 1) % ring_size;
 	}
 
+	/**
+	 * Increments the 'release' position in the buffer.
+	 *
+	 */
+	virtual void inc_release_index()
+	{
+		ex_release_index=(ex_release_index + 1) % ring_size;
+	}
+
 	/**
 	 * Increments the 'write' position in the buffer.
 	 *
@@ -220,6 +247,8 @@ protected:
 	int32_t ex_write_index;
 	/// Position of next example to be read
 	int32_t ex_read_index;
+	/// Position of the oldest example that was read but not released
+	int32_t ex_release_index;
 
 	/// Whether examples on the ring will be freed on destruction
 	bool free_vectors_on_destruct;
@@ -251,6 +280,7 @@ template <class T> CParseBuffer<T>::CParseBuffer(int32_t size)
 
 	ex_write_index = 0;
 	ex_read_index = 0;
+	ex_release_index = 0;
 
 	for (int32_t i=0; i<ring_size; i++)
 	{
@@ -334,6 +364,31 @@ Example<T>* CParseBuffer<T>::get_unused_example()
 	return ex;
 }
 
+template <class T>
+Example<T>* CParseBuffer<T>::hold_unused_example()
+{
+	pthread_mutex_lock(read_lock);
+
+	Example<T> *ex;
+	int32_t current_index = ex_read_index;
+
+	pthread_mutex_lock(&ex_in_use_mutex[current_index]);
+
+	if (ex_used[current_index] == E_NOT_USED)
+	{
+		ex = return_example_to_read();
+		ex_used[current_index] = E_IN_USE;
+		inc_read_index();
+	}
+	else
+		ex = NULL;
+
+	pthread_mutex_unlock(&ex_in_use_mutex[current_index]);
+
+	pthread_mutex_unlock(read_lock);
+	return ex;
+}
+
 template <class T>
 int32_t CParseBuffer<T>::copy_example(Example<T> *ex)
 {
@@ -342,7 +397,8 @@ int32_t CParseBuffer<T>::copy_example(Example<T> *ex)
 	int32_t current_index = ex_write_index;
 
 	pthread_mutex_lock(&ex_in_use_mutex[current_index]);
-	while (ex_used[ex_write_index] == E_NOT_USED)
+	while (ex_used[ex_write_index] == E_NOT_USED ||
+			ex_used[ex_write_index] == E_IN_USE)
 	{
 		pthread_cond_wait(&ex_in_use_cond[ex_write_index], &ex_in_use_mutex[ex_write_index]);
 	}
@@ -359,21 +415,26 @@ template <class T>
 void CParseBuffer<T>::finalize_example(bool free_after_release)
 {
 	pthread_mutex_lock(read_lock);
-	pthread_mutex_lock(&ex_in_use_mutex[ex_read_index]);
-	ex_used[ex_read_index] = E_USED;
+	pthread_mutex_lock(&ex_in_use_mutex[ex_release_index]);
+	// examples from get_unused_example() are still at the 'read' position,
+	// held ones were passed by it
+	bool held = ex_used[ex_release_index] == E_IN_USE;
+	ex_used[ex_release_index] = E_USED;
 
 	if (free_after_release)
 	{
 		SG_DEBUG("Freeing object in ring at index %d and address: %p.\n",
-			 ex_read_index, ex_ring[ex_read_index].fv);
+			 ex_release_index, ex_ring[ex_release_index].fv);
 
-		SG_FREE(ex_ring[ex_read_index].fv);
-		ex_ring[ex_read_index].fv=NULL;
+		SG_FREE(ex_ring[ex_release_index].fv);
+		ex_ring[ex_release_index].fv=NULL;
 	}
 
-	pthread_cond_signal(&ex_in_use_cond[ex_read_index]);
-	pthread_mutex_unlock(&ex_in_use_mutex[ex_read_index]);
-	inc_read_index();
+	pthread_cond_signal(&ex_in_use_cond[ex_release_index]);
+	pthread_mutex_unlock(&ex_in_use_mutex[ex_release_index]);
+	inc_release_index();
+	if (!held)
+		inc_read_index();
 
 	pthread_mutex_unlock(read_lock);
 }
@@ -38,6 +38,69 @@
 
 using namespace shogun;
 
+namespace shogun
+{
+/** collects kernel values of one lhs vector with arbitrary rhs vectors,
+ * computes them block by block and writes them to their targets */
+template <class T> class KernelRowGather
+{
+	public:
+		/** constructor
+		 *
+		 * @param kernel kernel
+		 * @param idx_a index of the lhs vector
+		 */
+		KernelRowGather(CKernel* kernel, int32_t idx_a)
+			: m_kernel(kernel), m_num(0)
+		{
+			for (int32_t i=0; i<KERNEL_BLOCK_SIZE; i++)
+				m_idx_a[i]=idx_a;
+		}
+
+		/** computes the remaining values */
+		~KernelRowGather() { flush(); }
+
+		/** request a kernel value
+		 *
+		 * @param idx_b index of the rhs vector
+		 * @param target where to write the kernel value
+		 */
+		inline void add(int32_t idx_b, T* target)
+		{
+			m_idx_b[m_num]=idx_b;
+			m_targets[m_num]=target;
+			if (++m_num==KERNEL_BLOCK_SIZE)
+				flush();
+		}
+
+		/** compute the requested values */
+		void flush()
+		{
+			if (!m_num)
+				return;
+
+			m_kernel->kernel_block(m_idx_a, m_idx_b, m_num, m_values);
+			for (int32_t i=0; i<m_num; i++)
+				*m_targets[i]=(T) m_values[i];
+			m_num=0;
+		}
+
+	private:
+		/** kernel */
+		CKernel* m_kernel;
+		/** number of requested values */
+		int32_t m_num;
+		/** lhs indices, all the same */
+		int32_t m_idx_a[KERNEL_BLOCK_SIZE];
+		/** rhs indices */
+		int32_t m_idx_b[KERNEL_BLOCK_SIZE];
+		/** targets of the values */
+		T* m_targets[KERNEL_BLOCK_SIZE];
+		/** kernel values */
+		float64_t m_values[KERNEL_BLOCK_SIZE];
+};
+}
+
 CKernel::CKernel() : CSGObject()
 {
 	init();
@@ -235,6 +298,38 @@ void CKernel::kernel_cache_init(int32_t buffsize, bool regression_hack)
 	kernel_cache.time=0;
 }
 
+void CKernel::kernel_block(const int32_t* idx_a, const int32_t* idx_b,
+		int32_t num, float64_t* result)
+{
+	SG_METRIC_ADD(this, "kernel_evaluations", num)
+	for (int32_t i=0; i<num; i++)
+		result[i]=compute(idx_a[i], idx_b[i]);
+
+	normalizer->normalize_block(result, idx_a, idx_b, num);
+}
+
+void CKernel::kernel_row_block(int32_t idx_a, int32_t start_b, int32_t num,
+		float64_t* result)
+{
+	REQUIRE(idx_a>=0 && idx_a<num_lhs && start_b>=0 && num>=0 && start_b+num<=num_rhs,
+		"%s::kernel_row_block(): index out of Range: idx_a=%d/%d idx_b=%d..%d/%d\n",
+		get_name(), idx_a, num_lhs, start_b, start_b+num-1, num_rhs);
+
+	int32_t idx_a_block[KERNEL_BLOCK_SIZE];
+	int32_t idx_b_block[KERNEL_BLOCK_SIZE];
+	for (int32_t i=0; i<KERNEL_BLOCK_SIZE; i++)
+		idx_a_block[i]=idx_a;
+
+	for (int32_t offs=0; offs<num; offs+=KERNEL_BLOCK_SIZE)
+	{
+		int32_t len=CMath::min(KERNEL_BLOCK_SIZE, num-offs);
+		for (int32_t i=0; i<len; i++)
+			idx_b_block[i]=start_b+offs+i;
+
+		kernel_block(idx_a_block, idx_b_block, len, result+offs);
+	}
+}
+
 void CKernel::get_kernel_row(
 	int32_t docnum, int32_t *active2dnum, float64_t *buffer, bool full_line)
 {
@@ -248,9 +343,11 @@ void CKernel::get_kernel_row(
 	/* is cached? */
 	if(kernel_cache.index[docnum] != -1)
 	{
+		SG_METRIC_INC(this, "kernel_cache_hits")
 		kernel_cache.lru[kernel_cache.index[docnum]]=kernel_cache.time; /* lru */
 		start=((KERNELCACHE_IDX) kernel_cache.activenum)*kernel_cache.index[docnum];
 
+		KernelRowGather<float64_t> gather(this, docnum);
 		if (full_line)
 		{
 			for(j=0;j<get_num_vec_lhs();j++)
@@ -258,7 +355,7 @@ void CKernel::get_kernel_row(
 				if(kernel_cache.totdoc2active[j] >= 0)
 					buffer[j]=kernel_cache.buffer[start+kernel_cache.totdoc2active[j]];
 				else
-					buffer[j]=(float64_t) kernel(docnum, j);
+					gather.add(j, &buffer[j]);
 			}
 		}
 		else
@@ -272,26 +369,31 @@ void CKernel::get_kernel_row(
 					int32_t k=j;
 					if (k>=num_vectors)
 						k=2*num_vectors-1-k;
-					buffer[j]=(float64_t) kernel(docnum, k);
+					gather.add(k, &buffer[j]);
 				}
 			}
 		}
 	}
 	else
 	{
+		SG_METRIC_INC(this, "kernel_cache_misses")
 		if (full_line)
 		{
+			kernel_row_block(docnum, 0, get_num_vec_lhs(), buffer);
+#ifdef USE_SHORTREAL_KERNELCACHE
 			for(j=0;j<get_num_vec_lhs();j++)
-				buffer[j]=(KERNELCACHE_ELEM) kernel(docnum, j);
+				buffer[j]=(KERNELCACHE_ELEM) buffer[j];
+#endif
 		}
 		else
 		{
+			KernelRowGather<float64_t> gather(this, docnum);
 			for(i=0;(j=active2dnum[i])>=0;i++)
 			{
 				int32_t k=j;
 				if (k>=num_vectors)
 					k=2*num_vectors-1-k;
-				buffer[j]=(KERNELCACHE_ELEM) kernel(docnum, k);
+				gather.add(k, &buffer[j]);
 			}
 		}
 	}
@@ -311,9 +413,11 @@ void CKernel::cache_kernel_row(int32_t m)
 
 	if(!kernel_cache_check(m))   // not cached yet
 	{
+		SG_METRIC_INC(this, "kernel_cache_rows_computed")
 		cache = kernel_cache_clean_and_malloc(m);
 		if(cache) {
 			l=kernel_cache.totdoc2active[m];
+			KernelRowGather<KERNELCACHE_ELEM> gather(this, m);
 
 			for(j=0;j<kernel_cache.activenum;j++)  // fill cache
 			{
@@ -328,7 +432,7 @@ void CKernel::cache_kernel_row(int32_t m)
 					if (k>=num_vectors)
 						k=2*num_vectors-1-k;
 
-					cache[j]=kernel(m, k);
+					gather.add(k, &cache[j]);
 				}
 			}
 		}
@@ -348,6 +452,7 @@ void* CKernel::cache_multiple_kernel_row_helper(void* p)
 		KERNELCACHE_ELEM* cache=params->cache[i];
 		int32_t m = params->uncached_rows[i];
 		l=params->kernel_cache->totdoc2active[m];
+		KernelRowGather<KERNELCACHE_ELEM> gather(params->kernel, m);
 
 		for(j=0;j<params->kernel_cache->activenum;j++)  // fill cache
 		{
@@ -362,9 +467,10 @@ void* CKernel::cache_multiple_kernel_row_helper(void* p)
 					if (k>=params->num_vectors)
 						k=2*params->num_vectors-1-k;
 
-					cache[j]=params->kernel->kernel(m, k);
+					gather.add(k, &cache[j]);
 				}
 		}
+		gather.flush();
 
 		//now line m is cached
 		params->needs_computation[m]=0;
@@ -411,6 +517,7 @@ void CKernel::cache_multiple_kernel_rows(int32_t* rows, int32_t num_rows)
 			if (kernel_cache_check(idx))
 				continue;
 
+			SG_METRIC_INC(this, "kernel_cache_rows_computed")
 			needs_computation[idx]=1;
 			uncached_rows[num]=idx;
 			cache[num]= kernel_cache_clean_and_malloc(idx);
@@ -615,6 +722,7 @@ int32_t CKernel::kernel_cache_free_lru()
   }
 
   if(least_elem != -1) {
+    SG_METRIC_INC(this, "kernel_cache_evictions")
     kernel_cache_free(least_elem);
     kernel_cache.index[kernel_cache.invindex[least_elem]]=-1;
     kernel_cache.invindex[least_elem]=-1;
@@ -1304,6 +1412,9 @@ template <class T> void* CKernel::get_kernel_matrix_helper(void* p)
 	int64_t total_start=params->total_start;
 	int64_t total_end=params->total_end;
 	int64_t total=total_start;
+	int64_t total_reported=total_start;
+
+	float64_t values[KERNEL_BLOCK_SIZE];
 
 	for (int32_t i=i_start; i<i_end; i++)
 	{
@@ -1312,23 +1423,32 @@ template <class T> void* CKernel::get_kernel_matrix_helper(void* p)
 		if (symmetric)
 			j_start=i;
 
-		for (int32_t j=j_start; j<n; j++)
+		for (int32_t j_block=j_start; j_block<n; j_block+=KERNEL_BLOCK_SIZE)
 		{
-			float64_t v=k->kernel(i,j);
-			result[i+j*m]=v;
+			int32_t len=CMath::min(KERNEL_BLOCK_SIZE, n-j_block);
+			k->kernel_row_block(i, j_block, len, values);
 
-			if (symmetric && i!=j)
-				result[j+i*m]=v;
+			for (int32_t j=j_block; j<j_block+len; j++)
+			{
+				float64_t v=values[j-j_block];
+				result[i+j*m]=v;
+
+				if (symmetric && i!=j)
+					result[j+i*m]=v;
+			}
 
 			if (verbose)
 			{
-				total++;
+				total+=len;
 
-				if (symmetric && i!=j)
-					total++;
+				if (symmetric)
+					total+=len-(j_block==i);
 
-				if (total%100 == 0)
+				if (total-total_reported>=100)
+				{
+					total_reported=total;
 					SG_OBJ_PROGRESS(k, total, total_start, total_end)
+				}
 
 				if (CSignal::cancel_computations())
 					break;
@@ -19,6 +19,7 @@
 
 #include <shogun/lib/common.h>
 #include <shogun/lib/Signal.h>
+#include <shogun/lib/Metrics.h>
 #include <shogun/io/SGIO.h>
 #include <shogun/io/File.h>
 #include <shogun/mathematics/Math.h>
@@ -45,6 +46,10 @@ namespace shogun
 /** kernel cache index */
 typedef int64_t KERNELCACHE_IDX;
 
+/** number of kernel values which are computed and normalized together, see
+ * CKernel::kernel_block() */
+#define KERNEL_BLOCK_SIZE 256
+
 
 /** optimization type */
 enum EOptimizationType
@@ -210,9 +215,35 @@ class CKernel : public CSGObject
 				"%s::kernel(): index out of Range: idx_a=%d/%d idx_b=%d/%d\n",
 				get_name(), idx_a,num_lhs, idx_b,num_rhs);
 
+			SG_METRIC_INC(this, "kernel_evaluations")
 			return normalizer->normalize(compute(idx_a, idx_b), idx_a, idx_b);
 		}
 
+		/** get kernel function for pairs of lhs and rhs feature vectors
+		 *
+		 * All values are computed before the normalizer post-processes
+		 * them with one call, see CKernelNormalizer::normalize_block().
+		 * The indices are not checked.
+		 *
+		 * @param idx_a indices of lhs feature vectors
+		 * @param idx_b indices of rhs feature vectors
+		 * @param num number of pairs
+		 * @param result computed kernel functions
+		 */
+		void kernel_block(const int32_t* idx_a, const int32_t* idx_b,
+				int32_t num, float64_t* result);
+
+		/** get kernel function for lhs feature vector a and the consecutive
+		 * rhs feature vectors start_b,...,start_b+num-1
+		 *
+		 * @param idx_a index of lhs feature vector a
+		 * @param start_b index of the first rhs feature vector
+		 * @param num number of rhs feature vectors
+		 * @param result computed kernel functions
+		 */
+		void kernel_row_block(int32_t idx_a, int32_t start_b, int32_t num,
+				float64_t* result);
+
 		/** get kernel matrix
 		 *
 		 * @return computed kernel matrix (needs to be cleaned up)
@@ -280,9 +311,7 @@ class CKernel : public CSGObject
 		virtual SGVector<float64_t> get_kernel_row(int32_t i)
 		{
 			SGVector<float64_t> row = SGVector<float64_t>(num_lhs);
-
-			for (int32_t j=0; j!=num_lhs; j++)
-				row[j] = kernel(i,j);
+			kernel_row_block(i, 0, num_lhs, row.vector);
 
 			return row;
 		}
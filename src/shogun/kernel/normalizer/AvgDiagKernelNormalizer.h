@@ -89,6 +89,19 @@ class CAvgDiagKernelNormalizer : public CKernelNormalizer
 			return value/scale;
 		}
 
+		/** normalize a block of kernel values
+		 * @param values kernel values, normalized in place
+		 * @param idx_lhs indices of left hand side vectors
+		 * @param idx_rhs indices of right hand side vectors
+		 * @param num number of values
+		 */
+		virtual void normalize_block(float64_t* values,
+			const int32_t* idx_lhs, const int32_t* idx_rhs, int32_t num)
+		{
+			for (int32_t i=0; i<num; i++)
+				values[i]/=scale;
+		}
+
 		/** normalize only the left hand side vector
 		 * @param value value of a component of the left hand side feature vector
 		 * @param idx_lhs index of left hand side vector
@@ -77,6 +77,25 @@ class CKernelNormalizer : public CSGObject
 		virtual float64_t normalize(
 			float64_t value, int32_t idx_lhs, int32_t idx_rhs)=0;
 
+		/** normalize a block of kernel values
+		 *
+		 * The kernel computes a whole row, tile or batch of values before
+		 * normalizing them with one call. The default calls normalize()
+		 * for every value; normalizers which only rescale by precomputed
+		 * values override it with a plain loop.
+		 *
+		 * @param values kernel values, normalized in place
+		 * @param idx_lhs indices of left hand side vectors
+		 * @param idx_rhs indices of right hand side vectors
+		 * @param num number of values
+		 */
+		virtual void normalize_block(float64_t* values,
+			const int32_t* idx_lhs, const int32_t* idx_rhs, int32_t num)
+		{
+			for (int32_t i=0; i<num; i++)
+				values[i]=normalize(values[i], idx_lhs[i], idx_rhs[i]);
+		}
+
 		/** normalize only the left hand side vector
 		 * @param value value of a component of the left hand side feature vector
 		 * @param idx_lhs index of left hand side vector
@@ -84,6 +84,22 @@ class CTanimotoKernelNormalizer : public CKernelNormalizer
 			return value/(diag_sum-value);
 		}
 
+		/** normalize a block of kernel values
+		 * @param values kernel values, normalized in place
+		 * @param idx_lhs indices of left hand side vectors
+		 * @param idx_rhs indices of right hand side vectors
+		 * @param num number of values
+		 */
+		virtual void normalize_block(float64_t* values,
+			const int32_t* idx_lhs, const int32_t* idx_rhs, int32_t num)
+		{
+			for (int32_t i=0; i<num; i++)
+			{
+				float64_t diag_sum=diag_lhs[idx_lhs[i]]*diag_rhs[idx_rhs[i]];
+				values[i]=values[i]/(diag_sum-values[i]);
+			}
+		}
+
 		/** normalize only the left hand side vector
 		 * @param value value of a component of the left hand side feature vector
 		 * @param idx_lhs index of left hand side vector
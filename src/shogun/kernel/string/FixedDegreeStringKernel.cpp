@@ -20,7 +20,11 @@ using namespace shogun;
 void
 CFixedDegreeStringKernel::init()
 {
+	packed_computation=true;
+
 	SG_ADD(&degree, "degree", "The degree.", MS_AVAILABLE);
+	SG_ADD(&packed_computation, "packed_computation",
+		"If kernel is computed on packed strings.", MS_NOT_AVAILABLE);
 	set_normalizer(new CSqrtDiagKernelNormalizer());
 }
 
@@ -52,16 +56,26 @@ CFixedDegreeStringKernel::~CFixedDegreeStringKernel()
 bool CFixedDegreeStringKernel::init(CFeatures* l, CFeatures* r)
 {
 	CStringKernel<char>::init(l, r);
+	if (packed_computation)
+		packed_strings.pack(lhs, rhs);
+	else
+		packed_strings.clear();
 	return init_normalizer();
 }
 
 void CFixedDegreeStringKernel::cleanup()
 {
+	packed_strings.clear();
 	CKernel::cleanup();
 }
 
 float64_t CFixedDegreeStringKernel::compute(int32_t idx_a, int32_t idx_b)
 {
+	CPackedStrings* packed_a=packed_strings.get_packed_strings(lhs);
+	CPackedStrings* packed_b=packed_strings.get_packed_strings(rhs);
+	if (packed_a && packed_b && packed_a->is_compatible(*packed_b))
+		return compute_packed(packed_a, idx_a, packed_b, idx_b);
+
 	int32_t alen, blen;
 	bool free_avec, free_bvec;
 
@@ -86,3 +100,24 @@ float64_t CFixedDegreeStringKernel::compute(int32_t idx_a, int32_t idx_b)
 
 	return sum;
 }
+
+float64_t CFixedDegreeStringKernel::compute_packed(
+	CPackedStrings* packed_a, int32_t idx_a,
+	CPackedStrings* packed_b, int32_t idx_b)
+{
+	// can only deal with strings of same length
+	ASSERT(packed_a->get_length(idx_a)==packed_b->get_length(idx_b))
+
+	CPackedStrings::SMatchRuns runs;
+	int32_t start, run_len;
+	packed_a->begin_match_runs(idx_a, *packed_b, idx_b, runs);
+
+	int64_t sum=0;
+	while (packed_a->next_match_run(runs, start, run_len))
+	{
+		if (run_len>=degree)
+			sum+=run_len-degree+1;
+	}
+
+	return sum;
+}
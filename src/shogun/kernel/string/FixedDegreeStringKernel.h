@@ -15,6 +15,7 @@
 
 #include <shogun/lib/common.h>
 #include <shogun/kernel/string/StringKernel.h>
+#include <shogun/lib/PackedStrings.h>
 
 namespace shogun
 {
@@ -83,6 +84,22 @@ class CFixedDegreeStringKernel: public CStringKernel<char>
 		 */
 		virtual const char* get_name() const{ return "FixedDegreeStringKernel"; }
 
+		/** set if the kernel shall be computed on strings packed into bit
+		 * planes (see CPackedStrings), the packed strings are built in init()
+		 *
+		 * @param packed if packed computation shall be performed
+		 */
+		inline void set_use_packed_computation(bool packed)
+		{
+			packed_computation=packed;
+		}
+
+		/** check if packed computation is performed
+		 *
+		 * @return if packed computation is performed
+		 */
+		inline bool get_use_packed_computation() { return packed_computation; }
+
 	protected:
 		/** compute kernel function for features a and b
 		 * idx_{a,b} denote the index of the feature vectors
@@ -93,8 +110,26 @@ class CFixedDegreeStringKernel: public CStringKernel<char>
 		 * @return computed kernel function at indices a,b
 		 */
 		float64_t compute(int32_t idx_a, int32_t idx_b);
+
+		/** compute kernel function on the packed strings, every run of
+		 * l matches contains l-degree+1 matching substrings
+		 *
+		 * @param packed_a packed strings of lhs
+		 * @param idx_a index a
+		 * @param packed_b packed strings of rhs
+		 * @param idx_b index b
+		 * @return computed kernel function at indices a,b
+		 */
+		float64_t compute_packed(CPackedStrings* packed_a, int32_t idx_a,
+			CPackedStrings* packed_b, int32_t idx_b);
+
 		/** the degree */
 		int32_t degree;
+
+		/** if packed computation is used */
+		bool packed_computation;
+		/** packed strings of lhs and rhs */
+		CPackedStringPair packed_strings;
 };
 }
 #endif /* _FIXEDDEGREESTRINGKERNEL_H___ */
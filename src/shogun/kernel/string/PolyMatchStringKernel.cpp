@@ -52,11 +52,16 @@ CPolyMatchStringKernel::~CPolyMatchStringKernel()
 bool CPolyMatchStringKernel::init(CFeatures* l, CFeatures* r)
 {
 	CStringKernel<char>::init(l, r);
+	if (packed_computation)
+		packed_strings.pack(lhs, rhs);
+	else
+		packed_strings.clear();
 	return init_normalizer();
 }
 
 void CPolyMatchStringKernel::cleanup()
 {
+	packed_strings.clear();
 	CKernel::cleanup();
 }
 
@@ -65,6 +70,20 @@ float64_t CPolyMatchStringKernel::compute(int32_t idx_a, int32_t idx_b)
 	int32_t i, alen, blen, sum;
 	bool free_avec, free_bvec;
 
+	CPackedStrings* packed_a=packed_strings.get_packed_strings(lhs);
+	CPackedStrings* packed_b=packed_strings.get_packed_strings(rhs);
+	if (packed_a && packed_b && packed_a->is_compatible(*packed_b))
+	{
+		alen=packed_a->get_length(idx_a);
+		ASSERT(alen==packed_b->get_length(idx_b))
+		sum=inhomogene+packed_a->count_matches(idx_a, *packed_b, idx_b);
+
+		float64_t result=((float64_t) sum);
+		if (rescaling)
+			result/=alen;
+		return CMath::pow(result, degree);
+	}
+
 	char* avec = ((CStringFeatures<char>*) lhs)->get_feature_vector(idx_a, alen, free_avec);
 	char* bvec = ((CStringFeatures<char>*) rhs)->get_feature_vector(idx_b, blen, free_bvec);
 
@@ -89,6 +108,7 @@ void CPolyMatchStringKernel::init()
 	degree=0;
 	inhomogene=false;
 	rescaling=false;
+	packed_computation=true;
 	set_normalizer(new CSqrtDiagKernelNormalizer());
 
 	SG_ADD(&degree, "degree", "Degree of poly-kernel.", MS_AVAILABLE);
@@ -96,4 +116,6 @@ void CPolyMatchStringKernel::init()
 	    MS_NOT_AVAILABLE);
 	SG_ADD(&rescaling, "rescaling",
 	    "True to rescale kernel with string length.", MS_AVAILABLE);
+	SG_ADD(&packed_computation, "packed_computation",
+	    "If kernel is computed on packed strings.", MS_NOT_AVAILABLE);
 }
@@ -15,6 +15,7 @@
 
 #include <shogun/lib/common.h>
 #include <shogun/kernel/string/StringKernel.h>
+#include <shogun/lib/PackedStrings.h>
 
 namespace shogun
 {
@@ -106,6 +107,22 @@ class CPolyMatchStringKernel: public CStringKernel<char>
 			return rescaling;
 		}
 
+		/** set if the kernel shall be computed on strings packed into bit
+		 * planes (see CPackedStrings), the packed strings are built in init()
+		 *
+		 * @param packed if packed computation shall be performed
+		 */
+		inline void set_use_packed_computation(bool packed)
+		{
+			packed_computation=packed;
+		}
+
+		/** check if packed computation is performed
+		 *
+		 * @return if packed computation is performed
+		 */
+		inline bool get_use_packed_computation() { return packed_computation; }
+
 	protected:
 		/** compute kernel function for features a and b
 		 * idx_{a,b} denote the index of the feature vectors
@@ -127,6 +144,10 @@ class CPolyMatchStringKernel: public CStringKernel<char>
 		bool inhomogene;
 		/** true to rescale kernel with string length */
 		bool rescaling;
+		/** if packed computation is used */
+		bool packed_computation;
+		/** packed strings of lhs and rhs */
+		CPackedStringPair packed_strings;
 };
 }
 #endif /* _POLYMATCHSTRINGKERNEL_H___ */
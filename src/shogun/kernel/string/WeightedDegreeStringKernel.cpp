@@ -175,6 +175,10 @@ bool CWeightedDegreeStringKernel::init(CFeatures* l, CFeatures* r)
 	create_empty_tries();
 
 	init_block_weights();
+	if (packed_computation)
+		packed_strings.pack(lhs, rhs);
+	else
+		packed_strings.clear();
 
 	return init_normalizer();
 }
@@ -200,6 +204,8 @@ void CWeightedDegreeStringKernel::cleanup()
 	SG_UNREF(alphabet);
 	alphabet=NULL;
 
+	packed_strings.clear();
+
 	CKernel::cleanup();
 }
 
@@ -360,8 +366,121 @@ float64_t CWeightedDegreeStringKernel::compute_without_mismatch_matrix(
 }
 
 
+float64_t CWeightedDegreeStringKernel::compute_packed(
+	CPackedStrings* packed_a, int32_t idx_a,
+	CPackedStrings* packed_b, int32_t idx_b)
+{
+	int32_t len=CMath::min(packed_a->get_length(idx_a),
+			packed_b->get_length(idx_b));
+	float64_t sum=0;
+
+	CPackedStrings::SMatchRuns runs;
+	int32_t start, run_len;
+	packed_a->begin_match_runs(idx_a, *packed_b, idx_b, runs);
+
+	if (max_mismatch==0 && length==0 && block_computation)
+	{
+		// every run of matches contributes its block weight
+		while (packed_a->next_match_run(runs, start, run_len))
+			sum+=block_weights[run_len-1];
+	}
+	else if (max_mismatch==0)
+	{
+		// position i of a run matches the next r characters, where r is
+		// the remaining length of the run, so it contributes the first
+		// min(r,degree) weights. The run is traversed backwards to sum
+		// these up incrementally.
+		while (packed_a->next_match_run(runs, start, run_len))
+		{
+			float64_t sumi=0;
+			for (int32_t r=1; r<=run_len; r++)
+			{
+				int32_t i=start+run_len-r;
+				if (length==0)
+				{
+					if (r<=degree)
+						sumi+=weights[r-1];
+				}
+				else
+				{
+					sumi=0;
+					for (int32_t j=0; j<CMath::min(r, degree); j++)
+						sumi+=weights[i*degree+j];
+				}
+
+				if (position_weights!=NULL)
+					sum+=position_weights[i]*sumi;
+				else
+					sum+=sumi;
+			}
+		}
+	}
+	else
+	{
+		// number of consecutive matches starting at each position and
+		// prefix sums of the weights of each number of mismatches, such
+		// that every stretch of matches is added at once
+		int32_t* run=SG_CALLOC(int32_t, len+1);
+		float64_t* cum=SG_MALLOC(float64_t, (max_mismatch+1)*(degree+1));
+
+		while (packed_a->next_match_run(runs, start, run_len))
+		{
+			for (int32_t r=1; r<=run_len; r++)
+				run[start+run_len-r]=r;
+		}
+
+		for (int32_t m=0; m<=max_mismatch; m++)
+		{
+			float64_t* c=&cum[m*(degree+1)];
+			c[0]=0;
+			for (int32_t j=0; j<degree; j++)
+				c[j+1]=c[j]+weights[j+degree*m];
+		}
+
+		for (int32_t i=0; i<len; i++)
+		{
+			int32_t n=CMath::min(degree, len-i);
+			int32_t mismatches=0;
+			float64_t sumi=0;
+
+			for (int32_t j=0; j<n; )
+			{
+				int32_t k=CMath::min(run[i+j], n-j);
+				float64_t* c=&cum[mismatches*(degree+1)];
+				sumi+=c[j+k]-c[j];
+				j+=k;
+
+				if (j==n)
+					break;
+
+				// mismatch at position i+j
+				mismatches++;
+				if (mismatches>max_mismatch)
+					break;
+				sumi+=weights[j+degree*mismatches];
+				j++;
+			}
+
+			if (position_weights!=NULL)
+				sum+=position_weights[i]*sumi;
+			else
+				sum+=sumi;
+		}
+
+		SG_FREE(run);
+		SG_FREE(cum);
+	}
+
+	return sum;
+}
+
 float64_t CWeightedDegreeStringKernel::compute(int32_t idx_a, int32_t idx_b)
 {
+	CPackedStrings* packed_a=packed_strings.get_packed_strings(lhs);
+	CPackedStrings* packed_b=packed_strings.get_packed_strings(rhs);
+	if (packed_a && packed_b && packed_a->is_compatible(*packed_b))
+		return compute_packed(packed_a, idx_a, packed_b, idx_b);
+
 	int32_t alen, blen;
 	bool free_avec, free_bvec;
 	char* avec=((CStringFeatures<char>*) lhs)->get_feature_vector(idx_a, alen, free_avec);
@@ -574,9 +693,9 @@ bool CWeightedDegreeStringKernel::set_wd_weights_by_type(EWDKernType p_type)
 	ASSERT(p_type==E_WD) /// if we know a better weighting later on do a switch
 
 	SG_FREE(weights);
-	weights=SG_MALLOC(float64_t, degree);
+	weights=SG_MALLOC(float64_t, degree*(1+max_mismatch));
 	weights_degree=degree;
-	weights_length=1;
+	weights_length=(1+max_mismatch);
 
 	if (weights)
 	{
@@ -970,6 +1089,10 @@ bool CWeightedDegreeStringKernel::set_max_mismatch(int32_t max)
 
 	max_mismatch=max;
 
+	// the default weights have one row per number of mismatches
+	if (type==E_WD && length==0)
+		set_wd_weights_by_type(type);
+
 	if (lhs!=NULL && rhs!=NULL)
 		return init(lhs, rhs);
 	else
@@ -995,6 +1118,7 @@ void CWeightedDegreeStringKernel::init()
 
 	block_weights=NULL;
 	block_computation=true;
+	packed_computation=true;
 	type=E_WD;
 	which_degree=-1;
 	tries=NULL;
@@ -1020,6 +1144,9 @@ void CWeightedDegreeStringKernel::init()
 			"Number of allowed mismatches.", MS_AVAILABLE);
 	SG_ADD(&block_computation, "block_computation",
 			"If block computation shall be used.", MS_NOT_AVAILABLE);
+	SG_ADD(&packed_computation, "packed_computation",
+			"If computation on packed strings shall be used.",
+			MS_NOT_AVAILABLE);
 	SG_ADD((machine_int_t*) &type, "type",
 			"WeightedDegree kernel type.", MS_AVAILABLE);
 	SG_ADD(&which_degree, "which_degree",
@@ -16,6 +16,7 @@
 
 #include <shogun/lib/common.h>
 #include <shogun/lib/Trie.h>
+#include <shogun/lib/PackedStrings.h>
 #include <shogun/kernel/string/StringKernel.h>
 #include <shogun/transfer/multitask/MultitaskKernelMklNormalizer.h>
 #include <shogun/features/StringFeatures.h>
@@ -568,6 +569,25 @@ class CWeightedDegreeStringKernel: public CStringKernel<char>
 		 */
 		inline bool get_use_block_computation() { return block_computation; }
 
+		/** set if the kernel shall be computed on strings packed into bit
+		 * planes (see CPackedStrings), which compares 64 positions at once.
+		 * The packed strings are built in init().
+		 *
+		 * @param packed if packed computation shall be performed
+		 * @return if setting was successful
+		 */
+		inline bool set_use_packed_computation(bool packed)
+		{
+			packed_computation=packed;
+			return true;
+		}
+
+		/** check if packed computation is performed
+		 *
+		 * @return if packed computation is performed
+		 */
+		inline bool get_use_packed_computation() { return packed_computation; }
+
 		/** set MKL steps ize
 		 *
 		 * @param step new step size
@@ -701,6 +721,18 @@ class CWeightedDegreeStringKernel: public CStringKernel<char>
 		float64_t compute_using_block(char* avec, int32_t alen,
 			char* bvec, int32_t blen);
 
+		/** compute kernel function on the packed strings, equivalent to
+		 * the computations above
+		 *
+		 * @param packed_a packed strings of lhs
+		 * @param idx_a index a
+		 * @param packed_b packed strings of rhs
+		 * @param idx_b index b
+		 * @return computed kernel function at indices a,b
+		 */
+		float64_t compute_packed(CPackedStrings* packed_a, int32_t idx_a,
+			CPackedStrings* packed_b, int32_t idx_b);
+
 		/** remove lhs from kernel */
 		virtual void remove_lhs();
 
@@ -746,6 +778,11 @@ class CWeightedDegreeStringKernel: public CStringKernel<char>
 
 		/** (internal) block weights */
 		float64_t* block_weights;
+
+		/** if packed computation is used */
+		bool packed_computation;
+		/** packed strings of lhs and rhs */
+		CPackedStringPair packed_strings;
 		/** WeightedDegree kernel type */
 		EWDKernType type;
 		/** which degree */
@@ -0,0 +1,273 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef _BLOCKCACHE_H__
+#define _BLOCKCACHE_H__
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/common.h>
+#include <shogun/lib/Lock.h>
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/mathematics/Math.h>
+
+namespace shogun
+{
+/** @brief Thread-safe cache of blocks of feature vectors.
+ *
+ * Block i is stored in shard i mod num_shards, and every shard has its own
+ * lock, so threads working on different blocks rarely wait for each other.
+ * Blocks are reference counted SGMatrix objects: a block returned by
+ * get_block() stays valid even if it is evicted from the cache meanwhile.
+ * When a shard is full, its oldest block is evicted. Like the entries of
+ * CCache, a block can be locked, which keeps its memory until it is
+ * unlocked, so raw pointers into it can be handed out.
+ */
+template<class T> class CBlockCache
+{
+	public:
+	/** default constructor, creates an empty cache */
+	CBlockCache()
+	{
+		m_num_blocks=0;
+		m_num_shards=0;
+		m_shard_capacity=0;
+		m_blocks=NULL;
+		m_locked=NULL;
+		m_num_locks=NULL;
+		m_locks=NULL;
+		m_resident=NULL;
+		m_num_resident=NULL;
+		m_next_eviction=NULL;
+	}
+
+	/** destructor */
+	~CBlockCache()
+	{
+		free_cache();
+	}
+
+	/** (re)allocate the cache, removes all blocks
+	 *
+	 * @param num_blocks number of blocks that can be requested
+	 * @param capacity maximal number of blocks kept, all if 0
+	 * @param num_shards number of independently locked shards
+	 */
+	void resize(int32_t num_blocks, int32_t capacity=0, int32_t num_shards=16)
+	{
+		free_cache();
+
+		if (num_blocks<=0)
+			return;
+
+		m_num_blocks=num_blocks;
+		m_num_shards=CMath::max(1, CMath::min(num_shards, num_blocks));
+
+		if (capacity<=0 || capacity>num_blocks)
+			capacity=num_blocks;
+		m_shard_capacity=CMath::max(1, (capacity+m_num_shards-1)/m_num_shards);
+
+		m_blocks=new SGMatrix<T>[m_num_blocks];
+		m_locked=new SGMatrix<T>[m_num_blocks];
+		m_num_locks=SG_CALLOC(int32_t, m_num_blocks);
+		m_locks=new CLock[m_num_shards];
+		m_resident=SG_MALLOC(int32_t, m_num_shards*m_shard_capacity);
+		m_num_resident=SG_CALLOC(int32_t, m_num_shards);
+		m_next_eviction=SG_CALLOC(int32_t, m_num_shards);
+	}
+
+	/** remove all blocks, the size of the cache is kept. Locked blocks
+	 * stay in memory until they are unlocked. */
+	void clear()
+	{
+		for (int32_t s=0; s<m_num_shards; s++)
+		{
+			m_locks[s].lock();
+			for (int32_t i=0; i<m_num_resident[s]; i++)
+				m_blocks[m_resident[s*m_shard_capacity+i]]=SGMatrix<T>();
+
+			m_num_resident[s]=0;
+			m_next_eviction[s]=0;
+			m_locks[s].unlock();
+		}
+	}
+
+	/** @return number of blocks that can be requested */
+	int32_t get_num_blocks() const { return m_num_blocks; }
+
+	/** get a cached block
+	 *
+	 * @param block index of the block
+	 * @return the block, or an empty matrix if it is not cached
+	 */
+	SGMatrix<T> get_block(int32_t block)
+	{
+		ASSERT(block>=0 && block<m_num_blocks)
+
+		const int32_t s=block%m_num_shards;
+		m_locks[s].lock();
+		SGMatrix<T> result=m_blocks[block];
+		m_locks[s].unlock();
+
+		return result;
+	}
+
+	/** get a cached block and lock it, its memory is kept even if the
+	 * block is evicted until unlock_block() is called
+	 *
+	 * @param block index of the block
+	 * @return the block, or an empty matrix if it is not cached
+	 */
+	SGMatrix<T> lock_block(int32_t block)
+	{
+		ASSERT(block>=0 && block<m_num_blocks)
+
+		const int32_t s=block%m_num_shards;
+		m_locks[s].lock();
+		SGMatrix<T> result=m_blocks[block];
+		if (!result.matrix)
+			result=m_locked[block];
+		if (result.matrix)
+			add_lock(block, result);
+		m_locks[s].unlock();
+
+		return result;
+	}
+
+	/** unlock a block locked by lock_block() or set_block(). Blocks which
+	 * are not locked, e.g. since the cache was resized, are ignored.
+	 *
+	 * @param block index of the block
+	 */
+	void unlock_block(int32_t block)
+	{
+		if (block<0 || block>=m_num_blocks)
+			return;
+
+		const int32_t s=block%m_num_shards;
+		m_locks[s].lock();
+		if (m_num_locks[block]>0 && --m_num_locks[block]==0)
+			m_locked[block]=SGMatrix<T>();
+		m_locks[s].unlock();
+	}
+
+	/** store a block, keeps the existing one if another thread was faster
+	 *
+	 * @param block index of the block
+	 * @param data the block
+	 * @param lock whether to lock the block, see lock_block()
+	 * @return the block which is cached now
+	 */
+	SGMatrix<T> set_block(int32_t block, SGMatrix<T> data, bool lock=false)
+	{
+		ASSERT(block>=0 && block<m_num_blocks)
+
+		const int32_t s=block%m_num_shards;
+		int32_t* resident=m_resident+s*m_shard_capacity;
+
+		m_locks[s].lock();
+		if (m_blocks[block].matrix)
+			data=m_blocks[block];
+		else
+		{
+			/* an evicted block might still be locked */
+			if (m_locked[block].matrix)
+				data=m_locked[block];
+
+			if (m_num_resident[s]<m_shard_capacity)
+				resident[m_num_resident[s]++]=block;
+			else
+			{
+				int32_t& next=m_next_eviction[s];
+				m_blocks[resident[next]]=SGMatrix<T>();
+				resident[next]=block;
+				next=(next+1)%m_shard_capacity;
+			}
+
+			m_blocks[block]=data;
+		}
+		if (lock)
+			add_lock(block, data);
+		m_locks[s].unlock();
+
+		return data;
+	}
+
+	private:
+	/** lock a block, the lock of its shard has to be held
+	 *
+	 * @param block index of the block
+	 * @param data the block
+	 */
+	void add_lock(int32_t block, SGMatrix<T> data)
+	{
+		if (m_num_locks[block]++==0)
+			m_locked[block]=data;
+	}
+
+	/** free all memory */
+	void free_cache()
+	{
+		delete[] m_blocks;
+		delete[] m_locked;
+		SG_FREE(m_num_locks);
+		delete[] m_locks;
+		SG_FREE(m_resident);
+		SG_FREE(m_num_resident);
+		SG_FREE(m_next_eviction);
+
+		m_blocks=NULL;
+		m_locked=NULL;
+		m_num_locks=NULL;
+		m_locks=NULL;
+		m_resident=NULL;
+		m_num_resident=NULL;
+		m_next_eviction=NULL;
+		m_num_blocks=0;
+		m_num_shards=0;
+		m_shard_capacity=0;
+	}
+
+	/** copying would share the locks */
+	CBlockCache(const CBlockCache& orig);
+
+	/** copying would share the locks */
+	CBlockCache& operator=(const CBlockCache& orig);
+
+	private:
+	/** number of blocks */
+	int32_t m_num_blocks;
+
+	/** number of shards */
+	int32_t m_num_shards;
+
+	/** maximal number of blocks per shard */
+	int32_t m_shard_capacity;
+
+	/** blocks, empty if not cached */
+	SGMatrix<T>* m_blocks;
+
+	/** locked blocks, empty if not locked */
+	SGMatrix<T>* m_locked;
+
+	/** number of locks of every block */
+	int32_t* m_num_locks;
+
+	/** one lock per shard */
+	CLock* m_locks;
+
+	/** indices of the cached blocks of every shard */
+	int32_t* m_resident;
+
+	/** number of cached blocks of every shard */
+	int32_t* m_num_resident;
+
+	/** next slot to evict of every shard */
+	int32_t* m_next_eviction;
+};
+}
+#endif // _BLOCKCACHE_H__
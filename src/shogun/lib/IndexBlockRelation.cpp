@@ -10,6 +10,7 @@
 #include <shogun/lib/IndexBlockRelation.h>
 #include <shogun/lib/IndexBlock.h>
 #include <shogun/lib/List.h>
+#include <shogun/mathematics/KeyIndexSort.h>
 
 using namespace shogun;
 
@@ -30,8 +31,8 @@ bool CIndexBlockRelation::check_blocks_list(CList* blocks)
 		SG_UNREF(iter_block);
 		iter_block = (CIndexBlock*)(blocks->get_next_element());
 	}
-	CMath::qsort_index(min_idxs, block_idxs_min, n_sub_blocks);
-	CMath::qsort_index(max_idxs, block_idxs_max, n_sub_blocks);
+	CKeyIndexSort::sort(min_idxs, block_idxs_min, n_sub_blocks);
+	CKeyIndexSort::sort(max_idxs, block_idxs_max, n_sub_blocks);
 
 	for (int32_t i=0; i<n_sub_blocks; i++)
 	{
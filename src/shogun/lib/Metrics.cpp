@@ -0,0 +1,185 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <shogun/lib/Metrics.h>
+
+#ifdef USE_METRICS
+#include <shogun/io/SGIO.h>
+#include <shogun/lib/memory.h>
+
+#include <stdio.h>
+#include <string.h>
+
+namespace shogun
+{
+
+/** names and types of the registered metrics */
+static const char* metric_names[Metrics::MAX_METRICS];
+static EMetricType metric_types[Metrics::MAX_METRICS];
+static std::atomic<int32_t> num_metric_names(0);
+static CLock metric_names_lock;
+
+/** slot of the next thread using a metric */
+static std::atomic<int32_t> next_thread_slot(0);
+
+Metric::Metric()
+{
+	reset();
+}
+
+int64_t Metric::get_sum() const
+{
+	int64_t sum=0;
+	for (int32_t i=0; i<NUM_SLOTS; i++)
+		sum+=m_slots[i].sum.load(std::memory_order_relaxed);
+
+	return sum;
+}
+
+int64_t Metric::get_count() const
+{
+	int64_t count=0;
+	for (int32_t i=0; i<NUM_SLOTS; i++)
+		count+=m_slots[i].count.load(std::memory_order_relaxed);
+
+	return count;
+}
+
+void Metric::reset()
+{
+	for (int32_t i=0; i<NUM_SLOTS; i++)
+	{
+		m_slots[i].sum.store(0, std::memory_order_relaxed);
+		m_slots[i].count.store(0, std::memory_order_relaxed);
+	}
+}
+
+int32_t Metric::thread_slot()
+{
+	static thread_local int32_t slot=
+		next_thread_slot.fetch_add(1, std::memory_order_relaxed)%NUM_SLOTS;
+
+	return slot;
+}
+
+Metrics::Metrics()
+{
+	for (int32_t i=0; i<MAX_METRICS; i++)
+		m_metrics[i].store(NULL, std::memory_order_relaxed);
+}
+
+Metrics::~Metrics()
+{
+	for (int32_t i=0; i<MAX_METRICS; i++)
+		delete m_metrics[i].load(std::memory_order_relaxed);
+}
+
+int32_t Metrics::register_metric(const char* name, EMetricType type)
+{
+	metric_names_lock.lock();
+
+	const int32_t num=num_metric_names.load(std::memory_order_relaxed);
+	int32_t id=0;
+	while (id<num && strcmp(metric_names[id], name))
+		id++;
+
+	if (id==num)
+	{
+		if (num==MAX_METRICS)
+		{
+			metric_names_lock.unlock();
+			SG_SERROR("Cannot register metric %s, all %d metrics are in use\n",
+					name, MAX_METRICS)
+		}
+
+		metric_names[id]=get_strdup(name);
+		metric_types[id]=type;
+		num_metric_names.store(num+1, std::memory_order_release);
+	}
+	else if (metric_types[id]!=type)
+	{
+		metric_names_lock.unlock();
+		SG_SERROR("Metric %s is used as counter and as timer\n", name)
+	}
+
+	metric_names_lock.unlock();
+	return id;
+}
+
+Metric* Metrics::create(int32_t id)
+{
+	REQUIRE(id>=0 && id<num_metric_names.load(std::memory_order_acquire),
+			"Metric %d is not registered\n", id)
+
+	m_lock.lock();
+	Metric* metric=m_metrics[id].load(std::memory_order_relaxed);
+	if (!metric)
+	{
+		metric=new Metric();
+		m_metrics[id].store(metric, std::memory_order_release);
+	}
+	m_lock.unlock();
+
+	return metric;
+}
+
+Metric* Metrics::find(const char* name) const
+{
+	const int32_t num=num_metric_names.load(std::memory_order_acquire);
+	for (int32_t i=0; i<num; i++)
+	{
+		if (!strcmp(metric_names[i], name))
+			return m_metrics[i].load(std::memory_order_acquire);
+	}
+
+	return NULL;
+}
+
+void Metrics::reset()
+{
+	for (int32_t i=0; i<MAX_METRICS; i++)
+	{
+		Metric* metric=m_metrics[i].load(std::memory_order_acquire);
+		if (metric)
+			metric->reset();
+	}
+}
+
+std::string Metrics::to_json() const
+{
+	std::string json="{";
+	char buffer[64];
+
+	const int32_t num=num_metric_names.load(std::memory_order_acquire);
+	for (int32_t i=0; i<num; i++)
+	{
+		Metric* metric=m_metrics[i].load(std::memory_order_acquire);
+		if (!metric)
+			continue;
+
+		if (json.size()>1)
+			json+=", ";
+
+		json+="\"";
+		json+=metric_names[i];
+		json+="\": ";
+
+		if (metric_types[i]==METRIC_COUNTER)
+			snprintf(buffer, sizeof(buffer), "%lld", (long long) metric->get_sum());
+		else
+		{
+			snprintf(buffer, sizeof(buffer), "{\"count\": %lld, \"seconds\": %.9f}",
+					(long long) metric->get_count(), metric->get_sum()*1e-9);
+		}
+		json+=buffer;
+	}
+
+	json+="}";
+	return json;
+}
+}
+#endif // USE_METRICS
@@ -0,0 +1,273 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef __METRICS_H__
+#define __METRICS_H__
+
+#include <shogun/lib/config.h>
+
+/** @file Metrics.h
+ * Counters and timers of kernels, caches and solvers.
+ *
+ * Metrics are only collected if shogun is configured with USE_METRICS,
+ * otherwise the SG_METRIC_* macros expand to nothing and instrumented code
+ * runs as without them. Every CSGObject has its own set of metrics, which is
+ * exported by CSGObject::get_metrics_json(), e.g. after
+ *
+ *     SG_METRIC_INC(this, "kernel_evaluations")
+ *
+ * in a kernel, the number of evaluations can be read from the kernel.
+ */
+
+#ifdef USE_METRICS
+
+#include <shogun/lib/common.h>
+#include <shogun/lib/Lock.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+namespace shogun
+{
+
+/** type of a metric */
+enum EMetricType
+{
+	/** sum of the added values */
+	METRIC_COUNTER,
+	/** number and total duration of timed intervals in nanoseconds */
+	METRIC_TIMER
+};
+
+/** @brief A counter or timer which many threads can update concurrently.
+ *
+ * Every thread adds to one of NUM_SLOTS slots of its own cache line, which
+ * avoids contention on a shared counter. The slots are summed up on read.
+ */
+class Metric
+{
+public:
+	/** number of slots, threads beyond share slots */
+	static const int32_t NUM_SLOTS=64;
+
+	/** constructor */
+	Metric();
+
+	/** add a value, counts one event
+	 *
+	 * @param value value to add, nanoseconds for timers
+	 */
+	inline void add(int64_t value)
+	{
+		Slot& slot=m_slots[thread_slot()];
+		slot.sum.fetch_add(value, std::memory_order_relaxed);
+		slot.count.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/** @return sum of all added values */
+	int64_t get_sum() const;
+
+	/** @return number of add() calls */
+	int64_t get_count() const;
+
+	/** set to zero */
+	void reset();
+
+	/** @return slot of the calling thread */
+	static int32_t thread_slot();
+
+private:
+	/** per thread part of the metric, one cache line each */
+	struct Slot
+	{
+		std::atomic<int64_t> sum;
+		std::atomic<int64_t> count;
+		char padding[64-2*sizeof(std::atomic<int64_t>)];
+	};
+
+	/** slots of the threads */
+	Slot m_slots[NUM_SLOTS];
+};
+
+/** @brief The metrics of one object.
+ *
+ * Metric names are registered once per call site and map to a global id,
+ * so that looking up the metric of an object in hot code is a single array
+ * access. Metrics are created when they are first used.
+ */
+class Metrics
+{
+public:
+	/** maximal number of distinct metric names */
+	static const int32_t MAX_METRICS=256;
+
+	/** constructor */
+	Metrics();
+
+	/** destructor */
+	~Metrics();
+
+	/** register a metric name, may be called repeatedly for the same name
+	 *
+	 * @param name name of the metric
+	 * @param type type of the metric
+	 * @return id of the metric
+	 */
+	static int32_t register_metric(const char* name, EMetricType type);
+
+	/** get a metric, creates it if it was not used yet
+	 *
+	 * @param id id of the metric from register_metric()
+	 * @return the metric
+	 */
+	inline Metric* get(int32_t id)
+	{
+		Metric* metric=m_metrics[id].load(std::memory_order_acquire);
+		return metric ? metric : create(id);
+	}
+
+	/** find a metric by name
+	 *
+	 * @param name name of the metric
+	 * @return the metric or NULL if it was not used
+	 */
+	Metric* find(const char* name) const;
+
+	/** set all metrics to zero */
+	void reset();
+
+	/** export the metrics as JSON object, counters as their sum and timers
+	 * as object with fields count and seconds
+	 *
+	 * @return JSON representation
+	 */
+	std::string to_json() const;
+
+private:
+	/** create a metric */
+	Metric* create(int32_t id);
+
+	/** copying would share the metrics */
+	Metrics(const Metrics& orig);
+
+	/** copying would share the metrics */
+	Metrics& operator=(const Metrics& orig);
+
+private:
+	/** metrics by id, NULL if not used */
+	std::atomic<Metric*> m_metrics[MAX_METRICS];
+
+	/** protects the creation of metrics */
+	CLock m_lock;
+};
+
+/** @brief Adds the lifetime of the object to a timer. */
+class MetricTimer
+{
+public:
+	/** constructor, starts the timer
+	 *
+	 * @param metric timer to add to
+	 */
+	MetricTimer(Metric* metric)
+	: m_metric(metric), m_start(std::chrono::steady_clock::now())
+	{
+	}
+
+	/** destructor, adds the elapsed time */
+	~MetricTimer()
+	{
+		m_metric->add(std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now()-m_start).count());
+	}
+
+private:
+	/** timer to add to */
+	Metric* m_metric;
+
+	/** start time */
+	std::chrono::steady_clock::time_point m_start;
+};
+
+/** @brief Splits a period into consecutive phases which are added to
+ * different timers. */
+class MetricStopwatch
+{
+public:
+	/** constructor, starts the first phase */
+	MetricStopwatch() : m_start(std::chrono::steady_clock::now())
+	{
+	}
+
+	/** start a new phase without recording the current one */
+	void restart()
+	{
+		m_start=std::chrono::steady_clock::now();
+	}
+
+	/** end the current phase and start the next one
+	 *
+	 * @param metric timer to add the current phase to
+	 */
+	void lap(Metric* metric)
+	{
+		std::chrono::steady_clock::time_point now=std::chrono::steady_clock::now();
+		metric->add(std::chrono::duration_cast<std::chrono::nanoseconds>(
+				now-m_start).count());
+		m_start=now;
+	}
+
+private:
+	/** start of the current phase */
+	std::chrono::steady_clock::time_point m_start;
+};
+}
+
+#define SG_METRIC_CONCAT_IMPL(a, b) a##b
+#define SG_METRIC_CONCAT(a, b) SG_METRIC_CONCAT_IMPL(a, b)
+
+/** metric of an object, the name is registered once per call site */
+#define SG_METRIC(obj, name, type) \
+	(obj)->get_metrics()->get(([]() { \
+		static const int32_t id=shogun::Metrics::register_metric(name, type); \
+		return id; })())
+
+/** add a value to a counter of an object */
+#define SG_METRIC_ADD(obj, name, value) \
+	{ SG_METRIC(obj, name, shogun::METRIC_COUNTER)->add(value); }
+
+/** add one to a counter of an object */
+#define SG_METRIC_INC(obj, name) SG_METRIC_ADD(obj, name, 1)
+
+/** time the rest of the enclosing scope */
+#define SG_METRIC_TIMER(obj, name) \
+	shogun::MetricTimer SG_METRIC_CONCAT(__metric_timer, __LINE__)( \
+		SG_METRIC(obj, name, shogun::METRIC_TIMER));
+
+/** declare a stopwatch which times consecutive phases */
+#define SG_METRIC_STOPWATCH(var) shogun::MetricStopwatch var;
+
+/** start a new phase without recording the current one */
+#define SG_METRIC_RESTART(var) var.restart();
+
+/** add the current phase to a timer of an object and start the next one */
+#define SG_METRIC_LAP(obj, var, name) \
+	var.lap(SG_METRIC(obj, name, shogun::METRIC_TIMER));
+
+#else // USE_METRICS
+
+// empty statements, so that a metric can be the body of if and else
+#define SG_METRIC_ADD(obj, name, value) {}
+#define SG_METRIC_INC(obj, name) {}
+#define SG_METRIC_TIMER(obj, name)
+#define SG_METRIC_STOPWATCH(var)
+#define SG_METRIC_RESTART(var) {}
+#define SG_METRIC_LAP(obj, var, name) {}
+
+#endif // USE_METRICS
+#endif // __METRICS_H__
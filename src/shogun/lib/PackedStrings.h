@@ -0,0 +1,465 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef _PACKEDSTRINGS_H__
+#define _PACKEDSTRINGS_H__
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/common.h>
+#include <shogun/features/Alphabet.h>
+#include <shogun/features/StringFeatures.h>
+#include <shogun/mathematics/Math.h>
+
+#include <string.h>
+
+namespace shogun
+{
+/** @brief Strings of a CStringFeatures object packed into bit planes, for
+ * comparing many positions of two strings at once.
+ *
+ * Every symbol is encoded with the bits of its alphabet (2 for DNA, 5 for
+ * protein) if that encoding distinguishes all symbols that occur, and with
+ * all 8 bits otherwise, so two encoded symbols are equal exactly if the
+ * characters are. Bit k of the codes of 64 consecutive positions is stored
+ * in one word (plane k), hence the positions where two strings agree are
+ * found with a few XOR and OR operations on words and positionwise matches,
+ * runs of matches and mismatches are counted with popcount and count
+ * trailing zero instructions.
+ */
+class CPackedStrings
+{
+	public:
+	/** default constructor, packs no strings */
+	CPackedStrings()
+	{
+		m_num_strings=0;
+		m_num_words=0;
+		m_num_planes=0;
+		m_planes=NULL;
+		m_lengths=NULL;
+		m_features=NULL;
+		memset(m_codes, 0, sizeof(m_codes));
+	}
+
+	/** destructor */
+	~CPackedStrings()
+	{
+		clear();
+	}
+
+	/** pack all strings of features
+	 *
+	 * @param features string features to pack
+	 */
+	void pack(CStringFeatures<char>* features)
+	{
+		clear();
+
+		if (!features)
+			return;
+
+		int32_t num_strings=features->get_num_vectors();
+		int32_t max_len=features->get_max_vector_length();
+
+		// use the alphabet encoding only if it keeps the occurring
+		// symbols apart
+		CAlphabet* alphabet=features->get_alphabet();
+		int32_t num_planes=alphabet->get_num_bits();
+		uint8_t codes[256];
+		bool occurs[256];
+		for (int32_t c=0; c<256; c++)
+		{
+			codes[c]=alphabet->remap_to_bin((uint8_t) c);
+			occurs[c]=false;
+		}
+		SG_UNREF(alphabet);
+
+		for (int32_t i=0; i<num_strings; i++)
+		{
+			int32_t len;
+			bool free_vec;
+			char* vec=features->get_feature_vector(i, len, free_vec);
+			for (int32_t j=0; j<len; j++)
+				occurs[(uint8_t) vec[j]]=true;
+			features->free_feature_vector(vec, i, free_vec);
+		}
+
+		bool used[256];
+		for (int32_t c=0; c<256; c++)
+			used[c]=false;
+		for (int32_t c=0; c<256 && num_planes<8; c++)
+		{
+			if (!occurs[c])
+				continue;
+			if (codes[c]>>num_planes || used[codes[c]])
+				num_planes=8;
+			used[codes[c]]=true;
+		}
+		if (num_planes<1 || num_planes>=8)
+		{
+			num_planes=8;
+			for (int32_t c=0; c<256; c++)
+				codes[c]=(uint8_t) c;
+		}
+
+		SG_REF(features);
+		m_features=features;
+		m_num_strings=num_strings;
+		m_num_words=(max_len+63)/64;
+		m_num_planes=num_planes;
+		memcpy(m_codes, codes, sizeof(m_codes));
+		m_lengths=SG_MALLOC(int32_t, num_strings);
+		m_planes=SG_CALLOC(uint64_t, int64_t(num_strings)*num_planes*m_num_words);
+
+		for (int32_t i=0; i<num_strings; i++)
+		{
+			int32_t len;
+			bool free_vec;
+			char* vec=features->get_feature_vector(i, len, free_vec);
+			m_lengths[i]=len;
+			uint64_t* planes=get_planes(i);
+			for (int32_t j=0; j<len; j++)
+			{
+				uint8_t code=codes[(uint8_t) vec[j]];
+				for (int32_t k=0; k<num_planes; k++)
+				{
+					planes[k*m_num_words+j/64]|=
+						uint64_t((code>>k) & 1) << (j%64);
+				}
+			}
+			features->free_feature_vector(vec, i, free_vec);
+		}
+	}
+
+	/** remove all strings */
+	void clear()
+	{
+		SG_FREE(m_planes);
+		SG_FREE(m_lengths);
+		m_planes=NULL;
+		m_lengths=NULL;
+		SG_UNREF(m_features);
+		m_features=NULL;
+		m_num_strings=0;
+		m_num_words=0;
+		m_num_planes=0;
+	}
+
+	/** whether the strings of features were packed, kernels use this to
+	 * tell which packed strings belong to their current lhs and rhs
+	 *
+	 * @param features string features
+	 * @return whether features is the object last packed
+	 */
+	inline bool is_packed(CFeatures* features) const
+	{
+		return features!=NULL && features==m_features;
+	}
+
+	/** @return number of packed strings */
+	inline int32_t get_num_strings() const
+	{
+		return m_num_strings;
+	}
+
+	/** @return number of bits per symbol */
+	inline int32_t get_num_planes() const
+	{
+		return m_num_planes;
+	}
+
+	/** whether strings of this and another object can be compared, this
+	 * requires the same symbol codes, e.g. DNA 'T' and RNA 'U' are both
+	 * encoded as 3 but do not match
+	 *
+	 * @param other other packed strings
+	 * @return whether both use the same encoding
+	 */
+	inline bool is_compatible(const CPackedStrings& other) const
+	{
+		return m_num_strings>0 && other.m_num_strings>0 &&
+			m_num_planes==other.m_num_planes &&
+			m_num_words==other.m_num_words &&
+			memcmp(m_codes, other.m_codes, sizeof(m_codes))==0;
+	}
+
+	/** length of a string
+	 *
+	 * @param idx index of string
+	 * @return length
+	 */
+	inline int32_t get_length(int32_t idx) const
+	{
+		return m_lengths[idx];
+	}
+
+	/** positions where two strings agree
+	 *
+	 * @param idx_a index of string in this object
+	 * @param other object of the other string
+	 * @param idx_b index of the other string
+	 * @param word index of the word, i.e. positions 64*word to 64*word+63
+	 * @param len common length of the strings, bits of positions at or
+	 * beyond are zero
+	 * @return bit mask with bit j set if position 64*word+j matches
+	 */
+	inline uint64_t get_matches(int32_t idx_a, const CPackedStrings& other,
+			int32_t idx_b, int32_t word, int32_t len) const
+	{
+		const uint64_t* a=get_planes(idx_a)+word;
+		const uint64_t* b=other.get_planes(idx_b)+word;
+
+		uint64_t diff=0;
+		for (int32_t k=0; k<m_num_planes; k++)
+			diff|=a[k*m_num_words]^b[k*m_num_words];
+
+		int32_t valid=len-64*word;
+		uint64_t mask=valid>=64 ? ~uint64_t(0) : (uint64_t(1)<<valid)-1;
+		return ~diff & mask;
+	}
+
+	/** number of positions where two strings agree
+	 *
+	 * @param idx_a index of string in this object
+	 * @param other object of the other string
+	 * @param idx_b index of the other string
+	 * @return number of matches within the common length
+	 */
+	inline int32_t count_matches(int32_t idx_a, const CPackedStrings& other,
+			int32_t idx_b) const
+	{
+		int32_t len=CMath::min(m_lengths[idx_a], other.m_lengths[idx_b]);
+		int32_t num_words=(len+63)/64;
+
+		int32_t count=0;
+		for (int32_t w=0; w<num_words; w++)
+			count+=popcount(get_matches(idx_a, other, idx_b, w, len));
+		return count;
+	}
+
+	/** state of an iteration over the runs of matches of two strings */
+	struct SMatchRuns
+	{
+		/** object of the other string */
+		const CPackedStrings* other;
+		/** index of string in this object */
+		int32_t idx_a;
+		/** index of the other string */
+		int32_t idx_b;
+		/** common length */
+		int32_t len;
+		/** number of words of the common length */
+		int32_t num_words;
+		/** current word */
+		int32_t word;
+		/** current position in word */
+		int32_t pos;
+		/** matches of current word */
+		uint64_t matches;
+	};
+
+	/** start an iteration over the maximal runs of matching positions of
+	 * two strings, see next_match_run()
+	 *
+	 * @param idx_a index of string in this object
+	 * @param other object of the other string
+	 * @param idx_b index of the other string
+	 * @param runs iteration state to initialize
+	 */
+	inline void begin_match_runs(int32_t idx_a, const CPackedStrings& other,
+			int32_t idx_b, SMatchRuns& runs) const
+	{
+		runs.other=&other;
+		runs.idx_a=idx_a;
+		runs.idx_b=idx_b;
+		runs.len=CMath::min(m_lengths[idx_a], other.m_lengths[idx_b]);
+		runs.num_words=(runs.len+63)/64;
+		runs.word=-1;
+		runs.pos=64;
+		runs.matches=0;
+	}
+
+	/** get the next maximal run of matching positions, runs are returned
+	 * in increasing order
+	 *
+	 * @param runs iteration state
+	 * @param start start position of the run
+	 * @param run_len length of the run
+	 * @return false if there are no more runs
+	 */
+	inline bool next_match_run(SMatchRuns& runs, int32_t& start,
+			int32_t& run_len) const
+	{
+		// find the next match
+		uint64_t rest=runs.pos<64 ? runs.matches>>runs.pos : 0;
+		while (rest==0)
+		{
+			if (++runs.word>=runs.num_words)
+				return false;
+			runs.matches=get_matches(runs.idx_a, *runs.other, runs.idx_b,
+					runs.word, runs.len);
+			runs.pos=0;
+			rest=runs.matches;
+		}
+		runs.pos+=count_trailing_zeros(rest);
+		start=64*runs.word+runs.pos;
+		run_len=0;
+
+		// count matches up to the next mismatch, possibly in later words
+		while (true)
+		{
+			rest=runs.matches>>runs.pos;
+			int32_t ones=~rest ? count_trailing_zeros(~rest) : 64-runs.pos;
+			run_len+=ones;
+			runs.pos+=ones;
+			if (runs.pos<64 || runs.word+1>=runs.num_words)
+				break;
+
+			runs.word++;
+			runs.matches=get_matches(runs.idx_a, *runs.other, runs.idx_b,
+					runs.word, runs.len);
+			runs.pos=0;
+		}
+
+		return true;
+	}
+
+	/** number of set bits
+	 *
+	 * @param x word
+	 * @return population count of x
+	 */
+	static inline int32_t popcount(uint64_t x)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_popcountll(x);
+#else
+		x=x-((x>>1) & 0x5555555555555555ULL);
+		x=(x & 0x3333333333333333ULL)+((x>>2) & 0x3333333333333333ULL);
+		x=(x+(x>>4)) & 0x0f0f0f0f0f0f0f0fULL;
+		return (int32_t) ((x*0x0101010101010101ULL)>>56);
+#endif
+	}
+
+	/** number of trailing zero bits
+	 *
+	 * @param x non-zero word
+	 * @return index of the lowest set bit of x
+	 */
+	static inline int32_t count_trailing_zeros(uint64_t x)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_ctzll(x);
+#else
+		return popcount((x & (~x+1))-1);
+#endif
+	}
+
+	private:
+	/** planes of a string */
+	inline uint64_t* get_planes(int32_t idx) const
+	{
+		return m_planes+int64_t(idx)*m_num_planes*m_num_words;
+	}
+
+	private:
+	/** packed features */
+	CFeatures* m_features;
+	/** number of strings */
+	int32_t m_num_strings;
+	/** number of words per plane */
+	int32_t m_num_words;
+	/** number of bits per symbol */
+	int32_t m_num_planes;
+	/** planes of all strings, string i starts at word i*m_num_planes*m_num_words */
+	uint64_t* m_planes;
+	/** lengths of all strings */
+	int32_t* m_lengths;
+	/** code of every character */
+	uint8_t m_codes[256];
+};
+
+/** @brief Packed strings of the lhs and rhs of a string kernel.
+ *
+ * The strings are packed once in the kernel's init(), rhs shares the packed
+ * strings of lhs if both are the same object. As normalizers may temporarily
+ * swap lhs and rhs, get_packed_strings() looks the packed strings up by the
+ * features.
+ */
+class CPackedStringPair
+{
+	public:
+	/** default constructor, packs no strings */
+	CPackedStringPair()
+	{
+		m_lhs=NULL;
+		m_rhs=NULL;
+	}
+
+	/** destructor */
+	~CPackedStringPair()
+	{
+		clear();
+	}
+
+	/** pack the strings of lhs and rhs
+	 *
+	 * @param lhs string features of the left hand side
+	 * @param rhs string features of the right hand side
+	 */
+	void pack(CFeatures* lhs, CFeatures* rhs)
+	{
+		clear();
+
+		if (!lhs || !rhs)
+			return;
+
+		m_lhs=new CPackedStrings();
+		m_lhs->pack((CStringFeatures<char>*) lhs);
+
+		if (rhs==lhs)
+			m_rhs=m_lhs;
+		else
+		{
+			m_rhs=new CPackedStrings();
+			m_rhs->pack((CStringFeatures<char>*) rhs);
+		}
+	}
+
+	/** free the packed strings */
+	void clear()
+	{
+		if (m_rhs!=m_lhs)
+			delete m_rhs;
+		delete m_lhs;
+		m_lhs=NULL;
+		m_rhs=NULL;
+	}
+
+	/** packed strings of features
+	 *
+	 * @param features lhs or rhs
+	 * @return packed strings of features or NULL if not packed
+	 */
+	inline CPackedStrings* get_packed_strings(CFeatures* features) const
+	{
+		if (m_lhs && m_lhs->is_packed(features))
+			return m_lhs;
+		if (m_rhs && m_rhs->is_packed(features))
+			return m_rhs;
+		return NULL;
+	}
+
+	private:
+	/** packed strings of lhs */
+	CPackedStrings* m_lhs;
+	/** packed strings of rhs, m_lhs if rhs and lhs are equal */
+	CPackedStrings* m_rhs;
+};
+}
+#endif //_PACKEDSTRINGS_H__
@@ -19,6 +19,7 @@
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/lapack.h>
 #include <limits>
+#include <utility>
 
 #include <shogun/mathematics/eigen3.h>
 
@@ -78,6 +79,29 @@ SGMatrix<T>::SGMatrix(const SGMatrix &orig) : SGReferencedData(orig)
 	copy_data(orig);
 }
 
+#if defined(HAVE_CXX0X) || defined(HAVE_CXX11)
+template <class T>
+SGMatrix<T>::SGMatrix(SGMatrix&& orig) : SGReferencedData(std::move(orig))
+{
+	copy_data(orig);
+	orig.init_data();
+}
+
+template <class T>
+SGMatrix<T>& SGMatrix<T>::operator=(const SGMatrix& orig)
+{
+	SGReferencedData::operator=(orig);
+	return *this;
+}
+
+template <class T>
+SGMatrix<T>& SGMatrix<T>::operator=(SGMatrix&& orig)
+{
+	SGReferencedData::operator=(std::move(orig));
+	return *this;
+}
+#endif // defined(HAVE_CXX0X) || defined(HAVE_CXX11)
+
 template <class T>
 SGMatrix<T>::SGMatrix(EigenMatrixXt& mat)
 : SGReferencedData(false), matrix(mat.data()),
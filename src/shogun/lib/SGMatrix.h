@@ -102,6 +102,19 @@ template<class T> class SGMatrix : public SGReferencedData
 		/** Copy constructor */
 		SGMatrix(const SGMatrix &orig);
 
+#ifndef SWIG // SWIG should skip this part
+#if defined(HAVE_CXX0X) || defined(HAVE_CXX11)
+		/** Move constructor, takes over data and reference of orig */
+		SGMatrix(SGMatrix&& orig);
+
+		/** Copy assignment */
+		SGMatrix& operator=(const SGMatrix& orig);
+
+		/** Move assignment, takes over data and reference of orig */
+		SGMatrix& operator=(SGMatrix&& orig);
+#endif // defined(HAVE_CXX0X) || defined(HAVE_CXX11)
+#endif // SWIG
+
 		/** Empty destructor */
 		virtual ~SGMatrix();
 
@@ -0,0 +1,129 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+#ifndef __SGMATRIXVIEW_H__
+#define __SGMATRIXVIEW_H__
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/common.h>
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGSpan.h>
+
+#include <string.h>
+
+namespace shogun
+{
+
+/** @brief non-owning view of a column major matrix
+ *
+ * Like SGSpan, the view neither allocates nor touches a reference count,
+ * and must not outlive the SGMatrix or the features it was obtained from.
+ * Columns are contiguous and are returned as SGSpan.
+ */
+template<class T> class SGMatrixView
+{
+	public:
+		/** The scalar type of the view */
+		typedef T Scalar;
+
+		/** Default constructor, empty view */
+		SGMatrixView() : m_data(NULL), m_num_rows(0), m_num_cols(0) { }
+
+		/** Constructor
+		 *
+		 * @param data first element of the column major matrix
+		 * @param num_rows number of rows
+		 * @param num_cols number of columns
+		 */
+		SGMatrixView(T* data, index_t num_rows, index_t num_cols)
+			: m_data(data), m_num_rows(num_rows), m_num_cols(num_cols) { }
+
+		/** View of the data of a matrix, the matrix keeps the ownership
+		 *
+		 * @param mat matrix
+		 */
+		SGMatrixView(const SGMatrix<T>& mat)
+			: m_data(mat.matrix), m_num_rows(mat.num_rows),
+			m_num_cols(mat.num_cols) { }
+
+		/** @return number of rows */
+		inline index_t num_rows() const { return m_num_rows; }
+
+		/** @return number of columns */
+		inline index_t num_cols() const { return m_num_cols; }
+
+		/** @return first element */
+		inline T* data() const { return m_data; }
+
+		/** Element access
+		 *
+		 * @param i_row row
+		 * @param i_col column
+		 * @return element in row i_row and column i_col
+		 */
+		inline T& operator()(index_t i_row, index_t i_col) const
+		{
+			return m_data[i_col*int64_t(m_num_rows)+i_row];
+		}
+
+		/** Column access
+		 *
+		 * @param i_col column
+		 * @return view of the column
+		 */
+		inline SGSpan<T> col(index_t i_col) const
+		{
+			return SGSpan<T>(m_data+i_col*int64_t(m_num_rows), m_num_rows);
+		}
+
+		/** Consecutive columns
+		 *
+		 * @param first first column
+		 * @param num number of columns
+		 * @return view of the columns
+		 */
+		inline SGMatrixView<T> cols(index_t first, index_t num) const
+		{
+			return SGMatrixView<T>(m_data+first*int64_t(m_num_rows),
+					m_num_rows, num);
+		}
+
+		/** Wraps a matrix without reference counting around the data, for
+		 * interfaces which take an SGMatrix
+		 *
+		 * @return matrix which does not own the data
+		 */
+		inline SGMatrix<T> as_matrix() const
+		{
+			return SGMatrix<T>(m_data, m_num_rows, m_num_cols, false);
+		}
+
+		/** @return matrix with a copy of the data */
+		SGMatrix<T> clone() const
+		{
+			SGMatrix<T> result(m_num_rows, m_num_cols);
+			if (m_num_rows && m_num_cols)
+			{
+				memcpy(result.matrix, m_data,
+						sizeof(T)*int64_t(m_num_rows)*m_num_cols);
+			}
+
+			return result;
+		}
+
+	private:
+		/** first element */
+		T* m_data;
+
+		/** number of rows */
+		index_t m_num_rows;
+
+		/** number of columns */
+		index_t m_num_cols;
+};
+}
+#endif // __SGMATRIXVIEW_H__
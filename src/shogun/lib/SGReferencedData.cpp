@@ -33,6 +33,27 @@ SGReferencedData& SGReferencedData::operator= (const SGReferencedData &orig)
 	return *this;
 }
 
+#if defined(HAVE_CXX0X) || defined(HAVE_CXX11)
+SGReferencedData::SGReferencedData(SGReferencedData&& orig)
+	: m_refcount(orig.m_refcount)
+{
+	orig.m_refcount=NULL;
+}
+
+SGReferencedData& SGReferencedData::operator= (SGReferencedData&& orig)
+{
+	if (this == &orig)
+		return *this;
+
+	unref();
+	copy_data(orig);
+	m_refcount=orig.m_refcount;
+	orig.m_refcount=NULL;
+	orig.init_data();
+	return *this;
+}
+#endif // defined(HAVE_CXX0X) || defined(HAVE_CXX11)
+
 SGReferencedData::~SGReferencedData()
 {
 	delete m_refcount;
@@ -30,6 +30,23 @@ class SGReferencedData
 		/** override assignment operator to increase refcount on assignments */
 		SGReferencedData& operator= (const SGReferencedData &orig);
 
+#ifndef SWIG // SWIG should skip this part
+#if defined(HAVE_CXX0X) || defined(HAVE_CXX11)
+		/** move constructor, takes over the reference of orig without
+		 * changing the reference count
+		 *
+		 * NOTE: derived classes have to take over the data of orig and
+		 * call init_data() on it.
+		 */
+		SGReferencedData(SGReferencedData&& orig);
+
+		/** move assignment, takes over data and reference of orig without
+		 * changing the reference count, orig is left empty
+		 */
+		SGReferencedData& operator= (SGReferencedData&& orig);
+#endif // defined(HAVE_CXX0X) || defined(HAVE_CXX11)
+#endif // SWIG
+
 		/** empty destructor
 		 *
 		 * NOTE: unref() has to be called in derived classes
@@ -0,0 +1,113 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+#ifndef __SGSPAN_H__
+#define __SGSPAN_H__
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/common.h>
+#include <shogun/lib/SGVector.h>
+
+#include <string.h>
+
+namespace shogun
+{
+
+/** @brief non-owning view of a contiguous array
+ *
+ * A span is only a pointer and a length: creating, copying and passing it
+ * neither allocates nor touches a reference count. It does not keep the
+ * memory alive, so it must not outlive the SGVector or the features it was
+ * obtained from.
+ */
+template<class T> class SGSpan
+{
+	public:
+		/** The scalar type of the span */
+		typedef T Scalar;
+
+		/** Default constructor, empty span */
+		SGSpan() : m_data(NULL), m_size(0) { }
+
+		/** Constructor
+		 *
+		 * @param data first element
+		 * @param size number of elements
+		 */
+		SGSpan(T* data, index_t size) : m_data(data), m_size(size) { }
+
+		/** View of the data of a vector, the vector keeps the ownership
+		 *
+		 * @param vec vector
+		 */
+		SGSpan(const SGVector<T>& vec) : m_data(vec.vector), m_size(vec.vlen) { }
+
+		/** @return number of elements */
+		inline index_t size() const { return m_size; }
+
+		/** @return whether the span is empty */
+		inline bool empty() const { return m_size==0; }
+
+		/** @return first element */
+		inline T* data() const { return m_data; }
+
+		/** @return first element */
+		inline T* begin() const { return m_data; }
+
+		/** @return one past the last element */
+		inline T* end() const { return m_data+m_size; }
+
+		/** Element access
+		 *
+		 * @param index index
+		 * @return element at index
+		 */
+		inline T& operator[](index_t index) const
+		{
+			return m_data[index];
+		}
+
+		/** Part of the span
+		 *
+		 * @param offset first element of the part
+		 * @param len number of elements of the part
+		 * @return view of the part
+		 */
+		inline SGSpan<T> subspan(index_t offset, index_t len) const
+		{
+			return SGSpan<T>(m_data+offset, len);
+		}
+
+		/** Wraps a vector without reference counting around the data, for
+		 * interfaces which take an SGVector
+		 *
+		 * @return vector which does not own the data
+		 */
+		inline SGVector<T> as_vector() const
+		{
+			return SGVector<T>(m_data, m_size, false);
+		}
+
+		/** @return vector with a copy of the data */
+		SGVector<T> clone() const
+		{
+			SGVector<T> result(m_size);
+			if (m_size)
+				memcpy(result.vector, m_data, sizeof(T)*m_size);
+
+			return result;
+		}
+
+	private:
+		/** first element */
+		T* m_data;
+
+		/** number of elements */
+		index_t m_size;
+};
+}
+#endif // __SGSPAN_H__
@@ -14,7 +14,9 @@
 #include <shogun/lib/SGSparseVector.h>
 #include <shogun/lib/SGVector.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/KeyIndexSort.h>
 #include <shogun/io/File.h>
+#include <utility>
 
 namespace shogun
 {
@@ -48,6 +50,29 @@ SGSparseVector<T>::SGSparseVector(const SGSparseVector &orig) :
 	copy_data(orig);
 }
 
+#if defined(HAVE_CXX0X) || defined(HAVE_CXX11)
+template <class T>
+SGSparseVector<T>::SGSparseVector(SGSparseVector&& orig) : SGReferencedData(std::move(orig))
+{
+	copy_data(orig);
+	orig.init_data();
+}
+
+template <class T>
+SGSparseVector<T>& SGSparseVector<T>::operator=(const SGSparseVector& orig)
+{
+	SGReferencedData::operator=(orig);
+	return *this;
+}
+
+template <class T>
+SGSparseVector<T>& SGSparseVector<T>::operator=(SGSparseVector&& orig)
+{
+	SGReferencedData::operator=(std::move(orig));
+	return *this;
+}
+#endif // defined(HAVE_CXX0X) || defined(HAVE_CXX11)
+
 template <class T>
 SGSparseVector<T>::~SGSparseVector()
 {
@@ -202,7 +227,7 @@ void SGSparseVector<T>::sort_features(bool stable_pointer)
 		feat_idx[j] = features[j].feat_index;
 	}
 
-	CMath::qsort_index(feat_idx, features, num_feat_entries);
+	CKeyIndexSort::sort(feat_idx, features, num_feat_entries);
 	SG_FREE(feat_idx);
 
 	for (index_t j = 1; j < num_feat_entries; j++)
@@ -58,6 +58,19 @@ public:
 	/** copy constructor */
 	SGSparseVector(const SGSparseVector& orig);
 
+#ifndef SWIG // SWIG should skip this part
+#if defined(HAVE_CXX0X) || defined(HAVE_CXX11)
+	/** move constructor, takes over data and reference of orig */
+	SGSparseVector(SGSparseVector&& orig);
+
+	/** copy assignment */
+	SGSparseVector& operator=(const SGSparseVector& orig);
+
+	/** move assignment, takes over data and reference of orig */
+	SGSparseVector& operator=(SGSparseVector&& orig);
+#endif // defined(HAVE_CXX0X) || defined(HAVE_CXX11)
+#endif // SWIG
+
 	virtual ~SGSparseVector();
 
 	/** compute the dot product between dense weights and a sparse feature vector
@@ -23,6 +23,7 @@
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/lapack.h>
 #include <algorithm>
+#include <utility>
 
 #include <shogun/mathematics/eigen3.h>
 
@@ -94,6 +95,29 @@ SGVector<T>::SGVector(const SGVector &orig) : SGReferencedData(orig)
 	copy_data(orig);
 }
 
+#if defined(HAVE_CXX0X) || defined(HAVE_CXX11)
+template<class T>
+SGVector<T>::SGVector(SGVector&& orig) : SGReferencedData(std::move(orig))
+{
+	copy_data(orig);
+	orig.init_data();
+}
+
+template<class T>
+SGVector<T>& SGVector<T>::operator=(const SGVector& orig)
+{
+	SGReferencedData::operator=(orig);
+	return *this;
+}
+
+template<class T>
+SGVector<T>& SGVector<T>::operator=(SGVector&& orig)
+{
+	SGReferencedData::operator=(std::move(orig));
+	return *this;
+}
+#endif // defined(HAVE_CXX0X) || defined(HAVE_CXX11)
+
 template<class T>
 void SGVector<T>::set(SGVector<T> orig)
 {
@@ -64,6 +64,14 @@ template<class T> class SGVector : public SGReferencedData
 
 #ifndef SWIG // SWIG should skip this part
 #if defined(HAVE_CXX0X) || defined(HAVE_CXX11)
+		/** Move constructor, takes over data and reference of orig */
+		SGVector(SGVector&& orig);
+
+		/** Copy assignment */
+		SGVector& operator=(const SGVector& orig);
+
+		/** Move assignment, takes over data and reference of orig */
+		SGVector& operator=(SGVector&& orig);
 
 		/** The container type for a given template argument */
 		template <typename ST> using container_type = SGVector<ST>;
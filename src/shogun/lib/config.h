@@ -0,0 +1,151 @@
+#ifndef __SHOGUN_LIB_CONFIG_H__
+#define __SHOGUN_LIB_CONFIG_H__
+
+#define MACHINE "x86_64"
+#define CONFIGURE_OPTIONS "TODO"
+#define COMPFLAGS_CPP "-std=c++11 -Wall -Wno-unused-parameter -Wformat -Wformat-security -Wparentheses -Wshadow -Wno-unknown-pragmas -Wno-deprecated  -fopenmp -fpermissive -Wno-psabi -O3 -fexpensive-optimizations -frerun-cse-after-loop -fcse-follow-jumps -finline-functions -fschedule-insns2 -fthread-jumps -fforce-addr -fstrength-reduce -funroll-loops -mfpmath=sse"
+#define LINKFLAGS "/usr/lib/x86_64-linux-gnu/libopenblas.so;-lm;-ldl;/usr/lib/x86_64-linux-gnu/libxml2.so;/usr/lib/x86_64-linux-gnu/hdf5/serial/libhdf5.so;/usr/lib/x86_64-linux-gnu/libcrypto.so;/usr/lib/x86_64-linux-gnu/libcurl.so;/usr/lib/x86_64-linux-gnu/libpthread.a;/usr/lib/x86_64-linux-gnu/libsz.so;/usr/lib/x86_64-linux-gnu/libz.so;/usr/lib/x86_64-linux-gnu/libdl.a;/usr/lib/x86_64-linux-gnu/libm.so;/usr/lib/x86_64-linux-gnu/libcurl.so;/usr/lib/x86_64-linux-gnu/libz.so;/usr/lib/x86_64-linux-gnu/libbz2.so;/usr/lib/x86_64-linux-gnu/liblzma.so;/usr/lib/x86_64-linux-gnu/libprotobuf.so"
+
+#define SFMT_MEXP 19937
+#define DSFMT_MEXP 19937
+
+#define HAVE_HDF5 1
+#define HAVE_CURL 1
+/* #undef HAVE_JSON */
+#define HAVE_XML 1
+#define HAVE_LARGEFILE 1
+/* #undef HAVE_DOXYGEN */
+#define HAVE_LAPACK 1
+/* #undef HAVE_MVEC */
+#define HAVE_PROTOBUF 1
+
+/* #undef HAVE_ARPACK */
+/* #undef HAVE_VIENNACL */
+/* #undef VIENNACL_VERSION */
+/* #undef HAVE_OPENCV */
+/* #undef HAVE_CATLAS */
+/* #undef HAVE_ATLAS */
+/* #undef HAVE_MKL */
+/* #undef HAVE_NLOPT */
+/* #undef USE_LPSOLVE */
+#define HAVE_PTHREAD 1
+#define HAVE_OPENMP 1
+/* #undef USE_CPLEX */
+/* #undef HAVE_COLPACK */
+/* #undef HAVE_ARPREC */
+/* #undef USE_META_INTEGRATION_TESTS */
+
+#define HAVE_POWL 1
+#define HAVE_LGAMMAL 1
+#define HAVE_SQRTL 1
+#define HAVE_LOG2 1
+/* #undef USE_LOGCACHE */
+/* #undef USE_LOGSUMARRAY */
+
+/* Tells ViennaCL to use OpenCL as computation backend */
+#define VIENNACL_WITH_OPENCL 1
+
+/* for linear algebra global backend setups */
+#define HAVE_LINALG_LIB 1
+
+#define USE_EIGEN3 1
+/* #undef USE_VIENNACL */
+
+#define USE_EIGEN3_CORE 1
+/* #undef USE_VIENNACL_CORE */
+
+#define USE_EIGEN3_REDUX 1
+/* #undef USE_VIENNACL_REDUX */
+
+/* #undef USE_EIGEN3_LINSLV */
+/* #undef USE_VIENNACL_LINSLV */
+
+#define USE_EIGEN3_EIGSLV 1
+/* #undef USE_VIENNACL_EIGSLV */
+
+/* Define to 1 if you have the declaration of `isfinite', and to 0 if you
+   don't. */
+/* #undef HAVE_DECL_ISFINITE */
+
+/* Define to 1 if you have the declaration of `isinf', and to 0 if you don't. */
+/* #undef HAVE_DECL_ISINF */
+
+/* Define to 1 if you have the declaration of `isnan', and to 0 if you don't. */
+/* #undef HAVE_DECL_ISNAN */
+
+/* Define to 1 if you have the `finite' function. */
+/* #undef HAVE_FINITE */
+
+/* Define to 1 if you have the `fpclass' function. */
+#define HAVE_FPCLASS 1
+
+/* Define to 1 if you have the `isfinite' function. */
+/* #undef HAVE_ISFINITE */
+
+/* Define to 1 if you have the `isinf' function. */
+#define HAVE_ISINF 1
+
+/* Define to 1 if you have the `isnan' function. */
+#define HAVE_ISNAN 1
+
+/* Define to 1 if you have the `std::isfinite' function. */
+#define HAVE_STD_ISFINITE 1
+
+/* Define to 1 if you have the `std::isinf' function. */
+#define HAVE_STD_ISINF 1
+
+/* Define to 1 if you have the `std::isnan' function. */
+#define HAVE_STD_ISNAN 1
+
+#define HAVE_DECL_SIGNGAM 1
+
+#define HAVE_FDOPEN 1
+
+#define USE_SPINLOCKS 1
+#define USE_SHORTREAL_KERNELCACHE 1
+#define USE_BIGSTATES 1
+
+/* #undef USE_HMMDEBUG */
+#define USE_HMMCACHE 1
+/* #undef USE_HMMPARALLEL */
+/* #undef USE_HMMPARALLEL_STRUCTURES */
+
+/* #undef USE_PATHDEBUG */
+
+#define USE_SVMLIGHT 1
+/* #undef USE_MOSEK */
+#define USE_GPL_SHOGUN 1
+
+/* #undef USE_GLPK */
+/* #undef USE_LZO */
+#define USE_GZIP 1
+#define USE_BZIP2 1
+#define USE_LZMA 1
+#define USE_REFERENCE_COUNTING 1
+/* #undef USE_SNAPPY */
+
+#define HAVE_SSE2 1
+#define HAVE_BUILTIN_VECTOR 1
+/* #undef OCTAVE_APIVERSION */
+
+/* #undef DARWIN */
+/* #undef FREEBSD */
+#define LINUX 1
+
+/* #undef USE_SWIG_DIRECTORS */
+/* #undef TRACE_MEMORY_ALLOCS */
+/* #undef USE_METRICS */
+/* #undef USE_JEMALLOC */
+
+/* #undef NARRAY_LIB */
+
+/* #undef HAVE_CXX0X */
+#define HAVE_CXX11 1
+#define HAVE_CXX11_ATOMIC 1
+#define HAVE_STD_UNORDERED_MAP 1
+
+/* random related defines */
+#define HAVE_ARC4RANDOM 1
+/* #undef DEV_RANDOM */
+
+#endif /* __SHOGUN_LIB_CONFIG_H__ */
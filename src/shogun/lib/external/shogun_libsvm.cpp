@@ -40,6 +40,7 @@
 #include <shogun/io/SGIO.h>
 #include <shogun/lib/Time.h>
 #include <shogun/lib/Signal.h>
+#include <shogun/lib/Metrics.h>
 #include <shogun/lib/common.h>
 #include <shogun/mathematics/Math.h>
 
@@ -76,11 +77,12 @@ class SVC_QMC;
 //
 // l is the number of total data items
 // size is the cache size limit in bytes
+// owner is the object whose metrics count hits, misses and evictions
 //
 class Cache
 {
 public:
-	Cache(int32_t l, int64_t size);
+	Cache(int32_t l, int64_t size, CSGObject* owner);
 	~Cache();
 
 	// request data [0,len)
@@ -92,6 +94,7 @@ public:
 private:
 	int32_t l;
 	int64_t size;
+	CSGObject* owner;
 	struct head_t
 	{
 		head_t *prev, *next;	// a circular list
@@ -105,7 +108,8 @@ private:
 	void lru_insert(head_t *h);
 };
 
-Cache::Cache(int32_t l_, int64_t size_):l(l_),size(size_)
+Cache::Cache(int32_t l_, int64_t size_, CSGObject* owner_)
+:l(l_),size(size_),owner(owner_)
 {
 	head = (head_t *)SG_CALLOC(head_t, l);	// initialized to 0
 	size /= sizeof(Qfloat);
@@ -145,9 +149,12 @@ int32_t Cache::get_data(const int32_t index, Qfloat **data, int32_t len)
 
 	if(more > 0)
 	{
+		SG_METRIC_INC(owner, "libsvm_cache_misses")
+
 		// free old space
 		while(size < more)
 		{
+			SG_METRIC_INC(owner, "libsvm_cache_evictions")
 			head_t *old = lru_head.next;
 			lru_delete(old);
 			SG_FREE(old->data);
@@ -161,6 +168,8 @@ int32_t Cache::get_data(const int32_t index, Qfloat **data, int32_t len)
 		size -= more;
 		CMath::swap(h->len,len);
 	}
+	else
+		SG_METRIC_INC(owner, "libsvm_cache_hits")
 
 	lru_insert(h);
 	*data = h->data;
@@ -376,6 +385,10 @@ LibSVMKernel::~LibSVMKernel()
 //
 // solution will be put in \alpha, objective value will be put in obj
 //
+// If G is given, it holds the gradient at the initial \alpha on input and
+// the final gradient on output, and the problem is left in its original
+// order so that Q (and its kernel cache) can be reused by another Solve
+//
 class Solver {
 public:
 	Solver() {};
@@ -392,7 +405,8 @@ public:
 	void Solve(
 		int32_t l, const QMatrix& Q, const float64_t *p_, const schar *y_,
 		float64_t *alpha_, float64_t Cp, float64_t Cn, float64_t eps,
-		SolutionInfo* si, int32_t shrinking, bool use_bias);
+		SolutionInfo* si, int32_t shrinking, bool use_bias,
+		float64_t *G_ = NULL);
 
 protected:
 	int32_t active_size;
@@ -489,7 +503,8 @@ void Solver::reconstruct_gradient()
 void Solver::Solve(
 	int32_t p_l, const QMatrix& p_Q, const float64_t *p_p,
 	const schar *p_y, float64_t *p_alpha, float64_t p_Cp, float64_t p_Cn,
-	float64_t p_eps, SolutionInfo* p_si, int32_t shrinking, bool use_bias)
+	float64_t p_eps, SolutionInfo* p_si, int32_t shrinking, bool use_bias,
+	float64_t *p_G)
 {
 	this->l = p_l;
 	this->Q = &p_Q;
@@ -520,9 +535,29 @@ void Solver::Solve(
 	// initialize gradient
 	CSignal::clear_cancel();
 	CTime start_time;
+	G = SG_MALLOC(float64_t, l);
+	G_bar = SG_MALLOC(float64_t, l);
+	if(p_G)
+	{
+		// gradient is given, only G_bar depends on the bounds
+		int32_t i;
+		for(i=0;i<l;i++)
+		{
+			G[i] = p_G[i];
+			G_bar[i] = 0;
+		}
+		for(i=0;i<l && !CSignal::cancel_computations(); i++)
+		{
+			if(is_upper_bound(i))
+			{
+				const Qfloat *Q_i = Q->get_Q(i,l);
+				for(int32_t j=0;j<l;j++)
+					G_bar[j] += get_C(i) * Q_i[j];
+			}
+		}
+	}
+	else
 	{
-		G = SG_MALLOC(float64_t, l);
-		G_bar = SG_MALLOC(float64_t, l);
 		int32_t i;
 		for(i=0;i<l;i++)
 		{
@@ -779,6 +814,18 @@ void Solver::Solve(
 		p_si->obj = v/2;
 	}
 
+	// restore the original order of the problem and pass the gradient back
+	if(p_G)
+	{
+		reconstruct_gradient();
+		active_size = l;
+		for(int32_t i=0;i<l;i++)
+			while(active_set[i] != i)
+				swap_index(i,active_set[i]);
+		for(int32_t i=0;i<l;i++)
+			p_G[i] = G[i];
+	}
+
 	// put back the solution
 	{
 		for(int32_t i=0;i<l;i++)
@@ -1325,7 +1372,7 @@ public:
 		nr_class=n_class;
 		factor=fac;
 		clone(y,y_,prob.l);
-		cache = new Cache(prob.l,(int64_t)(param.cache_size*(1l<<20)));
+		cache = new Cache(prob.l,(int64_t)(param.cache_size*(1l<<20)), param.kernel);
 		QD = SG_MALLOC(Qfloat, prob.l);
 		for(int32_t i=0;i<prob.l;i++)
 		{
@@ -1705,7 +1752,7 @@ public:
 	:LibSVMKernel(prob.l, prob.x, param)
 	{
 		clone(y,y_,prob.l);
-		cache = new Cache(prob.l,(int64_t)(param.cache_size*(1l<<20)));
+		cache = new Cache(prob.l,(int64_t)(param.cache_size*(1l<<20)), param.kernel);
 		QD = SG_MALLOC(Qfloat, prob.l);
 		for(int32_t i=0;i<prob.l;i++)
 			QD[i]= (Qfloat)kernel_function(i,i);
@@ -1753,7 +1800,7 @@ public:
 	ONE_CLASS_Q(const svm_problem& prob, const svm_parameter& param)
 	:LibSVMKernel(prob.l, prob.x, param)
 	{
-		cache = new Cache(prob.l,(int64_t)(param.cache_size*(1l<<20)));
+		cache = new Cache(prob.l,(int64_t)(param.cache_size*(1l<<20)), param.kernel);
 		QD = SG_MALLOC(Qfloat, prob.l);
 		for(int32_t i=0;i<prob.l;i++)
 			QD[i]= (Qfloat)kernel_function(i,i);
@@ -1798,7 +1845,7 @@ public:
 	:LibSVMKernel(prob.l, prob.x, param)
 	{
 		l = prob.l;
-		cache = new Cache(l,(int64_t)(param.cache_size*(1l<<20)));
+		cache = new Cache(l,(int64_t)(param.cache_size*(1l<<20)), param.kernel);
 		QD = SG_MALLOC(Qfloat, 2*l);
 		sign = SG_MALLOC(schar, 2*l);
 		index = SG_MALLOC(int32_t, 2*l);
@@ -2572,6 +2619,125 @@ svm_model *svm_train(const svm_problem *prob, const svm_parameter *param)
 	return model;
 }
 
+// scales down the alphas of the side with the larger sum, such that the
+// clipped alphas satisfy sum_i y_i alpha_i = 0 again
+static void balance_alphas(float64_t *alpha, const schar *y, int32_t l)
+{
+	float64_t sum_pos = 0, sum_neg = 0;
+	for(int32_t i=0;i<l;i++)
+	{
+		if(y[i] > 0)
+			sum_pos += alpha[i];
+		else
+			sum_neg += alpha[i];
+	}
+	if(sum_pos == sum_neg)
+		return;
+
+	schar larger = sum_pos > sum_neg ? +1 : -1;
+	float64_t scale = sum_pos > sum_neg ? sum_neg/sum_pos : sum_pos/sum_neg;
+	for(int32_t i=0;i<l;i++)
+		if(y[i] == larger)
+			alpha[i] *= scale;
+}
+
+void svm_train_path(
+	const svm_problem *prob, const svm_parameter *param, int32_t num_steps,
+	const float64_t *Cp, const float64_t *Cn, const float64_t *p,
+	float64_t *alpha, float64_t *rho, float64_t *objective)
+{
+	int32_t l = prob->l;
+	bool regression = param->svm_type == EPSILON_SVR;
+	// regression has one variable for each side of the tube
+	int32_t n = regression ? 2*l : l;
+
+	schar *y = SG_MALLOC(schar, n);
+	float64_t *linear_term = SG_MALLOC(float64_t, n);
+	float64_t *a = SG_CALLOC(float64_t, n);
+	float64_t *a_new = SG_MALLOC(float64_t, n);
+	float64_t *G = SG_MALLOC(float64_t, n);
+
+	for(int32_t i=0;i<l;i++)
+	{
+		if(regression)
+		{
+			y[i] = +1;
+			y[i+l] = -1;
+			linear_term[i] = p[0] - prob->y[i];
+			linear_term[i+l] = p[0] + prob->y[i];
+		}
+		else
+		{
+			y[i] = prob->y[i] > 0 ? +1 : -1;
+			linear_term[i] = prob->pv ? prob->pv[i] : -1.0;
+		}
+	}
+	// gradient at alpha = 0
+	for(int32_t i=0;i<n;i++)
+		G[i] = linear_term[i];
+
+	// the kernel cache of Q is kept for all steps
+	QMatrix *Q;
+	if(regression)
+		Q = new SVR_Q(*prob,*param);
+	else
+		Q = new SVC_Q(*prob,*param,y);
+
+	for(int32_t k=0;k<num_steps && !CSignal::cancel_computations();k++)
+	{
+		float64_t C_pos = Cp[k];
+		float64_t C_neg = regression ? Cp[k] : Cn[k];
+		SG_SINFO("path step %d of %d: C = (%f, %f)\n", k+1, num_steps, C_neg, C_pos)
+
+		// a change of the tube shifts the linear term and the gradient alike
+		if(regression && k > 0 && p[k] != p[k-1])
+		{
+			for(int32_t i=0;i<n;i++)
+			{
+				linear_term[i] += p[k] - p[k-1];
+				G[i] += p[k] - p[k-1];
+			}
+		}
+
+		// warm start from the previous solution clipped to the new box
+		for(int32_t i=0;i<n;i++)
+			a_new[i] = CMath::min(a[i], y[i] > 0 ? C_pos : C_neg);
+		if(param->use_bias)
+			balance_alphas(a_new, y, n);
+
+		// gradient update for the clipped alphas only
+		for(int32_t i=0;i<n;i++)
+		{
+			float64_t delta = a_new[i] - a[i];
+			if(delta != 0)
+			{
+				const Qfloat *Q_i = Q->get_Q(i,n);
+				for(int32_t j=0;j<n;j++)
+					G[j] += delta * Q_i[j];
+				a[i] = a_new[i];
+			}
+		}
+
+		Solver s;
+		Solver::SolutionInfo si;
+		s.Solve(n, *Q, linear_term, y, a, C_pos, C_neg, param->eps, &si,
+			param->shrinking, param->use_bias, G);
+
+		float64_t *alpha_k = alpha + int64_t(k)*l;
+		for(int32_t i=0;i<l;i++)
+			alpha_k[i] = regression ? a[i] - a[i+l] : a[i]*y[i];
+		rho[k] = si.rho;
+		objective[k] = si.obj;
+	}
+
+	delete Q;
+	SG_FREE(y);
+	SG_FREE(linear_term);
+	SG_FREE(a);
+	SG_FREE(a_new);
+	SG_FREE(G);
+}
+
 void svm_destroy_model(svm_model* model)
 {
 	if(model->free_sv && model->l > 0)
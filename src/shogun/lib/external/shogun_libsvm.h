@@ -166,6 +166,21 @@ struct svm_model
 struct svm_model *svm_train(
 	const struct svm_problem *prob, const struct svm_parameter *param);
 
+/** Solves a C_SVC or EPSILON_SVR problem for a sequence of parameters.
+ * Step k uses the constants Cp[k] (and Cn[k] for the negative class of
+ * C_SVC) and, for EPSILON_SVR, the tube epsilon p[k]. Each step is warm
+ * started from the solution and the gradient of the previous one, the
+ * alphas clipped to the new box, and the kernel cache is kept for all
+ * steps. The signed coefficients of step k are written to
+ * alpha[k*l...(k+1)*l-1], its threshold to rho[k] and the dual objective
+ * to objective[k].
+ */
+void svm_train_path(
+	const struct svm_problem *prob, const struct svm_parameter *param,
+	int32_t num_steps, const float64_t *Cp, const float64_t *Cn,
+	const float64_t *p, float64_t *alpha, float64_t *rho,
+	float64_t *objective);
+
 float64_t svm_predict(const struct svm_model *model, const struct svm_node *x);
 
 void svm_destroy_model(struct svm_model *model);
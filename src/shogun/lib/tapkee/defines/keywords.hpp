@@ -400,6 +400,19 @@ namespace tapkee
 			 */
 			const ParameterKeyword<ScalarType> sne_theta("SNE theta", 0.5);
 
+			/** The keyword for the value that stores whether the t-SNE
+			 * algorithm approximates the repulsive forces by FFT-accelerated
+			 * interpolation instead of Barnes-Hut. Takes effect only
+			 * when @ref tapkee::keywords::sne_theta is positive.
+			 *
+			 * Used by @ref tapkee::tDistributedStochasticNeighborEmbedding.
+			 *
+			 * Default value is false.
+			 *
+			 * The corresponding value should have type bool.
+			 */
+			const ParameterKeyword<bool> sne_interpolation("SNE interpolation", false);
+
 			/** The keyword for the value that stores the squishingRate
 			 * parameter of the Manifold Sculpting algorithm.
 			 *
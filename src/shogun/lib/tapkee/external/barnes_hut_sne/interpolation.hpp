@@ -0,0 +1,260 @@
+/* This software is distributed under BSD 3-clause license (see LICENSE file).
+ *
+ * Repulsive forces of t-SNE by polynomial interpolation on an equispaced
+ * grid, where the convolutions with the Cauchy kernels are computed by FFT.
+ * The approach follows
+ *
+ * Linderman, G. C., Rachh, M., Hoskins, J. G., Steinerberger, S., & Kluger, Y.
+ * (2019). Fast interpolation-based t-SNE for improved visualization of
+ * single-cell RNA-seq data. Nature Methods, 16(3), 243-245.
+ */
+
+#ifndef TSNE_INTERPOLATION_H
+#define TSNE_INTERPOLATION_H
+
+#include <math.h>
+#include <float.h>
+#include <complex>
+#include <vector>
+#include <algorithm>
+
+namespace tsne
+{
+
+class InterpolatedRepulsiveForces
+{
+	typedef std::complex<double> Complex;
+
+	// Interpolation nodes per box and dimension
+	static const int INTERPOLATION_POINTS = 3;
+	// Number of boxes per dimension is the embedding range clamped to these
+	// bounds, boxes are added to fill the transform size
+	static const int MIN_BOXES = 10;
+	static const int MAX_BOXES = 80;
+
+public:
+
+	// Computes the unnormalized repulsive forces neg_f of all points of a
+	// two-dimensional embedding Y and the normalization sum_Q of the
+	// t-distribution, like the Barnes-Hut approximation
+	void compute(const double* Y, int N, double* neg_f, double* sum_Q)
+	{
+		const int p = INTERPOLATION_POINTS;
+
+		// Square grid of boxes which covers the embedding
+		double lo = DBL_MAX, hi = -DBL_MAX;
+		for(int i = 0; i < N * 2; i++) {
+			lo = std::min(lo, Y[i]);
+			hi = std::max(hi, Y[i]);
+		}
+		int n_boxes = std::min(MAX_BOXES, std::max(MIN_BOXES, (int) ceil(hi - lo)));
+		n_fft = 1;
+		while(n_fft < 2 * n_boxes * p) n_fft *= 2;
+		n_boxes = n_fft / 2 / p;
+		double box_width = (hi - lo) / n_boxes + DBL_EPSILON;
+		double h = box_width / p;
+		M = n_boxes * p;
+
+		// Small embeddings are cheaper to sum directly than the transforms
+		if((double) N * N <= (double) n_fft * n_fft * log2((double) n_fft)) {
+			computeDirect(Y, N, neg_f, sum_Q);
+			return;
+		}
+
+		prepareTransform(h);
+
+		// Interpolation weights of all points
+		std::vector<int> boxes(2 * N);
+		std::vector<double> weights(2 * p * N);
+#pragma omp parallel for
+		for(int i = 0; i < N; i++) {
+			for(int d = 0; d < 2; d++) {
+				double u = (Y[i * 2 + d] - lo) / box_width;
+				int box = std::min(n_boxes - 1, (int) u);
+				boxes[i * 2 + d] = box;
+				lagrangeWeights(u - box, &weights[(i * 2 + d) * p]);
+			}
+		}
+
+		// Charges 1 and y_1 + i y_2 spread to the grid nodes
+		for(int c = 0; c < 2; c++) charges[c].assign(n_fft * n_fft, Complex(0));
+		for(int i = 0; i < N; i++) {
+			const double* wx = &weights[i * 2 * p];
+			const double* wy = &weights[(i * 2 + 1) * p];
+			for(int kx = 0; kx < p; kx++) {
+				for(int ky = 0; ky < p; ky++) {
+					int g = (boxes[i * 2] * p + kx) * n_fft + boxes[i * 2 + 1] * p + ky;
+					double w = wx[kx] * wy[ky];
+					charges[0][g] += w;
+					charges[1][g] += Complex(w * Y[i * 2], w * Y[i * 2 + 1]);
+				}
+			}
+		}
+
+		// Potentials at the grid nodes. The transforms of both kernels are
+		// real, so the charge 1 convolved with the kernel pair gives both
+		// potentials of the normalization, and the coordinates are convolved
+		// with the squared kernel at once.
+		for(int c = 0; c < 2; c++) fft2(&charges[c][0], false, M);
+		convolve(charges[0], false, potentials[0]);
+		convolve(charges[1], true, potentials[1]);
+
+		// Interpolate the potentials at the points
+		double Z = .0;
+#pragma omp parallel for reduction(+:Z)
+		for(int i = 0; i < N; i++) {
+			const double* wx = &weights[i * 2 * p];
+			const double* wy = &weights[(i * 2 + 1) * p];
+			double phi[4] = {.0, .0, .0, .0};
+			for(int kx = 0; kx < p; kx++) {
+				for(int ky = 0; ky < p; ky++) {
+					int g = (boxes[i * 2] * p + kx) * n_fft + boxes[i * 2 + 1] * p + ky;
+					double w = wx[kx] * wy[ky];
+					phi[0] += w * potentials[0][g].real();
+					phi[1] += w * potentials[0][g].imag();
+					phi[2] += w * potentials[1][g].real();
+					phi[3] += w * potentials[1][g].imag();
+				}
+			}
+
+			// Remove the interaction of the point with itself, which is 1
+			Z += phi[0] - 1.0;
+			neg_f[i * 2]     = Y[i * 2]     * phi[1] - phi[2];
+			neg_f[i * 2 + 1] = Y[i * 2 + 1] * phi[1] - phi[3];
+		}
+		*sum_Q = Z;
+	}
+
+private:
+
+	// Exact forces by summation over all pairs of points
+	static void computeDirect(const double* Y, int N, double* neg_f, double* sum_Q)
+	{
+		double Z = .0;
+#pragma omp parallel for reduction(+:Z)
+		for(int i = 0; i < N; i++) {
+			neg_f[i * 2] = neg_f[i * 2 + 1] = .0;
+			for(int j = 0; j < N; j++) {
+				if(i == j) continue;
+				double dx = Y[i * 2] - Y[j * 2];
+				double dy = Y[i * 2 + 1] - Y[j * 2 + 1];
+				double q = 1.0 / (1.0 + dx * dx + dy * dy);
+				Z += q;
+				neg_f[i * 2]     += q * q * dx;
+				neg_f[i * 2 + 1] += q * q * dy;
+			}
+		}
+		*sum_Q = Z;
+	}
+
+	// Lagrange polynomials of the nodes (k + .5) / p at u in [0, 1]
+	static void lagrangeWeights(double u, double* w)
+	{
+		const int p = INTERPOLATION_POINTS;
+		for(int k = 0; k < p; k++) {
+			w[k] = 1.0;
+			for(int m = 0; m < p; m++) {
+				if(m != k) w[k] *= (u - (m + .5) / p) / ((double) (k - m) / p);
+			}
+		}
+	}
+
+	// Transforms the kernel and the squared kernel sampled at the distances
+	// of the nodes with spacing h as real and imaginary part of one sequence.
+	// Both are symmetric, so their transforms are real and stay separated.
+	void prepareTransform(double h)
+	{
+		twiddles.resize(n_fft / 2);
+		for(int k = 0; k < n_fft / 2; k++) twiddles[k] = std::polar(1.0, -2.0 * M_PI * k / n_fft);
+
+		// Circulant embedding, offsets beyond M-1 in both directions are never used
+		kernels_hat.assign(n_fft * n_fft, Complex(0));
+		for(int a = 0; a < n_fft; a++) {
+			int da = a < M ? a : a - n_fft;
+			if(da <= -M) continue;
+			for(int b = 0; b < n_fft; b++) {
+				int db = b < M ? b : b - n_fft;
+				if(db <= -M) continue;
+				double q = 1.0 / (1.0 + h * h * (da * da + db * db));
+				kernels_hat[a * n_fft + b] = Complex(q, q * q);
+			}
+		}
+		fft2(&kernels_hat[0], false, n_fft);
+	}
+
+	// Circular convolution of transformed charges with both kernels, or with
+	// the squared kernel only
+	void convolve(const std::vector<Complex>& charges_hat, bool squared_only,
+	              std::vector<Complex>& result)
+	{
+		double scale = 1.0 / ((double) n_fft * n_fft);
+		result.resize(n_fft * n_fft);
+#pragma omp parallel for
+		for(int g = 0; g < n_fft * n_fft; g++) {
+			if(squared_only)
+				result[g] = charges_hat[g] * (kernels_hat[g].imag() * scale);
+			else
+				result[g] = charges_hat[g] * kernels_hat[g] * scale;
+		}
+		fft2(&result[0], true, M);
+	}
+
+	// Two-dimensional transform, rows are transformed, transposed and
+	// transformed again, so the spectrum is transposed. The inverse
+	// transform (without scaling) of a transposed spectrum restores the
+	// original layout. Only the first rows of the input of the forward
+	// transform are non-zero and only the first rows of the output of the
+	// inverse transform are needed.
+	void fft2(Complex* x, bool inverse, int rows) const
+	{
+		for(int pass = 0; pass < 2; pass++) {
+			int n_rows = (pass == 0) != inverse ? rows : n_fft;
+#pragma omp parallel for
+			for(int r = 0; r < n_rows; r++) fft(x + r * n_fft, inverse);
+			if(pass == 0) {
+				for(int r = 0; r < n_fft; r++) {
+					for(int c = r + 1; c < n_fft; c++) std::swap(x[r * n_fft + c], x[c * n_fft + r]);
+				}
+			}
+		}
+	}
+
+	// In-place iterative radix-2 transform of n_fft values
+	void fft(Complex* x, bool inverse) const
+	{
+		const int n = n_fft;
+		for(int i = 1, j = 0; i < n; i++) {
+			int bit = n >> 1;
+			for(; j & bit; bit >>= 1) j ^= bit;
+			j ^= bit;
+			if(i < j) std::swap(x[i], x[j]);
+		}
+		for(int len = 2; len <= n; len <<= 1) {
+			int step = n / len;
+			for(int i = 0; i < n; i += len) {
+				for(int k = 0; k < len / 2; k++) {
+					const Complex& w = twiddles[k * step];
+					const Complex& y = x[i + k + len / 2];
+					double w_imag = inverse ? -w.imag() : w.imag();
+					Complex t(w.real() * y.real() - w_imag * y.imag(),
+					          w.real() * y.imag() + w_imag * y.real());
+					x[i + k + len / 2] = x[i + k] - t;
+					x[i + k] += t;
+				}
+			}
+		}
+	}
+
+	// Transform size and number of nodes per dimension
+	int n_fft;
+	int M;
+	std::vector<Complex> twiddles;
+	std::vector<Complex> kernels_hat;
+	// Grids are kept between calls to avoid reallocations
+	std::vector<Complex> charges[2];
+	std::vector<Complex> potentials[2];
+};
+
+}
+
+#endif
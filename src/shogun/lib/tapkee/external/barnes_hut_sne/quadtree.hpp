@@ -69,9 +69,6 @@ class QuadTree
 	static const int QT_NO_DIMS = 2;
 	static const int QT_NODE_CAPACITY = 1;
 
-	// A buffer we use when doing force computations
-	double buff[QT_NO_DIMS];
-
 	// Properties of this node in the tree
 	QuadTree* parent;
 	bool is_leaf;
@@ -311,14 +308,16 @@ public:
 		                             southEast->getDepth()));
 	}
 
-	// Compute non-edge forces using Barnes-Hut algorithm
-	void computeNonEdgeForces(int point_index, double theta, double neg_f[], double* sum_Q)
+	// Compute non-edge forces using Barnes-Hut algorithm, the forces of
+	// several points may be computed in parallel
+	void computeNonEdgeForces(int point_index, double theta, double neg_f[], double* sum_Q) const
 	{
 
 		// Make sure that we spend no time on empty nodes or self-interactions
 		if(cum_size == 0 || (is_leaf && size == 1 && index[0] == point_index)) return;
 
 		// Compute distance between point and center-of-mass
+		double buff[QT_NO_DIMS];
 		double D = .0;
 		int ind = point_index * QT_NO_DIMS;
 		for(int d = 0; d < QT_NO_DIMS; d++) buff[d]  = data[ind + d];
@@ -344,30 +343,6 @@ public:
 		}
 	}
 
-	// Computes edge forces
-	void computeEdgeForces(int* row_P, int* col_P, double* val_P, int N, double* pos_f)
-	{
-		// Loop over all edges in the graph
-		int ind1, ind2;
-		double D;
-		for(int n = 0; n < N; n++) {
-			ind1 = n * QT_NO_DIMS;
-			for(int i = row_P[n]; i < row_P[n + 1]; i++) {
-
-				// Compute pairwise distance and Q-value
-				D = .0;
-				ind2 = col_P[i] * QT_NO_DIMS;
-				for(int d = 0; d < QT_NO_DIMS; d++) buff[d]  = data[ind1 + d];
-				for(int d = 0; d < QT_NO_DIMS; d++) buff[d] -= data[ind2 + d];
-				for(int d = 0; d < QT_NO_DIMS; d++) D += buff[d] * buff[d];
-				D = val_P[i] / (1.0 + D);
-
-				// Sum positive force
-				for(int d = 0; d < QT_NO_DIMS; d++) pos_f[ind1 + d] += D * buff[d];
-			}
-		}
-	}
-
 	// Print out tree
 	void print()
 	{
@@ -37,6 +37,7 @@
 #include <shogun/lib/tapkee/utils/time.hpp>
 #include <shogun/lib/tapkee/external/barnes_hut_sne/quadtree.hpp>
 #include <shogun/lib/tapkee/external/barnes_hut_sne/vptree.hpp>
+#include <shogun/lib/tapkee/external/barnes_hut_sne/interpolation.hpp>
 /* End of Tapkee includes */
 
 #include <math.h>
@@ -55,12 +56,18 @@ static inline double sign(double x) { return (x == .0 ? .0 : (x < .0 ? -1.0 : 1.
 class TSNE
 {
 public:
-	void run(double* X, int N, int D, double* Y, int no_dims, double perplexity, double theta)
+	// Embeds X with exact t-SNE if theta is zero. Otherwise, the repulsive
+	// forces are approximated either by Barnes-Hut with accuracy theta or,
+	// if interpolate is set, by FFT-accelerated interpolation. Both
+	// approximations need a two-dimensional embedding.
+	void run(double* X, int N, int D, double* Y, int no_dims, double perplexity, double theta, bool interpolate = false)
 	{
 		// Determine whether we are using an exact algorithm
 		bool exact = (theta == .0) ? true : false;
 		if (exact)
 			tapkee::LoggingSingleton::instance().message_info("Using exact t-SNE algorithm");
+		else if (interpolate)
+			tapkee::LoggingSingleton::instance().message_info("Using FFT-accelerated interpolation t-SNE algorithm");
 		else
 			tapkee::LoggingSingleton::instance().message_info("Using Barnes-Hut-SNE algorithm");
 
@@ -138,6 +145,7 @@ public:
 
 				// Compute (approximate) gradient
 				if(exact) computeExactGradient(P, Y, N, no_dims, dY);
+				else if(interpolate) computeInterpolatedGradient(row_P, col_P, val_P, Y, N, no_dims, dY);
 				else computeGradient(P, row_P, col_P, val_P, Y, N, no_dims, dY, theta);
 
 				// Update gains
@@ -291,8 +299,15 @@ private:
 		double* pos_f = (double*) calloc(N * D, sizeof(double));
 		double* neg_f = (double*) calloc(N * D, sizeof(double));
 		if(pos_f == NULL || neg_f == NULL) { printf("Memory allocation failed!\n"); exit(1); }
-		tree->computeEdgeForces(inp_row_P, inp_col_P, inp_val_P, N, pos_f);
-		for(int n = 0; n < N; n++) tree->computeNonEdgeForces(n, theta, neg_f + n * D, &sum_Q);
+		computeEdgeForces(inp_row_P, inp_col_P, inp_val_P, Y, N, D, pos_f);
+
+		// The tree walks of the points are independent
+#pragma omp parallel for schedule(dynamic, 256) reduction(+:sum_Q)
+		for(int n = 0; n < N; n++) {
+			double point_sum_Q = .0;
+			tree->computeNonEdgeForces(n, theta, neg_f + n * D, &point_sum_Q);
+			sum_Q += point_sum_Q;
+		}
 
 		// Compute final t-SNE gradient
 		for(int i = 0; i < N * D; i++) {
@@ -303,6 +318,45 @@ private:
 		delete tree;
 	}
 
+	void computeInterpolatedGradient(int* inp_row_P, int* inp_col_P, double* inp_val_P, double* Y, int N, int D, double* dC)
+	{
+		// Compute all terms required for t-SNE gradient
+		double sum_Q = .0;
+		double* pos_f = (double*) calloc(N * D, sizeof(double));
+		double* neg_f = (double*) calloc(N * D, sizeof(double));
+		if(pos_f == NULL || neg_f == NULL) { printf("Memory allocation failed!\n"); exit(1); }
+		computeEdgeForces(inp_row_P, inp_col_P, inp_val_P, Y, N, D, pos_f);
+		interpolation.compute(Y, N, neg_f, &sum_Q);
+
+		// Compute final t-SNE gradient
+		for(int i = 0; i < N * D; i++) {
+			dC[i] = pos_f[i] - (neg_f[i] / sum_Q);
+		}
+		free(pos_f);
+		free(neg_f);
+	}
+
+	// Computes the attractive forces along the edges of the input similarities
+	void computeEdgeForces(int* row_P, int* col_P, double* val_P, double* Y, int N, int D, double* pos_f)
+	{
+		// The rows are independent
+#pragma omp parallel for schedule(dynamic, 256)
+		for(int n = 0; n < N; n++) {
+			int ind1 = n * D;
+			for(int i = row_P[n]; i < row_P[n + 1]; i++) {
+
+				// Compute pairwise distance and Q-value
+				double Q = .0;
+				int ind2 = col_P[i] * D;
+				for(int d = 0; d < D; d++) Q += (Y[ind1 + d] - Y[ind2 + d]) * (Y[ind1 + d] - Y[ind2 + d]);
+				Q = val_P[i] / (1.0 + Q);
+
+				// Sum positive force
+				for(int d = 0; d < D; d++) pos_f[ind1 + d] += Q * (Y[ind1 + d] - Y[ind2 + d]);
+			}
+		}
+	}
+
 	void computeExactGradient(double* P, double* Y, int N, int D, double* dC)
 	{
 		// Make sure the current gradient contains zeros
@@ -327,6 +381,7 @@ private:
 		}
 
 		// Perform the computation of the gradient
+#pragma omp parallel for
 		for(int n = 0; n < N; n++) {
 			for(int m = 0; m < N; m++) {
 				if(n != m) {
@@ -507,8 +562,6 @@ private:
 		int* row_P = *_row_P;
 		int* col_P = *_col_P;
 		double* val_P = *_val_P;
-		double* cur_P = (double*) malloc((N - 1) * sizeof(double));
-		if(cur_P == NULL) { printf("Memory allocation failed!\n"); exit(1); }
 		row_P[0] = 0;
 		for(int n = 0; n < N; n++) row_P[n + 1] = row_P[n] + K;
 
@@ -518,14 +571,16 @@ private:
 		for(int n = 0; n < N; n++) obj_X[n] = DataPoint(D, n, X + n * D);
 		tree->create(obj_X);
 
-		// Loop over all points to find nearest neighbors
-		//printf("Building tree...\n");
+		// Loop over all points to find nearest neighbors, the searches and
+		// binary searches of the points are independent
+#pragma omp parallel
+		{
 		std::vector<DataPoint> indices;
 		std::vector<double> distances;
+		double* cur_P = (double*) malloc((N - 1) * sizeof(double));
+		if(cur_P == NULL) { printf("Memory allocation failed!\n"); exit(1); }
+#pragma omp for schedule(dynamic, 64)
 		for(int n = 0; n < N; n++) {
-
-			//if(n % 10000 == 0) printf(" - point %d of %d\n", n, N);
-
 			// Find nearest neighbors
 			indices.clear();
 			distances.clear();
@@ -585,10 +640,11 @@ private:
 				val_P[row_P[n] + m] = cur_P[m];
 			}
 		}
+		free(cur_P);
+		}
 
 		// Clean up memory
 		obj_X.clear();
-		free(cur_P);
 		delete tree;
 	}
 
@@ -771,12 +827,14 @@ private:
 		}
 		Eigen::Map<Eigen::MatrixXd> DD_map(DD,N,N);
 		Eigen::Map<Eigen::MatrixXd> X_map(X,D,N);
-		DD_map.noalias() = -2.0*X_map.transpose()*X_map;
+		DD_map.noalias() += -2.0*X_map.transpose()*X_map;
 
 		//cblas_dgemm(CblasColMajor, CblasTrans, CblasNoTrans, N, N, D, -2.0, X, D, X, D, 1.0, DD, N);
 		free(dataSums); dataSums = NULL;
 	}
 
+	InterpolatedRepulsiveForces interpolation;
+
 };
 
 }
@@ -94,7 +94,7 @@ class VpTree
 public:
 
 	// Default constructor
-	VpTree() :  _items(), _tau(0.0), _root(0) {}
+	VpTree() :  _items(), _root(0) {}
 
 	// Destructor
 	~VpTree() {
@@ -108,18 +108,19 @@ public:
 		_root = buildFromPoints(0, items.size());
 	}
 
-	// Function that uses the tree to find the k nearest neighbors of target
-	void search(const T& target, int k, std::vector<T>* results, std::vector<double>* distances)
+	// Function that uses the tree to find the k nearest neighbors of target,
+	// several searches may run in parallel
+	void search(const T& target, int k, std::vector<T>* results, std::vector<double>* distances) const
 	{
 
 		// Use a priority queue to store intermediate results on
 		std::priority_queue<HeapItem> heap;
 
 		// Variable that tracks the distance to the farthest point in our results
-		_tau = DBL_MAX;
+		double tau = DBL_MAX;
 
 		// Perform the searcg
-		search(_root, target, k, heap);
+		search(_root, target, k, heap, tau);
 
 		// Gather final results
 		results->clear(); distances->clear();
@@ -140,7 +141,6 @@ private:
 	VpTree& operator=(const VpTree&);
 
 	std::vector<T> _items;
-	double _tau;
 
 	// Single node of a VP tree (has a point and radius; left children are closer to point than the radius)
 	struct Node
@@ -223,7 +223,7 @@ private:
 	}
 
 	// Helper function that searches the tree
-	void search(Node* node, const T& target, int k, std::priority_queue<HeapItem>& heap)
+	void search(Node* node, const T& target, int k, std::priority_queue<HeapItem>& heap, double& tau) const
 	{
 		if(node == NULL) return;     // indicates that we're done here
 
@@ -231,10 +231,10 @@ private:
 		double dist = distance(_items[node->index], target);
 
 		// If current node within radius tau
-		if(dist < _tau) {
+		if(dist < tau) {
 			if(heap.size() == static_cast<size_t>(k)) heap.pop(); // remove furthest node from result list (if we already have k results)
 			heap.push(HeapItem(node->index, dist));           // add current node to result list
-			if(heap.size() == static_cast<size_t>(k)) _tau = heap.top().dist;     // update value of tau (farthest point in result list)
+			if(heap.size() == static_cast<size_t>(k)) tau = heap.top().dist;     // update value of tau (farthest point in result list)
 		}
 
 		// Return if we arrived at a leaf
@@ -244,22 +244,22 @@ private:
 
 		// If the target lies within the radius of ball
 		if(dist < node->threshold) {
-			if(dist - _tau <= node->threshold) {         // if there can still be neighbors inside the ball, recursively search left child first
-				search(node->left, target, k, heap);
+			if(dist - tau <= node->threshold) {         // if there can still be neighbors inside the ball, recursively search left child first
+				search(node->left, target, k, heap, tau);
 			}
 
-			if(dist + _tau >= node->threshold) {         // if there can still be neighbors outside the ball, recursively search right child
-				search(node->right, target, k, heap);
+			if(dist + tau >= node->threshold) {         // if there can still be neighbors outside the ball, recursively search right child
+				search(node->right, target, k, heap, tau);
 			}
 
 			// If the target lies outsize the radius of the ball
 		} else {
-			if(dist + _tau >= node->threshold) {         // if there can still be neighbors outside the ball, recursively search right child first
-				search(node->right, target, k, heap);
+			if(dist + tau >= node->threshold) {         // if there can still be neighbors outside the ball, recursively search right child first
+				search(node->right, target, k, heap, tau);
 			}
 
-			if (dist - _tau <= node->threshold) {         // if there can still be neighbors inside the ball, recursively search left child
-				search(node->left, target, k, heap);
+			if (dist - tau <= node->threshold) {         // if there can still be neighbors inside the ball, recursively search left child
+				search(node->left, target, k, heap, tau);
 			}
 		}
 	}
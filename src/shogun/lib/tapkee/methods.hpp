@@ -53,7 +53,7 @@ public:
 		eigen_method(), neighbors_method(), eigenshift(), traceshift(),
 		check_connectivity(), n_neighbors(), width(), timesteps(),
 		ratio(), max_iteration(), tolerance(), n_updates(), perplexity(),
-		theta(), squishing_rate(), global_strategy(), epsilon(), target_dimension(),
+		theta(), interpolation(), squishing_rate(), global_strategy(), epsilon(), target_dimension(),
 		n_vectors(0), current_dimension(0)
 	{
 		n_vectors = (end-begin);
@@ -80,6 +80,7 @@ public:
 		tolerance = parameters(keywords::spe_tolerance).checked().positive();
 		n_updates = parameters(keywords::spe_num_updates).checked().positive();
 		theta = parameters(keywords::sne_theta).checked().nonNegative();
+		interpolation = parameters(keywords::sne_interpolation);
 		squishing_rate = parameters(keywords::squishing_rate);
 		global_strategy = parameters(keywords::spe_global_strategy);
 		epsilon = parameters(keywords::fa_epsilon).checked().nonNegative();
@@ -176,6 +177,7 @@ private:
 	Parameter n_updates;
 	Parameter perplexity;
 	Parameter theta;
+	Parameter interpolation;
 	Parameter squishing_rate;
 	Parameter global_strategy;
 	Parameter epsilon;
@@ -489,7 +491,7 @@ private:
 
 		DenseMatrix embedding(static_cast<IndexType>(target_dimension),n_vectors);
 		tsne::TSNE tsne;
-		tsne.run(data.data(),n_vectors,current_dimension,embedding.data(),target_dimension,perplexity,theta);
+		tsne.run(data.data(),n_vectors,current_dimension,embedding.data(),target_dimension,perplexity,theta,interpolation);
 
 		return TapkeeOutput(embedding.transpose(), unimplementedProjectingFunction());
 	}
@@ -177,6 +177,7 @@ CDenseFeatures<float64_t>* shogun::tapkee_embed(const shogun::TAPKEE_PARAMETERS_
 		 tapkee::keywords::fa_epsilon = parameters.fa_epsilon,
 		 tapkee::keywords::sne_perplexity = parameters.sne_perplexity,
 		 tapkee::keywords::sne_theta = parameters.sne_theta,
+		 tapkee::keywords::sne_interpolation = parameters.sne_interpolation,
 		 tapkee::keywords::squishing_rate = parameters.squishing_rate
 		 );
 
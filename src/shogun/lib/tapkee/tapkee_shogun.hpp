@@ -54,7 +54,8 @@ struct TAPKEE_PARAMETERS_FOR_SHOGUN
 		gaussian_kernel_width(1.0), spe_tolerance(1e-5),
 		spe_global_strategy(false), max_iteration(100),
 		fa_epsilon(1e-5), sne_theta(0.5),
-		sne_perplexity(30.0), squishing_rate(0.99),
+		sne_perplexity(30.0), sne_interpolation(false),
+		squishing_rate(0.99),
 		kernel(NULL), distance(NULL), features(NULL)
 	{
 	}
@@ -72,6 +73,7 @@ struct TAPKEE_PARAMETERS_FOR_SHOGUN
 	float64_t fa_epsilon;
 	float64_t sne_theta;
 	float64_t sne_perplexity;
+	bool sne_interpolation;
 	float64_t squishing_rate;
 	CKernel* kernel;
 	CDistance* distance;
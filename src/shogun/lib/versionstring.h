@@ -0,0 +1,11 @@
+#define MAINVERSION "5.1.0"
+
+#define VERSION_EXTRA ""
+#define VERSION_REVISION 0xcefab0e
+#define VERSION_RELEASE "git_cefab0e_2026-10-19_4:58"
+#define VERSION_YEAR 2026
+#define VERSION_MONTH 10
+#define VERSION_DAY 19
+#define VERSION_HOUR 4
+#define VERSION_MINUTE 58
+#define VERSION_PARAMETER 1
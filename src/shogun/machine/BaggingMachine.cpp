@@ -11,6 +11,8 @@
 #include <shogun/machine/BaggingMachine.h>
 #include <shogun/ensemble/CombinationRule.h>
 #include <shogun/evaluation/Evaluation.h>
+#include <shogun/mathematics/RandomStream.h>
+#include <shogun/multiclass/tree/CARTree.h>
 
 using namespace shogun;
 
@@ -128,16 +130,22 @@ bool CBaggingMachine::train_machine(CFeatures* data)
 	SG_UNREF(m_oob_indices);
 	m_oob_indices = new CDynamicObjectArray();
 
-	/*
-	  TODO: enable multi-threaded learning. This requires views support
-		on CFeatures*/
-	#pragma omp parallel for	
+	// every bag draws from its own random stream and is stored in its own
+	// slot, so the result does not depend on the number of threads
+	const uint64_t seed=CMath::random();
+	CMachine** bags=SG_MALLOC(CMachine*, m_num_bags);
+	CDynamicArray<index_t>** oobs=SG_MALLOC(CDynamicArray<index_t>*, m_num_bags);
+
+	#pragma omp parallel for
 	for (int32_t i = 0; i < m_num_bags; ++i)
 	{
 		CMachine* c=dynamic_cast<CMachine*>(m_machine->clone());
 		ASSERT(c != NULL);
+
+		RandomStream rng(seed, i);
 		SGVector<index_t> idx(get_bag_size());
-		idx.random(0, m_features->get_num_vectors()-1);
+		for (index_t j=0; j<idx.vlen; ++j)
+			idx[j]=rng.random(0, m_features->get_num_vectors()-1);
 
 		CFeatures* features;
 		CLabels* labels;
@@ -172,30 +180,34 @@ bool CBaggingMachine::train_machine(CFeatures* data)
 		*/
 		features->add_subset(idx);
 		set_machine_parameters(c,idx);
+		set_machine_random_seed(c,rng.random_64());
 		c->set_labels(labels);
 		c->train(features);
 		features->remove_subset();
 		labels->remove_subset();
 
-		#pragma omp critical
-		{		
 		// get out of bag indexes
-		CDynamicArray<index_t>* oob = get_oob_indices(idx);
-		m_oob_indices->push_back(oob);
-
-		// add trained machine to bag array
-		m_bags->push_back(c);
-		}
+		oobs[i] = get_oob_indices(idx);
+		bags[i] = c;
 
 		if (get_global_parallel()->get_num_threads()!=1)
 		{
 			SG_UNREF(features);
 			SG_UNREF(labels);
 		}
+	}
 
-		SG_UNREF(c);
+	// add trained machines to bag array in bag order
+	for (int32_t i = 0; i < m_num_bags; ++i)
+	{
+		m_oob_indices->push_back(oobs[i]);
+		m_bags->push_back(bags[i]);
+		SG_UNREF(bags[i]);
 	}
 
+	SG_FREE(oobs);
+	SG_FREE(bags);
+
 	return true;
 }
 
@@ -203,6 +215,14 @@ void CBaggingMachine::set_machine_parameters(CMachine* m, SGVector<index_t> idx)
 {
 }
 
+void CBaggingMachine::set_machine_random_seed(CMachine* m, uint64_t seed)
+{
+	// trees would otherwise seed themselves from the global generator
+	CCARTree* tree=dynamic_cast<CCARTree*>(m);
+	if (tree)
+		tree->set_random_seed(seed);
+}
+
 void CBaggingMachine::register_parameters()
 {
 	SG_ADD((CSGObject**)&m_features, "features", "Train features for bagging",
@@ -131,6 +131,16 @@ namespace shogun
 			 */
 			virtual void set_machine_parameters(CMachine* m, SGVector<index_t> idx);
 
+			/**
+			 * seeds the randomness of a bag's machine, called with a seed
+			 * drawn from the bag's own random stream. Seeds CCARTree and
+			 * derived trees, other machines are left unchanged.
+			 *
+			 * @param m machine
+			 * @param seed seed for the machine
+			 */
+			virtual void set_machine_random_seed(CMachine* m, uint64_t seed);
+
 			/** helper function for the apply_{regression,..} functions that
 			 * computes the output
 			 *
@@ -183,8 +183,8 @@ void* CDistanceMachine::run_distance_thread_lhs(void* p)
     int32_t idx_stop=params->idx_stop;
     int32_t idx_c=params->idx_comp;
 
-    for (int32_t i=idx_res_start; idx_act<idx_stop; i++,idx_act++)
-        res[i] =distance->distance(idx_act,idx_c);
+    if (idx_act<idx_stop)
+        distance->distance_block(idx_act, idx_stop-idx_act, idx_c, 1, res+idx_res_start);
 
     return NULL;
 }
@@ -199,8 +199,8 @@ void* CDistanceMachine::run_distance_thread_rhs(void* p)
     int32_t idx_stop=params->idx_stop;
     int32_t idx_c=params->idx_comp;
 
-    for (int32_t i=idx_res_start; idx_act<idx_stop; i++,idx_act++)
-        res[i] =distance->distance(idx_c,idx_act);
+    if (idx_act<idx_stop)
+        distance->distance_block(idx_c, 1, idx_act, idx_stop-idx_act, res+idx_res_start, 1);
 
     return NULL;
 }
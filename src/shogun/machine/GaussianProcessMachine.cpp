@@ -41,6 +41,7 @@
 #include <shogun/mathematics/Math.h>
 #include <shogun/kernel/Kernel.h>
 #include <shogun/machine/gp/SingleFITCInference.h>
+#include <shogun/labels/RegressionLabels.h>
 #include <shogun/mathematics/eigen3.h>
 
 using namespace shogun;
@@ -60,13 +61,41 @@ CGaussianProcessMachine::CGaussianProcessMachine(CInference* method)
 void CGaussianProcessMachine::init()
 {
 	m_method=NULL;
+	m_predictive_kernel=NULL;
+	m_predictive_features=NULL;
+	m_predictive_mean=NULL;
+	m_predictive_scale2=1.0;
+	m_predictive_upper=false;
+	m_prediction_tile_size=1024;
 
 	SG_ADD((CSGObject**) &m_method, "inference_method", "Inference method",
 	    MS_AVAILABLE);
+	SG_ADD(&m_prediction_tile_size, "prediction_tile_size",
+		"Number of testing vectors predicted at once", MS_NOT_AVAILABLE);
+	SG_ADD((CSGObject**) &m_predictive_kernel, "predictive_kernel",
+		"Kernel of the predictive state", MS_NOT_AVAILABLE);
+	SG_ADD((CSGObject**) &m_predictive_features, "predictive_features",
+		"Training features of the predictive state", MS_NOT_AVAILABLE);
+	SG_ADD((CSGObject**) &m_predictive_mean, "predictive_mean",
+		"Mean function of the predictive state", MS_NOT_AVAILABLE);
+	SG_ADD(&m_predictive_scale2, "predictive_scale2",
+		"Squared kernel scale of the predictive state", MS_NOT_AVAILABLE);
+	SG_ADD(&m_predictive_alpha, "predictive_alpha",
+		"Alpha vector of the predictive state", MS_NOT_AVAILABLE);
+	SG_ADD(&m_predictive_L, "predictive_L",
+		"Cholesky factor of the predictive state", MS_NOT_AVAILABLE);
+	SG_ADD(&m_predictive_sW, "predictive_sW",
+		"Diagonal vector of the predictive state", MS_NOT_AVAILABLE);
+	SG_ADD(&m_predictive_residual, "predictive_residual",
+		"Residual of the training labels of the predictive state",
+		MS_NOT_AVAILABLE);
+	SG_ADD(&m_predictive_upper, "predictive_upper",
+		"Whether predictive_L is an upper Cholesky factor", MS_NOT_AVAILABLE);
 }
 
 CGaussianProcessMachine::~CGaussianProcessMachine()
 {
+	clear_predictive_state();
 	SG_UNREF(m_method);
 }
 
@@ -74,6 +103,13 @@ SGVector<float64_t> CGaussianProcessMachine::get_posterior_means(CFeatures* data
 {
 	REQUIRE(m_method, "Inference method should not be NULL\n")
 
+	if (has_predictive_state())
+	{
+		SGVector<float64_t> mu;
+		predict_from_state(data, &mu, NULL);
+		return mu;
+	}
+
 	CFeatures* feat;
 
 	CSingleSparseInference* sparse_method=
@@ -134,6 +170,13 @@ SGVector<float64_t> CGaussianProcessMachine::get_posterior_variances(
 {
 	REQUIRE(m_method, "Inference method should not be NULL\n")
 
+	if (has_predictive_state())
+	{
+		SGVector<float64_t> s2;
+		predict_from_state(data, NULL, &s2);
+		return s2;
+	}
+
 	CFeatures* feat;
 
 	bool is_sparse=false;
@@ -251,3 +294,303 @@ SGVector<float64_t> CGaussianProcessMachine::get_posterior_variances(
 
 	return s2;
 }
+
+void CGaussianProcessMachine::get_posterior_means_and_variances(
+		CFeatures* data, SGVector<float64_t>& means,
+		SGVector<float64_t>& variances)
+{
+	REQUIRE(m_method, "Inference method should not be NULL\n")
+
+	if (has_predictive_state())
+		predict_from_state(data, &means, &variances);
+	else
+	{
+		means=get_posterior_means(data);
+		variances=get_posterior_variances(data);
+	}
+}
+
+void CGaussianProcessMachine::compute_predictive_state()
+{
+	REQUIRE(m_method, "Inference method should not be NULL\n")
+
+	clear_predictive_state();
+
+	bool is_sparse=false;
+	CSingleSparseInference* sparse_method=
+		dynamic_cast<CSingleSparseInference *>(m_method);
+	// use inducing features for sparse inference method
+	if (sparse_method)
+	{
+		sparse_method->optimize_inducing_features();
+		m_predictive_features=sparse_method->get_inducing_features();
+		is_sparse=true;
+	}
+	else
+		m_predictive_features=m_method->get_features();
+
+	// predictions initialize copies of this kernel with the testing
+	// features of every block, so drop the copies of its features made by
+	// clone
+	CKernel* training_kernel=m_method->get_kernel();
+	m_predictive_kernel=CKernel::obtain_from_generic(training_kernel->clone());
+	m_predictive_kernel->remove_lhs_and_rhs();
+	SG_UNREF(training_kernel);
+
+	m_predictive_mean=m_method->get_mean();
+	m_predictive_scale2=CMath::sq(m_method->get_scale());
+
+	// inference methods may update their matrices in place, so keep copies
+	m_predictive_alpha=m_method->get_alpha().clone();
+
+	if (m_predictive_alpha.vlen!=m_predictive_features->get_num_vectors())
+	{
+		clear_predictive_state();
+		SG_ERROR("Predictive state is not supported for multiclass inference\n")
+	}
+
+	// the CG inference method does not factorize the kernel matrix
+	if (m_method->get_inference_type()!=INF_CG)
+	{
+		m_predictive_L=m_method->get_cholesky().clone();
+		Map<MatrixXd> eigen_L(m_predictive_L.matrix, m_predictive_L.num_rows,
+			m_predictive_L.num_cols);
+		m_predictive_upper=eigen_L.isUpperTriangular() && !is_sparse;
+
+		if (m_predictive_upper)
+			m_predictive_sW=m_method->get_diagonal_vector().clone();
+	}
+
+	if (m_method->get_inference_type()==INF_EXACT)
+	{
+		CLabels* labels=m_method->get_labels();
+		m_predictive_residual=((CRegressionLabels*)labels)->get_labels().clone();
+		SG_UNREF(labels);
+
+		SGVector<float64_t> m=m_predictive_mean->get_mean_vector(
+			m_predictive_features);
+		Map<VectorXd> eigen_m(m.vector, m.vlen);
+		Map<VectorXd> eigen_r(m_predictive_residual.vector,
+			m_predictive_residual.vlen);
+		eigen_r-=eigen_m;
+	}
+}
+
+void CGaussianProcessMachine::clear_predictive_state()
+{
+	SG_UNREF(m_predictive_kernel);
+	SG_UNREF(m_predictive_features);
+	SG_UNREF(m_predictive_mean);
+	m_predictive_kernel=NULL;
+	m_predictive_features=NULL;
+	m_predictive_mean=NULL;
+
+	m_predictive_alpha=SGVector<float64_t>();
+	m_predictive_L=SGMatrix<float64_t>();
+	m_predictive_sW=SGVector<float64_t>();
+	m_predictive_residual=SGVector<float64_t>();
+	m_predictive_upper=false;
+}
+
+void CGaussianProcessMachine::append_training_data(CFeatures* features,
+		CLabels* labels)
+{
+	REQUIRE(has_predictive_state(), "Predictive state has to be computed "
+		"before training data can be appended\n")
+	REQUIRE(m_predictive_residual.vector, "Appending training data is only "
+		"supported for CExactInferenceMethod\n")
+	REQUIRE(features, "Features should not be NULL\n")
+	REQUIRE(labels, "Labels should not be NULL\n")
+	REQUIRE(labels->get_label_type()==LT_REGRESSION,
+		"Labels must be type of CRegressionLabels\n")
+	REQUIRE(features->get_num_vectors()==labels->get_num_labels(),
+		"Number of training vectors (%d) must match number of labels (%d)\n",
+		features->get_num_vectors(), labels->get_num_labels())
+
+	SG_REF(features);
+	SG_REF(labels);
+
+	const index_t n=m_predictive_alpha.vlen;
+	const index_t k=features->get_num_vectors();
+
+	// exact inference uses sW=1/sigma
+	const float64_t sigma2=1.0/CMath::sq(m_predictive_sW[0]);
+
+	// kernel blocks of A=K*scale^2/sigma^2+I for the new vectors
+	m_predictive_kernel->init(m_predictive_features, features);
+	SGMatrix<float64_t> k_cross=m_predictive_kernel->get_kernel_matrix();
+	Map<MatrixXd> eigen_A12(k_cross.matrix, n, k);
+	eigen_A12*=m_predictive_scale2/sigma2;
+
+	m_predictive_kernel->init(features, features);
+	SGMatrix<float64_t> k_new=m_predictive_kernel->get_kernel_matrix();
+	Map<MatrixXd> eigen_A22(k_new.matrix, k, k);
+	eigen_A22*=m_predictive_scale2/sigma2;
+	eigen_A22+=MatrixXd::Identity(k, k);
+
+	m_predictive_kernel->remove_lhs_and_rhs();
+
+	// extend the upper factor: U12=U11'\A12, U22=chol(A22-U12'*U12)
+	Map<MatrixXd> eigen_U11(m_predictive_L.matrix, n, n);
+	SGMatrix<float64_t> L(n+k, n+k);
+	Map<MatrixXd> eigen_L(L.matrix, n+k, n+k);
+
+	eigen_L.topLeftCorner(n, n)=eigen_U11;
+	eigen_L.topRightCorner(n, k)=eigen_U11.triangularView<Upper>().adjoint().solve(
+		eigen_A12);
+	eigen_L.bottomLeftCorner(k, n).setZero();
+
+	MatrixXd eigen_S=eigen_A22-eigen_L.topRightCorner(n, k).adjoint()*
+		eigen_L.topRightCorner(n, k);
+	LLT<MatrixXd> llt(eigen_S);
+	if (llt.info()!=Success)
+	{
+		SG_UNREF(features);
+		SG_UNREF(labels);
+		SG_ERROR("Cholesky update failed, the kernel matrix of the merged "
+			"training data is not positive definite\n")
+	}
+	eigen_L.bottomRightCorner(k, k)=llt.matrixU();
+
+	m_predictive_L=L;
+
+	// extend residuals and diagonal vector
+	SGVector<float64_t> y=((CRegressionLabels*)labels)->get_labels();
+	SGVector<float64_t> m=m_predictive_mean->get_mean_vector(features);
+
+	SGVector<float64_t> residual(n+k);
+	Map<VectorXd> eigen_residual(residual.vector, n+k);
+	eigen_residual.head(n)=Map<VectorXd>(m_predictive_residual.vector, n);
+	eigen_residual.tail(k)=Map<VectorXd>(y.vector, k)-Map<VectorXd>(m.vector, k);
+	m_predictive_residual=residual;
+
+	SGVector<float64_t> sW(n+k);
+	sW.set_const(m_predictive_sW[0]);
+	m_predictive_sW=sW;
+
+	// solve (L'*L)*alpha=(y-m)/sigma^2
+	m_predictive_alpha=SGVector<float64_t>(n+k);
+	Map<VectorXd> eigen_alpha(m_predictive_alpha.vector, n+k);
+	eigen_alpha=eigen_L.triangularView<Upper>().adjoint().solve(eigen_residual);
+	eigen_alpha=eigen_L.triangularView<Upper>().solve(eigen_alpha);
+	eigen_alpha/=sigma2;
+
+	// merge the training data, which is also passed to the inference method
+	CFeatures* merged=m_predictive_features->create_merged_copy(features);
+	SG_REF(merged);
+	SG_UNREF(m_predictive_features);
+	m_predictive_features=merged;
+
+	CLabels* old_labels=m_method->get_labels();
+	SGVector<float64_t> old_y=((CRegressionLabels*)old_labels)->get_labels();
+	SG_UNREF(old_labels);
+
+	SGVector<float64_t> merged_y(n+k);
+	memcpy(merged_y.vector, old_y.vector, sizeof(float64_t)*n);
+	memcpy(merged_y.vector+n, y.vector, sizeof(float64_t)*k);
+	CRegressionLabels* merged_labels=new CRegressionLabels(merged_y);
+
+	m_method->set_features(merged);
+	m_method->set_labels(merged_labels);
+	CMachine::set_labels(merged_labels);
+
+	SG_UNREF(features);
+	SG_UNREF(labels);
+}
+
+void CGaussianProcessMachine::predict_from_state(CFeatures* data,
+		SGVector<float64_t>* means, SGVector<float64_t>* variances)
+{
+	REQUIRE(data, "Testing features should not be NULL\n")
+	REQUIRE(!variances || m_predictive_L.matrix, "%s does not provide "
+		"posterior variances\n", m_method->get_name())
+
+	const index_t m=data->get_num_vectors();
+
+	if (means)
+		*means=SGVector<float64_t>(m);
+	if (variances)
+		*variances=SGVector<float64_t>(m);
+
+	SG_REF(data);
+
+	// the kernel is initialized with every block, a copy per call keeps
+	// concurrent predictions on the same machine apart
+	CKernel* kernel=CKernel::obtain_from_generic(m_predictive_kernel->clone());
+
+	if (m<=m_prediction_tile_size)
+	{
+		predict_block_from_state(kernel, data, means ? means->vector : NULL,
+			variances ? variances->vector : NULL);
+	}
+	else
+	{
+		for (index_t start=0; start<m; start+=m_prediction_tile_size)
+		{
+			SGVector<index_t> indices(CMath::min(m_prediction_tile_size,
+				m-start));
+			indices.range_fill(start);
+
+			CFeatures* block=data->copy_subset(indices);
+			predict_block_from_state(kernel, block,
+				means ? means->vector+start : NULL,
+				variances ? variances->vector+start : NULL);
+			SG_UNREF(block);
+		}
+	}
+
+	SG_UNREF(kernel);
+	SG_UNREF(data);
+}
+
+void CGaussianProcessMachine::predict_block_from_state(CKernel* kernel,
+		CFeatures* block, float64_t* means, float64_t* variances)
+{
+	const index_t n=m_predictive_alpha.vlen;
+	const index_t m=block->get_num_vectors();
+
+	// compute kernel matrix: K(feat, data)*scale^2
+	kernel->init(m_predictive_features, block);
+	SGMatrix<float64_t> k_trts=kernel->get_kernel_matrix();
+	Map<MatrixXd> eigen_Ks(k_trts.matrix, n, m);
+	eigen_Ks*=m_predictive_scale2;
+
+	if (means)
+	{
+		SGVector<float64_t> mean=m_predictive_mean->get_mean_vector(block);
+		Map<VectorXd> eigen_mean(mean.vector, mean.vlen);
+		Map<VectorXd> eigen_alpha(m_predictive_alpha.vector, n);
+		Map<VectorXd> eigen_mu(means, m);
+
+		// compute mean: mu=Ks'*alpha+m
+		eigen_mu=eigen_Ks.adjoint()*eigen_alpha+eigen_mean;
+	}
+
+	if (variances)
+	{
+		Map<MatrixXd> eigen_L(m_predictive_L.matrix, m_predictive_L.num_rows,
+			m_predictive_L.num_cols);
+		Map<VectorXd> eigen_s2(variances, m);
+
+		if (m_predictive_upper)
+		{
+			// solve L' * V = sW * Ks and compute V.^2
+			Map<VectorXd> eigen_sW(m_predictive_sW.vector, n);
+			MatrixXd eigen_V=eigen_L.triangularView<Upper>().adjoint().solve(
+				eigen_sW.asDiagonal()*eigen_Ks);
+
+			eigen_s2=-eigen_V.cwiseProduct(eigen_V).colwise().sum().adjoint();
+		}
+		else
+		{
+			// M = Ks .* (L * Ks)
+			MatrixXd eigen_M=eigen_Ks.cwiseProduct(eigen_L*eigen_Ks);
+			eigen_s2=eigen_M.colwise().sum().adjoint();
+		}
+
+		// add Kss=diag(K(data, data))*scale^2
+		kernel->init(block, block);
+		for (index_t i=0; i<m; ++i)
+			eigen_s2[i]+=m_predictive_scale2*kernel->kernel(i, i);
+	}
+}
@@ -97,6 +97,62 @@ public:
 	 */
 	SGVector<float64_t> get_posterior_variances(CFeatures* data);
 
+	/** computes posterior means and variances together, which evaluates
+	 * the kernel between training and testing features only once
+	 *
+	 * @param data testing features
+	 * @param means posterior means (output)
+	 * @param variances posterior variances (output)
+	 */
+	void get_posterior_means_and_variances(CFeatures* data,
+		SGVector<float64_t>& means, SGVector<float64_t>& variances);
+
+	/** Computes and keeps everything predictions need: a copy of the kernel,
+	 * the training features, alpha, the Cholesky factor and the diagonal
+	 * vector of the inference method. Until clear_predictive_state() is
+	 * called, all predictions use this state instead of querying the
+	 * inference method, and the testing features are processed in blocks of
+	 * get_prediction_tile_size() vectors.
+	 *
+	 * The state is cleared on training and when the inference method or the
+	 * labels are replaced. It has to be recomputed by hand if the inference
+	 * method is modified directly. Multiclass inference is not supported.
+	 */
+	void compute_predictive_state();
+
+	/** releases the state computed by compute_predictive_state() */
+	void clear_predictive_state();
+
+	/** @return whether predictions use a stored predictive state */
+	bool has_predictive_state() const { return m_predictive_kernel!=NULL; }
+
+	/** appends training data to the stored predictive state without a full
+	 * refit. The Cholesky factor is extended by a rank-k block update in
+	 * \f$O(n^2k)\f$ and alpha is recomputed in \f$O(n^2)\f$, while the
+	 * hyperparameters are kept. The merged data is also passed to the
+	 * inference method, so that the next training refits on all of it.
+	 *
+	 * Only supported for CExactInferenceMethod with dense features.
+	 *
+	 * @param features features of the new training vectors
+	 * @param labels regression labels of the new training vectors
+	 */
+	void append_training_data(CFeatures* features, CLabels* labels);
+
+	/** set the number of testing vectors that are predicted at once with
+	 * the stored predictive state
+	 *
+	 * @param tile_size number of vectors per block
+	 */
+	void set_prediction_tile_size(index_t tile_size)
+	{
+		REQUIRE(tile_size>0, "Tile size (%d) has to be positive\n", tile_size)
+		m_prediction_tile_size=tile_size;
+	}
+
+	/** @return number of testing vectors that are predicted at once */
+	index_t get_prediction_tile_size() const { return m_prediction_tile_size; }
+
 	/** get inference method
 	 *
 	 * @return inference method, which is used by Gaussian process machine
@@ -113,6 +169,7 @@ public:
 	 */
 	void set_inference_method(CInference* method)
 	{
+		clear_predictive_state();
 		SG_REF(method);
 		SG_UNREF(m_method);
 		m_method=method;
@@ -124,6 +181,7 @@ public:
 	 */
 	virtual void set_labels(CLabels* lab)
 	{
+		clear_predictive_state();
 		CMachine::set_labels(lab);
 		m_method->set_labels(lab);
 	}
@@ -138,9 +196,68 @@ public:
 private:
 	void init();
 
+	/** predicts the testing features block wise with the stored predictive
+	 * state
+	 *
+	 * @param data testing features
+	 * @param means posterior means (output), not computed if NULL
+	 * @param variances posterior variances (output), not computed if NULL
+	 */
+	void predict_from_state(CFeatures* data, SGVector<float64_t>* means,
+		SGVector<float64_t>* variances);
+
+	/** predicts one block of testing features with the stored predictive
+	 * state
+	 *
+	 * @param kernel copy of the predictive kernel owned by the caller
+	 * @param block testing features
+	 * @param means destination of the posterior means or NULL
+	 * @param variances destination of the posterior variances or NULL
+	 */
+	void predict_block_from_state(CKernel* kernel, CFeatures* block,
+		float64_t* means, float64_t* variances);
+
 protected:
 	/** inference method */
 	CInference* m_method;
+
+	/** copy of the training kernel without features, every prediction
+	 * works on its own clone
+	 */
+	CKernel* m_predictive_kernel;
+
+	/** training (or inducing) features of the predictive state */
+	CFeatures* m_predictive_features;
+
+	/** mean function of the predictive state */
+	CMeanFunction* m_predictive_mean;
+
+	/** squared kernel scale of the predictive state */
+	float64_t m_predictive_scale2;
+
+	/** alpha vector of the predictive state */
+	SGVector<float64_t> m_predictive_alpha;
+
+	/** Cholesky factor of the predictive state, empty if the inference
+	 * method provides no variances
+	 */
+	SGMatrix<float64_t> m_predictive_L;
+
+	/** diagonal vector of the predictive state */
+	SGVector<float64_t> m_predictive_sW;
+
+	/** labels minus prior mean of the training vectors, only kept for exact
+	 * inference to allow appending training data
+	 */
+	SGVector<float64_t> m_predictive_residual;
+
+	/** whether m_predictive_L is the upper Cholesky factor of
+	 * \f$sW*K*sW+I\f$ (otherwise it is used as in \f$K+K_s^TLK_s\f$)
+	 */
+	bool m_predictive_upper;
+
+	/** number of testing vectors predicted at once */
+	index_t m_prediction_tile_size;
 };
 }
 #endif /* _GAUSSIANPROCESSMACHINE_H_ */
@@ -413,9 +413,25 @@ float64_t CKernelMachine::apply_one(int32_t num)
 	}
 	else
 	{
+		REQUIRE(num>=0 && num<kernel->get_num_vec_rhs(),
+			"%s::apply_one(): index out of Range: %d/%d\n", get_name(), num,
+			kernel->get_num_vec_rhs());
+
 		float64_t score=0;
-		for(int32_t i=0; i<get_num_support_vectors(); i++)
-			score+=kernel->kernel(get_support_vector(i), num)*get_alpha(i);
+		float64_t values[KERNEL_BLOCK_SIZE];
+		int32_t idx_rhs[KERNEL_BLOCK_SIZE];
+		for (int32_t i=0; i<KERNEL_BLOCK_SIZE; i++)
+			idx_rhs[i]=num;
+
+		int32_t num_sv=get_num_support_vectors();
+		for (int32_t offs=0; offs<num_sv; offs+=KERNEL_BLOCK_SIZE)
+		{
+			int32_t len=CMath::min(KERNEL_BLOCK_SIZE, num_sv-offs);
+			kernel->kernel_block(m_svs.vector+offs, idx_rhs, len, values);
+
+			for (int32_t i=0; i<len; i++)
+				score+=values[i]*m_alpha[offs+i];
+		}
 
 		return score+get_bias();
 	}
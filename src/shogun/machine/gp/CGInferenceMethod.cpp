@@ -0,0 +1,719 @@
+/*
+ * Copyright (c) The Shogun Machine Learning Toolbox
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of the Shogun Development Team.
+ *
+ */
+#include <shogun/machine/gp/CGInferenceMethod.h>
+
+#include <shogun/machine/gp/GaussianLikelihood.h>
+#include <shogun/labels/RegressionLabels.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/eigen3.h>
+#include <shogun/mathematics/linalg/linop/KernelMatrixOperator.h>
+#include <shogun/mathematics/linalg/eigsolver/LanczosEigenSolver.h>
+#include <shogun/mathematics/linalg/linsolver/CGMShiftedFamilySolver.h>
+#include <shogun/mathematics/linalg/ratapprox/logdet/LogDetEstimator.h>
+#include <shogun/mathematics/linalg/ratapprox/logdet/opfunc/LogRationalApproximationCGM.h>
+#include <shogun/mathematics/linalg/ratapprox/tracesampler/NormalSampler.h>
+#include <shogun/lib/computation/engine/SerialComputationEngine.h>
+
+using namespace shogun;
+using namespace Eigen;
+
+/* applies the inverse of the preconditioner P=F*F'+sigma^2*I to all columns
+ * of r, using the Woodbury identity with the upper triangular Cholesky factor
+ * C of sigma^2*I+F'*F
+ */
+static void apply_preconditioner(const Map<MatrixXd>& F, const Map<MatrixXd>& C,
+		float64_t sigma2, const MatrixXd& r, MatrixXd& z)
+{
+	if (F.cols()>0)
+	{
+		MatrixXd t=F.transpose()*r;
+		t=C.triangularView<Upper>().adjoint().solve(t);
+		t=C.triangularView<Upper>().solve(t);
+		z=(r-F*t)/sigma2;
+	}
+	else
+		z=r/sigma2;
+}
+
+CCGInferenceMethod::CCGInferenceMethod() : CInference()
+{
+	init();
+}
+
+CCGInferenceMethod::CCGInferenceMethod(CKernel* kern, CFeatures* feat,
+		CMeanFunction* m, CLabels* lab, CLikelihoodModel* mod) :
+		CInference(kern, feat, m, lab, mod)
+{
+	init();
+}
+
+void CCGInferenceMethod::init()
+{
+	m_max_iterations=1000;
+	m_tolerance=1E-8;
+	m_num_probes=16;
+	m_num_log_det_estimates=8;
+	m_log_det_accuracy=1E-5;
+	m_preconditioner_rank=32;
+	m_tile_size=512;
+	m_log_det=CMath::NOT_A_NUMBER;
+	m_lock=new CLock();
+
+	SG_ADD(&m_max_iterations, "max_iterations",
+		"Maximum number of CG iterations", MS_NOT_AVAILABLE);
+	SG_ADD(&m_tolerance, "tolerance",
+		"Relative residual norm at which CG stops", MS_NOT_AVAILABLE);
+	SG_ADD(&m_num_probes, "num_probes",
+		"Number of probe vectors for the trace estimates", MS_NOT_AVAILABLE);
+	SG_ADD(&m_num_log_det_estimates, "num_log_det_estimates",
+		"Number of averaged log-determinant estimates", MS_NOT_AVAILABLE);
+	SG_ADD(&m_log_det_accuracy, "log_det_accuracy",
+		"Accuracy of the log-determinant approximation", MS_NOT_AVAILABLE);
+	SG_ADD(&m_preconditioner_rank, "preconditioner_rank",
+		"Rank of the pivoted Cholesky preconditioner", MS_NOT_AVAILABLE);
+	SG_ADD(&m_tile_size, "tile_size",
+		"Number of rows and columns of a kernel tile", MS_NOT_AVAILABLE);
+}
+
+CCGInferenceMethod::~CCGInferenceMethod()
+{
+	delete m_lock;
+}
+
+void CCGInferenceMethod::set_max_iterations(index_t max_iterations)
+{
+	REQUIRE(max_iterations>0, "Maximum number of iterations (%d) has to be "
+		"positive\n", max_iterations)
+	m_max_iterations=max_iterations;
+}
+
+void CCGInferenceMethod::set_tolerance(float64_t tolerance)
+{
+	REQUIRE(tolerance>0, "Tolerance (%f) has to be positive\n", tolerance)
+	m_tolerance=tolerance;
+}
+
+void CCGInferenceMethod::set_num_probes(index_t num_probes)
+{
+	REQUIRE(num_probes>0, "Number of probes (%d) has to be positive\n",
+		num_probes)
+	m_num_probes=num_probes;
+}
+
+void CCGInferenceMethod::set_num_log_det_estimates(index_t num_estimates)
+{
+	REQUIRE(num_estimates>0, "Number of log-determinant estimates (%d) has to "
+		"be positive\n", num_estimates)
+	m_num_log_det_estimates=num_estimates;
+}
+
+void CCGInferenceMethod::set_log_det_accuracy(float64_t accuracy)
+{
+	REQUIRE(accuracy>0, "Accuracy (%f) has to be positive\n", accuracy)
+	m_log_det_accuracy=accuracy;
+}
+
+void CCGInferenceMethod::set_preconditioner_rank(index_t rank)
+{
+	REQUIRE(rank>=0, "Rank of the preconditioner (%d) must not be negative\n",
+		rank)
+	m_preconditioner_rank=rank;
+}
+
+void CCGInferenceMethod::set_tile_size(index_t tile_size)
+{
+	REQUIRE(tile_size>0, "Tile size (%d) has to be positive\n", tile_size)
+	m_tile_size=tile_size;
+}
+
+void CCGInferenceMethod::register_minimizer(Minimizer* minimizer)
+{
+	SG_WARNING("The method does not require a minimizer. The provided minimizer will not be used.\n");
+}
+
+void CCGInferenceMethod::compute_gradient()
+{
+	CInference::compute_gradient();
+
+	if (!m_gradient_update)
+	{
+		update_deriv();
+		m_gradient_update=true;
+		update_parameter_hash();
+	}
+}
+
+void CCGInferenceMethod::update()
+{
+	SG_DEBUG("entering\n");
+
+	CInference::update();
+	update_chol();
+	update_alpha();
+	m_log_det=CMath::NOT_A_NUMBER;
+	m_gradient_update=false;
+	update_parameter_hash();
+
+	SG_DEBUG("leaving\n");
+}
+
+void CCGInferenceMethod::check_members() const
+{
+	CInference::check_members();
+
+	REQUIRE(m_model->get_model_type()==LT_GAUSSIAN,
+		"CG inference method can only use Gaussian likelihood function\n")
+	REQUIRE(m_labels->get_label_type()==LT_REGRESSION,
+		"Labels must be type of CRegressionLabels\n")
+}
+
+void CCGInferenceMethod::update_train_kernel()
+{
+	// the kernel matrix is never computed, kernel values are evaluated in
+	// tiles by CKernelMatrixOperator
+	m_kernel->init(m_features, m_features);
+}
+
+SGVector<float64_t> CCGInferenceMethod::get_diagonal_vector()
+{
+	if (parameter_hash_changed())
+		update();
+
+	// get the sigma variable from the Gaussian likelihood model
+	CGaussianLikelihood* lik=CGaussianLikelihood::obtain_from_generic(m_model);
+	float64_t sigma=lik->get_sigma();
+	SG_UNREF(lik);
+
+	// compute diagonal vector: sW=1/sigma
+	SGVector<float64_t> result(m_features->get_num_vectors());
+	result.fill_vector(result.vector, m_features->get_num_vectors(), 1.0/sigma);
+
+	return result;
+}
+
+float64_t CCGInferenceMethod::get_negative_log_marginal_likelihood()
+{
+	if (parameter_hash_changed())
+		update();
+
+	// the estimate is kept until the hyperparameters change
+	if (CMath::is_nan(m_log_det))
+		m_log_det=compute_log_det();
+
+	Map<VectorXd> eigen_alpha(m_alpha.vector, m_alpha.vlen);
+
+	// get labels and mean vectors and create eigen representation
+	SGVector<float64_t> y=((CRegressionLabels*) m_labels)->get_labels();
+	Map<VectorXd> eigen_y(y.vector, y.vlen);
+	SGVector<float64_t> m=m_mean->get_mean_vector(m_features);
+	Map<VectorXd> eigen_m(m.vector, m.vlen);
+
+	// compute negative log of the marginal likelihood:
+	// nlZ=(y-m)'*alpha/2+log(det(K))/2+n*log(2*pi)/2
+	float64_t result=(eigen_y-eigen_m).dot(eigen_alpha)/2.0+m_log_det/2.0+
+		m_alpha.vlen*CMath::log(2*CMath::PI)/2.0;
+
+	return result;
+}
+
+SGVector<float64_t> CCGInferenceMethod::get_alpha()
+{
+	if (parameter_hash_changed())
+		update();
+
+	return SGVector<float64_t>(m_alpha);
+}
+
+SGMatrix<float64_t> CCGInferenceMethod::get_cholesky()
+{
+	SG_ERROR("%s does not factorize the kernel matrix, use "
+		"CExactInferenceMethod to compute posterior variances\n", get_name())
+
+	return SGMatrix<float64_t>();
+}
+
+SGVector<float64_t> CCGInferenceMethod::get_posterior_mean()
+{
+	if (parameter_hash_changed())
+		update();
+
+	// get the sigma variable from the Gaussian likelihood model
+	CGaussianLikelihood* lik=CGaussianLikelihood::obtain_from_generic(m_model);
+	float64_t sigma=lik->get_sigma();
+	SG_UNREF(lik);
+
+	SGVector<float64_t> y=((CRegressionLabels*) m_labels)->get_labels();
+	Map<VectorXd> eigen_y(y.vector, y.vlen);
+	SGVector<float64_t> m=m_mean->get_mean_vector(m_features);
+	Map<VectorXd> eigen_m(m.vector, m.vlen);
+	Map<VectorXd> eigen_alpha(m_alpha.vector, m_alpha.vlen);
+
+	SGVector<float64_t> mu(m.vlen);
+	Map<VectorXd> eigen_mu(mu.vector, mu.vlen);
+
+	// since (K*scale^2+sigma^2*I)*alpha=y-m, the posterior mean
+	// mu=K*scale^2*alpha does not need another kernel product
+	eigen_mu=eigen_y-eigen_m-CMath::sq(sigma)*eigen_alpha;
+
+	return mu;
+}
+
+SGMatrix<float64_t> CCGInferenceMethod::get_posterior_covariance()
+{
+	SG_ERROR("%s does not factorize the kernel matrix, use "
+		"CExactInferenceMethod to compute the posterior covariance\n",
+		get_name())
+
+	return SGMatrix<float64_t>();
+}
+
+SGMatrix<float64_t> CCGInferenceMethod::solve_kernel_system(
+		SGMatrix<float64_t> b)
+{
+	// get the sigma variable from the Gaussian likelihood model
+	CGaussianLikelihood* lik=CGaussianLikelihood::obtain_from_generic(m_model);
+	float64_t sigma=lik->get_sigma();
+	SG_UNREF(lik);
+
+	CKernelMatrixOperator* op=new CKernelMatrixOperator(m_kernel,
+		CMath::exp(m_log_scale*2.0), CMath::sq(sigma), m_tile_size);
+	SG_REF(op);
+
+	const index_t n=b.num_rows;
+	const index_t k=b.num_cols;
+
+	Map<MatrixXd> eigen_b(b.matrix, n, k);
+	Map<MatrixXd> F(m_precond_factor.matrix, m_precond_factor.num_rows,
+		m_precond_factor.num_cols);
+	Map<MatrixXd> C(m_precond_chol.matrix, m_precond_chol.num_rows,
+		m_precond_chol.num_cols);
+
+	SGMatrix<float64_t> x(n, k);
+	Map<MatrixXd> eigen_x(x.matrix, n, k);
+	eigen_x.setZero();
+
+	// residuals, preconditioned residuals and search directions of all
+	// right hand sides
+	MatrixXd r=eigen_b;
+	MatrixXd z;
+	apply_preconditioner(F, C, CMath::sq(sigma), r, z);
+	MatrixXd p=z;
+	VectorXd rz=r.cwiseProduct(z).colwise().sum().transpose();
+	VectorXd b_norm=eigen_b.colwise().norm().transpose();
+
+	// columns which did not converge yet, only those are multiplied with
+	// the kernel matrix
+	SGVector<index_t> active(k);
+	index_t num_active=0;
+	for (index_t c=0; c<k; ++c)
+	{
+		if (b_norm[c]>0)
+			active[num_active++]=c;
+	}
+
+	index_t iter=0;
+	for (; iter<m_max_iterations && num_active>0; ++iter)
+	{
+		SGMatrix<float64_t> p_active(n, num_active);
+		Map<MatrixXd> eigen_p_active(p_active.matrix, n, num_active);
+		for (index_t a=0; a<num_active; ++a)
+			eigen_p_active.col(a)=p.col(active[a]);
+
+		SGMatrix<float64_t> ap=op->apply(p_active);
+		Map<MatrixXd> eigen_ap(ap.matrix, n, num_active);
+
+		index_t num_remaining=0;
+		for (index_t a=0; a<num_active; ++a)
+		{
+			const index_t c=active[a];
+			const float64_t step=rz[c]/eigen_p_active.col(a).dot(eigen_ap.col(a));
+
+			eigen_x.col(c)+=step*p.col(c);
+			r.col(c)-=step*eigen_ap.col(a);
+
+			if (r.col(c).norm()>m_tolerance*b_norm[c])
+				active[num_remaining++]=c;
+		}
+		num_active=num_remaining;
+
+		if (!num_active)
+			break;
+
+		MatrixXd r_active(n, num_active);
+		for (index_t a=0; a<num_active; ++a)
+			r_active.col(a)=r.col(active[a]);
+
+		MatrixXd z_active;
+		apply_preconditioner(F, C, CMath::sq(sigma), r_active, z_active);
+
+		for (index_t a=0; a<num_active; ++a)
+		{
+			const index_t c=active[a];
+			const float64_t rz_new=r_active.col(a).dot(z_active.col(a));
+
+			p.col(c)=z_active.col(a)+(rz_new/rz[c])*p.col(c);
+			rz[c]=rz_new;
+		}
+	}
+
+	if (num_active>0)
+	{
+		SG_WARNING("CG did not converge for %d of %d right hand sides within "
+			"%d iterations\n", num_active, k, m_max_iterations);
+	}
+	else
+		SG_DEBUG("CG converged after %d iterations\n", iter+1);
+
+	SG_UNREF(op);
+
+	return x;
+}
+
+float64_t CCGInferenceMethod::compute_log_det()
+{
+#ifdef HAVE_LAPACK
+	// get the sigma variable from the Gaussian likelihood model
+	CGaussianLikelihood* lik=CGaussianLikelihood::obtain_from_generic(m_model);
+	float64_t sigma=lik->get_sigma();
+	SG_UNREF(lik);
+
+	CKernelMatrixOperator* op=new CKernelMatrixOperator(m_kernel,
+		CMath::exp(m_log_scale*2.0), CMath::sq(sigma), m_tile_size);
+	SG_REF(op);
+
+	CSerialComputationEngine* engine=new CSerialComputationEngine();
+	SG_REF(engine);
+
+	CLanczosEigenSolver* eig_solver=new CLanczosEigenSolver(op);
+	SG_REF(eig_solver);
+
+	CCGMShiftedFamilySolver* linear_solver=new CCGMShiftedFamilySolver();
+	SG_REF(linear_solver);
+
+	CLogRationalApproximationCGM* op_func=new CLogRationalApproximationCGM(op,
+		engine, eig_solver, linear_solver, m_log_det_accuracy);
+	SG_REF(op_func);
+
+	CNormalSampler* trace_sampler=new CNormalSampler(op->get_dimension());
+	SG_REF(trace_sampler);
+
+	CLogDetEstimator estimator(trace_sampler, op_func, engine);
+	SGVector<float64_t> estimates=estimator.sample(m_num_log_det_estimates);
+
+	float64_t result=0.0;
+	for (index_t i=0; i<estimates.vlen; ++i)
+		result+=estimates[i];
+	result/=estimates.vlen;
+
+	SG_UNREF(trace_sampler);
+	SG_UNREF(op_func);
+	SG_UNREF(linear_solver);
+	SG_UNREF(eig_solver);
+	SG_UNREF(engine);
+	SG_UNREF(op);
+
+	return result;
+#else
+	SG_ERROR("%s needs LAPACK to estimate the log-determinant\n", get_name())
+	return 0.0;
+#endif /* HAVE_LAPACK */
+}
+
+void CCGInferenceMethod::update_chol()
+{
+	// get the sigma variable from the Gaussian likelihood model
+	CGaussianLikelihood* lik=CGaussianLikelihood::obtain_from_generic(m_model);
+	float64_t sigma=lik->get_sigma();
+	SG_UNREF(lik);
+
+	CKernelMatrixOperator* op=new CKernelMatrixOperator(m_kernel,
+		CMath::exp(m_log_scale*2.0), 0.0, m_tile_size);
+	SG_REF(op);
+
+	const index_t n=op->get_dimension();
+	const index_t max_rank=CMath::min(m_preconditioner_rank, n);
+
+	// greedy pivoted Cholesky of K*scale^2, which only needs the diagonal and
+	// one kernel column per step
+	SGVector<float64_t> d=op->get_diagonal();
+	Map<VectorXd> eigen_d(d.vector, d.vlen);
+	const float64_t trace=eigen_d.sum();
+
+	MatrixXd factor(n, max_rank);
+	index_t rank=0;
+
+	for (; rank<max_rank; ++rank)
+	{
+		VectorXd::Index pivot;
+		const float64_t max_d=eigen_d.maxCoeff(&pivot);
+
+		// stop if the approximation is already good enough
+		if (max_d<=1E-10*trace)
+			break;
+
+		SGVector<float64_t> col=op->get_kernel_column(pivot);
+		Map<VectorXd> eigen_col(col.vector, col.vlen);
+
+		factor.col(rank)=(eigen_col-factor.leftCols(rank)*
+			factor.row(pivot).head(rank).transpose())/CMath::sqrt(max_d);
+
+		eigen_d-=factor.col(rank).cwiseAbs2();
+		eigen_d[pivot]=0.0;
+	}
+
+	SG_UNREF(op);
+
+	m_precond_factor=SGMatrix<float64_t>(n, rank);
+	Map<MatrixXd> F(m_precond_factor.matrix, n, rank);
+	F=factor.leftCols(rank);
+
+	m_precond_chol=SGMatrix<float64_t>(rank, rank);
+	Map<MatrixXd> C(m_precond_chol.matrix, rank, rank);
+	LLT<MatrixXd> llt(F.transpose()*F+CMath::sq(sigma)*
+		MatrixXd::Identity(rank, rank));
+	C=llt.matrixU();
+}
+
+void CCGInferenceMethod::update_alpha()
+{
+	// get labels and mean vector and create eigen representation
+	SGVector<float64_t> y=((CRegressionLabels*) m_labels)->get_labels();
+	Map<VectorXd> eigen_y(y.vector, y.vlen);
+	SGVector<float64_t> m=m_mean->get_mean_vector(m_features);
+	Map<VectorXd> eigen_m(m.vector, m.vlen);
+
+	SGMatrix<float64_t> b(y.vlen, 1);
+	Map<VectorXd> eigen_b(b.matrix, y.vlen);
+	eigen_b=eigen_y-eigen_m;
+
+	// solve (K*scale^2+sigma^2*I)*alpha=y-m
+	SGMatrix<float64_t> x=solve_kernel_system(b);
+
+	m_alpha=SGVector<float64_t>(y.vlen);
+	memcpy(m_alpha.vector, x.matrix, sizeof(float64_t)*y.vlen);
+}
+
+void CCGInferenceMethod::update_deriv()
+{
+	const index_t n=m_features->get_num_vectors();
+
+	// Rademacher probe vectors for the trace estimates
+	m_probes=SGMatrix<float64_t>(n, m_num_probes);
+	for (index_t i=0; i<m_probes.num_rows*m_probes.num_cols; ++i)
+		m_probes.matrix[i]=CMath::random(0, 1) ? 1.0 : -1.0;
+
+	m_probe_solutions=solve_kernel_system(m_probes);
+}
+
+SGVector<float64_t> CCGInferenceMethod::get_derivative_wrt_inference_method(
+		const TParameter* param)
+{
+	REQUIRE(!strcmp(param->m_name, "log_scale"), "Can't compute derivative of "
+			"the nagative log marginal likelihood wrt %s.%s parameter\n",
+			get_name(), param->m_name)
+
+	// get the sigma variable from the Gaussian likelihood model
+	CGaussianLikelihood* lik=CGaussianLikelihood::obtain_from_generic(m_model);
+	float64_t sigma=lik->get_sigma();
+	SG_UNREF(lik);
+
+	SGVector<float64_t> y=((CRegressionLabels*) m_labels)->get_labels();
+	Map<VectorXd> eigen_y(y.vector, y.vlen);
+	SGVector<float64_t> m=m_mean->get_mean_vector(m_features);
+	Map<VectorXd> eigen_m(m.vector, m.vlen);
+	Map<VectorXd> eigen_alpha(m_alpha.vector, m_alpha.vlen);
+	Map<MatrixXd> eigen_Z(m_probes.matrix, m_probes.num_rows,
+		m_probes.num_cols);
+	Map<MatrixXd> eigen_U(m_probe_solutions.matrix,
+		m_probe_solutions.num_rows, m_probe_solutions.num_cols);
+
+	// stochastic estimate of trace(inv(K*scale^2+sigma^2*I))
+	float64_t trace_inv=eigen_Z.cwiseProduct(eigen_U).sum()/eigen_Z.cols();
+
+	SGVector<float64_t> result(1);
+
+	// compute derivative wrt kernel scale, using K*scale^2=Khat-sigma^2*I:
+	// dnlZ=n-sigma^2*trace(inv(Khat))-alpha'*(y-m)+sigma^2*alpha'*alpha
+	result[0]=m_alpha.vlen-CMath::sq(sigma)*trace_inv-
+		eigen_alpha.dot(eigen_y-eigen_m)+
+		CMath::sq(sigma)*eigen_alpha.squaredNorm();
+
+	return result;
+}
+
+CCGInferenceMethod* CCGInferenceMethod::obtain_from_generic(
+		CInference* inference)
+{
+	if (inference==NULL)
+		return NULL;
+
+	if (inference->get_inference_type()!=INF_CG)
+		SG_SERROR("Provided inference is not of type CCGInferenceMethod!\n")
+
+	SG_REF(inference);
+	return (CCGInferenceMethod*)inference;
+}
+
+SGVector<float64_t> CCGInferenceMethod::get_derivative_wrt_likelihood_model(
+		const TParameter* param)
+{
+	REQUIRE(!strcmp(param->m_name, "log_sigma"), "Can't compute derivative of "
+			"the nagative log marginal likelihood wrt %s.%s parameter\n",
+			m_model->get_name(), param->m_name)
+
+	// get the sigma variable from the Gaussian likelihood model
+	CGaussianLikelihood* lik=CGaussianLikelihood::obtain_from_generic(m_model);
+	float64_t sigma=lik->get_sigma();
+	SG_UNREF(lik);
+
+	Map<VectorXd> eigen_alpha(m_alpha.vector, m_alpha.vlen);
+	Map<MatrixXd> eigen_Z(m_probes.matrix, m_probes.num_rows,
+		m_probes.num_cols);
+	Map<MatrixXd> eigen_U(m_probe_solutions.matrix,
+		m_probe_solutions.num_rows, m_probe_solutions.num_cols);
+
+	float64_t trace_inv=eigen_Z.cwiseProduct(eigen_U).sum()/eigen_Z.cols();
+
+	SGVector<float64_t> result(1);
+
+	// compute derivative wrt likelihood model parameter sigma:
+	// dnlZ=sigma^2*(trace(inv(Khat))-alpha'*alpha)
+	result[0]=CMath::sq(sigma)*(trace_inv-eigen_alpha.squaredNorm());
+
+	return result;
+}
+
+SGVector<float64_t> CCGInferenceMethod::get_derivative_wrt_kernel(
+		const TParameter* param)
+{
+	REQUIRE(param, "Param not set\n");
+	SGVector<float64_t> result;
+	int64_t len=const_cast<TParameter *>(param)->m_datatype.get_num_elements();
+	result=SGVector<float64_t>(len);
+	result.zero();
+
+	const index_t n=m_features->get_num_vectors();
+	const index_t num_probes=m_probes.num_cols;
+
+	// sum(Q.*dK) with Q=inv(Khat)-alpha*alpha' is estimated as
+	// sum(W.*(dK*V)) with W=[U/S, -alpha] and V=[Z, alpha]
+	MatrixXd W(n, num_probes+1);
+	MatrixXd V(n, num_probes+1);
+	W.leftCols(num_probes)=Map<MatrixXd>(m_probe_solutions.matrix, n,
+		num_probes)/num_probes;
+	W.col(num_probes)=-Map<VectorXd>(m_alpha.vector, n);
+	V.leftCols(num_probes)=Map<MatrixXd>(m_probes.matrix, n, num_probes);
+	V.col(num_probes)=Map<VectorXd>(m_alpha.vector, n);
+
+	const index_t num_tiles=(n+m_tile_size-1)/m_tile_size;
+	CFeatures** tiles=SG_MALLOC(CFeatures*, num_tiles);
+	for (index_t t=0; t<num_tiles; ++t)
+	{
+		const index_t start=t*m_tile_size;
+		SGVector<index_t> indices(CMath::min(m_tile_size, n-start));
+		indices.range_fill(start);
+		tiles[t]=m_features->copy_subset(indices);
+	}
+
+	// the derivative of the kernel matrix is only computed for one tile at
+	// a time. Derivatives wrt different parameters are computed in parallel,
+	// so the kernel is locked until it is initialized on all features again
+	m_lock->lock();
+	for (index_t r=0; r<num_tiles; ++r)
+	{
+		const index_t row_start=r*m_tile_size;
+		const index_t num_rows=CMath::min(m_tile_size, n-row_start);
+
+		for (index_t c=0; c<num_tiles; ++c)
+		{
+			const index_t col_start=c*m_tile_size;
+			const index_t num_cols=CMath::min(m_tile_size, n-col_start);
+
+			m_kernel->init(tiles[r], tiles[c]);
+
+			for (index_t i=0; i<result.vlen; i++)
+			{
+				SGMatrix<float64_t> dK;
+
+				if (result.vlen==1)
+					dK=m_kernel->get_parameter_gradient(param);
+				else
+					dK=m_kernel->get_parameter_gradient(param, i);
+
+				Map<MatrixXd> eigen_dK(dK.matrix, dK.num_rows, dK.num_cols);
+
+				result[i]+=W.middleRows(row_start, num_rows).cwiseProduct(
+					eigen_dK*V.middleRows(col_start, num_cols)).sum();
+			}
+		}
+	}
+
+	update_train_kernel();
+	m_lock->unlock();
+
+	for (index_t t=0; t<num_tiles; ++t)
+		SG_UNREF(tiles[t]);
+	SG_FREE(tiles);
+
+	// compute derivative wrt kernel parameter: dnlZ=sum(Q.*dK*scale)/2.0
+	for (index_t i=0; i<result.vlen; i++)
+		result[i]*=CMath::exp(m_log_scale*2.0)/2.0;
+
+	return result;
+}
+
+SGVector<float64_t> CCGInferenceMethod::get_derivative_wrt_mean(
+		const TParameter* param)
+{
+	// create eigen representation of alpha vector
+	Map<VectorXd> eigen_alpha(m_alpha.vector, m_alpha.vlen);
+
+	REQUIRE(param, "Param not set\n");
+	SGVector<float64_t> result;
+	int64_t len=const_cast<TParameter *>(param)->m_datatype.get_num_elements();
+	result=SGVector<float64_t>(len);
+
+	for (index_t i=0; i<result.vlen; i++)
+	{
+		SGVector<float64_t> dmu;
+
+		if (result.vlen==1)
+			dmu=m_mean->get_parameter_derivative(m_features, param);
+		else
+			dmu=m_mean->get_parameter_derivative(m_features, param, i);
+
+		Map<VectorXd> eigen_dmu(dmu.vector, dmu.vlen);
+
+		// compute derivative wrt mean parameter: dnlZ=-dmu'*alpha
+		result[i]=-eigen_dmu.dot(eigen_alpha);
+	}
+
+	return result;
+}
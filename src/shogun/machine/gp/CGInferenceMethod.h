@@ -0,0 +1,377 @@
+/*
+ * Copyright (c) The Shogun Machine Learning Toolbox
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of the Shogun Development Team.
+ *
+ */
+#ifndef CCGINFERENCEMETHOD_H_
+#define CCGINFERENCEMETHOD_H_
+
+#include <shogun/lib/config.h>
+
+#include <shogun/machine/gp/Inference.h>
+#include <shogun/lib/Lock.h>
+
+namespace shogun
+{
+
+/** @brief Matrix-free inference method for Gaussian process regression
+ * based on conjugate gradients.
+ *
+ * Computes the same quantities as CExactInferenceMethod without ever
+ * storing the \f$n\times n\f$ kernel matrix. All systems with
+ *
+ * \f[
+ * \hat{K} = s^{2}K + \sigma^{2}I
+ * \f]
+ *
+ * are solved with preconditioned conjugate gradients on a
+ * CKernelMatrixOperator, which evaluates the kernel in tiles. Several right
+ * hand sides are solved at once, so that every kernel value is computed
+ * once per iteration for all of them. The preconditioner is
+ * \f$LL^{T}+\sigma^{2}I\f$, where \f$L\f$ is a rank \f$k\f$ pivoted
+ * Cholesky factor of \f$s^{2}K\f$.
+ *
+ * The log-determinant \f$\log|\hat{K}|\f$ is estimated with
+ * CLogDetEstimator, and the traces in the hyperparameter derivatives
+ *
+ * \f[
+ * tr(\hat{K}^{-1}\frac{\partial \hat{K}}{\partial \theta})\approx
+ * \frac{1}{S}\sum_{s=1}^{S}(\hat{K}^{-1}z_{s})^{T}
+ * \frac{\partial \hat{K}}{\partial \theta}z_{s}
+ * \f]
+ *
+ * with \f$S\f$ Rademacher probe vectors \f$z_{s}\f$. Hence the negative log
+ * marginal likelihood and its derivatives are unbiased stochastic estimates.
+ * Memory is \f$O(n(k+S))\f$ plus one tile per thread.
+ *
+ * Since no factorization of \f$\hat{K}\f$ is available, get_cholesky() and
+ * get_posterior_covariance() are not supported, i.e. only posterior means
+ * can be predicted.
+ *
+ * NOTE: The Gaussian Likelihood Function must be used for this inference
+ * method.
+ */
+class CCGInferenceMethod: public CInference
+{
+public:
+	/** default constructor */
+	CCGInferenceMethod();
+
+	/** constructor
+	 *
+	 * @param kernel covariance function
+	 * @param features features to use in inference
+	 * @param mean mean function to use
+	 * @param labels labels of the features
+	 * @param model likelihood model to use
+	 */
+	CCGInferenceMethod(CKernel* kernel, CFeatures* features,
+			CMeanFunction* mean, CLabels* labels, CLikelihoodModel* model);
+
+	virtual ~CCGInferenceMethod();
+
+	/** return what type of inference we are
+	 *
+	 * @return inference type CG
+	 */
+	virtual EInferenceType get_inference_type() const { return INF_CG; }
+
+	/** returns the name of the inference method
+	 *
+	 * @return name CGInferenceMethod
+	 */
+	virtual const char* get_name() const { return "CGInferenceMethod"; }
+
+	/** helper method used to specialize a base class instance
+	 *
+	 * @param inference inference method
+	 * @return casted CCGInferenceMethod object
+	 */
+	static CCGInferenceMethod* obtain_from_generic(CInference* inference);
+
+	/** get negative log marginal likelihood
+	 *
+	 * @return stochastic estimate of the negative log of the marginal
+	 * likelihood function:
+	 *
+	 * \f[
+	 * -log(p(y|X, \theta))=\frac{1}{2}(y-m)^{T}\alpha+
+	 * \frac{1}{2}\log|\hat{K}|+\frac{n}{2}\log(2\pi)
+	 * \f]
+	 *
+	 * where \f$y\f$ are the labels, \f$X\f$ are the features, and \f$\theta\f$
+	 * represent hyperparameters.
+	 */
+	virtual float64_t get_negative_log_marginal_likelihood();
+
+	/** get alpha vector
+	 *
+	 * @return vector to compute posterior mean of Gaussian Process:
+	 *
+	 * \f[
+	 * \mu = K\alpha
+	 * \f]
+	 *
+	 * where \f$\mu\f$ is the mean and \f$K\f$ is the prior covariance matrix.
+	 */
+	virtual SGVector<float64_t> get_alpha();
+
+	/** not supported, since no factorization is computed
+	 *
+	 * @return nothing
+	 */
+	virtual SGMatrix<float64_t> get_cholesky();
+
+	/** get diagonal vector
+	 *
+	 * @return diagonal of matrix used to calculate posterior covariance matrix
+	 *
+	 * \f[
+	 * Cov = (K^{-1}+sW^{2})^{-1}
+	 * \f]
+	 *
+	 * where \f$Cov\f$ is the posterior covariance matrix, \f$K\f$ is the prior
+	 * covariance matrix, and \f$sW\f$ is the diagonal vector.
+	 */
+	virtual SGVector<float64_t> get_diagonal_vector();
+
+	/** returns mean vector \f$\mu\f$ of the posterior Gaussian distribution
+	 * \f$\mathcal{N}(\mu,\Sigma)\f$, computed as
+	 * \f$\mu=y-m-\sigma^{2}\alpha\f$
+	 *
+	 * @return mean vector
+	 */
+	virtual SGVector<float64_t> get_posterior_mean();
+
+	/** not supported, since no factorization is computed
+	 *
+	 * @return nothing
+	 */
+	virtual SGMatrix<float64_t> get_posterior_covariance();
+
+	/**
+	 * @return whether combination of CG inference method and given
+	 * likelihood function supports regression
+	 */
+	virtual bool supports_regression() const
+	{
+		check_members();
+		return m_model->supports_regression();
+	}
+
+	/** update alpha and the preconditioner, but not the gradients */
+	virtual void update();
+
+	/** Set a minimizer
+	 *
+	 * @param minimizer minimizer used in inference method
+	 */
+	virtual void register_minimizer(Minimizer* minimizer);
+
+	/** set maximum number of CG iterations
+	 *
+	 * @param max_iterations maximum number of iterations
+	 */
+	void set_max_iterations(index_t max_iterations);
+
+	/** @return maximum number of CG iterations */
+	index_t get_max_iterations() const { return m_max_iterations; }
+
+	/** set the tolerance of CG, relative to the norm of the right hand side
+	 *
+	 * @param tolerance relative residual norm at which CG stops
+	 */
+	void set_tolerance(float64_t tolerance);
+
+	/** @return tolerance of CG */
+	float64_t get_tolerance() const { return m_tolerance; }
+
+	/** set number of probe vectors used to estimate the traces in the
+	 * derivatives
+	 *
+	 * @param num_probes number of probe vectors
+	 */
+	void set_num_probes(index_t num_probes);
+
+	/** @return number of probe vectors */
+	index_t get_num_probes() const { return m_num_probes; }
+
+	/** set number of log-determinant estimates that are averaged
+	 *
+	 * @param num_estimates number of estimates
+	 */
+	void set_num_log_det_estimates(index_t num_estimates);
+
+	/** @return number of log-determinant estimates */
+	index_t get_num_log_det_estimates() const
+	{
+		return m_num_log_det_estimates;
+	}
+
+	/** set accuracy of the rational approximation of the log-determinant
+	 *
+	 * @param accuracy desired accuracy
+	 */
+	void set_log_det_accuracy(float64_t accuracy);
+
+	/** @return accuracy of the log-determinant approximation */
+	float64_t get_log_det_accuracy() const { return m_log_det_accuracy; }
+
+	/** set rank of the pivoted Cholesky preconditioner, zero disables it
+	 *
+	 * @param rank rank of the preconditioner
+	 */
+	void set_preconditioner_rank(index_t rank);
+
+	/** @return rank of the pivoted Cholesky preconditioner */
+	index_t get_preconditioner_rank() const { return m_preconditioner_rank; }
+
+	/** set number of rows and columns of a kernel tile
+	 *
+	 * @param tile_size size of a tile
+	 */
+	void set_tile_size(index_t tile_size);
+
+	/** @return number of rows and columns of a kernel tile */
+	index_t get_tile_size() const { return m_tile_size; }
+
+protected:
+	/** check if members of object are valid for inference */
+	virtual void check_members() const;
+
+	/** update alpha vector */
+	virtual void update_alpha();
+
+	/** update pivoted Cholesky preconditioner */
+	virtual void update_chol();
+
+	/** draw probe vectors and solve the system with all of them */
+	virtual void update_deriv();
+
+	/** initialize the kernel without computing the kernel matrix */
+	virtual void update_train_kernel();
+
+	/** returns derivative of negative log marginal likelihood wrt parameter of
+	 * CInference class
+	 *
+	 * @param param parameter of CInference class
+	 *
+	 * @return derivative of negative log marginal likelihood
+	 */
+	virtual SGVector<float64_t> get_derivative_wrt_inference_method(
+			const TParameter* param);
+
+	/** returns derivative of negative log marginal likelihood wrt parameter of
+	 * likelihood model
+	 *
+	 * @param param parameter of given likelihood model
+	 *
+	 * @return derivative of negative log marginal likelihood
+	 */
+	virtual SGVector<float64_t> get_derivative_wrt_likelihood_model(
+			const TParameter* param);
+
+	/** returns derivative of negative log marginal likelihood wrt kernel's
+	 * parameter
+	 *
+	 * @param param parameter of given kernel
+	 *
+	 * @return derivative of negative log marginal likelihood
+	 */
+	virtual SGVector<float64_t> get_derivative_wrt_kernel(
+			const TParameter* param);
+
+	/** returns derivative of negative log marginal likelihood wrt mean
+	 * function's parameter
+	 *
+	 * @param param parameter of given mean function
+	 *
+	 * @return derivative of negative log marginal likelihood
+	 */
+	virtual SGVector<float64_t> get_derivative_wrt_mean(
+			const TParameter* param);
+
+	/** update gradients */
+	virtual void compute_gradient();
+
+	/** solves \f$\hat{K}X=B\f$ for all columns of \f$B\f$ at once with
+	 * preconditioned conjugate gradients
+	 *
+	 * @param b right hand sides
+	 * @return solutions
+	 */
+	SGMatrix<float64_t> solve_kernel_system(SGMatrix<float64_t> b);
+
+	/** @return estimate of \f$\log|\hat{K}|\f$ */
+	float64_t compute_log_det();
+
+private:
+	void init();
+
+protected:
+	/** maximum number of CG iterations */
+	index_t m_max_iterations;
+
+	/** relative residual norm at which CG stops */
+	float64_t m_tolerance;
+
+	/** number of probe vectors for the trace estimates */
+	index_t m_num_probes;
+
+	/** number of averaged log-determinant estimates */
+	index_t m_num_log_det_estimates;
+
+	/** accuracy of the rational approximation of the log-determinant */
+	float64_t m_log_det_accuracy;
+
+	/** rank of the pivoted Cholesky preconditioner */
+	index_t m_preconditioner_rank;
+
+	/** number of rows and columns of a kernel tile */
+	index_t m_tile_size;
+
+	/** pivoted Cholesky factor \f$L\f$ of the preconditioner */
+	SGMatrix<float64_t> m_precond_factor;
+
+	/** upper triangular Cholesky factor of \f$\sigma^{2}I+L^{T}L\f$ */
+	SGMatrix<float64_t> m_precond_chol;
+
+	/** Rademacher probe vectors \f$z_{s}\f$ */
+	SGMatrix<float64_t> m_probes;
+
+	/** solutions \f$\hat{K}^{-1}z_{s}\f$ */
+	SGMatrix<float64_t> m_probe_solutions;
+
+	/** cached log-determinant estimate, NaN if not computed yet */
+	float64_t m_log_det;
+
+	/** lock for the kernel, which is initialized on tiles while the
+	 * derivatives wrt its parameters are computed */
+	CLock* m_lock;
+};
+}
+#endif /* CCGINFERENCEMETHOD_H_ */
@@ -54,6 +54,7 @@ enum EInferenceType
 {
 	INF_NONE=0,
 	INF_EXACT=10,
+	INF_CG=11,
 	INF_SPARSE=20,
 	INF_FITC_REGRESSION=21,
 	INF_FITC_LAPLACE_SINGLE=22,
@@ -0,0 +1,20 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <shogun/mathematics/KeyIndexSort.h>
+#include <shogun/base/Parallel.h>
+#include <shogun/base/init.h>
+
+using namespace shogun;
+
+int32_t CKeyIndexSort::get_num_threads()
+{
+	Parallel* parallel=get_global_parallel();
+	int32_t num_threads=parallel ? parallel->get_num_threads() : 1;
+	SG_UNREF(parallel);
+	return num_threads;
+}
@@ -0,0 +1,420 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef __KEYINDEXSORT_H_
+#define __KEYINDEXSORT_H_
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/common.h>
+#include <shogun/mathematics/Math.h>
+#include <algorithm>
+#include <string.h>
+
+namespace shogun
+{
+/** @brief Sorting of keys together with a parallel index array, a faster
+ * replacement for CMath::qsort_index and CMath::qsort_backward_index.
+ *
+ * Integer and floating point keys are sorted with a stable LSD radix sort.
+ * Floating point keys are mapped to unsigned integers of the same order by
+ * flipping the sign bit of non-negative and all bits of negative numbers,
+ * descending order complements these. Each of the byte passes is skipped if
+ * all keys share the byte. Large arrays are split into one chunk per thread
+ * for the histogram and scatter steps of every pass, so the result does not
+ * depend on the number of threads. Keys of other types are sorted with
+ * CMath::qsort_index.
+ *
+ * sort_smallest and sort_largest only order the first k elements, using a
+ * selection instead of a full sort, for users that only need the top k.
+ */
+class CKeyIndexSort
+{
+	public:
+		/** sort output in ascending order and permute index alongside,
+		 * matlab alike [sorted,index]=sort(output). Equal keys keep their
+		 * order if they are integer or floating point numbers.
+		 *
+		 * @param output keys to be sorted
+		 * @param index index array
+		 * @param size size of arrays
+		 */
+		template <class T1, class T2>
+		static void sort(T1* output, T2* index, index_t size)
+		{
+			sort_keys(output, index, size, false);
+		}
+
+		/** sort output in descending order and permute index alongside
+		 *
+		 * @param output keys to be sorted
+		 * @param index index array
+		 * @param size size of arrays
+		 */
+		template <class T1, class T2>
+		static void sort_backward(T1* output, T2* index, index_t size)
+		{
+			sort_keys(output, index, size, true);
+		}
+
+		/** move the k smallest keys to the front of output in ascending
+		 * order, the remaining keys follow in unspecified order. Equal keys
+		 * are ordered by their position.
+		 *
+		 * @param output keys
+		 * @param index index array
+		 * @param size size of arrays
+		 * @param k number of keys to sort
+		 */
+		template <class T1, class T2>
+		static void sort_smallest(T1* output, T2* index, index_t size,
+				index_t k)
+		{
+			select_keys(output, index, size, k, false);
+		}
+
+		/** move the k largest keys to the front of output in descending
+		 * order, the remaining keys follow in unspecified order. Equal keys
+		 * are ordered by their position.
+		 *
+		 * @param output keys
+		 * @param index index array
+		 * @param size size of arrays
+		 * @param k number of keys to sort
+		 */
+		template <class T1, class T2>
+		static void sort_largest(T1* output, T2* index, index_t size,
+				index_t k)
+		{
+			select_keys(output, index, size, k, true);
+		}
+
+		/** @return number of threads used for large arrays */
+		static int32_t get_num_threads();
+
+	protected:
+		/** keys of other types are sorted by quicksort */
+		template <class T1, class T2>
+		static void sort_keys(T1* output, T2* index, index_t size,
+				bool descending)
+		{
+			if (descending)
+				CMath::qsort_backward_index(output, index, size);
+			else
+				CMath::qsort_index(output, index, size);
+		}
+
+		/** radix sort of float64_t keys */
+		template <class T2>
+		static void sort_keys(float64_t* output, T2* index, index_t size,
+				bool descending)
+		{
+			radix_sort<float64_t, uint64_t, T2>(output, index, size, descending);
+		}
+
+		/** radix sort of float32_t keys */
+		template <class T2>
+		static void sort_keys(float32_t* output, T2* index, index_t size,
+				bool descending)
+		{
+			radix_sort<float32_t, uint32_t, T2>(output, index, size, descending);
+		}
+
+		/** radix sort of int32_t keys */
+		template <class T2>
+		static void sort_keys(int32_t* output, T2* index, index_t size,
+				bool descending)
+		{
+			radix_sort<int32_t, uint32_t, T2>(output, index, size, descending);
+		}
+
+		/** radix sort of uint32_t keys */
+		template <class T2>
+		static void sort_keys(uint32_t* output, T2* index, index_t size,
+				bool descending)
+		{
+			radix_sort<uint32_t, uint32_t, T2>(output, index, size, descending);
+		}
+
+		/** radix sort of int64_t keys */
+		template <class T2>
+		static void sort_keys(int64_t* output, T2* index, index_t size,
+				bool descending)
+		{
+			radix_sort<int64_t, uint64_t, T2>(output, index, size, descending);
+		}
+
+		/** radix sort of uint64_t keys */
+		template <class T2>
+		static void sort_keys(uint64_t* output, T2* index, index_t size,
+				bool descending)
+		{
+			radix_sort<uint64_t, uint64_t, T2>(output, index, size, descending);
+		}
+
+		/** @name order preserving maps of keys to unsigned integers */
+		//@{
+		static inline uint64_t to_radix(float64_t key)
+		{
+			uint64_t bits;
+			memcpy(&bits, &key, sizeof(bits));
+			return bits>>63 ? ~bits : bits | (uint64_t(1)<<63);
+		}
+		static inline uint32_t to_radix(float32_t key)
+		{
+			uint32_t bits;
+			memcpy(&bits, &key, sizeof(bits));
+			return bits>>31 ? ~bits : bits | (uint32_t(1)<<31);
+		}
+		static inline uint32_t to_radix(int32_t key)
+		{
+			return uint32_t(key) ^ (uint32_t(1)<<31);
+		}
+		static inline uint32_t to_radix(uint32_t key)
+		{
+			return key;
+		}
+		static inline uint64_t to_radix(int64_t key)
+		{
+			return uint64_t(key) ^ (uint64_t(1)<<63);
+		}
+		static inline uint64_t to_radix(uint64_t key)
+		{
+			return key;
+		}
+		//@}
+
+		/** @name inverse maps of to_radix */
+		//@{
+		static inline void from_radix(uint64_t bits, float64_t& key)
+		{
+			bits=bits>>63 ? bits & ~(uint64_t(1)<<63) : ~bits;
+			memcpy(&key, &bits, sizeof(bits));
+		}
+		static inline void from_radix(uint32_t bits, float32_t& key)
+		{
+			bits=bits>>31 ? bits & ~(uint32_t(1)<<31) : ~bits;
+			memcpy(&key, &bits, sizeof(bits));
+		}
+		static inline void from_radix(uint32_t bits, int32_t& key)
+		{
+			key=int32_t(bits ^ (uint32_t(1)<<31));
+		}
+		static inline void from_radix(uint32_t bits, uint32_t& key)
+		{
+			key=bits;
+		}
+		static inline void from_radix(uint64_t bits, int64_t& key)
+		{
+			key=int64_t(bits ^ (uint64_t(1)<<63));
+		}
+		static inline void from_radix(uint64_t bits, uint64_t& key)
+		{
+			key=bits;
+		}
+		//@}
+
+		/** stable LSD radix sort of keys mapped to unsigned integers U
+		 *
+		 * @param output keys to be sorted
+		 * @param index index array
+		 * @param size size of arrays
+		 * @param descending whether to sort in descending order
+		 */
+		template <class T1, class U, class T2>
+		static void radix_sort(T1* output, T2* index, index_t size,
+				bool descending)
+		{
+			if (size<=1)
+				return;
+
+			// small arrays are sorted by insertion
+			if (size<=64)
+			{
+				for (index_t i=1; i<size; i++)
+				{
+					T1 key=output[i];
+					T2 idx=index[i];
+					index_t j=i;
+					while (j>0 && (descending ? output[j-1]<key : key<output[j-1]))
+					{
+						output[j]=output[j-1];
+						index[j]=index[j-1];
+						j--;
+					}
+					output[j]=key;
+					index[j]=idx;
+				}
+				return;
+			}
+
+			int32_t num_chunks=1;
+			if (size>=parallel_threshold)
+				num_chunks=CMath::max(1, get_num_threads());
+
+			U* keys=SG_MALLOC(U, size);
+			U* keys_tmp=SG_MALLOC(U, size);
+			T2* index_tmp=SG_MALLOC(T2, size);
+			T2* index_buf=index;
+			int64_t* counts=SG_MALLOC(int64_t, int64_t(num_chunks)*256);
+
+			U flip=descending ? ~U(0) : U(0);
+#pragma omp parallel for num_threads(num_chunks)
+			for (index_t i=0; i<size; i++)
+				keys[i]=to_radix(output[i]) ^ flip;
+
+			for (int32_t shift=0; shift<int32_t(8*sizeof(U)); shift+=8)
+			{
+				memset(counts, 0, sizeof(int64_t)*num_chunks*256);
+
+#pragma omp parallel for num_threads(num_chunks)
+				for (int32_t t=0; t<num_chunks; t++)
+				{
+					int64_t* c=&counts[t*256];
+					index_t end=chunk_begin(t+1, num_chunks, size);
+					for (index_t i=chunk_begin(t, num_chunks, size); i<end; i++)
+						c[(keys[i]>>shift) & 0xff]++;
+				}
+
+				// turn counts into offsets, digit major and chunk minor
+				bool skip=false;
+				int64_t offset=0;
+				for (int32_t d=0; d<256; d++)
+				{
+					int64_t total=0;
+					for (int32_t t=0; t<num_chunks; t++)
+					{
+						int64_t c=counts[t*256+d];
+						counts[t*256+d]=offset;
+						offset+=c;
+						total+=c;
+					}
+					if (total==size)
+						skip=true;
+				}
+				if (skip)
+					continue;
+
+#pragma omp parallel for num_threads(num_chunks)
+				for (int32_t t=0; t<num_chunks; t++)
+				{
+					int64_t* c=&counts[t*256];
+					index_t end=chunk_begin(t+1, num_chunks, size);
+					for (index_t i=chunk_begin(t, num_chunks, size); i<end; i++)
+					{
+						int64_t j=c[(keys[i]>>shift) & 0xff]++;
+						keys_tmp[j]=keys[i];
+						index_tmp[j]=index_buf[i];
+					}
+				}
+
+				CMath::swap(keys, keys_tmp);
+				CMath::swap(index_buf, index_tmp);
+			}
+
+#pragma omp parallel for num_threads(num_chunks)
+			for (index_t i=0; i<size; i++)
+				from_radix(U(keys[i] ^ flip), output[i]);
+
+			// the sorted index may have ended up in the scratch buffer
+			if (index_buf!=index)
+			{
+				for (index_t i=0; i<size; i++)
+					index[i]=index_buf[i];
+				CMath::swap(index_buf, index_tmp);
+			}
+
+			SG_FREE(keys);
+			SG_FREE(keys_tmp);
+			SG_FREE(index_tmp);
+			SG_FREE(counts);
+		}
+
+		/** start of a chunk of a parallel radix pass */
+		static inline index_t chunk_begin(int32_t chunk, int32_t num_chunks,
+				index_t size)
+		{
+			return index_t(int64_t(size)*chunk/num_chunks);
+		}
+
+		/** orders positions by their keys, ties by position */
+		template <class T1>
+		struct SKeyLess
+		{
+			/** keys */
+			const T1* keys;
+			/** whether larger keys come first */
+			bool descending;
+
+			/** @return whether position a comes before position b */
+			inline bool operator()(index_t a, index_t b) const
+			{
+				if (keys[a]<keys[b])
+					return !descending;
+				if (keys[b]<keys[a])
+					return descending;
+				return a<b;
+			}
+		};
+
+		/** partial sort of the first k keys by selection
+		 *
+		 * @param output keys
+		 * @param index index array
+		 * @param size size of arrays
+		 * @param k number of keys to sort
+		 * @param descending whether the largest keys are selected
+		 */
+		template <class T1, class T2>
+		static void select_keys(T1* output, T2* index, index_t size,
+				index_t k, bool descending)
+		{
+			k=CMath::min(k, size);
+			if (k<=0)
+				return;
+
+			// selection only pays off if few keys are sorted
+			if (k>size/8)
+			{
+				sort_keys(output, index, size, descending);
+				return;
+			}
+
+			index_t* perm=SG_MALLOC(index_t, size);
+			for (index_t i=0; i<size; i++)
+				perm[i]=i;
+
+			SKeyLess<T1> less;
+			less.keys=output;
+			less.descending=descending;
+			std::nth_element(perm, perm+k-1, perm+size, less);
+			std::sort(perm, perm+k, less);
+
+			T1* output_tmp=SG_MALLOC(T1, size);
+			T2* index_tmp=SG_MALLOC(T2, size);
+			for (index_t i=0; i<size; i++)
+			{
+				output_tmp[i]=output[perm[i]];
+				index_tmp[i]=index[perm[i]];
+			}
+			for (index_t i=0; i<size; i++)
+			{
+				output[i]=output_tmp[i];
+				index[i]=index_tmp[i];
+			}
+
+			SG_FREE(perm);
+			SG_FREE(output_tmp);
+			SG_FREE(index_tmp);
+		}
+
+	protected:
+		/** arrays of at least this size are sorted in parallel */
+		static const index_t parallel_threshold=65536;
+};
+}
+#endif /* __KEYINDEXSORT_H_ */
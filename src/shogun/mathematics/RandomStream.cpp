@@ -0,0 +1,205 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <shogun/mathematics/RandomStream.h>
+#include <shogun/mathematics/Math.h>
+
+using namespace shogun;
+
+/* multipliers and Weyl sequence constants of Philox4x32 */
+#define PHILOX_M0 0xD2511F53U
+#define PHILOX_M1 0xCD9E8D57U
+#define PHILOX_W0 0x9E3779B9U
+#define PHILOX_W1 0xBB67AE85U
+#define PHILOX_ROUNDS 10
+
+/* number of blocks which are generated together by the bulk methods */
+#define PHILOX_LANES 8
+
+RandomStream::RandomStream(uint64_t seed, uint64_t stream)
+{
+	set_stream(seed, stream);
+}
+
+void RandomStream::set_stream(uint64_t seed, uint64_t stream)
+{
+	m_key[0]=uint32_t(seed);
+	m_key[1]=uint32_t(seed>>32);
+	m_stream=stream;
+	set_counter(0);
+}
+
+void RandomStream::set_counter(uint64_t block)
+{
+	m_counter=block;
+	m_position=4;
+}
+
+void RandomStream::philox4x32(const uint32_t counter[4], const uint32_t key[2],
+		uint32_t result[4])
+{
+	uint32_t c0=counter[0], c1=counter[1], c2=counter[2], c3=counter[3];
+	uint32_t k0=key[0], k1=key[1];
+
+	for (int32_t r=0; r<PHILOX_ROUNDS; ++r)
+	{
+		uint64_t p0=uint64_t(PHILOX_M0)*c0;
+		uint64_t p1=uint64_t(PHILOX_M1)*c2;
+
+		c0=uint32_t(p1>>32)^c1^k0;
+		c2=uint32_t(p0>>32)^c3^k1;
+		c1=uint32_t(p1);
+		c3=uint32_t(p0);
+
+		k0+=PHILOX_W0;
+		k1+=PHILOX_W1;
+	}
+
+	result[0]=c0;
+	result[1]=c1;
+	result[2]=c2;
+	result[3]=c3;
+}
+
+void RandomStream::next_block()
+{
+	uint32_t counter[4]={uint32_t(m_counter), uint32_t(m_counter>>32),
+		uint32_t(m_stream), uint32_t(m_stream>>32)};
+
+	philox4x32(counter, m_key, m_block);
+
+	m_counter++;
+	m_position=0;
+}
+
+void RandomStream::generate_blocks(uint32_t* result, index_t num_blocks)
+{
+	const uint32_t s0=uint32_t(m_stream);
+	const uint32_t s1=uint32_t(m_stream>>32);
+
+	index_t b=0;
+
+	// the rounds are computed for several counters in lock step, which
+	// the compiler can vectorize
+	for (; b+PHILOX_LANES<=num_blocks; b+=PHILOX_LANES)
+	{
+		uint32_t c0[PHILOX_LANES], c1[PHILOX_LANES];
+		uint32_t c2[PHILOX_LANES], c3[PHILOX_LANES];
+
+		for (int32_t l=0; l<PHILOX_LANES; ++l)
+		{
+			uint64_t ctr=m_counter+b+l;
+			c0[l]=uint32_t(ctr);
+			c1[l]=uint32_t(ctr>>32);
+			c2[l]=s0;
+			c3[l]=s1;
+		}
+
+		uint32_t k0=m_key[0];
+		uint32_t k1=m_key[1];
+
+		for (int32_t r=0; r<PHILOX_ROUNDS; ++r)
+		{
+			for (int32_t l=0; l<PHILOX_LANES; ++l)
+			{
+				uint64_t p0=uint64_t(PHILOX_M0)*c0[l];
+				uint64_t p1=uint64_t(PHILOX_M1)*c2[l];
+
+				c0[l]=uint32_t(p1>>32)^c1[l]^k0;
+				c2[l]=uint32_t(p0>>32)^c3[l]^k1;
+				c1[l]=uint32_t(p1);
+				c3[l]=uint32_t(p0);
+			}
+
+			k0+=PHILOX_W0;
+			k1+=PHILOX_W1;
+		}
+
+		for (int32_t l=0; l<PHILOX_LANES; ++l)
+		{
+			uint32_t* block=result+4*(b+l);
+			block[0]=c0[l];
+			block[1]=c1[l];
+			block[2]=c2[l];
+			block[3]=c3[l];
+		}
+	}
+
+	for (; b<num_blocks; ++b)
+	{
+		uint64_t ctr=m_counter+b;
+		uint32_t counter[4]={uint32_t(ctr), uint32_t(ctr>>32), s0, s1};
+		philox4x32(counter, m_key, result+4*b);
+	}
+
+	m_counter+=num_blocks;
+	m_position=4;
+}
+
+float64_t RandomStream::std_normal_distrib()
+{
+	// Box-Muller transform of one block
+	float64_t u1=random_open();
+	float64_t u2=random_half_open();
+
+	return CMath::sqrt(-2.0*CMath::log(u1))*cos(2.0*CMath::PI*u2);
+}
+
+void RandomStream::fill_array(uint32_t* array, index_t size)
+{
+	const index_t num_blocks=size/4;
+	generate_blocks(array, num_blocks);
+
+	for (index_t i=4*num_blocks; i<size; ++i)
+		array[i]=random_32();
+}
+
+void RandomStream::fill_uniform(float64_t* array, index_t size,
+		float64_t min_value, float64_t max_value)
+{
+	// every block gives two numbers with 53 random bits
+	const index_t num_blocks=(size+1)/2;
+	uint32_t* bits=SG_MALLOC(uint32_t, 4*num_blocks);
+	generate_blocks(bits, num_blocks);
+
+	const float64_t scale=(max_value-min_value)/9007199254740992.0;
+	for (index_t i=0; i<size; ++i)
+	{
+		uint64_t word=(uint64_t(bits[2*i])<<32) | bits[2*i+1];
+		array[i]=min_value+(word>>11)*scale;
+	}
+
+	SG_FREE(bits);
+}
+
+void RandomStream::fill_normal(float64_t* array, index_t size, float64_t mu,
+		float64_t sigma)
+{
+	// every block gives two numbers by the Box-Muller transform
+	const index_t num_blocks=(size+1)/2;
+	uint32_t* bits=SG_MALLOC(uint32_t, 4*num_blocks);
+	generate_blocks(bits, num_blocks);
+
+	for (index_t b=0; b<num_blocks; ++b)
+	{
+		const uint32_t* block=bits+4*b;
+		uint64_t w1=(uint64_t(block[0])<<32) | block[1];
+		uint64_t w2=(uint64_t(block[2])<<32) | block[3];
+
+		float64_t u1=((w1>>12)+0.5)*(1.0/4503599627370496.0);
+		float64_t u2=(w2>>11)*(1.0/9007199254740992.0);
+
+		float64_t radius=sigma*CMath::sqrt(-2.0*CMath::log(u1));
+		float64_t angle=2.0*CMath::PI*u2;
+
+		array[2*b]=mu+radius*cos(angle);
+		if (2*b+1<size)
+			array[2*b+1]=mu+radius*sin(angle);
+	}
+
+	SG_FREE(bits);
+}
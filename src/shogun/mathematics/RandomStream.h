@@ -0,0 +1,214 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef __RANDOMSTREAM_H__
+#define __RANDOMSTREAM_H__
+
+#include <shogun/lib/config.h>
+#include <shogun/lib/common.h>
+
+namespace shogun
+{
+
+/** @brief Counter-based pseudo random number stream (Philox4x32-10).
+ *
+ * The n-th block of 128 random bits of a stream is a pure function of the
+ * seed, the stream index and n, so there is no shared state and no lock.
+ * Parallel code creates one stream per task, e.g.
+ *
+ * \code
+ * uint64_t seed=CMath::random();
+ * #pragma omp parallel for
+ * for (index_t i=0; i<num_tasks; ++i)
+ * {
+ *     RandomStream rng(seed, i);
+ *     ...
+ * }
+ * \endcode
+ *
+ * which gives the same numbers for every task, regardless of the number of
+ * threads and the scheduling. Streams are small value objects and not
+ * meant to be shared between threads.
+ *
+ * The bulk fill methods generate several blocks at once and always start
+ * at the beginning of a new block.
+ *
+ * J. K. Salmon, M. A. Moraes, R. O. Dror, D. E. Shaw: Parallel random
+ * numbers: as easy as 1, 2, 3. SC 2011.
+ */
+class RandomStream
+{
+public:
+	/** constructor
+	 *
+	 * @param seed master seed, the key of the generator
+	 * @param stream index of the stream, e.g. the task index
+	 */
+	RandomStream(uint64_t seed=0, uint64_t stream=0);
+
+	/** restart at the beginning of another stream
+	 *
+	 * @param seed master seed
+	 * @param stream index of the stream
+	 */
+	void set_stream(uint64_t seed, uint64_t stream);
+
+	/** jump to a block of the stream
+	 *
+	 * @param block index of the next block of 128 bits to use
+	 */
+	void set_counter(uint64_t block);
+
+	/** @return index of the next block of 128 bits */
+	uint64_t get_counter() const { return m_counter; }
+
+	/** @return unsigned 32 bit random number */
+	inline uint32_t random_32()
+	{
+		if (m_position==4)
+			next_block();
+
+		return m_block[m_position++];
+	}
+
+	/** @return unsigned 64 bit random number */
+	inline uint64_t random_64()
+	{
+		uint64_t hi=random_32();
+		return (hi<<32) | random_32();
+	}
+
+	/** @return random number in \f$[0,1)\f$ with 53 random bits */
+	inline float64_t random_half_open()
+	{
+		return (random_64()>>11)*(1.0/9007199254740992.0);
+	}
+
+	/** @return random number in \f$(0,1)\f$ */
+	inline float64_t random_open()
+	{
+		return ((random_64()>>12)+0.5)*(1.0/4503599627370496.0);
+	}
+
+	/** generate a random number in \f$[min, max)\f$
+	 *
+	 * @param min_value minimum value
+	 * @param max_value maximum value
+	 * @return random number
+	 */
+	inline float64_t random(float64_t min_value, float64_t max_value)
+	{
+		return min_value+(max_value-min_value)*random_half_open();
+	}
+
+	/** generate a random integer in \f$[min, max]\f$
+	 *
+	 * @param min_value minimum value
+	 * @param max_value maximum value
+	 * @return random integer
+	 */
+	inline index_t random(index_t min_value, index_t max_value)
+	{
+		uint64_t range=uint64_t(max_value-min_value)+1;
+		return min_value+index_t((random_32()*range)>>32);
+	}
+
+	/** @return standard normal random number */
+	float64_t std_normal_distrib();
+
+	/** generate a normal random number
+	 *
+	 * @param mu mean
+	 * @param sigma standard deviation
+	 * @return random number
+	 */
+	inline float64_t normal_distrib(float64_t mu, float64_t sigma)
+	{
+		return mu+sigma*std_normal_distrib();
+	}
+
+	/** fill an array with unsigned 32 bit random numbers
+	 *
+	 * @param array array to fill
+	 * @param size length of the array
+	 */
+	void fill_array(uint32_t* array, index_t size);
+
+	/** fill an array with uniform random numbers in \f$[min, max)\f$
+	 *
+	 * @param array array to fill
+	 * @param size length of the array
+	 * @param min_value minimum value
+	 * @param max_value maximum value
+	 */
+	void fill_uniform(float64_t* array, index_t size, float64_t min_value=0.0,
+		float64_t max_value=1.0);
+
+	/** fill an array with normal random numbers
+	 *
+	 * @param array array to fill
+	 * @param size length of the array
+	 * @param mu mean
+	 * @param sigma standard deviation
+	 */
+	void fill_normal(float64_t* array, index_t size, float64_t mu=0.0,
+		float64_t sigma=1.0);
+
+	/** permute an array randomly (Fisher-Yates)
+	 *
+	 * @param array array to permute
+	 * @param size length of the array
+	 */
+	template <class T>
+	void permute(T* array, index_t size)
+	{
+		for (index_t i=0; i<size-1; ++i)
+		{
+			index_t j=random(i, size-1);
+			T tmp=array[i];
+			array[i]=array[j];
+			array[j]=tmp;
+		}
+	}
+
+	/** the Philox4x32-10 bijection
+	 *
+	 * @param counter 128 bit counter
+	 * @param key 64 bit key
+	 * @param result 128 random bits (output)
+	 */
+	static void philox4x32(const uint32_t counter[4], const uint32_t key[2],
+		uint32_t result[4]);
+
+private:
+	/** generate the block at the current counter and advance it */
+	void next_block();
+
+	/** generate the next num_blocks blocks into result, advances the
+	 * counter
+	 */
+	void generate_blocks(uint32_t* result, index_t num_blocks);
+
+private:
+	/** key of the generator */
+	uint32_t m_key[2];
+
+	/** index of the stream */
+	uint64_t m_stream;
+
+	/** index of the next block */
+	uint64_t m_counter;
+
+	/** current block */
+	uint32_t m_block[4];
+
+	/** position of the next unused word in the current block */
+	int32_t m_position;
+};
+
+}
+#endif /* __RANDOMSTREAM_H__ */
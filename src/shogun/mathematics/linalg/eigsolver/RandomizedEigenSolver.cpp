@@ -0,0 +1,70 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <shogun/lib/config.h>
+
+#include <shogun/mathematics/linalg/eigsolver/RandomizedEigenSolver.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/eigen3.h>
+#include <shogun/io/SGIO.h>
+
+using namespace Eigen;
+
+namespace shogun
+{
+
+/* replaces the columns of a matrix by an orthonormal basis of their span */
+static void orthonormalize(SGMatrix<float64_t> vectors)
+{
+	Map<MatrixXd> v(vectors.matrix, vectors.num_rows, vectors.num_cols);
+	HouseholderQR<MatrixXd> qr(v);
+	v=qr.householderQ()*MatrixXd::Identity(v.rows(), v.cols());
+}
+
+void RandomizedEigenSolver::compute(int32_t dim, int32_t num_vectors,
+		int32_t power_iterations, const MatrixProduct& product,
+		SGVector<float64_t>& eigenvalues, SGMatrix<float64_t>& eigenvectors)
+{
+	REQUIRE(num_vectors>0 && num_vectors<=dim, "Number of sketch vectors (%d) "
+		"has to be in [1, %d]\n", num_vectors, dim)
+	REQUIRE(power_iterations>=0, "Number of power iterations (%d) has to be "
+		"non-negative\n", power_iterations)
+
+	SGMatrix<float64_t> basis(dim, num_vectors);
+	for (int64_t i=0; i<int64_t(dim)*num_vectors; i++)
+		basis.matrix[i]=CMath::randn_double();
+
+	/* sketch of the range, refined by power iterations */
+	SGMatrix<float64_t> image(dim, num_vectors);
+	for (int32_t i=0; i<=power_iterations; i++)
+	{
+		product(basis, image);
+		orthonormalize(image);
+		CMath::swap(basis, image);
+	}
+
+	/* Rayleigh-Ritz projection onto the subspace */
+	product(basis, image);
+	Map<MatrixXd> q(basis.matrix, dim, num_vectors);
+	Map<MatrixXd> z(image.matrix, dim, num_vectors);
+	MatrixXd projection=q.transpose()*z;
+	projection=0.5*(projection+projection.transpose());
+
+	SelfAdjointEigenSolver<MatrixXd> solver(projection);
+	REQUIRE(solver.info()==Success, "Eigendecomposition of the projected "
+		"matrix failed\n")
+
+	/* eigen returns ascending eigenvalues */
+	eigenvalues=SGVector<float64_t>(num_vectors);
+	eigenvectors=SGMatrix<float64_t>(dim, num_vectors);
+	Map<VectorXd> values(eigenvalues.vector, num_vectors);
+	Map<MatrixXd> vectors(eigenvectors.matrix, dim, num_vectors);
+	values=solver.eigenvalues().reverse();
+	vectors.noalias()=q*solver.eigenvectors().rowwise().reverse();
+}
+
+}
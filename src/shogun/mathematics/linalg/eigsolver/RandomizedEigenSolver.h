@@ -0,0 +1,68 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef RANDOMIZED_EIGEN_SOLVER_H_
+#define RANDOMIZED_EIGEN_SOLVER_H_
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/common.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/lib/SGMatrix.h>
+
+#include <functional>
+
+namespace shogun
+{
+
+/** @brief Computes the largest eigenpairs of a real valued, symmetric
+ * positive semi-definite matrix with randomized subspace iteration.
+ *
+ * The matrix is only accessed through products with blocks of vectors,
+ * so it may be implicit, e.g. the covariance of data streamed from disk.
+ * The range of the matrix is sketched by its product with a gaussian
+ * random matrix of num_vectors columns, refined by power iterations and
+ * orthonormalized. The Rayleigh-Ritz projection of the matrix onto that
+ * subspace is decomposed exactly. This needs power_iterations+2 products,
+ * i.e. O(d^2 l) operations for a dense d x d matrix with l vectors instead
+ * of O(d^3) for a full eigendecomposition.
+ *
+ * To get k accurate eigenpairs, num_vectors should be k plus an
+ * oversampling of about 10. Each power iteration improves the accuracy
+ * when the spectrum decays slowly.
+ *
+ * Halko, N., Martinsson, P. G., & Tropp, J. A. (2011).
+ * Finding structure with randomness: Probabilistic algorithms for
+ * constructing approximate matrix decompositions. SIAM review, 53(2).
+ */
+class RandomizedEigenSolver
+{
+public:
+	/** computes the product result=A*vectors of the matrix A with a block of
+	 * vectors, result is allocated and has the shape of vectors
+	 */
+	typedef std::function<void(SGMatrix<float64_t> vectors,
+			SGMatrix<float64_t> result)> MatrixProduct;
+
+	/** approximate the largest eigenpairs of a matrix
+	 *
+	 * @param dim dimension of the matrix
+	 * @param num_vectors number of sketch vectors, at most dim
+	 * @param power_iterations number of power iterations
+	 * @param product product of the matrix with a block of vectors
+	 * @param eigenvalues approximate eigenvalues, num_vectors values in
+	 * descending order
+	 * @param eigenvectors corresponding orthonormal eigenvectors, one per
+	 * column
+	 */
+	static void compute(int32_t dim, int32_t num_vectors,
+			int32_t power_iterations, const MatrixProduct& product,
+			SGVector<float64_t>& eigenvalues, SGMatrix<float64_t>& eigenvectors);
+};
+
+}
+#endif // RANDOMIZED_EIGEN_SOLVER_H_
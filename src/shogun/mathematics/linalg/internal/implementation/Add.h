@@ -37,6 +37,7 @@
 #include <shogun/lib/SGVector.h>
 
 #include <shogun/mathematics/eigen3.h>
+#include <shogun/mathematics/linalg/internal/implementation/CPUDispatch.h>
 
 #ifdef HAVE_VIENNACL
 #include <shogun/lib/GPUMatrix.h>
@@ -168,6 +169,87 @@ struct add<Backend::EIGEN3, Matrix>
 	}
 };
 
+/** Specialization of add for the CPU backend */
+template <class Matrix>
+struct add<Backend::CPU, Matrix>
+{
+	/** Scalar type */
+	typedef typename Matrix::Scalar T;
+
+	/**
+	 * Performs the operation C = alpha*A + beta*B.
+	 * @param A first matrix
+	 * @param B second matrix
+	 * @param alpha constant to be multiplied by the first matrix
+	 * @param beta constant to be multiplied by the second matrix
+	 * @return The return matrix
+	 */
+	static SGMatrix<T> compute(SGMatrix<T> A, SGMatrix<T> B, T alpha=1, T beta=1)
+	{
+		REQUIRE(A.matrix, "Matrix A is not initialized!\n");
+		REQUIRE(B.matrix, "Matrix B is not initialized!\n");
+
+		REQUIRE(A.num_rows == B.num_rows && A.num_cols == B.num_cols,
+				"Dimension mismatch! A(%d x %d) vs B(%d x %d)\n",
+				A.num_rows, A.num_cols, B.num_rows, B.num_cols);
+
+		SGMatrix<T> C(A.num_rows, A.num_cols);
+		compute(A, B, C, alpha, beta);
+
+		return C;
+	}
+
+	/**
+	 * Performs the operation C = alpha*A + beta*B using the runtime
+	 * dispatched CPU kernels
+	 * @param A first matrix
+	 * @param B second matrix
+	 * @param C matrix to store the result
+	 * @param alpha constant to be multiplied by the first matrix
+	 * @param beta constant to be multiplied by the second matrix
+	 */
+	static void compute(SGMatrix<T> A, SGMatrix<T> B, SGMatrix<T> C,
+		T alpha, T beta)
+	{
+		cpu_kernels<T>::add(A.matrix, B.matrix, C.matrix,
+			A.num_rows*A.num_cols, alpha, beta);
+	}
+
+	/**
+	 * Performs the operation C = alpha*A + beta*B.
+	 * @param A first vector
+	 * @param B second vector
+	 * @param alpha constant to be multiplied by the first vector
+	 * @param beta constant to be multiplied by the second vector
+	 * @return The result vector
+	 */
+	static SGVector<T> compute(SGVector<T> A, SGVector<T> B, T alpha=1, T beta=1)
+	{
+		REQUIRE(A.vlen == B.vlen, "Vectors should have same length! "
+				"A(%d) vs B(%d)\n", A.vlen, B.vlen);
+
+		SGVector<T> C(A.vlen);
+		compute(A, B, C, alpha, beta);
+
+		return C;
+	}
+
+	/**
+	 * Performs the operation C = alpha*A + beta*B using the runtime
+	 * dispatched CPU kernels
+	 * @param A first vector
+	 * @param B second vector
+	 * @param C vector to store the result
+	 * @param alpha constant to be multiplied by the first vector
+	 * @param beta constant to be multiplied by the second vector
+	 */
+	static void compute(SGVector<T> A, SGVector<T> B, SGVector<T> C,
+		T alpha, T beta)
+	{
+		cpu_kernels<T>::add(A.vector, B.vector, C.vector, A.vlen, alpha, beta);
+	}
+};
+
 #ifdef HAVE_VIENNACL
 
 /**
@@ -115,6 +115,15 @@ struct apply<Backend::EIGEN3, Matrix, Vector>
 	}
 };
 
+/**
+ * @brief Specialization of generic apply for the CPU backend. There is no
+ * runtime dispatched kernel for it, so it falls back to Eigen3.
+ */
+template <class Matrix, class Vector>
+struct apply<Backend::CPU, Matrix, Vector> : public apply<Backend::EIGEN3, Matrix, Vector>
+{
+};
+
 #ifdef HAVE_VIENNACL
 /**
  * @brief Partial specialization of apply for the ViennaCL backend
@@ -0,0 +1,511 @@
+/*
+ * Copyright (c) The Shogun Machine Learning Toolbox
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of the Shogun Development Team.
+ */
+
+#include <shogun/mathematics/linalg/internal/implementation/CPUDispatch.h>
+#include <shogun/io/SGIO.h>
+
+#include <cstdlib>
+#include <cstring>
+
+/*
+ * The vectorized kernels are written once against GCC's generic vector
+ * extensions and forced inline into thin per instruction set entry points
+ * which carry the matching target attribute. This way the compiler emits
+ * SSE2, AVX2+FMA and AVX-512 code into the same object file without any
+ * global -m flags, and we pick the entry points at runtime.
+ */
+#if defined(HAVE_SSE2) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SG_CPU_DISPATCH_X86
+#define SG_CPU_FORCE_INLINE inline __attribute__((always_inline))
+#define SG_CPU_TARGET(ISA) __attribute__((target(ISA)))
+#endif
+
+using namespace shogun;
+using namespace shogun::linalg;
+
+namespace
+{
+
+/** Plain loops, used where no vectorized implementation is available */
+namespace scalar
+{
+
+template <typename T>
+T dot(const T* a, const T* b, index_t len)
+{
+	T result=0;
+	for (index_t i=0; i<len; ++i)
+		result+=a[i]*b[i];
+	return result;
+}
+
+template <typename T>
+void add(const T* a, const T* b, T* c, index_t len, T alpha, T beta)
+{
+	for (index_t i=0; i<len; ++i)
+		c[i]=alpha*a[i]+beta*b[i];
+}
+
+template <typename T>
+void scale(const T* a, T* b, index_t len, T alpha)
+{
+	for (index_t i=0; i<len; ++i)
+		b[i]=alpha*a[i];
+}
+
+template <typename T>
+void elementwise_product(const T* a, const T* b, T* c, index_t len)
+{
+	for (index_t i=0; i<len; ++i)
+		c[i]=a[i]*b[i];
+}
+
+template <typename T>
+T sum(const T* a, index_t len)
+{
+	T result=0;
+	for (index_t i=0; i<len; ++i)
+		result+=a[i];
+	return result;
+}
+
+template <typename T>
+T max(const T* a, index_t len)
+{
+	T result=a[0];
+	for (index_t i=1; i<len; ++i)
+		if (a[i]>result)
+			result=a[i];
+	return result;
+}
+
+}
+
+#ifdef SG_CPU_DISPATCH_X86
+/** Width independent kernels, W is the number of lanes of a register */
+namespace simd
+{
+
+template <typename T, int W>
+struct reg
+{
+	typedef T type __attribute__((vector_size(W*sizeof(T))));
+};
+
+template <class V, typename T>
+SG_CPU_FORCE_INLINE void load(V& v, const T* p)
+{
+	memcpy(&v, p, sizeof(V));
+}
+
+template <class V, typename T>
+SG_CPU_FORCE_INLINE void store(T* p, const V& v)
+{
+	memcpy(p, &v, sizeof(V));
+}
+
+template <typename T, int W>
+SG_CPU_FORCE_INLINE T dot(const T* a, const T* b, index_t len)
+{
+	typedef typename reg<T,W>::type vec;
+	vec acc0={}, acc1={}, va, vb;
+	index_t i=0;
+
+	// two independent accumulators to hide the latency of the adds
+	for (; i+2*W<=len; i+=2*W)
+	{
+		load(va, a+i); load(vb, b+i);
+		acc0+=va*vb;
+		load(va, a+i+W); load(vb, b+i+W);
+		acc1+=va*vb;
+	}
+	for (; i+W<=len; i+=W)
+	{
+		load(va, a+i); load(vb, b+i);
+		acc0+=va*vb;
+	}
+	acc0+=acc1;
+
+	T result=0;
+	for (int k=0; k<W; ++k)
+		result+=acc0[k];
+	for (; i<len; ++i)
+		result+=a[i]*b[i];
+
+	return result;
+}
+
+template <typename T, int W>
+SG_CPU_FORCE_INLINE void add(const T* a, const T* b, T* c, index_t len,
+	T alpha, T beta)
+{
+	typedef typename reg<T,W>::type vec;
+	vec va, vb, valpha, vbeta;
+	for (int k=0; k<W; ++k)
+	{
+		valpha[k]=alpha;
+		vbeta[k]=beta;
+	}
+
+	index_t i=0;
+	for (; i+W<=len; i+=W)
+	{
+		load(va, a+i); load(vb, b+i);
+		va=valpha*va+vbeta*vb;
+		store(c+i, va);
+	}
+	for (; i<len; ++i)
+		c[i]=alpha*a[i]+beta*b[i];
+}
+
+template <typename T, int W>
+SG_CPU_FORCE_INLINE void scale(const T* a, T* b, index_t len, T alpha)
+{
+	typedef typename reg<T,W>::type vec;
+	vec va, valpha;
+	for (int k=0; k<W; ++k)
+		valpha[k]=alpha;
+
+	index_t i=0;
+	for (; i+W<=len; i+=W)
+	{
+		load(va, a+i);
+		va*=valpha;
+		store(b+i, va);
+	}
+	for (; i<len; ++i)
+		b[i]=alpha*a[i];
+}
+
+template <typename T, int W>
+SG_CPU_FORCE_INLINE void elementwise_product(const T* a, const T* b, T* c,
+	index_t len)
+{
+	typedef typename reg<T,W>::type vec;
+	vec va, vb;
+
+	index_t i=0;
+	for (; i+W<=len; i+=W)
+	{
+		load(va, a+i); load(vb, b+i);
+		va*=vb;
+		store(c+i, va);
+	}
+	for (; i<len; ++i)
+		c[i]=a[i]*b[i];
+}
+
+template <typename T, int W>
+SG_CPU_FORCE_INLINE T sum(const T* a, index_t len)
+{
+	typedef typename reg<T,W>::type vec;
+	vec acc0={}, acc1={}, va;
+	index_t i=0;
+
+	for (; i+2*W<=len; i+=2*W)
+	{
+		load(va, a+i);
+		acc0+=va;
+		load(va, a+i+W);
+		acc1+=va;
+	}
+	for (; i+W<=len; i+=W)
+	{
+		load(va, a+i);
+		acc0+=va;
+	}
+	acc0+=acc1;
+
+	T result=0;
+	for (int k=0; k<W; ++k)
+		result+=acc0[k];
+	for (; i<len; ++i)
+		result+=a[i];
+
+	return result;
+}
+
+template <typename T, int W>
+SG_CPU_FORCE_INLINE T max(const T* a, index_t len)
+{
+	if (len<W)
+		return scalar::max(a, len);
+
+	typedef typename reg<T,W>::type vec;
+	vec acc, va;
+	load(acc, a);
+
+	index_t i=W;
+	for (; i+W<=len; i+=W)
+	{
+		load(va, a+i);
+		acc=va>acc ? va : acc;
+	}
+
+	T result=acc[0];
+	for (int k=1; k<W; ++k)
+		if (acc[k]>result)
+			result=acc[k];
+	for (; i<len; ++i)
+		if (a[i]>result)
+			result=a[i];
+
+	return result;
+}
+
+}
+
+/**
+ * Defines the entry points of one instruction set, which instantiate the
+ * generic kernels with the register width of that instruction set
+ */
+#define SG_DEFINE_CPU_KERNELS(NAME, ISA, BYTES) \
+namespace NAME \
+{ \
+template <typename T> SG_CPU_TARGET(ISA) \
+T dot(const T* a, const T* b, index_t len) \
+{ \
+	return simd::dot<T,BYTES/sizeof(T)>(a, b, len); \
+} \
+template <typename T> SG_CPU_TARGET(ISA) \
+void add(const T* a, const T* b, T* c, index_t len, T alpha, T beta) \
+{ \
+	simd::add<T,BYTES/sizeof(T)>(a, b, c, len, alpha, beta); \
+} \
+template <typename T> SG_CPU_TARGET(ISA) \
+void scale(const T* a, T* b, index_t len, T alpha) \
+{ \
+	simd::scale<T,BYTES/sizeof(T)>(a, b, len, alpha); \
+} \
+template <typename T> SG_CPU_TARGET(ISA) \
+void elementwise_product(const T* a, const T* b, T* c, index_t len) \
+{ \
+	simd::elementwise_product<T,BYTES/sizeof(T)>(a, b, c, len); \
+} \
+template <typename T> SG_CPU_TARGET(ISA) \
+T sum(const T* a, index_t len) \
+{ \
+	return simd::sum<T,BYTES/sizeof(T)>(a, len); \
+} \
+template <typename T> SG_CPU_TARGET(ISA) \
+T max(const T* a, index_t len) \
+{ \
+	return simd::max<T,BYTES/sizeof(T)>(a, len); \
+} \
+}
+
+SG_DEFINE_CPU_KERNELS(sse2, "sse2", 16)
+SG_DEFINE_CPU_KERNELS(avx2, "avx2,fma", 32)
+SG_DEFINE_CPU_KERNELS(avx512, "avx512f", 64)
+
+#undef SG_DEFINE_CPU_KERNELS
+#endif // SG_CPU_DISPATCH_X86
+
+/** Table of the entry points currently used for scalar type T */
+template <typename T>
+struct kernel_table
+{
+	T (*dot)(const T*, const T*, index_t);
+	void (*add)(const T*, const T*, T*, index_t, T, T);
+	void (*scale)(const T*, T*, index_t, T);
+	void (*elementwise_product)(const T*, const T*, T*, index_t);
+	T (*sum)(const T*, index_t);
+	T (*max)(const T*, index_t);
+};
+
+#define SG_KERNEL_TABLE(NAME, T) \
+	{ &NAME::dot<T>, &NAME::add<T>, &NAME::scale<T>, \
+	  &NAME::elementwise_product<T>, &NAME::sum<T>, &NAME::max<T> }
+
+/*
+ * The tables start out with the scalar kernels, which only requires constant
+ * initialization. Hence they are usable even from static initializers that
+ * run before the selection below.
+ */
+kernel_table<float64_t> float64_kernels=SG_KERNEL_TABLE(scalar, float64_t);
+kernel_table<float32_t> float32_kernels=SG_KERNEL_TABLE(scalar, float32_t);
+CPUInstructionSet current_isa=CPUInstructionSet::SCALAR;
+
+CPUInstructionSet detect_isa()
+{
+#ifdef SG_CPU_DISPATCH_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f"))
+		return CPUInstructionSet::AVX512;
+	if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+		return CPUInstructionSet::AVX2;
+	return CPUInstructionSet::SSE2;
+#else
+	return CPUInstructionSet::SCALAR;
+#endif
+}
+
+void select_isa(CPUInstructionSet isa)
+{
+	switch (isa)
+	{
+#ifdef SG_CPU_DISPATCH_X86
+	case CPUInstructionSet::AVX512:
+		float64_kernels=SG_KERNEL_TABLE(avx512, float64_t);
+		float32_kernels=SG_KERNEL_TABLE(avx512, float32_t);
+		break;
+	case CPUInstructionSet::AVX2:
+		float64_kernels=SG_KERNEL_TABLE(avx2, float64_t);
+		float32_kernels=SG_KERNEL_TABLE(avx2, float32_t);
+		break;
+	case CPUInstructionSet::SSE2:
+		float64_kernels=SG_KERNEL_TABLE(sse2, float64_t);
+		float32_kernels=SG_KERNEL_TABLE(sse2, float32_t);
+		break;
+#endif // SG_CPU_DISPATCH_X86
+	default:
+		isa=CPUInstructionSet::SCALAR;
+		float64_kernels=SG_KERNEL_TABLE(scalar, float64_t);
+		float32_kernels=SG_KERNEL_TABLE(scalar, float32_t);
+		break;
+	}
+	current_isa=isa;
+}
+
+#undef SG_KERNEL_TABLE
+
+/** Selects the kernels once when the library is loaded */
+struct CPUDispatchInitializer
+{
+	CPUDispatchInitializer()
+	{
+		CPUInstructionSet isa=detect_isa();
+		const char* requested=getenv("SHOGUN_LINALG_CPU");
+		if (requested)
+		{
+			CPUInstructionSet wanted=isa;
+			if (!strcmp(requested, "scalar"))
+				wanted=CPUInstructionSet::SCALAR;
+			else if (!strcmp(requested, "sse2"))
+				wanted=CPUInstructionSet::SSE2;
+			else if (!strcmp(requested, "avx2"))
+				wanted=CPUInstructionSet::AVX2;
+			else if (!strcmp(requested, "avx512"))
+				wanted=CPUInstructionSet::AVX512;
+			if (wanted<isa)
+				isa=wanted;
+		}
+		select_isa(isa);
+	}
+};
+
+CPUDispatchInitializer cpu_dispatch_initializer;
+
+}
+
+namespace shogun
+{
+
+namespace linalg
+{
+
+CPUInstructionSet get_cpu_instruction_set()
+{
+	return current_isa;
+}
+
+CPUInstructionSet get_max_cpu_instruction_set()
+{
+	return detect_isa();
+}
+
+const char* get_cpu_instruction_set_name()
+{
+	switch (current_isa)
+	{
+	case CPUInstructionSet::AVX512:
+		return "AVX-512";
+	case CPUInstructionSet::AVX2:
+		return "AVX2";
+	case CPUInstructionSet::SSE2:
+		return "SSE2";
+	default:
+		return "scalar";
+	}
+}
+
+CPUInstructionSet set_cpu_instruction_set(CPUInstructionSet isa)
+{
+	CPUInstructionSet max_isa=detect_isa();
+	if (isa>max_isa)
+		isa=max_isa;
+
+	select_isa(isa);
+	SG_SDEBUG("linalg CPU backend uses %s kernels\n",
+		get_cpu_instruction_set_name());
+
+	return current_isa;
+}
+
+namespace implementation
+{
+
+#define SG_DEFINE_CPU_KERNEL_SPECIALIZATION(T, TABLE) \
+T cpu_kernels<T>::dot(const T* a, const T* b, index_t len) \
+{ \
+	return TABLE.dot(a, b, len); \
+} \
+void cpu_kernels<T>::add(const T* a, const T* b, T* c, index_t len, \
+	T alpha, T beta) \
+{ \
+	TABLE.add(a, b, c, len, alpha, beta); \
+} \
+void cpu_kernels<T>::scale(const T* a, T* b, index_t len, T alpha) \
+{ \
+	TABLE.scale(a, b, len, alpha); \
+} \
+void cpu_kernels<T>::elementwise_product(const T* a, const T* b, T* c, \
+	index_t len) \
+{ \
+	TABLE.elementwise_product(a, b, c, len); \
+} \
+T cpu_kernels<T>::sum(const T* a, index_t len) \
+{ \
+	return TABLE.sum(a, len); \
+} \
+T cpu_kernels<T>::max(const T* a, index_t len) \
+{ \
+	return TABLE.max(a, len); \
+}
+
+SG_DEFINE_CPU_KERNEL_SPECIALIZATION(float64_t, float64_kernels)
+SG_DEFINE_CPU_KERNEL_SPECIALIZATION(float32_t, float32_kernels)
+
+#undef SG_DEFINE_CPU_KERNEL_SPECIALIZATION
+
+}
+
+}
+
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) The Shogun Machine Learning Toolbox
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of the Shogun Development Team.
+ */
+
+#ifndef CPU_DISPATCH_IMPL_H_
+#define CPU_DISPATCH_IMPL_H_
+
+#include <shogun/lib/config.h>
+#include <shogun/lib/common.h>
+
+namespace shogun
+{
+
+namespace linalg
+{
+
+/**
+ * @brief Instruction sets for which the CPU backend ships hand vectorized
+ * kernels. The best one supported by the host is selected once, when the
+ * library is loaded, so that binaries built for a generic baseline still make
+ * use of wider registers where available.
+ *
+ * The enum is ordered, i.e. a later value implies support for all earlier ones.
+ */
+enum class CPUInstructionSet
+{
+	SCALAR,
+	SSE2,
+	AVX2,
+	AVX512
+};
+
+/** @return the instruction set currently used by the CPU backend */
+CPUInstructionSet get_cpu_instruction_set();
+
+/** @return the widest instruction set supported by this host and build */
+CPUInstructionSet get_max_cpu_instruction_set();
+
+/** @return a human readable name of the instruction set used by the CPU backend */
+const char* get_cpu_instruction_set_name();
+
+/**
+ * Overrides the instruction set chosen at load time. Requests for
+ * instruction sets that are not supported by the host are clamped to the
+ * widest supported one. At load time the environment variable
+ * SHOGUN_LINALG_CPU (one of scalar, sse2, avx2, avx512) is honoured the same way.
+ *
+ * @param isa the desired instruction set
+ * @return the instruction set that is actually used from now on
+ */
+CPUInstructionSet set_cpu_instruction_set(CPUInstructionSet isa);
+
+namespace implementation
+{
+
+/**
+ * @brief Kernels of the CPU backend for contiguous memory. The generic version
+ * consists of plain loops and is used for all scalar types other than
+ * float32_t and float64_t, for which the specializations dispatch to SSE2,
+ * AVX2 or AVX-512 implementations at runtime.
+ */
+template <typename T>
+struct cpu_kernels
+{
+	/** @return \f$\sum_i a_i b_i\f$ */
+	static T dot(const T* a, const T* b, index_t len)
+	{
+		T result=0;
+		for (index_t i=0; i<len; ++i)
+			result+=a[i]*b[i];
+		return result;
+	}
+
+	/** Performs \f$c_i=\alpha a_i+\beta b_i\f$, c may alias a or b */
+	static void add(const T* a, const T* b, T* c, index_t len, T alpha, T beta)
+	{
+		for (index_t i=0; i<len; ++i)
+			c[i]=alpha*a[i]+beta*b[i];
+	}
+
+	/** Performs \f$b_i=\alpha a_i\f$, b may alias a */
+	static void scale(const T* a, T* b, index_t len, T alpha)
+	{
+		for (index_t i=0; i<len; ++i)
+			b[i]=alpha*a[i];
+	}
+
+	/** Performs \f$c_i=a_i b_i\f$, c may alias a or b */
+	static void elementwise_product(const T* a, const T* b, T* c, index_t len)
+	{
+		for (index_t i=0; i<len; ++i)
+			c[i]=a[i]*b[i];
+	}
+
+	/** @return \f$\sum_i a_i\f$ */
+	static T sum(const T* a, index_t len)
+	{
+		T result=0;
+		for (index_t i=0; i<len; ++i)
+			result+=a[i];
+		return result;
+	}
+
+	/** @return \f$\max_i a_i\f$, len has to be positive */
+	static T max(const T* a, index_t len)
+	{
+		T result=a[0];
+		for (index_t i=1; i<len; ++i)
+			if (a[i]>result)
+				result=a[i];
+		return result;
+	}
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <>
+struct cpu_kernels<float64_t>
+{
+	static float64_t dot(const float64_t* a, const float64_t* b, index_t len);
+	static void add(const float64_t* a, const float64_t* b, float64_t* c,
+		index_t len, float64_t alpha, float64_t beta);
+	static void scale(const float64_t* a, float64_t* b, index_t len, float64_t alpha);
+	static void elementwise_product(const float64_t* a, const float64_t* b,
+		float64_t* c, index_t len);
+	static float64_t sum(const float64_t* a, index_t len);
+	static float64_t max(const float64_t* a, index_t len);
+};
+
+template <>
+struct cpu_kernels<float32_t>
+{
+	static float32_t dot(const float32_t* a, const float32_t* b, index_t len);
+	static void add(const float32_t* a, const float32_t* b, float32_t* c,
+		index_t len, float32_t alpha, float32_t beta);
+	static void scale(const float32_t* a, float32_t* b, index_t len, float32_t alpha);
+	static void elementwise_product(const float32_t* a, const float32_t* b,
+		float32_t* c, index_t len);
+	static float32_t sum(const float32_t* a, index_t len);
+	static float32_t max(const float32_t* a, index_t len);
+};
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+}
+
+}
+
+}
+#endif // CPU_DISPATCH_IMPL_H_
@@ -113,6 +113,15 @@ struct cholesky<Backend::EIGEN3, Matrix>
 
 };
 
+/**
+ * @brief Specialization of generic cholesky for the CPU backend. There is no
+ * runtime dispatched kernel for it, so it falls back to Eigen3.
+ */
+template <class Matrix>
+struct cholesky<Backend::CPU, Matrix> : public cholesky<Backend::EIGEN3, Matrix>
+{
+};
+
 }
 
 }
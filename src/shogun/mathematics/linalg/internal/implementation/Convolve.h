@@ -150,6 +150,15 @@ struct convolve<Backend::EIGEN3, Matrix>
 	}
 };
 
+/**
+ * @brief Specialization of generic convolve for the CPU backend. There is no
+ * runtime dispatched kernel for it, so it falls back to Eigen3.
+ */
+template <class Matrix>
+struct convolve<Backend::CPU, Matrix> : public convolve<Backend::EIGEN3, Matrix>
+{
+};
+
 #ifdef HAVE_VIENNACL
 
 /** Partial specialization of convolve for the ViennaCL backend */
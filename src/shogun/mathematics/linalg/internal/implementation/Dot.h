@@ -37,6 +37,7 @@
 #include <shogun/io/SGIO.h>
 
 #include <shogun/mathematics/eigen3.h>
+#include <shogun/mathematics/linalg/internal/implementation/CPUDispatch.h>
 
 #ifdef HAVE_VIENNACL
 #include <shogun/lib/GPUVector.h>
@@ -103,6 +104,33 @@ struct dot<Backend::EIGEN3, Vector>
 	}
 };
 
+/**
+ * @brief Specialization of generic dot for the CPU backend
+ */
+template <class Vector>
+struct dot<Backend::CPU, Vector>
+{
+	/** Scalar type */
+	typedef typename Vector::Scalar T;
+
+	/**
+	 * Method that computes the dot product of SGVectors using the runtime
+	 * dispatched CPU kernels
+	 *
+	 * @param a first vector
+	 * @param b second vector
+	 * @return the dot product of \f$\mathbf{a}\f$ and \f$\mathbf{b}\f$, computed
+	 * as \f$\sum_i a_i b_i\f$
+	 */
+	static T compute(shogun::SGVector<T> a, shogun::SGVector<T> b)
+	{
+		REQUIRE(a.vlen==b.vlen, "Vectors should have same length! "
+			"a(%d) vs b(%d)\n", a.vlen, b.vlen);
+
+		return cpu_kernels<T>::dot(a.vector, b.vector, a.vlen);
+	}
+};
+
 #ifdef HAVE_VIENNACL
 /**
  * @brief Specialization of generic dot for the ViennaCL backend
@@ -35,6 +35,7 @@
 #include <shogun/lib/SGMatrix.h>
 
 #include <shogun/mathematics/eigen3.h>
+#include <shogun/mathematics/linalg/internal/implementation/CPUDispatch.h>
 
 #ifdef HAVE_VIENNACL
 #include <shogun/lib/GPUMatrix.h>
@@ -124,6 +125,51 @@ struct elementwise_product<Backend::EIGEN3, Matrix>
 	}
 };
 
+/** Specialization of elementwise_product for the CPU backend */
+template <class Matrix>
+struct elementwise_product<Backend::CPU, Matrix>
+{
+	/** Scalar type */
+	typedef typename Matrix::Scalar T;
+
+	/** Return type */
+	typedef SGMatrix<T> ReturnType;
+
+	/** Performs the operation C = A .* B where ".*" denotes elementwise multiplication.
+	 *
+	 * @param A First matrix
+	 * @param B Second matrix
+	 * @return The result of the operation
+	 */
+	static ReturnType compute(SGMatrix<T> A, SGMatrix<T> B)
+	{
+		REQUIRE(A.matrix, "Matrix A is not initialized!\n");
+		REQUIRE(B.matrix, "Matrix B is not initialized!\n");
+
+		REQUIRE(A.num_rows == B.num_rows && A.num_cols == B.num_cols,
+				"Dimension mismatch! A(%d x %d) vs B(%d x %d)\n",
+				A.num_rows, A.num_cols, B.num_rows, B.num_cols);
+
+		ReturnType retMatrix(A.num_rows, A.num_cols);
+		compute(A, B, retMatrix);
+
+		return retMatrix;
+	}
+
+	/** Performs the operation C = A .* B where ".*" denotes elementwise
+	 * multiplication using the runtime dispatched CPU kernels.
+	 *
+	 * @param A First matrix
+	 * @param B Second matrix
+	 * @param C Result of the operation
+	 */
+	static void compute(SGMatrix<T> A, SGMatrix<T> B, SGMatrix<T> C)
+	{
+		cpu_kernels<T>::elementwise_product(A.matrix, B.matrix, C.matrix,
+			A.num_rows*A.num_cols);
+	}
+};
+
 #ifdef HAVE_VIENNACL
 
 /** Specialization of elementwise_product for the ViennaCL backend */
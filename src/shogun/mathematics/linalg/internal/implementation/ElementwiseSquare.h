@@ -158,6 +158,15 @@ struct elementwise_square<Backend::EIGEN3,Matrix>
 	}
 };
 
+/**
+ * @brief Specialization of generic elementwise_square for the CPU backend. There is no
+ * runtime dispatched kernel for it, so it falls back to Eigen3.
+ */
+template <class Matrix>
+struct elementwise_square<Backend::CPU,Matrix> : public elementwise_square<Backend::EIGEN3,Matrix>
+{
+};
+
 
 #ifdef HAVE_VIENNACL
 /**
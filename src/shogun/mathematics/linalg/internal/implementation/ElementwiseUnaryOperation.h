@@ -139,6 +139,17 @@ struct elementwise_unary_operation<Backend::EIGEN3, Operand, ReturnType, UnaryOp
 	}
 };
 
+/**
+ * @brief Specialization for elementwise_unary_operation with CPU backend.
+ * There is no runtime dispatched kernel for arbitrary unary operators, so it
+ * falls back to the NATIVE loop.
+ */
+template <class Operand, class ReturnType, class UnaryOp>
+struct elementwise_unary_operation<Backend::CPU, Operand, ReturnType, UnaryOp>
+	: public elementwise_unary_operation<Backend::NATIVE, Operand, ReturnType, UnaryOp>
+{
+};
+
 #ifdef HAVE_VIENNACL
 /**
  * @brief Specialization for elementwise_unary_operation with VIENNACL backend.
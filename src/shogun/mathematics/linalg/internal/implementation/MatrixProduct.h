@@ -158,6 +158,15 @@ struct matrix_product<Backend::EIGEN3, Matrix>
 	}
 };
 
+/**
+ * @brief Specialization of generic matrix_product for the CPU backend. There is no
+ * runtime dispatched kernel for it, so it falls back to Eigen3.
+ */
+template <class Matrix>
+struct matrix_product<Backend::CPU, Matrix> : public matrix_product<Backend::EIGEN3, Matrix>
+{
+};
+
 #ifdef HAVE_VIENNACL
 
 /** Specialization of matrix_product for the ViennaCL backend */
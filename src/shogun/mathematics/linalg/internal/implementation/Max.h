@@ -37,6 +37,7 @@
 #include <shogun/mathematics/Math.h>
 
 #include <shogun/mathematics/eigen3.h>
+#include <shogun/mathematics/linalg/internal/implementation/CPUDispatch.h>
 
 #ifdef HAVE_VIENNACL
 #include <shogun/mathematics/linalg/internal/opencl_util.h>
@@ -113,6 +114,38 @@ struct max<Backend::EIGEN3,Matrix>
 	}
 };
 
+/**
+ * @brief Specialization of max for the CPU backend
+ */
+template <class Matrix>
+struct max<Backend::CPU,Matrix>
+{
+	/** Scalar type */
+	typedef typename Matrix::Scalar T;
+
+	/**
+	 * Returns the largest element in a matrix
+	 * @param mat input matrix
+	 * @return largest value in the matrix
+	 */
+	static T compute(SGMatrix<T> mat)
+	{
+		REQUIRE(mat.num_rows*mat.num_cols>0, "Matrix is empty!\n");
+		return cpu_kernels<T>::max(mat.matrix, mat.num_rows*mat.num_cols);
+	}
+
+	/**
+	 * Returns the largest element in a vector
+	 * @param vec input vector
+	 * @return largest value in the vector
+	 */
+	static T compute(SGVector<T> vec)
+	{
+		REQUIRE(vec.vlen>0, "Vector is empty!\n");
+		return cpu_kernels<T>::max(vec.vector, vec.vlen);
+	}
+};
+
 #ifdef HAVE_VIENNACL
 
 /**
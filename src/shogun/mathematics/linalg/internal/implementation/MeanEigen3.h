@@ -198,6 +198,15 @@ struct mean<Backend::EIGEN3, Matrix>
 	}
 };
 
+/**
+ * @brief Specialization of generic mean for the CPU backend. There is no
+ * runtime dispatched kernel for it, so it falls back to Eigen3.
+ */
+template <class Matrix>
+struct mean<Backend::CPU, Matrix> : public mean<Backend::EIGEN3, Matrix>
+{
+};
+
 
 /**
  * @brief Specialization of generic mean which works with SGMatrix
@@ -261,6 +270,15 @@ struct rowwise_mean<Backend::EIGEN3, Matrix>
 
 };
 
+/**
+ * @brief Specialization of generic rowwise_mean for the CPU backend. There is no
+ * runtime dispatched kernel for it, so it falls back to Eigen3.
+ */
+template <class Matrix>
+struct rowwise_mean<Backend::CPU, Matrix> : public rowwise_mean<Backend::EIGEN3, Matrix>
+{
+};
+
 }
 
 }
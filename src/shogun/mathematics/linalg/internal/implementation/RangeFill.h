@@ -97,6 +97,15 @@ struct range_fill<Backend::EIGEN3, Matrix>
 
 };
 
+/**
+ * @brief Specialization of generic range_fill for the CPU backend. There is no
+ * runtime dispatched kernel for it, so it falls back to Eigen3.
+ */
+template <class Matrix>
+struct range_fill<Backend::CPU, Matrix> : public range_fill<Backend::EIGEN3, Matrix>
+{
+};
+
 }
 
 }
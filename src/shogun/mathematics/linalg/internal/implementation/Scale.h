@@ -36,6 +36,7 @@
 #include <shogun/lib/SGVector.h>
 
 #include <shogun/mathematics/eigen3.h>
+#include <shogun/mathematics/linalg/internal/implementation/CPUDispatch.h>
 
 #ifdef HAVE_VIENNACL
 #include <shogun/lib/GPUMatrix.h>
@@ -96,6 +97,26 @@ struct scale<Backend::EIGEN3, Matrix>
 	}
 };
 
+/** Specialization of scale for the CPU backend */
+template <class Matrix>
+struct scale<Backend::CPU, Matrix>
+{
+	/** Scalar type */
+	typedef typename Matrix::Scalar T;
+
+	/** Performs the operation B = alpha*A */
+	static void compute(SGMatrix<T> A, SGMatrix<T> B, T alpha)
+	{
+		cpu_kernels<T>::scale(A.matrix, B.matrix, A.num_rows*A.num_cols, alpha);
+	}
+
+	/** Performs the operation B = alpha*A */
+	static void compute(SGVector<T> A, SGVector<T> B, T alpha)
+	{
+		cpu_kernels<T>::scale(A.vector, B.vector, A.vlen, alpha);
+	}
+};
+
 #ifdef HAVE_VIENNACL
 
 /** Specialization of scale for the ViennaCL backend */
@@ -93,6 +93,15 @@ struct set_rows_const<Backend::EIGEN3, Matrix, Vector>
 	}
 };
 
+/**
+ * @brief Specialization of generic set_rows_const for the CPU backend. There is no
+ * runtime dispatched kernel for it, so it falls back to Eigen3.
+ */
+template <class Matrix, class Vector>
+struct set_rows_const<Backend::CPU, Matrix, Vector> : public set_rows_const<Backend::EIGEN3, Matrix, Vector>
+{
+};
+
 #ifdef HAVE_VIENNACL
 
 /** Specialization of set_rows_const for the ViennaCL backend */
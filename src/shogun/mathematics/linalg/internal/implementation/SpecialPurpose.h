@@ -84,6 +84,15 @@ struct logistic<Backend::EIGEN3, Matrix>
 	}
 };
 
+/**
+ * @brief Specialization of generic logistic for the CPU backend. There is no
+ * runtime dispatched kernel for it, so it falls back to Eigen3.
+ */
+template <class Matrix>
+struct logistic<Backend::CPU, Matrix> : public logistic<Backend::EIGEN3, Matrix>
+{
+};
+
 #ifdef HAVE_VIENNACL
 
 /** Specialization of logistic for the ViennaCL backend */
@@ -142,6 +151,15 @@ struct multiply_by_logistic_derivative<Backend::EIGEN3, Matrix>
 	}
 };
 
+/**
+ * @brief Specialization of generic multiply_by_logistic_derivative for the CPU backend. There is no
+ * runtime dispatched kernel for it, so it falls back to Eigen3.
+ */
+template <class Matrix>
+struct multiply_by_logistic_derivative<Backend::CPU, Matrix> : public multiply_by_logistic_derivative<Backend::EIGEN3, Matrix>
+{
+};
+
 #ifdef HAVE_VIENNACL
 
 /** Specialization of multiply_by_logistic_derivative for the ViennaCL backend */
@@ -201,6 +219,15 @@ struct rectified_linear<Backend::EIGEN3, Matrix>
 	}
 };
 
+/**
+ * @brief Specialization of generic rectified_linear for the CPU backend. There is no
+ * runtime dispatched kernel for it, so it falls back to Eigen3.
+ */
+template <class Matrix>
+struct rectified_linear<Backend::CPU, Matrix> : public rectified_linear<Backend::EIGEN3, Matrix>
+{
+};
+
 #ifdef HAVE_VIENNACL
 
 /** Specialization of rectified_linear for the ViennaCL backend */
@@ -260,6 +287,15 @@ struct multiply_by_rectified_linear_derivative<Backend::EIGEN3, Matrix>
 	}
 };
 
+/**
+ * @brief Specialization of generic multiply_by_rectified_linear_derivative for the CPU backend. There is no
+ * runtime dispatched kernel for it, so it falls back to Eigen3.
+ */
+template <class Matrix>
+struct multiply_by_rectified_linear_derivative<Backend::CPU, Matrix> : public multiply_by_rectified_linear_derivative<Backend::EIGEN3, Matrix>
+{
+};
+
 #ifdef HAVE_VIENNACL
 
 /** Specialization of multiply_by_rectified_linear_derivative for the ViennaCL backend */
@@ -337,6 +373,15 @@ struct softmax<Backend::EIGEN3, Matrix>
 	}
 };
 
+/**
+ * @brief Specialization of generic softmax for the CPU backend. There is no
+ * runtime dispatched kernel for it, so it falls back to Eigen3.
+ */
+template <class Matrix>
+struct softmax<Backend::CPU, Matrix> : public softmax<Backend::EIGEN3, Matrix>
+{
+};
+
 #ifdef HAVE_VIENNACL
 
 /** Specialization of softmax for the ViennaCL backend */
@@ -444,6 +489,15 @@ struct cross_entropy<Backend::EIGEN3,Matrix>
 	}
 };
 
+/**
+ * @brief Specialization of generic cross_entropy for the CPU backend. There is no
+ * runtime dispatched kernel for it, so it falls back to Eigen3.
+ */
+template <class Matrix>
+struct cross_entropy<Backend::CPU,Matrix> : public cross_entropy<Backend::EIGEN3,Matrix>
+{
+};
+
 #ifdef HAVE_VIENNACL
 /** Specialization of cross_entropy for the ViennaCL backend */
 template <class Matrix>
@@ -559,6 +613,15 @@ struct squared_error<Backend::EIGEN3,Matrix>
 	}
 };
 
+/**
+ * @brief Specialization of generic squared_error for the CPU backend. There is no
+ * runtime dispatched kernel for it, so it falls back to Eigen3.
+ */
+template <class Matrix>
+struct squared_error<Backend::CPU,Matrix> : public squared_error<Backend::EIGEN3,Matrix>
+{
+};
+
 #ifdef HAVE_VIENNACL
 /** Specialization of squared_error for the ViennaCL backend */
 template <class Matrix>
@@ -39,6 +39,7 @@
 #include <shogun/mathematics/linalg/internal/Block.h>
 
 #include <shogun/mathematics/eigen3.h>
+#include <shogun/mathematics/linalg/internal/implementation/CPUDispatch.h>
 
 #ifdef HAVE_VIENNACL
 #include <shogun/mathematics/linalg/internal/opencl_util.h>
@@ -349,6 +350,15 @@ struct sum_symmetric<Backend::EIGEN3,Matrix>
 	}
 };
 
+/**
+ * @brief Specialization of generic sum_symmetric for the CPU backend. There is no
+ * runtime dispatched kernel for it, so it falls back to Eigen3.
+ */
+template <class Matrix>
+struct sum_symmetric<Backend::CPU,Matrix> : public sum_symmetric<Backend::EIGEN3,Matrix>
+{
+};
+
 /**
  * @brief Specialization of generic colwise_sum which works with SGMatrix and uses Eigen3
  * as backend for computing sum.
@@ -449,6 +459,15 @@ struct colwise_sum<Backend::EIGEN3,Matrix>
 	}
 };
 
+/**
+ * @brief Specialization of generic colwise_sum for the CPU backend. There is no
+ * runtime dispatched kernel for it, so it falls back to Eigen3.
+ */
+template <class Matrix>
+struct colwise_sum<Backend::CPU,Matrix> : public colwise_sum<Backend::EIGEN3,Matrix>
+{
+};
+
 /**
  * @brief Specialization of generic rowwise_sum which works with SGMatrix and uses Eigen3
  * as backend for computing sum.
@@ -549,6 +568,75 @@ struct rowwise_sum<Backend::EIGEN3,Matrix>
 	}
 };
 
+/**
+ * @brief Specialization of generic rowwise_sum for the CPU backend. There is no
+ * runtime dispatched kernel for it, so it falls back to Eigen3.
+ */
+template <class Matrix>
+struct rowwise_sum<Backend::CPU,Matrix> : public rowwise_sum<Backend::EIGEN3,Matrix>
+{
+};
+
+
+/**
+ * @brief Specialization of generic sum which works with SGMatrix and uses the
+ * runtime dispatched CPU kernels for computing sum.
+ */
+template <class Matrix>
+struct sum<Backend::CPU,Matrix>
+{
+	/** Scalar type */
+	typedef typename Matrix::Scalar T;
+
+	/**
+	 * Method that computes the sum of co-efficients of SGMatrix
+	 *
+	 * @param mat the matrix whose sum of co-efficients has to be computed
+	 * @param no_diag if true, diagonal entries are excluded from the sum
+	 * @return the sum of co-efficients computed as \f$\sum_{i,j}m_{i,j}\f$
+	 */
+	static T compute(SGMatrix<T> mat, bool no_diag)
+	{
+		T sum=cpu_kernels<T>::sum(mat.matrix, mat.num_rows*mat.num_cols);
+
+		// remove the main diagonal elements if required
+		if (no_diag)
+		{
+			index_t len_major_diag=mat.num_rows < mat.num_cols ? mat.num_rows : mat.num_cols;
+			for (index_t i=0; i<len_major_diag; ++i)
+				sum-=mat(i,i);
+		}
+
+		return sum;
+	}
+
+	/**
+	 * Method that computes the sum of co-efficients of SGMatrix blocks
+	 *
+	 * @param b the matrix-block whose sum of co-efficients has to be computed
+	 * @param no_diag if true, diagonal entries are excluded from the sum
+	 * @return the sum of co-efficients computed as \f$\sum_{i,j}b_{i,j}\f$
+	 */
+	static T compute(Block<SGMatrix<T> > b, bool no_diag)
+	{
+		T sum=0;
+		for (index_t j=0; j<b.m_col_size; ++j)
+		{
+			sum+=cpu_kernels<T>::sum(&b.m_matrix(b.m_row_begin, b.m_col_begin+j),
+				b.m_row_size);
+		}
+
+		// remove the main diagonal elements if required
+		if (no_diag)
+		{
+			index_t len_major_diag=b.m_row_size < b.m_col_size ? b.m_row_size : b.m_col_size;
+			for (index_t i=0; i<len_major_diag; ++i)
+				sum-=b.m_matrix(b.m_row_begin+i, b.m_col_begin+i);
+		}
+
+		return sum;
+	}
+};
 
 #ifdef HAVE_VIENNACL
 /**
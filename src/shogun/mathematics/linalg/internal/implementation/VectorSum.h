@@ -41,6 +41,7 @@
 #endif
 
 #include <shogun/mathematics/eigen3.h>
+#include <shogun/mathematics/linalg/internal/implementation/CPUDispatch.h>
 
 #include <numeric>
 
@@ -99,6 +100,28 @@ struct vector_sum<Backend::EIGEN3, Vector>
 	}
 };
 
+/**
+ * @brief Specialization of generic vector_sum for the CPU backend
+ */
+template <class Vector>
+struct vector_sum<Backend::CPU, Vector>
+{
+	/** Scalar type */
+	typedef typename Vector::Scalar T;
+
+	/**
+	 * Method that computes the sum of SGVectors using the runtime dispatched
+	 * CPU kernels
+	 *
+	 * @param vec a vector whose sum has to be computed
+	 * @return the vector sum \f$\sum_i a_i\f$
+	 */
+	static T compute(SGVector<T> vec)
+	{
+		return cpu_kernels<T>::sum(vec.vector, vec.vlen);
+	}
+};
+
 
 #ifdef HAVE_VIENNACL
 /**
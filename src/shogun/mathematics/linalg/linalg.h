@@ -70,6 +70,13 @@ namespace linalg
  * in, first defined one will be used as default.
  *
  * Note - Currently EIGEN3 is the default (if it is available).
+ *
+ * The CPU backend provides vectorized implementations of a few elementwise
+ * and reduction operations (dot, add, scale, elementwise_product, sum, max)
+ * whose instruction set (SSE2, AVX2, AVX-512) is chosen at runtime, see
+ * get_cpu_instruction_set(). All other operations fall back to Eigen3 (or to
+ * the Native implementation for element-wise unary operations), so it can be
+ * set as a module or global backend.
  */
 enum class Backend
 {
@@ -78,6 +85,7 @@ enum class Backend
 	VIENNACL,
 #endif
 	NATIVE,
+	CPU,
 	DEFAULT = 0
 };
 
@@ -0,0 +1,166 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/SGVector.h>
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/base/Parameter.h>
+#include <shogun/kernel/Kernel.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/eigen3.h>
+#include <shogun/mathematics/linalg/linop/KernelMatrixOperator.h>
+
+using namespace Eigen;
+
+namespace shogun
+{
+
+CKernelMatrixOperator::CKernelMatrixOperator()
+	: CLinearOperator<float64_t>()
+{
+	init();
+
+	SG_GCDEBUG("%s created (%p)\n", this->get_name(), this);
+}
+
+CKernelMatrixOperator::CKernelMatrixOperator(CKernel* kernel,
+	float64_t scale, float64_t shift, index_t tile_size)
+	: CLinearOperator<float64_t>()
+{
+	init();
+
+	REQUIRE(kernel, "Kernel is NULL!\n");
+	REQUIRE(kernel->get_num_vec_lhs()==kernel->get_num_vec_rhs(),
+		"Kernel matrix is not square (%d x %d)!\n",
+		kernel->get_num_vec_lhs(), kernel->get_num_vec_rhs());
+	REQUIRE(tile_size>0, "Tile size (%d) has to be positive!\n", tile_size);
+
+	m_kernel=kernel;
+	SG_REF(m_kernel);
+
+	m_dimension=kernel->get_num_vec_lhs();
+	m_scale=scale;
+	m_shift=shift;
+	m_tile_size=tile_size;
+
+	SG_GCDEBUG("%s created (%p)\n", this->get_name(), this);
+}
+
+void CKernelMatrixOperator::init()
+{
+	m_kernel=NULL;
+	m_scale=1.0;
+	m_shift=0.0;
+	m_tile_size=512;
+
+	SG_ADD((CSGObject**)&m_kernel, "kernel", "The kernel", MS_NOT_AVAILABLE);
+	SG_ADD(&m_scale, "scale", "Scale of the kernel matrix", MS_NOT_AVAILABLE);
+	SG_ADD(&m_shift, "shift", "Shift of the diagonal", MS_NOT_AVAILABLE);
+	SG_ADD(&m_tile_size, "tile_size", "Number of rows and columns of a tile",
+		MS_NOT_AVAILABLE);
+}
+
+CKernelMatrixOperator::~CKernelMatrixOperator()
+{
+	SG_UNREF(m_kernel);
+
+	SG_GCDEBUG("%s destroyed (%p)\n", this->get_name(), this);
+}
+
+SGVector<float64_t> CKernelMatrixOperator::apply(SGVector<float64_t> b) const
+{
+	SGMatrix<float64_t> result=apply(SGMatrix<float64_t>(b.vector, b.vlen, 1,
+		false));
+
+	SGVector<float64_t> result_vector(b.vlen);
+	memcpy(result_vector.vector, result.matrix, sizeof(float64_t)*b.vlen);
+
+	return result_vector;
+}
+
+SGMatrix<float64_t> CKernelMatrixOperator::apply(SGMatrix<float64_t> b) const
+{
+	REQUIRE(m_kernel, "Kernel is NULL!\n");
+	REQUIRE(m_dimension==b.num_rows, "Number of rows of the operand (%d) "
+		"does not match the dimension (%d)!\n", b.num_rows, m_dimension);
+
+	SGMatrix<float64_t> result(b.num_rows, b.num_cols);
+	Map<MatrixXd> b_map(b.matrix, b.num_rows, b.num_cols);
+	Map<MatrixXd> result_map(result.matrix, result.num_rows, result.num_cols);
+	result_map=m_shift*b_map;
+
+	const index_t num_tiles=(m_dimension+m_tile_size-1)/m_tile_size;
+
+	// every thread owns a block of rows of the result, kernel values are
+	// only kept for the current tile
+#pragma omp parallel
+	{
+		MatrixXd tile(m_tile_size, m_tile_size);
+
+#pragma omp for schedule(dynamic)
+		for (index_t r=0; r<num_tiles; ++r)
+		{
+			const index_t row_start=r*m_tile_size;
+			const index_t num_rows=CMath::min(m_tile_size, m_dimension-row_start);
+
+			for (index_t c=0; c<num_tiles; ++c)
+			{
+				const index_t col_start=c*m_tile_size;
+				const index_t num_cols=CMath::min(m_tile_size,
+					m_dimension-col_start);
+
+				for (index_t j=0; j<num_cols; ++j)
+				{
+					for (index_t i=0; i<num_rows; ++i)
+						tile(i,j)=m_kernel->kernel(row_start+i, col_start+j);
+				}
+
+				result_map.middleRows(row_start, num_rows)+=m_scale*
+					tile.topLeftCorner(num_rows, num_cols)*
+					b_map.middleRows(col_start, num_cols);
+			}
+		}
+	}
+
+	return result;
+}
+
+SGVector<float64_t> CKernelMatrixOperator::get_diagonal() const
+{
+	REQUIRE(m_kernel, "Kernel is NULL!\n");
+
+	SGVector<float64_t> diag(m_dimension);
+
+#pragma omp parallel for
+	for (index_t i=0; i<m_dimension; ++i)
+		diag[i]=m_scale*m_kernel->kernel(i, i)+m_shift;
+
+	return diag;
+}
+
+SGVector<float64_t> CKernelMatrixOperator::get_kernel_column(index_t j) const
+{
+	REQUIRE(m_kernel, "Kernel is NULL!\n");
+	REQUIRE(j>=0 && j<m_dimension, "Column index (%d) out of bounds!\n", j);
+
+	SGVector<float64_t> col(m_dimension);
+
+#pragma omp parallel for
+	for (index_t i=0; i<m_dimension; ++i)
+		col[i]=m_scale*m_kernel->kernel(i, j);
+
+	return col;
+}
+
+CKernel* CKernelMatrixOperator::get_kernel() const
+{
+	SG_REF(m_kernel);
+	return m_kernel;
+}
+
+}
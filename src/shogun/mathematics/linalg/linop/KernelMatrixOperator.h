@@ -0,0 +1,107 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef KERNEL_MATRIX_OPERATOR_H_
+#define KERNEL_MATRIX_OPERATOR_H_
+
+#include <shogun/lib/config.h>
+
+#include <shogun/mathematics/linalg/linop/LinearOperator.h>
+
+namespace shogun
+{
+template<class T> class SGVector;
+template<class T> class SGMatrix;
+class CKernel;
+
+/** @brief Class that represents the linear operator
+ * \f$A=sK+dI\f$ of a kernel matrix \f$K\f$ without storing it.
+ *
+ * The kernel has to be initialized with the same features on both sides.
+ * Its values are computed on the fly in square tiles of the given size,
+ * which are split among all threads and multiplied with the operand.
+ * Applying the operator therefore costs \f$O(n^2)\f$ kernel evaluations
+ * but only needs memory for one tile per thread.
+ */
+class CKernelMatrixOperator : public CLinearOperator<float64_t>
+{
+public:
+	/** default constructor */
+	CKernelMatrixOperator();
+
+	/**
+	 * constructor
+	 *
+	 * @param kernel kernel initialized with the same features on both sides
+	 * @param scale scale \f$s\f$ of the kernel matrix
+	 * @param shift shift \f$d\f$ added to the diagonal
+	 * @param tile_size number of rows and columns of a tile
+	 */
+	CKernelMatrixOperator(CKernel* kernel, float64_t scale=1.0,
+		float64_t shift=0.0, index_t tile_size=512);
+
+	/** destructor */
+	virtual ~CKernelMatrixOperator();
+
+	/**
+	 * method that applies the operator to a vector
+	 *
+	 * @param b the vector to which the linear operator applies
+	 * @return the result vector
+	 */
+	virtual SGVector<float64_t> apply(SGVector<float64_t> b) const;
+
+	/**
+	 * method that applies the operator to all columns of a matrix at once.
+	 * Every kernel value is computed only once for all columns.
+	 *
+	 * @param b the matrix to which the linear operator applies
+	 * @return the result matrix
+	 */
+	SGMatrix<float64_t> apply(SGMatrix<float64_t> b) const;
+
+	/** @return the main diagonal of the operator */
+	SGVector<float64_t> get_diagonal() const;
+
+	/**
+	 * method that computes a column of the scaled kernel matrix \f$sK\f$,
+	 * without the shift
+	 *
+	 * @param j index of the column
+	 * @return the column
+	 */
+	SGVector<float64_t> get_kernel_column(index_t j) const;
+
+	/** @return the kernel */
+	CKernel* get_kernel() const;
+
+	/** @return object name */
+	virtual const char* get_name() const
+	{
+		return "KernelMatrixOperator";
+	}
+
+private:
+	/** the kernel */
+	CKernel* m_kernel;
+
+	/** scale of the kernel matrix */
+	float64_t m_scale;
+
+	/** shift of the diagonal */
+	float64_t m_shift;
+
+	/** number of rows and columns of a tile */
+	index_t m_tile_size;
+
+	/** initialize with default values and register params */
+	void init();
+};
+
+}
+
+#endif // KERNEL_MATRIX_OPERATOR_H_
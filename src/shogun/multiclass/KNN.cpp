@@ -15,6 +15,7 @@
 #include <shogun/labels/Labels.h>
 #include <shogun/labels/MulticlassLabels.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/KeyIndexSort.h>
 #include <shogun/lib/Signal.h>
 #include <shogun/lib/JLCoverTree.h>
 #include <shogun/lib/Time.h>
@@ -145,8 +146,8 @@ SGMatrix<index_t> CKNN::nearest_neighbors()
 		for (int32_t j=0; j<m_train_labels.vlen; j++)
 			train_idxs[j]=j;
 
-		//sort the distance vector between test example i and all train examples
-		CMath::qsort_index(dists, train_idxs, m_train_labels.vlen);
+		//sort the k smallest distances between test example i and all train examples
+		CKeyIndexSort::sort_smallest(dists, train_idxs, m_train_labels.vlen, m_k);
 
 #ifdef DEBUG_KNN
 		SG_PRINT("\nQuick sort query %d\n", i)
@@ -475,7 +476,7 @@ SGMatrix<int32_t> CKNN::classify_for_multiple_k()
 			}
 
 			// Now we get the indices to the neighbors sorted by distance
-			CMath::qsort_index(dists, train_lab, m_k);
+			CKeyIndexSort::sort(dists, train_lab, m_k);
 
 			choose_class_for_multiple_k(output+res[i][0].m_index, classes,
 					train_lab, num_lab);
@@ -505,7 +506,7 @@ SGMatrix<int32_t> CKNN::classify_for_multiple_k()
 				train_lab[j] = m_train_labels[ NN(j,i) ];
 				dists[j] = distance->distance(i, NN(j,i));
 			}
-			CMath::qsort_index(dists, train_lab, m_k);
+			CKeyIndexSort::sort(dists, train_lab, m_k);
 
 			choose_class_for_multiple_k(output+i, classes, train_lab, num_lab);
 		}
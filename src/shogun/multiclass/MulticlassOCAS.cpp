@@ -14,6 +14,7 @@
 #ifdef USE_GPL_SHOGUN
 #include <shogun/multiclass/MulticlassOneVsRestStrategy.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/KeyIndexSort.h>
 #include <shogun/labels/MulticlassLabels.h>
 
 using namespace shogun;
@@ -260,7 +261,7 @@ int CMulticlassOCAS::msvm_full_compute_output(float64_t *output, void* user_data
 
 int CMulticlassOCAS::msvm_sort_data(float64_t* vals, float64_t* data, uint32_t size)
 {
-	CMath::qsort_index(vals, data, size);
+	CKeyIndexSort::sort(vals, data, size);
 	return 0;
 }
 
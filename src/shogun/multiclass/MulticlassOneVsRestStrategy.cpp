@@ -12,6 +12,7 @@
 #include <shogun/labels/BinaryLabels.h>
 #include <shogun/labels/MulticlassLabels.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/KeyIndexSort.h>
 
 using namespace shogun;
 
@@ -58,7 +59,7 @@ SGVector<index_t> CMulticlassOneVsRestStrategy::decide_label_multiple_output(SGV
 		outputs_[i] = outputs[i];
 		indices_[i] = i;
 	}
-	CMath::qsort_backward_index(outputs_,indices_,outputs.vlen);
+	CKeyIndexSort::sort_largest(outputs_,indices_,outputs.vlen,n_outputs);
 	SGVector<index_t> result(n_outputs);
 	for (int32_t i=0; i<n_outputs; i++)
 		result[i] = indices_[i];
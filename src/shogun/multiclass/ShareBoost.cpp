@@ -138,11 +138,16 @@ void CShareBoost::compute_pred(const float64_t *W)
 }
 
 void CShareBoost::compute_rho()
+{
+	compute_rho(0, m_rho.num_cols);
+}
+
+void CShareBoost::compute_rho(int32_t begin, int32_t end)
 {
 	CMulticlassLabels *lab = dynamic_cast<CMulticlassLabels *>(m_labels);
 	for (int32_t i=0; i < m_rho.num_rows; ++i)
 	{ // i loop classes
-		for (int32_t j=0; j < m_rho.num_cols; ++j)
+		for (int32_t j=begin; j < end; ++j)
 		{ // j loop samples
 			int32_t label = lab->get_int_label(j);
 
@@ -151,7 +156,7 @@ void CShareBoost::compute_rho()
 	}
 
 	// normalize
-	for (int32_t j=0; j < m_rho.num_cols; ++j)
+	for (int32_t j=begin; j < end; ++j)
 	{
 		m_rho_norm[j] = 0;
 		for (int32_t i=0; i < m_rho.num_rows; ++i)
@@ -57,6 +57,7 @@ public:
 	SGVector<int32_t> get_activeset();
 
 	friend class ShareBoostOptimizer;
+	friend class ShareBoostCostFunction;
 protected:
 
 	/** train machine */
@@ -66,6 +67,7 @@ private:
 	void init_sb_params(); ///< init machine parameters
 
 	void compute_rho(); ///< compute the rho matrix
+	void compute_rho(int32_t begin, int32_t end); ///< compute the columns [begin,end) of the rho matrix
 	int32_t choose_feature(); ///< choose next feature greedily
 	void optimize_coefficients(); ///< optimize coefficients with gradient descent
 	void compute_pred(); ///< compute predictions on training data, according to W in m_machines
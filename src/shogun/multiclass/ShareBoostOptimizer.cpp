@@ -28,8 +28,15 @@ void ShareBoostOptimizer::optimize()
 
 	lbfgs_progress_t progress = m_verbose ? &ShareBoostOptimizer::lbfgs_progress : NULL;
 
+	// the objective is a sum over the training examples, evaluated in
+	// parallel shards
+	m_cost_function = new ShareBoostCostFunction(m_sb);
+	SG_REF(m_cost_function);
+
 	lbfgs(N, W, &objval, &ShareBoostOptimizer::lbfgs_evaluate, progress, this, &param);
 
+	SG_UNREF(m_cost_function);
+
 	int32_t w_len = m_sb->m_activeset.vlen;
 	for (int32_t i=0; i < m_sb->m_multiclass_strategy->get_num_classes(); ++i)
 	{
@@ -48,42 +55,54 @@ float64_t ShareBoostOptimizer::lbfgs_evaluate(void *userdata, const float64_t *W
 {
 	ShareBoostOptimizer *optimizer = static_cast<ShareBoostOptimizer *>(userdata);
 
-	optimizer->m_sb->compute_pred(W);
-	optimizer->m_sb->compute_rho();
+	optimizer->m_cost_function->set_variable(
+			SGVector<float64_t>(const_cast<float64_t *>(W), n, false));
+	return optimizer->m_cost_function->evaluate(SGVector<float64_t>(grad, n, false));
+}
 
-	int32_t m = optimizer->m_sb->m_activeset.vlen;
-	int32_t k = optimizer->m_sb->m_multiclass_strategy->get_num_classes();
+void ShareBoostCostFunction::begin_evaluation()
+{
+	m_sb->compute_pred(m_W.vector);
+}
 
-	SGMatrix<float64_t> fea = optimizer->m_sb->m_fea;
-	CMulticlassLabels *lab = dynamic_cast<CMulticlassLabels *>(optimizer->m_sb->m_labels);
+float64_t ShareBoostCostFunction::evaluate_shard(index_t begin, index_t end,
+		SGVector<float64_t> gradient)
+{
+	m_sb->compute_rho(begin, end);
+
+	int32_t m = m_sb->m_activeset.vlen;
+	int32_t k = m_sb->m_multiclass_strategy->get_num_classes();
 
-	// compute gradient
-	for (int32_t i=0; i < m; ++i)
+	const SGMatrix<float64_t> &fea = m_sb->m_fea;
+	CMulticlassLabels *lab = dynamic_cast<CMulticlassLabels *>(m_sb->m_labels);
+
+	float64_t objval = 0;
+	for (int32_t ii=begin; ii < end; ++ii)
 	{
+		objval += CMath::log(m_sb->m_rho_norm[ii]);
+
+		int32_t label = lab->get_int_label(ii);
 		for (int32_t j=0; j < k; ++j)
 		{
-			int32_t idx = j*m + i;
-			float64_t g=0;
-			for (int32_t ii=0; ii < fea.num_cols; ++ii)
-				g += fea(optimizer->m_sb->m_activeset[i], ii) *
-					(optimizer->m_sb->m_rho(j,ii)/optimizer->m_sb->m_rho_norm[ii] -
-					 (j == lab->get_int_label(ii)));
-			g /= fea.num_cols;
-			grad[idx] = g;
+			float64_t coef = m_sb->m_rho(j,ii)/m_sb->m_rho_norm[ii] - (j == label);
+			for (int32_t i=0; i < m; ++i)
+				gradient[j*m + i] += fea(m_sb->m_activeset[i], ii) * coef;
 		}
 	}
 
-	// compute objective function
-	float64_t objval = 0;
-	for (int32_t ii=0; ii < fea.num_cols; ++ii)
-	{
-		objval += CMath::log(optimizer->m_sb->m_rho_norm[ii]);
-	}
-	objval /= fea.num_cols;
-
 	return objval;
 }
 
+float64_t ShareBoostCostFunction::end_evaluation(float64_t cost,
+		SGVector<float64_t> gradient)
+{
+	int32_t n = m_sb->m_fea.num_cols;
+	for (int32_t i=0; i < gradient.vlen; ++i)
+		gradient[i] /= n;
+
+	return cost / n;
+}
+
 int ShareBoostOptimizer::lbfgs_progress(
 		void *instance,
 		const float64_t *x,
@@ -14,17 +14,59 @@
 #include <shogun/lib/config.h>
 
 #include <shogun/multiclass/ShareBoost.h>
+#include <shogun/optimization/FirstOrderShardedCostFunction.h>
 
 namespace shogun
 {
 
+/** The ShareBoost objective for the coefficients of the active set, a sum
+ * over the training examples that is evaluated in parallel shards
+ */
+class ShareBoostCostFunction: public FirstOrderShardedCostFunction
+{
+public:
+	/** constructor */
+	ShareBoostCostFunction(CShareBoost *sb)
+		:FirstOrderShardedCostFunction(), m_sb(sb) { SG_REF(m_sb); }
+	/** destructor */
+	virtual ~ShareBoostCostFunction() { SG_UNREF(m_sb); }
+
+	/** set the coefficients to evaluate the objective at */
+	void set_variable(SGVector<float64_t> W) { m_W = W; }
+
+	/** @return coefficients */
+	virtual SGVector<float64_t> obtain_variable_reference() { return m_W; }
+
+	/** @return object name */
+	virtual const char* get_name() const { return "ShareBoostCostFunction"; }
+
+protected:
+	/** @return number of training examples */
+	virtual index_t get_num_terms() { return m_sb->m_fea.num_cols; }
+
+	/** compute predictions for the coefficients */
+	virtual void begin_evaluation();
+
+	/** objective and gradient of the examples [begin,end) */
+	virtual float64_t evaluate_shard(index_t begin, index_t end,
+		SGVector<float64_t> gradient);
+
+	/** average over the examples */
+	virtual float64_t end_evaluation(float64_t cost,
+		SGVector<float64_t> gradient);
+
+private:
+	CShareBoost *m_sb;
+	SGVector<float64_t> m_W;
+};
+
 /** Utility for ShareBoost to handle optimization */
 class ShareBoostOptimizer
 {
 public:
 	/** constructor */
 	ShareBoostOptimizer(CShareBoost *sb, bool verbose=false)
-		:m_sb(sb), m_verbose(verbose) { SG_REF(m_sb); }
+		:m_sb(sb), m_verbose(verbose), m_cost_function(NULL) { SG_REF(m_sb); }
 	/** destructor */
 	~ShareBoostOptimizer() { SG_UNREF(m_sb); }
 
@@ -50,6 +92,7 @@ private:
 
 	CShareBoost *m_sb;
 	bool m_verbose;
+	ShareBoostCostFunction *m_cost_function;
 };
 
 } /* shogun */
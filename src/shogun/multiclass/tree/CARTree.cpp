@@ -29,6 +29,7 @@
  */
 
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/KeyIndexSort.h>
 #include <shogun/multiclass/tree/CARTree.h>
 #include <shogun/mathematics/linalg/linalg.h>
 #include <shogun/mathematics/eigen3.h>
@@ -244,6 +245,12 @@ void CCARTree::set_label_epsilon(float64_t ep)
 	m_label_epsilon=ep;
 }
 
+void CCARTree::set_random_seed(uint64_t seed)
+{
+	m_random_seed=seed;
+	m_random_seed_set=true;
+}
+
 bool CCARTree::train_machine(CFeatures* data)
 {
 	REQUIRE(data,"Data required for training\n")
@@ -276,6 +283,10 @@ bool CCARTree::train_machine(CFeatures* data)
 		m_nominal.fill_vector(m_nominal.vector,m_nominal.vlen,false);
 	}
 
+	// the random numbers only depend on the seed, not on other trees
+	// trained in parallel
+	m_rng.set_stream(m_random_seed_set ? m_random_seed : CMath::random(), 0);
+
 	set_root(CARTtrain(data,m_weights,m_labels,0));
 
 	if (m_apply_cv_pruning)
@@ -310,7 +321,7 @@ void CCARTree::pre_sort_features(CFeatures* data, SGMatrix<float64_t>& sorted_fe
 
 	#pragma omp parallel for
 	for(int32_t i=0; i<sorted_feats.num_cols; i++)
-		CMath::qsort_index(sorted_feats.get_column_vector(i), sorted_indices.get_column_vector(i), sorted_feats.num_rows);
+		CKeyIndexSort::sort(sorted_feats.get_column_vector(i), sorted_indices.get_column_vector(i), sorted_feats.num_rows);
 
 }
 
@@ -573,7 +584,7 @@ int32_t CCARTree::compute_best_attribute(const SGMatrix<float64_t>& mat, const S
 	if (subset_size)
 	{
 		num_feats=subset_size;
-		CMath::permute(idx);
+		m_rng.permute(idx.vector, idx.vlen);
 	}
 
 	float64_t max_gain=MIN_SPLIT_GAIN;
@@ -633,7 +644,7 @@ int32_t CCARTree::compute_best_attribute(const SGMatrix<float64_t>& mat, const S
 
 			// O(N*logN)
 			sorted_args.range_fill();
-			CMath::qsort_index(feats.vector, sorted_args.vector, feats.size());
+			CKeyIndexSort::sort(feats.vector, sorted_args.vector, feats.size());
 		}
 		int32_t n_nm_vecs=feats.vlen;
 		// number of non-missing vecs
@@ -1191,7 +1202,8 @@ void CCARTree::prune_by_cross_validation(CDenseFeatures<float64_t>* data, int32_
 
 	// divide data into V folds randomly
 	SGVector<int32_t> subid(num_vecs);
-	subid.random_vector(subid.vector,subid.vlen,0,folds-1);
+	for (int32_t i=0;i<num_vecs;i++)
+		subid[i]=m_rng.random(0,folds-1);
 
 	// for each fold subset
 	CDynamicArray<float64_t>* r_cv=new CDynamicArray<float64_t>();
@@ -1504,6 +1516,8 @@ void CCARTree::init()
 	m_max_depth=0;
 	m_min_node_size=0;
 	m_label_epsilon=1e-7;
+	m_random_seed=0;
+	m_random_seed_set=false;
 
 	SG_ADD(&m_pre_sort,"m_pre_sort","presort", MS_NOT_AVAILABLE);
 	SG_ADD(&m_sorted_features,"m_sorted_features", "sorted feats", MS_NOT_AVAILABLE);
@@ -1517,4 +1531,6 @@ void CCARTree::init()
 	SG_ADD(&m_max_depth,"m_max_depth","max allowed tree depth",MS_NOT_AVAILABLE)
 	SG_ADD(&m_min_node_size,"m_min_node_size","min allowed node size",MS_NOT_AVAILABLE)
 	SG_ADD(&m_label_epsilon,"m_label_epsilon","epsilon for labels",MS_NOT_AVAILABLE)
+	SG_ADD(&m_random_seed,"m_random_seed","seed of the random stream",MS_NOT_AVAILABLE)
+	SG_ADD(&m_random_seed_set,"m_random_seed_set","random seed set",MS_NOT_AVAILABLE)
 }
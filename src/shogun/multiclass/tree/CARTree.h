@@ -37,6 +37,7 @@
 #include <shogun/multiclass/tree/TreeMachine.h>
 #include <shogun/multiclass/tree/CARTreeNodeData.h>
 #include <shogun/features/DenseFeatures.h>
+#include <shogun/mathematics/RandomStream.h>
 
 namespace shogun
 {
@@ -225,6 +226,14 @@ public:
 	 */
 	 void set_label_epsilon(float64_t epsilon);
 
+	/** set the seed of the random stream used while training, e.g. for the
+	 * random feature subsets of CRandomCARTree. If it is not set, a seed is
+	 * drawn from the global generator at the start of every training.
+	 *
+	 * @param seed seed of the random stream
+	 */
+	void set_random_seed(uint64_t seed);
+
 	void pre_sort_features(CFeatures* data, SGMatrix<float64_t>& sorted_feats, SGMatrix<index_t>& sorted_indices);
 	 
 	void set_sorted_features(SGMatrix<float64_t>& sorted_feats, SGMatrix<index_t>& sorted_indices);
@@ -422,6 +431,15 @@ protected:
 	/** equality range for regression labels */
 	float64_t m_label_epsilon;
 
+	/** seed of the random stream used while training */
+	uint64_t m_random_seed;
+
+	/** whether m_random_seed was set explicitly */
+	bool m_random_seed_set;
+
+	/** random stream used while training */
+	RandomStream m_rng;
+
 	/** vector depicting whether various feature dimensions are nominal or not **/
 	SGVector<bool> m_nominal;
 
@@ -145,8 +145,8 @@ void CConvolutionalFeatureMap::compute_gradients(
 			for (int32_t j=0; j<batch_size; j++)
 			{
 				activation_gradients(i+m_row_offset,j) *=
-					activation_gradients(i+m_row_offset,j) *
-					(1.0-activation_gradients(i+m_row_offset,j));
+					activations(i+m_row_offset,j) *
+					(1.0-activations(i+m_row_offset,j));
 			}
 		}
 	}
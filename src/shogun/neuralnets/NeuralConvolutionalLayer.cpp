@@ -33,6 +33,7 @@
 
 #include <shogun/neuralnets/NeuralConvolutionalLayer.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/eigen3.h>
 #include <shogun/lib/SGVector.h>
 
 using namespace shogun;
@@ -158,6 +159,13 @@ void CNeuralConvolutionalLayer::compute_activations(
 		SGVector<float64_t> parameters,
 		CDynamicObjectArray* layers)
 {
+	if (m_use_im2col && (autoencoder_position==NLAP_NONE ||
+		(m_stride_x==1 && m_stride_y==1)))
+	{
+		compute_activations_im2col(parameters, layers);
+		return;
+	}
+
 	int32_t num_parameters_per_map =
 		1 + m_input_num_channels*(2*m_radius_x+1)*(2*m_radius_y+1);
 
@@ -209,6 +217,13 @@ void CNeuralConvolutionalLayer::compute_gradients(
 				m_convolution_output_gradients(m_max_indices(i,j),j) =
 					m_activation_gradients(i,j);
 
+	if (m_use_im2col && (autoencoder_position==NLAP_NONE ||
+		(m_stride_x==1 && m_stride_y==1)))
+	{
+		compute_gradients_im2col(parameters, layers, parameter_gradients);
+		return;
+	}
+
 	int32_t num_parameters_per_map =
 		1 + m_input_num_channels*(2*m_radius_x+1)*(2*m_radius_y+1);
 
@@ -266,6 +281,345 @@ void CNeuralConvolutionalLayer::enforce_max_norm(SGVector<float64_t> parameters,
 	}
 }
 
+void CNeuralConvolutionalLayer::compute_activations_im2col(
+		SGVector<float64_t> parameters,
+		CDynamicObjectArray* layers)
+{
+	typedef Eigen::Map<Eigen::MatrixXd> EMatrix;
+	typedef Eigen::Map<Eigen::MatrixXd, 0, Eigen::OuterStride<> > EParamsMatrix;
+
+	int32_t filter_size = (2*m_radius_x+1)*(2*m_radius_y+1);
+	int32_t patch_size = m_input_num_channels*filter_size;
+	int32_t num_parameters_per_map = 1 + patch_size;
+
+	int32_t conv_width = m_input_width/m_stride_x;
+	int32_t conv_height = m_input_height/m_stride_y;
+	int32_t conv_num_neurons = conv_width*conv_height;
+	int32_t map_num_neurons = m_width*m_height;
+
+	float64_t** channels = SG_MALLOC(float64_t*, m_input_num_channels);
+	int32_t* channels_num_rows = SG_MALLOC(int32_t, m_input_num_channels);
+	get_input_channels(layers, channels, NULL, channels_num_rows);
+
+	// column m holds the filters of map m, the biases are skipped
+	EParamsMatrix W(parameters.vector+1, patch_size, m_num_maps,
+		Eigen::OuterStride<>(num_parameters_per_map));
+
+	int32_t num_blocks = CMath::min(parallel->get_num_threads(), m_batch_size);
+
+	#pragma omp parallel for num_threads(num_blocks)
+	for (int32_t t=0; t<num_blocks; t++)
+	{
+		SGMatrix<float64_t> patches(conv_num_neurons, patch_size);
+		EMatrix P(patches.matrix, conv_num_neurons, patch_size);
+
+		int32_t begin = (int64_t)t*m_batch_size/num_blocks;
+		int32_t end = (int64_t)(t+1)*m_batch_size/num_blocks;
+		for (int32_t j=begin; j<end; j++)
+		{
+			im2col(channels, channels_num_rows, j, patches);
+
+			// column m is the output image of map m
+			float64_t* conv = m_convolution_output.matrix +
+				(int64_t)j*m_convolution_output.num_rows;
+			EMatrix C(conv, conv_num_neurons, m_num_maps);
+			C.noalias() = P*W;
+
+			for (int32_t m=0; m<m_num_maps; m++)
+			{
+				float64_t bias = parameters[m*num_parameters_per_map];
+				float64_t* image = conv + m*conv_num_neurons;
+
+				if (m_activation_function==CMAF_LOGISTIC)
+				{
+					for (int32_t i=0; i<conv_num_neurons; i++)
+						image[i] = 1.0/(1.0+CMath::exp(-1.0*(image[i]+bias)));
+				}
+				else if (m_activation_function==CMAF_RECTIFIED_LINEAR)
+				{
+					for (int32_t i=0; i<conv_num_neurons; i++)
+						image[i] = CMath::max<float64_t>(0, image[i]+bias);
+				}
+				else
+				{
+					for (int32_t i=0; i<conv_num_neurons; i++)
+						image[i] += bias;
+				}
+
+				// max pooling, same as CConvolutionalFeatureMap::pool_activations()
+				float64_t* result = m_activations.matrix +
+					(int64_t)j*m_num_neurons + m*map_num_neurons;
+				float64_t* indices = m_max_indices.matrix +
+					(int64_t)j*m_num_neurons + m*map_num_neurons;
+
+				if (autoencoder_position != NLAP_NONE)
+				{
+					for (int32_t i=0; i<map_num_neurons; i++)
+					{
+						result[i] = 0;
+						indices[i] = -1.0;
+					}
+				}
+
+				for (int32_t x=0; x+m_pooling_width<=conv_width; x+=m_pooling_width)
+				{
+					for (int32_t y=0; y+m_pooling_height<=conv_height; y+=m_pooling_height)
+					{
+						float64_t max = image[y+x*conv_height];
+						int32_t max_index = y+x*conv_height;
+
+						for (int32_t x1=x; x1<x+m_pooling_width; x1++)
+						{
+							for (int32_t y1=y; y1<y+m_pooling_height; y1++)
+							{
+								if (image[y1+x1*conv_height] > max)
+								{
+									max = image[y1+x1*conv_height];
+									max_index = y1+x1*conv_height;
+								}
+							}
+						}
+
+						int32_t k = autoencoder_position == NLAP_NONE ?
+							y/m_pooling_height + (x/m_pooling_width)*m_height :
+							y + x*m_height;
+						result[k] = max;
+						indices[k] = m*conv_num_neurons + max_index;
+					}
+				}
+			}
+		}
+	}
+
+	SG_FREE(channels);
+	SG_FREE(channels_num_rows);
+}
+
+void CNeuralConvolutionalLayer::compute_gradients_im2col(
+		SGVector<float64_t> parameters,
+		CDynamicObjectArray* layers,
+		SGVector<float64_t> parameter_gradients)
+{
+	typedef Eigen::Map<Eigen::MatrixXd> EMatrix;
+	typedef Eigen::Map<Eigen::VectorXd> EVector;
+	typedef Eigen::Map<Eigen::MatrixXd, 0, Eigen::OuterStride<> > EParamsMatrix;
+
+	int32_t filter_size = (2*m_radius_x+1)*(2*m_radius_y+1);
+	int32_t patch_size = m_input_num_channels*filter_size;
+	int32_t num_parameters_per_map = 1 + patch_size;
+
+	int32_t conv_num_neurons =
+		(m_input_width/m_stride_x)*(m_input_height/m_stride_y);
+
+	float64_t** channels = SG_MALLOC(float64_t*, m_input_num_channels);
+	float64_t** channels_gradients = SG_MALLOC(float64_t*, m_input_num_channels);
+	int32_t* channels_num_rows = SG_MALLOC(int32_t, m_input_num_channels);
+	get_input_channels(layers, channels, channels_gradients, channels_num_rows);
+
+	bool need_input_gradients = false;
+	for (int32_t c=0; c<m_input_num_channels; c++)
+		if (channels_gradients[c])
+			need_input_gradients = true;
+
+	EParamsMatrix W(parameters.vector+1, patch_size, m_num_maps,
+		Eigen::OuterStride<>(num_parameters_per_map));
+
+	// each block of the batch accumulates its own filter gradients (first
+	// patch_size*m_num_maps rows) and bias gradients (last m_num_maps rows),
+	// they are summed up in order afterwards
+	int32_t num_blocks = CMath::min(parallel->get_num_threads(), m_batch_size);
+	SGMatrix<float64_t> block_gradients(
+		(patch_size+1)*m_num_maps, num_blocks);
+
+	#pragma omp parallel for num_threads(num_blocks)
+	for (int32_t t=0; t<num_blocks; t++)
+	{
+		SGMatrix<float64_t> patches(conv_num_neurons, patch_size);
+		EMatrix P(patches.matrix, conv_num_neurons, patch_size);
+
+		float64_t* gradients = block_gradients.get_column_vector(t);
+		EMatrix WG(gradients, patch_size, m_num_maps);
+		EVector BG(gradients+patch_size*m_num_maps, m_num_maps);
+		WG.setZero();
+		BG.setZero();
+
+		int32_t begin = (int64_t)t*m_batch_size/num_blocks;
+		int32_t end = (int64_t)(t+1)*m_batch_size/num_blocks;
+		for (int32_t j=begin; j<end; j++)
+		{
+			float64_t* conv = m_convolution_output.matrix +
+				(int64_t)j*m_convolution_output.num_rows;
+			float64_t* conv_gradients = m_convolution_output_gradients.matrix +
+				(int64_t)j*m_convolution_output_gradients.num_rows;
+			int32_t len = conv_num_neurons*m_num_maps;
+
+			if (m_activation_function==CMAF_LOGISTIC)
+			{
+				for (int32_t i=0; i<len; i++)
+					conv_gradients[i] *= conv[i]*(1.0-conv[i]);
+			}
+			else if (m_activation_function==CMAF_RECTIFIED_LINEAR)
+			{
+				for (int32_t i=0; i<len; i++)
+					if (conv[i]==0)
+						conv_gradients[i] = 0;
+			}
+
+			EMatrix G(conv_gradients, conv_num_neurons, m_num_maps);
+			BG += G.colwise().sum().transpose();
+
+			im2col(channels, channels_num_rows, j, patches);
+			WG.noalias() += P.transpose()*G;
+
+			if (need_input_gradients)
+			{
+				P.noalias() = G*W.transpose();
+				col2im(patches, channels_gradients, channels_num_rows, j);
+			}
+		}
+	}
+
+	for (int32_t m=0; m<m_num_maps; m++)
+	{
+		float64_t* map_gradients =
+			parameter_gradients.vector+m*num_parameters_per_map;
+
+		map_gradients[0] = 0;
+		for (int32_t t=0; t<num_blocks; t++)
+			map_gradients[0] += block_gradients(patch_size*m_num_maps+m, t);
+
+		for (int32_t k=0; k<patch_size; k++)
+		{
+			map_gradients[k+1] = 0;
+			for (int32_t t=0; t<num_blocks; t++)
+				map_gradients[k+1] += block_gradients(k+m*patch_size, t);
+		}
+	}
+
+	SG_FREE(channels);
+	SG_FREE(channels_gradients);
+	SG_FREE(channels_num_rows);
+}
+
+void CNeuralConvolutionalLayer::im2col(float64_t** channels,
+		int32_t* channels_num_rows, int32_t column,
+		SGMatrix<float64_t> patches)
+{
+	int32_t filter_width = 2*m_radius_x+1;
+	int32_t filter_height = 2*m_radius_y+1;
+	int32_t conv_width = m_input_width/m_stride_x;
+	int32_t conv_height = m_input_height/m_stride_y;
+
+	for (int32_t c=0; c<m_input_num_channels; c++)
+	{
+		float64_t* image = channels[c] + (int64_t)column*channels_num_rows[c];
+
+		for (int32_t wx=0; wx<filter_width; wx++)
+		{
+			for (int32_t wy=0; wy<filter_height; wy++)
+			{
+				// the filter is flipped, i.e position (wy,wx) multiplies the
+				// input pixel at offset (radius_y-wy,radius_x-wx)
+				float64_t* patch_column = patches.matrix + (int64_t)patches.num_rows*
+					(c*filter_width*filter_height + wy + wx*filter_height);
+
+				for (int32_t x=0; x<conv_width; x++)
+				{
+					int32_t x1 = x*m_stride_x + m_radius_x - wx;
+					float64_t* result = patch_column + x*conv_height;
+
+					if (x1<0 || x1>=m_input_width)
+					{
+						for (int32_t y=0; y<conv_height; y++)
+							result[y] = 0;
+						continue;
+					}
+
+					float64_t* input_column = image + x1*m_input_height;
+					for (int32_t y=0; y<conv_height; y++)
+					{
+						int32_t y1 = y*m_stride_y + m_radius_y - wy;
+						result[y] = (y1>=0 && y1<m_input_height) ?
+							input_column[y1] : 0;
+					}
+				}
+			}
+		}
+	}
+}
+
+void CNeuralConvolutionalLayer::col2im(SGMatrix<float64_t> patches,
+		float64_t** channels, int32_t* channels_num_rows, int32_t column)
+{
+	int32_t filter_width = 2*m_radius_x+1;
+	int32_t filter_height = 2*m_radius_y+1;
+	int32_t conv_width = m_input_width/m_stride_x;
+	int32_t conv_height = m_input_height/m_stride_y;
+
+	for (int32_t c=0; c<m_input_num_channels; c++)
+	{
+		if (!channels[c])
+			continue;
+
+		float64_t* image = channels[c] + (int64_t)column*channels_num_rows[c];
+
+		for (int32_t wx=0; wx<filter_width; wx++)
+		{
+			for (int32_t wy=0; wy<filter_height; wy++)
+			{
+				float64_t* patch_column = patches.matrix + (int64_t)patches.num_rows*
+					(c*filter_width*filter_height + wy + wx*filter_height);
+
+				for (int32_t x=0; x<conv_width; x++)
+				{
+					int32_t x1 = x*m_stride_x + m_radius_x - wx;
+					if (x1<0 || x1>=m_input_width)
+						continue;
+
+					float64_t* values = patch_column + x*conv_height;
+					float64_t* input_column = image + x1*m_input_height;
+					for (int32_t y=0; y<conv_height; y++)
+					{
+						int32_t y1 = y*m_stride_y + m_radius_y - wy;
+						if (y1>=0 && y1<m_input_height)
+							input_column[y1] += values[y];
+					}
+				}
+			}
+		}
+	}
+}
+
+void CNeuralConvolutionalLayer::get_input_channels(CDynamicObjectArray* layers,
+		float64_t** activations, float64_t** activation_gradients,
+		int32_t* num_rows)
+{
+	int32_t input_num_neurons = m_input_width*m_input_height;
+
+	int32_t c = 0;
+	for (int32_t l=0; l<m_input_indices.vlen; l++)
+	{
+		CNeuralLayer* layer =
+			(CNeuralLayer*)layers->element(m_input_indices[l]);
+
+		int32_t num_maps = layer->get_num_neurons()/input_num_neurons;
+		for (int32_t m=0; m<num_maps; m++, c++)
+		{
+			activations[c] =
+				layer->get_activations().matrix + m*input_num_neurons;
+			num_rows[c] = layer->get_num_neurons();
+
+			if (activation_gradients)
+			{
+				activation_gradients[c] = layer->is_input() ? NULL :
+					layer->get_activation_gradients().matrix + m*input_num_neurons;
+			}
+		}
+
+		SG_UNREF(layer);
+	}
+}
+
 void CNeuralConvolutionalLayer::init()
 {
 	m_num_maps = 1;
@@ -280,6 +634,7 @@ void CNeuralConvolutionalLayer::init()
 	m_stride_y = 1;
 	m_initialization_mode = NORMAL;
 	m_activation_function = CMAF_IDENTITY;
+	m_use_im2col = true;
 
 	SG_ADD(&m_num_maps, "num_maps", "Number of maps", MS_NOT_AVAILABLE);
 	SG_ADD(&m_input_width, "input_width", "Input Width", MS_NOT_AVAILABLE);
@@ -304,4 +659,7 @@ void CNeuralConvolutionalLayer::init()
 
 	SG_ADD(&m_convolution_output_gradients, "convolution_output_gradients",
 		"Convolution Output Gradients", MS_NOT_AVAILABLE);
+
+	SG_ADD(&m_use_im2col, "use_im2col",
+		"Whether convolutions are computed as matrix products", MS_NOT_AVAILABLE);
 }
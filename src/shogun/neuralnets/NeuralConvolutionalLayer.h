@@ -71,6 +71,16 @@ enum EInitializationMode
  * sides
  *
  * The layer assumes that its input images are in column major format
+ *
+ * By default, the convolutions of all the feature maps are computed together
+ * by unfolding the input patches of each image into the rows of a matrix
+ * (im2col) and multiplying it with the matrix of all the filters. The bias,
+ * the activation function and the pooling are applied in the same pass over
+ * the result, and the images of a batch are split between the available
+ * threads. The direct per-map convolution of CConvolutionalFeatureMap can be
+ * selected with set_use_im2col(false) and serves as the reference
+ * implementation. For autoencoder layers with a stride larger than one the
+ * direct convolution is always used.
  */
 class CNeuralConvolutionalLayer : public CNeuralLayer
 {
@@ -207,8 +217,87 @@ public:
 	virtual void enforce_max_norm(SGVector<float64_t> parameters,
 			float64_t max_norm);
 
+	/** Sets whether the convolutions are computed as matrix products of
+	 * unfolded input patches (the default) or directly, map by map
+	 *
+	 * @param use_im2col true to use the matrix product formulation
+	 */
+	virtual void set_use_im2col(bool use_im2col)
+	{
+		m_use_im2col = use_im2col;
+	}
+
+	/** @return whether the convolutions are computed as matrix products */
+	virtual bool get_use_im2col() { return m_use_im2col; }
+
 	virtual const char* get_name() const { return "NeuralConvolutionalLayer"; }
 
+protected:
+	/** Computes the activations of all the maps as one matrix product per
+	 * image, see compute_activations()
+	 *
+	 * @param parameters Vector of size get_num_parameters()
+	 * @param layers Array of layers that form the network
+	 */
+	virtual void compute_activations_im2col(SGVector<float64_t> parameters,
+			CDynamicObjectArray* layers);
+
+	/** Computes the parameter and input gradients of all the maps from
+	 * m_convolution_output_gradients as matrix products, see
+	 * compute_gradients()
+	 *
+	 * @param parameters Vector of size get_num_parameters()
+	 * @param layers Array of layers that form the network
+	 * @param parameter_gradients Vector of size get_num_parameters()
+	 */
+	virtual void compute_gradients_im2col(SGVector<float64_t> parameters,
+			CDynamicObjectArray* layers,
+			SGVector<float64_t> parameter_gradients);
+
+	/** Copies the input patches of an image into the rows of a matrix. Row
+	 * i holds the patch seen by output pixel i, column
+	 * c*filter_size+y+x*filter_height holds input channel c at filter
+	 * position (y,x).
+	 *
+	 * @param channels Pointers to the first column of each input channel
+	 * @param channels_num_rows Number of rows of the activations matrix that
+	 * each channel is part of
+	 * @param column Index of the image in the batch
+	 * @param patches Matrix of size
+	 * num_output_pixels*(m_input_num_channels*filter_size)
+	 */
+	void im2col(float64_t** channels, int32_t* channels_num_rows,
+			int32_t column, SGMatrix<float64_t> patches);
+
+	/** Inverse of im2col(), adds every element of the patches matrix to the
+	 * input pixel it was taken from. Channels given as NULL are skipped.
+	 *
+	 * @param patches Matrix of size
+	 * num_output_pixels*(m_input_num_channels*filter_size)
+	 * @param channels Pointers to the first column of each input channel's
+	 * activation gradients
+	 * @param channels_num_rows Number of rows of the matrix that each channel
+	 * is part of
+	 * @param column Index of the image in the batch
+	 */
+	void col2im(SGMatrix<float64_t> patches, float64_t** channels,
+			int32_t* channels_num_rows, int32_t column);
+
+	/** Collects the input channels of the layer
+	 *
+	 * @param layers Array of layers that form the network
+	 * @param activations Array of size m_input_num_channels, filled with
+	 * pointers to each channel's activations
+	 * @param activation_gradients Array of size m_input_num_channels, filled
+	 * with pointers to each channel's activation gradients, NULL for input
+	 * layers. Ignored if NULL.
+	 * @param num_rows Array of size m_input_num_channels, filled with the
+	 * number of neurons of the layer that each channel belongs to
+	 */
+	void get_input_channels(CDynamicObjectArray* layers,
+			float64_t** activations, float64_t** activation_gradients,
+			int32_t* num_rows);
+
 private:
 	void init();
 
@@ -257,6 +346,9 @@ protected:
 
 	/** Parameters initialization mode */
 	EInitializationMode m_initialization_mode;
+
+	/** Whether the convolutions are computed as matrix products */
+	bool m_use_im2col;
 };
 
 }
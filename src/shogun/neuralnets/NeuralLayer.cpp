@@ -87,11 +87,22 @@ void CNeuralLayer::set_batch_size(int32_t batch_size)
 	}
 }
 
-void CNeuralLayer::dropout_activations()
+void CNeuralLayer::dropout_activations(RandomStream* streams)
 {
 	if (dropout_prop==0.0) return;
 
-	if (is_training)
+	if (is_training && streams)
+	{
+		for (int32_t j=0; j<m_batch_size; j++)
+		{
+			for (int32_t i=0; i<m_num_neurons; i++)
+			{
+				m_dropout_mask(i,j) = streams[j].random(0.0,1.0) >= dropout_prop;
+				m_activations(i,j) *= m_dropout_mask(i,j);
+			}
+		}
+	}
+	else if (is_training)
 	{
 		int32_t len = m_num_neurons*m_batch_size;
 		for (int32_t i=0; i<len; i++)
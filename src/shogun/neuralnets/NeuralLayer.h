@@ -39,6 +39,7 @@
 #include <shogun/lib/SGMatrix.h>
 #include <shogun/lib/SGVector.h>
 #include <shogun/lib/DynamicObjectArray.h>
+#include <shogun/mathematics/RandomStream.h>
 
 namespace shogun
 {
@@ -223,8 +224,12 @@ public:
 	 * (according to dropout_prop) and multiplies it into the activations,
 	 * otherwise, multiplies the activations by (1-dropout_prop) to compensate
 	 * for using dropout during training
+	 *
+	 * @param streams one random stream per column of the batch, which the
+	 * mask of that column is drawn from. If NULL, the global random number
+	 * generator is used
 	 */
-	virtual void dropout_activations();
+	virtual void dropout_activations(RandomStream* streams=NULL);
 
 	/** Computes
 	 * \f[ \frac{\lambda}{N} \sum_{k=0}^{N-1} \left \| J(x_k) \right \|^2_F \f]
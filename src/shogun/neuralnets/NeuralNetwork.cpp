@@ -286,6 +286,23 @@ bool CNeuralNetwork::train_gradient_descent(SGMatrix<float64_t> inputs,
 	bool continue_training = true;
 	float64_t alpha = m_gd_learning_rate;
 
+	// with more than one thread, each thread processes a contiguous block of
+	// every mini-batch using its own copy of the network's layers
+	int32_t num_threads = CMath::min(parallel->get_num_threads(),
+		m_gd_mini_batch_size);
+	CDynamicObjectArray* replicas = NULL;
+	SGMatrix<float64_t> replica_gradients;
+	if (num_threads > 1)
+	{
+		replicas = create_replicas(m_gd_mini_batch_size, num_threads);
+		replica_gradients = SGMatrix<float64_t>(n_param, num_threads);
+	}
+
+	// the dropout masks of every column of a mini-batch are drawn from a
+	// stream of its own, which the replicas share
+	if (m_dropout_hidden>0.0 || m_dropout_input>0.0)
+		m_dropout_streams = new RandomStream[m_gd_mini_batch_size];
+
 	for (int32_t i=0; continue_training; i++)
 	{
 		if (m_max_num_epochs!=0)
@@ -307,7 +324,19 @@ bool CNeuralNetwork::train_gradient_descent(SGMatrix<float64_t> inputs,
 			for (int32_t k=0; k<n_param; k++)
 				m_params[k] += m_gd_momentum*param_updates[k];
 
-			float64_t e = compute_gradients(inputs_batch, targets_batch, gradients);
+			if (m_dropout_streams)
+			{
+				uint64_t seed = CMath::random();
+				for (int32_t k=0; k<m_gd_mini_batch_size; k++)
+					m_dropout_streams[k].set_stream(seed, k);
+			}
+
+			float64_t e;
+			if (replicas)
+				e = compute_gradients_parallel(inputs_batch, targets_batch,
+					gradients, replicas, replica_gradients);
+			else
+				e = compute_gradients(inputs_batch, targets_batch, gradients);
 
 
 			for (int32_t k=0; k<m_num_layers; k++)
@@ -351,6 +380,10 @@ bool CNeuralNetwork::train_gradient_descent(SGMatrix<float64_t> inputs,
 		}
 	}
 
+	SG_UNREF(replicas);
+	delete[] m_dropout_streams;
+	m_dropout_streams = NULL;
+
 	return true;
 }
 
@@ -458,7 +491,7 @@ SGMatrix<float64_t> CNeuralNetwork::forward_propagate(
 		else
 			layer->compute_activations(get_section(m_params, i), m_layers);
 
-		layer->dropout_activations();
+		layer->dropout_activations(m_dropout_streams);
 	}
 
 	return get_layer(j)->get_activations();
@@ -482,6 +515,26 @@ float64_t CNeuralNetwork::compute_gradients(SGMatrix<float64_t> inputs,
 				SGMatrix<float64_t>(), m_layers, get_section(gradients,i));
 	}
 
+	add_regularization_gradients(gradients);
+
+	return compute_error(targets);
+}
+
+float64_t CNeuralNetwork::compute_error(SGMatrix<float64_t> targets)
+{
+	return get_layer(m_num_layers-1)->compute_error(targets)
+		+ compute_regularization_error();
+}
+
+float64_t CNeuralNetwork::compute_error(SGMatrix<float64_t> inputs,
+		SGMatrix<float64_t> targets)
+{
+	forward_propagate(inputs);
+	return compute_error(targets);
+}
+
+void CNeuralNetwork::add_regularization_gradients(SGVector<float64_t> gradients)
+{
 	// L2 regularization
 	if (m_l2_coefficient != 0.0)
 	{
@@ -512,13 +565,11 @@ float64_t CNeuralNetwork::compute_gradients(SGMatrix<float64_t> inputs,
 			get_layer(i)->enforce_max_norm(layer_params, m_max_norm);
 		}
 	}
-
-	return compute_error(targets);
 }
 
-float64_t CNeuralNetwork::compute_error(SGMatrix<float64_t> targets)
+float64_t CNeuralNetwork::compute_regularization_error()
 {
-	float64_t error = get_layer(m_num_layers-1)->compute_error(targets);
+	float64_t error = 0.0;
 
 	// L2 regularization
 	if (m_l2_coefficient != 0.0)
@@ -543,11 +594,96 @@ float64_t CNeuralNetwork::compute_error(SGMatrix<float64_t> targets)
 	return error;
 }
 
-float64_t CNeuralNetwork::compute_error(SGMatrix<float64_t> inputs,
-		SGMatrix<float64_t> targets)
+CDynamicObjectArray* CNeuralNetwork::create_replicas(int32_t batch_size,
+		int32_t num_replicas)
 {
-	forward_propagate(inputs);
-	return compute_error(targets);
+	CDynamicObjectArray* replicas = new CDynamicObjectArray(num_replicas);
+	SG_REF(replicas);
+
+	for (int32_t t=0; t<num_replicas; t++)
+	{
+		CNeuralNetwork* replica = (CNeuralNetwork*)clone();
+		REQUIRE(replica, "Failed to create a copy of %s for parallel training\n",
+			get_name());
+
+		// parameters are shared, only the layers' buffers are private
+		replica->m_params = m_params;
+		replica->m_l2_coefficient = 0.0;
+		replica->m_l1_coefficient = 0.0;
+		replica->m_max_norm = -1.0;
+
+		int32_t block_size = batch_size/num_replicas
+			+ (t < batch_size%num_replicas ? 1 : 0);
+		replica->set_batch_size(block_size);
+
+		replicas->append_element(replica);
+		SG_UNREF(replica);
+	}
+
+	return replicas;
+}
+
+float64_t CNeuralNetwork::compute_gradients_parallel(SGMatrix<float64_t> inputs,
+		SGMatrix<float64_t> targets, SGVector<float64_t> gradients,
+		CDynamicObjectArray* replicas, SGMatrix<float64_t> replica_gradients)
+{
+	int32_t num_replicas = replicas->get_num_elements();
+	int32_t batch_size = inputs.num_cols;
+	int32_t num_outputs = get_num_outputs();
+
+	SGVector<float64_t> replica_errors(num_replicas);
+	SGVector<int32_t> block_offsets(num_replicas+1);
+	block_offsets[0] = 0;
+	for (int32_t t=0; t<num_replicas; t++)
+	{
+		block_offsets[t+1] = block_offsets[t] + batch_size/num_replicas
+			+ (t < batch_size%num_replicas ? 1 : 0);
+	}
+
+	#pragma omp parallel for num_threads(num_replicas)
+	for (int32_t t=0; t<num_replicas; t++)
+	{
+		CNeuralNetwork* replica = (CNeuralNetwork*)replicas->get_element(t);
+
+		int32_t offset = block_offsets[t];
+		int32_t block_size = block_offsets[t+1]-offset;
+
+		SGMatrix<float64_t> inputs_block(inputs.matrix+offset*m_num_inputs,
+			m_num_inputs, block_size, false);
+		SGMatrix<float64_t> targets_block(targets.matrix+offset*num_outputs,
+			num_outputs, block_size, false);
+		SGVector<float64_t> block_gradients(
+			replica_gradients.get_column_vector(t), m_total_num_parameters, false);
+		replica->m_dropout_streams =
+			m_dropout_streams ? m_dropout_streams+offset : NULL;
+
+		replica_errors[t] = replica->compute_gradients(inputs_block,
+			targets_block, block_gradients);
+
+		SG_UNREF(replica);
+	}
+
+	// the error and the gradients of every block are averages over the block,
+	// hence they are combined with weights proportional to the block sizes
+	#pragma omp parallel for
+	for (int32_t i=0; i<m_total_num_parameters; i++)
+	{
+		float64_t sum = 0.0;
+		for (int32_t t=0; t<num_replicas; t++)
+		{
+			sum += replica_gradients(i,t)
+				*(block_offsets[t+1]-block_offsets[t])/batch_size;
+		}
+		gradients[i] = sum;
+	}
+
+	float64_t error = 0.0;
+	for (int32_t t=0; t<num_replicas; t++)
+		error += replica_errors[t]*(block_offsets[t+1]-block_offsets[t])/batch_size;
+
+	add_regularization_gradients(gradients);
+
+	return error + compute_regularization_error();
 }
 
 
@@ -769,6 +905,7 @@ void CNeuralNetwork::init()
 	m_batch_size = 1;
 	m_lbfgs_temp_inputs = NULL;
 	m_lbfgs_temp_targets = NULL;
+	m_dropout_streams = NULL;
 	m_is_training = false;
 
 	SG_ADD((machine_int_t*)&m_optimization_method, "optimization_method",
@@ -44,6 +44,7 @@ namespace shogun
 template<class T> class CDenseFeatures;
 class CDynamicObjectArray;
 class CNeuralLayer;
+class RandomStream;
 
 /** optimization method for neural networks */
 enum ENNOptimizationMethod
@@ -537,6 +538,53 @@ protected:
 	 */
 	virtual float64_t compute_error(SGMatrix<float64_t> targets);
 
+	/** Adds the gradients of the L1/L2 penalties to the given gradients and
+	 * enforces the max-norm constraint on the parameters
+	 *
+	 * @param gradients gradients of the data term of the error
+	 */
+	void add_regularization_gradients(SGVector<float64_t> gradients);
+
+	/** @return value of the L1/L2 penalties for the current parameters */
+	float64_t compute_regularization_error();
+
+	/** Creates copies of the network for data-parallel gradient computation.
+	 * The copies share the parameters of this network but have their own
+	 * layers, and hence their own activation and gradient buffers. The
+	 * regularization is disabled in the copies, it is applied once to the
+	 * combined gradients instead.
+	 *
+	 * @param batch_size number of examples the copies are going to deal with
+	 * in total. The batch is split into contiguous blocks of columns, one
+	 * block per copy
+	 * @param num_replicas number of copies
+	 *
+	 * @return array of the copies
+	 */
+	CDynamicObjectArray* create_replicas(int32_t batch_size,
+			int32_t num_replicas);
+
+	/** Applies backpropagation to compute the gradients of the error with
+	 * repsect to every parameter in the network, splitting the batch between
+	 * the given replicas which are processed in parallel. The gradients of
+	 * the blocks are weighted by the block sizes and summed up in a fixed
+	 * order, so the result does not depend on thread scheduling.
+	 *
+	 * @param inputs inputs to the network, a matrix of size
+	 * m_num_inputs*batch_size
+	 * @param targets desired values for the output layer's activations
+	 * @param gradients array to be filled with gradient values
+	 * @param replicas network copies as returned by create_replicas()
+	 * @param replica_gradients buffer for the gradients of the replicas, of
+	 * size m_total_num_parameters*num_replicas
+	 *
+	 * @return error between the targets and the activations of the last layer
+	 */
+	float64_t compute_gradients_parallel(SGMatrix<float64_t> inputs,
+			SGMatrix<float64_t> targets, SGVector<float64_t> gradients,
+			CDynamicObjectArray* replicas,
+			SGMatrix<float64_t> replica_gradients);
+
 	virtual bool is_label_valid(CLabels *lab) const;
 
 	/** returns a pointer to layer i in the network */
@@ -716,6 +764,13 @@ private:
 	 */
 	const SGMatrix<float64_t>* m_lbfgs_temp_inputs;
 	const SGMatrix<float64_t>* m_lbfgs_temp_targets;
+
+	/** random streams for the dropout masks during gradient descent, one
+	 * per column of the batch, so the masks do not depend on how the batch
+	 * is split between threads. NULL if the global random number generator
+	 * is used
+	 */
+	RandomStream* m_dropout_streams;
 };
 
 }
@@ -320,11 +320,13 @@ void CRBM::free_energy_gradients(SGMatrix< float64_t > visible,
 	bool positive_phase,
 	SGMatrix< float64_t > hidden_mean_given_visible)
 {
-	set_batch_size(visible.num_cols);
+	// does not change the batch size, as this is called concurrently on
+	// blocks of the batch during contrastive divergence
+	int32_t batch_size = visible.num_cols;
 
 	if (hidden_mean_given_visible.num_rows==0)
 	{
-		hidden_mean_given_visible = SGMatrix<float64_t>(m_num_hidden,m_batch_size);
+		hidden_mean_given_visible = SGMatrix<float64_t>(m_num_hidden,batch_size);
 		mean_hidden(visible, hidden_mean_given_visible);
 	}
 
@@ -332,7 +334,7 @@ void CRBM::free_energy_gradients(SGMatrix< float64_t > visible,
 	typedef Eigen::Map<Eigen::VectorXd> EVector;
 
 	EMatrix V(visible.matrix, visible.num_rows, visible.num_cols);
-	EMatrix PH(hidden_mean_given_visible.matrix, m_num_hidden,m_batch_size);
+	EMatrix PH(hidden_mean_given_visible.matrix, m_num_hidden,batch_size);
 
 	EMatrix WG(get_weights(gradients).matrix, m_num_hidden, m_num_visible);
 	EVector BG(get_visible_bias(gradients).vector, m_num_visible);
@@ -340,15 +342,15 @@ void CRBM::free_energy_gradients(SGMatrix< float64_t > visible,
 
 	if (positive_phase)
 	{
-		WG = -1*PH*V.transpose()/m_batch_size;
-		BG = -1*V.rowwise().sum()/m_batch_size;
-		CG = -1*PH.rowwise().sum()/m_batch_size;
+		WG = -1*PH*V.transpose()/batch_size;
+		BG = -1*V.rowwise().sum()/batch_size;
+		CG = -1*PH.rowwise().sum()/batch_size;
 	}
 	else
 	{
-		WG += PH*V.transpose()/m_batch_size;
-		BG += V.rowwise().sum()/m_batch_size;
-		CG += PH.rowwise().sum()/m_batch_size;
+		WG += PH*V.transpose()/batch_size;
+		BG += V.rowwise().sum()/batch_size;
+		CG += PH.rowwise().sum()/batch_size;
 	}
 }
 
@@ -357,24 +359,72 @@ void CRBM::contrastive_divergence(SGMatrix< float64_t > visible_batch,
 {
 	set_batch_size(visible_batch.num_cols);
 
-	// positive phase
-	mean_hidden(visible_batch, hidden_state);
-	free_energy_gradients(visible_batch, gradients, true, hidden_state);
+	// the gibbs chains of the batch are independent, hence each thread runs
+	// the chains of a contiguous block of columns
+	int32_t num_blocks = CMath::min(parallel->get_num_threads(), m_batch_size);
 
-	// sampling
-	for (int32_t i=0; i<cd_num_steps; i++)
+	// one random stream per chain, the samples do not depend on the blocks
+	uint64_t seed = CMath::random();
+	RandomStream* streams = new RandomStream[m_batch_size];
+	for (int32_t j=0; j<m_batch_size; j++)
+		streams[j].set_stream(seed, j);
+
+	if (num_blocks==1)
 	{
-		if (i>0 || cd_persistent)
-			mean_hidden(visible_state, hidden_state);
-		sample_hidden(hidden_state, hidden_state);
-		mean_visible(hidden_state, visible_state);
-		if (cd_sample_visible)
-			sample_visible(visible_state, visible_state);
+		contrastive_divergence(visible_batch, visible_state, hidden_state,
+			gradients, streams);
 	}
+	else
+	{
+		if (m_block_gradients.num_rows!=m_num_params ||
+			m_block_gradients.num_cols!=num_blocks)
+			m_block_gradients = SGMatrix<float64_t>(m_num_params, num_blocks);
 
-	// negative phase
-	mean_hidden(visible_state, hidden_state);
-	free_energy_gradients(visible_state, gradients, false, hidden_state);
+		SGVector<int32_t> block_offsets(num_blocks+1);
+		block_offsets[0] = 0;
+		for (int32_t t=0; t<num_blocks; t++)
+		{
+			block_offsets[t+1] = block_offsets[t] + m_batch_size/num_blocks
+				+ (t < m_batch_size%num_blocks ? 1 : 0);
+		}
+
+		#pragma omp parallel for num_threads(num_blocks)
+		for (int32_t t=0; t<num_blocks; t++)
+		{
+			int32_t offset = block_offsets[t];
+			int32_t block_size = block_offsets[t+1]-offset;
+
+			SGMatrix<float64_t> visible_batch_block(
+				visible_batch.matrix+offset*m_num_visible,
+				m_num_visible, block_size, false);
+			SGMatrix<float64_t> visible_block(
+				visible_state.matrix+offset*m_num_visible,
+				m_num_visible, block_size, false);
+			SGMatrix<float64_t> hidden_block(
+				hidden_state.matrix+offset*m_num_hidden,
+				m_num_hidden, block_size, false);
+			SGVector<float64_t> block_gradients(
+				m_block_gradients.get_column_vector(t), m_num_params, false);
+
+			contrastive_divergence(visible_batch_block, visible_block,
+				hidden_block, block_gradients, streams+offset);
+		}
+
+		// the gradients of each block are averages over the block
+		#pragma omp parallel for
+		for (int32_t i=0; i<m_num_params; i++)
+		{
+			float64_t sum = 0;
+			for (int32_t t=0; t<num_blocks; t++)
+			{
+				sum += m_block_gradients(i,t)
+					*(block_offsets[t+1]-block_offsets[t])/m_batch_size;
+			}
+			gradients[i] = sum;
+		}
+	}
+
+	delete[] streams;
 
 	// regularization
 	if (l2_coefficient>0)
@@ -395,6 +445,30 @@ void CRBM::contrastive_divergence(SGMatrix< float64_t > visible_batch,
 
 }
 
+void CRBM::contrastive_divergence(SGMatrix< float64_t > visible_batch,
+	SGMatrix< float64_t > visible, SGMatrix< float64_t > hidden,
+	SGVector< float64_t > gradients, RandomStream* streams)
+{
+	// positive phase
+	mean_hidden(visible_batch, hidden);
+	free_energy_gradients(visible_batch, gradients, true, hidden);
+
+	// sampling
+	for (int32_t i=0; i<cd_num_steps; i++)
+	{
+		if (i>0 || cd_persistent)
+			mean_hidden(visible, hidden);
+		sample_hidden(hidden, hidden, streams);
+		mean_visible(hidden, visible);
+		if (cd_sample_visible)
+			sample_visible(visible, visible, streams);
+	}
+
+	// negative phase
+	mean_hidden(visible, hidden);
+	free_energy_gradients(visible, gradients, false, hidden);
+}
+
 float64_t CRBM::reconstruction_error(SGMatrix< float64_t > visible,
 	SGMatrix< float64_t > buffer)
 {
@@ -485,7 +559,7 @@ void CRBM::mean_visible(SGMatrix< float64_t > hidden, SGMatrix< float64_t > resu
 		if (m_visible_group_types->element(k)==RBMVUT_BINARY)
 		{
 			for (int32_t i=0; i<m_visible_group_sizes->element(k); i++)
-				for (int32_t j=0; j<m_batch_size; j++)
+				for (int32_t j=0; j<result.num_cols; j++)
 					result(i+offset,j) = 1.0/(1.0+CMath::exp(-1.0*result(i+offset,j)));
 		}
 		if (m_visible_group_types->element(k)==RBMVUT_SOFTMAX)
@@ -496,11 +570,11 @@ void CRBM::mean_visible(SGMatrix< float64_t > hidden, SGMatrix< float64_t > resu
 
 			float64_t max = result(offset,0);
 			for (int32_t i=0; i<m_visible_group_sizes->element(k); i++)
-				for (int32_t j=0; j<m_batch_size; j++)
+				for (int32_t j=0; j<result.num_cols; j++)
 					if (result(i+offset,j) > max)
 						max = result(i+offset,j);
 
-			for (int32_t j=0; j<m_batch_size; j++)
+			for (int32_t j=0; j<result.num_cols; j++)
 			{
 				float64_t sum = 0;
 				for (int32_t i=0; i<m_visible_group_sizes->element(k); i++)
@@ -516,42 +590,56 @@ void CRBM::mean_visible(SGMatrix< float64_t > hidden, SGMatrix< float64_t > resu
 	}
 }
 
-void CRBM::sample_hidden(SGMatrix< float64_t > mean, SGMatrix< float64_t > result)
+void CRBM::sample_hidden(SGMatrix< float64_t > mean, SGMatrix< float64_t > result,
+	RandomStream* streams)
 {
-	int32_t length = result.num_rows*result.num_cols;
-	for (int32_t i=0; i<length; i++)
-		result[i] = CMath::random(0.0,1.0) < mean[i];
+	if (streams==NULL)
+	{
+		int32_t length = result.num_rows*result.num_cols;
+		for (int32_t i=0; i<length; i++)
+			result[i] = CMath::random(0.0,1.0) < mean[i];
+	}
+	else
+	{
+		for (int32_t j=0; j<result.num_cols; j++)
+			for (int32_t i=0; i<result.num_rows; i++)
+				result(i,j) = streams[j].random(0.0,1.0) < mean(i,j);
+	}
 }
 
-void CRBM::sample_visible(SGMatrix< float64_t > mean, SGMatrix< float64_t > result)
+void CRBM::sample_visible(SGMatrix< float64_t > mean, SGMatrix< float64_t > result,
+	RandomStream* streams)
 {
 	for (int32_t k=0; k<m_num_visible_groups; k++)
 	{
-		sample_visible(k, mean, result);
+		sample_visible(k, mean, result, streams);
 	}
 }
 
 void CRBM::sample_visible(int32_t index,
-	SGMatrix< float64_t > mean, SGMatrix< float64_t > result)
+	SGMatrix< float64_t > mean, SGMatrix< float64_t > result,
+	RandomStream* streams)
 {
 	int32_t offset = m_visible_state_offsets->element(index);
 
 	if (m_visible_group_types->element(index)==RBMVUT_BINARY)
 	{
 		for (int32_t i=0; i<m_visible_group_sizes->element(index); i++)
-			for (int32_t j=0; j<m_batch_size; j++)
-				result(i+offset,j) = CMath::random(0.0,1.0) < mean(i+offset,j);
+			for (int32_t j=0; j<result.num_cols; j++)
+				result(i+offset,j) = (streams ? streams[j].random(0.0,1.0) :
+					CMath::random(0.0,1.0)) < mean(i+offset,j);
 	}
 
 	if (m_visible_group_types->element(index)==RBMVUT_SOFTMAX)
 	{
 		for (int32_t i=0; i<m_visible_group_sizes->element(index); i++)
-			for (int32_t j=0; j<m_batch_size; j++)
+			for (int32_t j=0; j<result.num_cols; j++)
 				result(i+offset,j) = 0;
 
-		for (int32_t j=0; j<m_batch_size; j++)
+		for (int32_t j=0; j<result.num_cols; j++)
 		{
-			int32_t r = CMath::random(0.0,1.0);
+			int32_t r = streams ? streams[j].random(0.0,1.0) :
+				CMath::random(0.0,1.0);
 			float64_t sum = 0;
 			for (int32_t i=0; i<m_visible_group_sizes->element(index); i++)
 			{
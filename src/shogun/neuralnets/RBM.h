@@ -42,6 +42,7 @@
 #include <shogun/lib/SGVector.h>
 #include <shogun/features/DenseFeatures.h>
 #include <shogun/lib/DynamicArray.h>
+#include <shogun/mathematics/RandomStream.h>
 
 namespace shogun
 {
@@ -274,6 +275,10 @@ public:
 			SGMatrix<float64_t> hidden_mean_given_visible = SGMatrix<float64_t>());
 
 	/** Computes the gradients using contrastive divergence
+	 *
+	 * Each gibbs chain samples from its own random stream, seeded once per
+	 * call from the global random number generator, so the result does not
+	 * depend on the number of threads.
 	 *
 	 * @param visible_batch States of the visible units
 	 * @param gradients Array in which the results are stored.
@@ -352,15 +357,52 @@ protected:
 	/** Computes the mean of the visible states given the hidden states */
 	virtual void mean_visible(SGMatrix<float64_t> hidden, SGMatrix<float64_t> result);
 
-	/** Samples the hidden states according to the provided means */
-	virtual void sample_hidden(SGMatrix<float64_t> mean, SGMatrix<float64_t> result);
+	/** Samples the hidden states according to the provided means
+	 *
+	 * @param mean Means of the hidden states
+	 * @param result Matrix in which the samples are stored
+	 * @param streams One random stream per column of result. If NULL, the
+	 * global random number generator is used
+	 */
+	virtual void sample_hidden(SGMatrix<float64_t> mean, SGMatrix<float64_t> result,
+			RandomStream* streams=NULL);
 
-	/** Samples the visible states according to the provided means */
-	virtual void sample_visible(SGMatrix<float64_t> mean, SGMatrix<float64_t> result);
+	/** Samples the visible states according to the provided means
+	 *
+	 * @param mean Means of the visible states
+	 * @param result Matrix in which the samples are stored
+	 * @param streams One random stream per column of result. If NULL, the
+	 * global random number generator is used
+	 */
+	virtual void sample_visible(SGMatrix<float64_t> mean, SGMatrix<float64_t> result,
+			RandomStream* streams=NULL);
 
-	/** Samples one group of visible states according to the provided means */
+	/** Samples one group of visible states according to the provided means
+	 *
+	 * @param index Index of the visible unit group
+	 * @param mean Means of the visible states
+	 * @param result Matrix in which the samples are stored
+	 * @param streams One random stream per column of result. If NULL, the
+	 * global random number generator is used
+	 */
 	virtual void sample_visible(int32_t index,
-			SGMatrix<float64_t> mean, SGMatrix<float64_t> result);
+			SGMatrix<float64_t> mean, SGMatrix<float64_t> result,
+			RandomStream* streams=NULL);
+
+	/** Runs contrastive divergence on a contiguous block of the batch. The
+	 * gradients are averaged over the block.
+	 *
+	 * @param visible_batch States of the visible units in the block
+	 * @param visible Columns of visible_state that belong to the block
+	 * @param hidden Columns of hidden_state that belong to the block
+	 * @param gradients Array in which the results are stored.
+	 * Length get_num_parameters()
+	 * @param streams Random streams of the gibbs chains in the block, one per
+	 * column
+	 */
+	virtual void contrastive_divergence(SGMatrix<float64_t> visible_batch,
+			SGMatrix<float64_t> visible, SGMatrix<float64_t> hidden,
+			SGVector<float64_t> gradients, RandomStream* streams);
 
 private:
 	void init();
@@ -459,6 +501,11 @@ protected:
 
 	/** Parameters */
 	SGVector<float64_t> m_params;
+
+	/** Gradients of each block of the batch during parallel contrastive
+	 * divergence, one column per block
+	 */
+	SGMatrix<float64_t> m_block_gradients;
 };
 
 }
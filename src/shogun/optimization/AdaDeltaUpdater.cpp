@@ -113,6 +113,33 @@ float64_t AdaDeltaUpdater::get_negative_descend_direction(float64_t variable,
 
 }
 
+float64_t AdaDeltaUpdater::get_sparse_negative_descend_direction(float64_t variable,
+	float64_t gradient, index_t idx, float64_t learning_rate,
+	int64_t iteration, int64_t last_iteration)
+{
+	if(iteration-last_iteration>1)
+	{
+		float64_t decay=CMath::pow(m_decay_factor,
+			(float64_t)(iteration-last_iteration-1));
+		m_gradient_accuracy[idx]*=decay;
+		m_gradient_delta_accuracy[idx]*=decay;
+	}
+	return get_negative_descend_direction(variable, gradient, idx, learning_rate);
+}
+
+void AdaDeltaUpdater::init_sparse_update(index_t len)
+{
+	DescendUpdaterWithCorrection::init_sparse_update(len);
+	if(m_gradient_accuracy.vlen!=len)
+	{
+		m_gradient_accuracy=SGVector<float64_t>(len);
+		m_gradient_accuracy.set_const(0.0);
+
+		m_gradient_delta_accuracy=SGVector<float64_t>(m_gradient_accuracy.vlen);
+		m_gradient_delta_accuracy.set_const(0.0);
+	}
+}
+
 void AdaDeltaUpdater::update_variable(SGVector<float64_t> variable_reference,
 	SGVector<float64_t> raw_negative_descend_direction, float64_t learning_rate)
 {
@@ -109,6 +109,12 @@ public:
 	virtual void update_variable(SGVector<float64_t> variable_reference,
 		SGVector<float64_t> raw_negative_descend_direction, float64_t learning_rate);
 
+	/** Prepare sparse updates of a target variable
+	 *
+	 * @param len length of the target variable
+	 */
+	virtual void init_sparse_update(index_t len);
+
 protected:
 	/** Get the negative descend direction given current variable  and gradient 
 	 *
@@ -125,6 +131,22 @@ protected:
 	virtual float64_t get_negative_descend_direction(float64_t variable,
 		float64_t gradient, index_t idx, float64_t learning_rate);
 
+	/** Get the negative descend direction of an entry in a sparse update,
+	 * the decay of the skipped iterations is caught up first
+	 *
+	 * @param variable current variable
+	 * @param gradient current gradient
+	 * @param idx the index of the variable
+	 * @param learning_rate learning rate
+	 * @param iteration number of the current update
+	 * @param last_iteration number of the last update of the entry, 0 if none
+	 *
+	 * @return negative descend direction
+	 */
+	virtual float64_t get_sparse_negative_descend_direction(float64_t variable,
+		float64_t gradient, index_t idx, float64_t learning_rate,
+		int64_t iteration, int64_t last_iteration);
+
 	/** learning_rate \f$ \alpha \f$ at iteration */
 	float64_t m_build_in_learning_rate;
 
@@ -88,6 +88,16 @@ float64_t AdaGradUpdater::get_negative_descend_direction(float64_t variable,
 	return res;
 }
 
+void AdaGradUpdater::init_sparse_update(index_t len)
+{
+	DescendUpdaterWithCorrection::init_sparse_update(len);
+	if(m_gradient_accuracy.vlen!=len)
+	{
+		m_gradient_accuracy=SGVector<float64_t>(len);
+		m_gradient_accuracy.set_const(0.0);
+	}
+}
+
 void AdaGradUpdater::update_variable(SGVector<float64_t> variable_reference,
 	SGVector<float64_t> raw_negative_descend_direction, float64_t learning_rate)
 {
@@ -102,6 +102,12 @@ public:
 		SGVector<float64_t> raw_negative_descend_direction,
 		float64_t learning_rate);
 
+	/** Prepare sparse updates of a target variable
+	 *
+	 * @param len length of the target variable
+	 */
+	virtual void init_sparse_update(index_t len);
+
 protected:
 	/** Get the negative descend direction given current variable  and gradient 
 	 *
@@ -133,6 +133,58 @@ float64_t AdamUpdater::get_negative_descend_direction(float64_t variable,
 	return res;
 }
 
+void AdamUpdater::init_sparse_update(index_t len)
+{
+	DescendUpdaterWithCorrection::init_sparse_update(len);
+	if(m_gradient_first_moment.vlen!=len)
+	{
+		m_gradient_first_moment=SGVector<float64_t>(len);
+		m_gradient_first_moment.set_const(0.0);
+		m_gradient_second_moment=SGVector<float64_t>(m_gradient_first_moment.vlen);
+		m_gradient_second_moment.set_const(0.0);
+	}
+}
+
+void AdamUpdater::update_variable_sparse(SGSpan<float64_t> variable_reference,
+	SGSpan<index_t> indices, SGSpan<float64_t> raw_negative_descend_direction,
+	float64_t learning_rate, int64_t iteration)
+{
+	REQUIRE(m_last_sparse_update.vlen==variable_reference.size(),
+		"Sparse updates of a variable of length %d must be initialized\n",
+		variable_reference.size());
+
+	/* bias correction of the moments, computed locally as several threads
+	 * may update concurrently */
+	float64_t scale=CMath::exp(m_log_learning_rate+
+		0.5*CMath::log(1.0-CMath::pow(m_decay_factor_second_moment,(float64_t)iteration))-
+		CMath::log(1.0-CMath::pow(m_decay_factor_first_moment,(float64_t)iteration)));
+
+	for(index_t k=0; k<indices.size(); k++)
+	{
+		index_t idx=indices[k];
+		int64_t num_skipped=iteration-m_last_sparse_update[idx]-1;
+		m_last_sparse_update[idx]=iteration;
+
+		float64_t first_moment=m_gradient_first_moment[idx];
+		float64_t second_moment=m_gradient_second_moment[idx];
+		if(num_skipped>0)
+		{
+			first_moment*=CMath::pow(m_decay_factor_first_moment,(float64_t)num_skipped);
+			second_moment*=CMath::pow(m_decay_factor_second_moment,(float64_t)num_skipped);
+		}
+
+		float64_t gradient=raw_negative_descend_direction[k];
+		first_moment=m_decay_factor_first_moment*first_moment+
+			(1.0-m_decay_factor_first_moment)*gradient;
+		second_moment=m_decay_factor_second_moment*second_moment+
+			(1.0-m_decay_factor_second_moment)*gradient*gradient;
+		m_gradient_first_moment[idx]=first_moment;
+		m_gradient_second_moment[idx]=second_moment;
+
+		variable_reference[idx]-=scale*first_moment/(CMath::sqrt(second_moment)+m_epsilon);
+	}
+}
+
 void AdamUpdater::update_variable(SGVector<float64_t> variable_reference,
 	SGVector<float64_t> raw_negative_descend_direction, float64_t learning_rate)
 {
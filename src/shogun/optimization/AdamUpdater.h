@@ -103,6 +103,28 @@ public:
 	virtual void update_variable(SGVector<float64_t> variable_reference,
 		SGVector<float64_t> raw_negative_descend_direction, float64_t learning_rate);
 
+	/** Prepare sparse updates of a target variable
+	 *
+	 * @param len length of the target variable
+	 */
+	virtual void init_sparse_update(index_t len);
+
+	/** Update the target variable based on a sparse negative descend
+	 * direction
+	 *
+	 * The moments of entries without gradient are decayed lazily, but the
+	 * steps they would have caused are skipped (lazy Adam).
+	 *
+	 * @param variable_reference a reference of the target variable
+	 * @param indices unique indices of the nonzero entries of the direction
+	 * @param raw_negative_descend_direction the nonzero entries of the direction
+	 * @param learning_rate learning rate
+	 * @param iteration number of the update, starting with 1
+	 */
+	virtual void update_variable_sparse(SGSpan<float64_t> variable_reference,
+		SGSpan<index_t> indices, SGSpan<float64_t> raw_negative_descend_direction,
+		float64_t learning_rate, int64_t iteration);
+
 protected:
 	/** Get the negative descend direction given current variable and gradient
 	 *
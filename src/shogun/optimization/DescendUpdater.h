@@ -32,6 +32,7 @@
 #ifndef DESCENDUPDATER_H
 #define DESCENDUPDATER_H
 #include <shogun/lib/SGVector.h>
+#include <shogun/lib/SGSpan.h>
 #include <shogun/base/SGObject.h>
 namespace shogun
 {
@@ -62,6 +63,38 @@ public:
 	virtual void update_variable(SGVector<float64_t> variable_reference,
 		SGVector<float64_t> negative_descend_direction, float64_t learning_rate)=0;
 
+	/** Does the updater support sparse updates?
+	 *
+	 * @return whether update_variable_sparse() can be used
+	 */
+	virtual bool supports_sparse_update() { return false; }
+
+	/** Prepare sparse updates of a target variable
+	 *
+	 * This method is called once before update_variable_sparse() is used.
+	 *
+	 * @param len length of the target variable
+	 */
+	virtual void init_sparse_update(index_t len) { SG_NOTIMPLEMENTED }
+
+	/** Update the target variable based on a sparse negative descend
+	 * direction
+	 *
+	 * Only the entries given by indices are touched. The entries of all
+	 * other indices have a zero direction, their state is caught up lazily
+	 * when they are touched next. Several threads may call this method
+	 * concurrently without locking (Hogwild), and it must not allocate.
+	 *
+	 * @param variable_reference a reference of the target variable
+	 * @param indices unique indices of the nonzero entries of the direction
+	 * @param negative_descend_direction the nonzero entries of the direction
+	 * @param learning_rate learning rate
+	 * @param iteration number of the update, starting with 1
+	 */
+	virtual void update_variable_sparse(SGSpan<float64_t> variable_reference,
+		SGSpan<index_t> indices, SGSpan<float64_t> negative_descend_direction,
+		float64_t learning_rate, int64_t iteration) { SG_NOTIMPLEMENTED }
+
 };
 
 }
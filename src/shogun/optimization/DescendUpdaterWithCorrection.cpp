@@ -86,9 +86,42 @@ void DescendUpdaterWithCorrection::update_variable(SGVector<float64_t> variable_
 	}
 }
 
+void DescendUpdaterWithCorrection::init_sparse_update(index_t len)
+{
+	REQUIRE(len>0, "The length of variable_reference (%d) must be positive\n", len);
+	REQUIRE(!m_correction, "Sparse updates do not support descend correction\n");
+	if(m_last_sparse_update.vlen!=len)
+	{
+		m_last_sparse_update=SGVector<int64_t>(len);
+		m_last_sparse_update.zero();
+	}
+}
+
+void DescendUpdaterWithCorrection::update_variable_sparse(SGSpan<float64_t> variable_reference,
+	SGSpan<index_t> indices, SGSpan<float64_t> raw_negative_descend_direction,
+	float64_t learning_rate, int64_t iteration)
+{
+	REQUIRE(m_last_sparse_update.vlen==variable_reference.size(),
+		"Sparse updates of a variable of length %d must be initialized\n",
+		variable_reference.size());
+
+	for(index_t k=0; k<indices.size(); k++)
+	{
+		index_t idx=indices[k];
+		int64_t last_iteration=m_last_sparse_update[idx];
+		m_last_sparse_update[idx]=iteration;
+
+		variable_reference[idx]-=get_sparse_negative_descend_direction(
+			variable_reference[idx], raw_negative_descend_direction[k], idx,
+			learning_rate, iteration, last_iteration);
+	}
+}
+
 void DescendUpdaterWithCorrection::init()
 {
 	m_correction=NULL;
 	SG_ADD((CSGObject **)&m_correction, "DescendUpdaterWithCorrection__m_correction",
 		"correction in DescendUpdaterWithCorrection", MS_NOT_AVAILABLE);
+	SG_ADD(&m_last_sparse_update, "DescendUpdaterWithCorrection__m_last_sparse_update",
+		"last_sparse_update in DescendUpdaterWithCorrection", MS_NOT_AVAILABLE);
 }
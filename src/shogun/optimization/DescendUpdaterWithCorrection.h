@@ -51,6 +51,13 @@ namespace shogun
 class DescendUpdaterWithCorrection: public DescendUpdater
 {
 public:
+	/* Constructor */
+	DescendUpdaterWithCorrection()
+		:DescendUpdater()
+	{
+		init();
+	}
+
 	/*  Destructor */
 	virtual ~DescendUpdaterWithCorrection();
 
@@ -66,6 +73,34 @@ public:
 	virtual void update_variable(SGVector<float64_t> variable_reference,
 		SGVector<float64_t> raw_negative_descend_direction, float64_t learning_rate);
 	
+	/** Does the updater support sparse updates?
+	 *
+	 * Sparse updates are not supported with descend correction, since
+	 * momentum keeps changing entries without gradient.
+	 *
+	 * @return whether update_variable_sparse() can be used
+	 */
+	virtual bool supports_sparse_update() { return m_correction==NULL; }
+
+	/** Prepare sparse updates of a target variable
+	 *
+	 * @param len length of the target variable
+	 */
+	virtual void init_sparse_update(index_t len);
+
+	/** Update the target variable based on a sparse negative descend
+	 * direction
+	 *
+	 * @param variable_reference a reference of the target variable
+	 * @param indices unique indices of the nonzero entries of the direction
+	 * @param raw_negative_descend_direction the nonzero entries of the direction
+	 * @param learning_rate learning rate
+	 * @param iteration number of the update, starting with 1
+	 */
+	virtual void update_variable_sparse(SGSpan<float64_t> variable_reference,
+		SGSpan<index_t> indices, SGSpan<float64_t> raw_negative_descend_direction,
+		float64_t learning_rate, int64_t iteration);
+
 	/** Set the type of descend correction
 	 *
 	 * @param correction the type of descend correction
@@ -95,9 +130,37 @@ protected:
 	virtual float64_t get_negative_descend_direction(float64_t variable,
 		float64_t raw_negative_descend_direction, index_t idx, float64_t learning_rate)=0;
 
+	/** Get the negative descend direction of an entry in a sparse update
+	 *
+	 * It will be called by update_variable_sparse(). The entry had a zero
+	 * direction in all iterations after last_iteration, which the default
+	 * implementation ignores. That is exact for updaters whose state of an
+	 * entry only changes with a nonzero direction, others catch up on the
+	 * skipped iterations here.
+	 *
+	 * @param variable current variable
+	 * @param raw_negative_descend_direction current raw negative descend direction
+	 * @param idx the index of the variable
+	 * @param learning_rate learning rate
+	 * @param iteration number of the current update
+	 * @param last_iteration number of the last update of the entry, 0 if none
+	 *
+	 * @return negative descend direction
+	 */
+	virtual float64_t get_sparse_negative_descend_direction(float64_t variable,
+		float64_t raw_negative_descend_direction, index_t idx, float64_t learning_rate,
+		int64_t iteration, int64_t last_iteration)
+	{
+		return get_negative_descend_direction(variable,
+			raw_negative_descend_direction, idx, learning_rate);
+	}
+
 	/** descend correction object */
 	DescendCorrection* m_correction;
 
+	/** iteration of the last sparse update of every entry */
+	SGVector<int64_t> m_last_sparse_update;
+
 private:
 	/**  Init */
 	void init();
@@ -68,6 +68,20 @@ float64_t ElasticNetPenalty::get_sparse_variable(float64_t variable, float64_t p
 	return m_l1_penalty->get_sparse_variable(variable, penalty_weight*m_l1_ratio);
 }
 
+float64_t ElasticNetPenalty::get_lazy_scale(float64_t penalty_weight,
+	float64_t learning_rate)
+{
+	check_ratio();
+	return m_l2_penalty->get_lazy_scale(penalty_weight*(1.0-m_l1_ratio), learning_rate);
+}
+
+float64_t ElasticNetPenalty::get_lazy_shrinkage(float64_t penalty_weight,
+	float64_t learning_rate)
+{
+	check_ratio();
+	return m_l1_penalty->get_lazy_shrinkage(penalty_weight*m_l1_ratio, learning_rate);
+}
+
 void ElasticNetPenalty::check_ratio()
 {
 	REQUIRE(m_l1_ratio>0, "l1_ratio must set\n");
@@ -110,6 +110,30 @@ public:
 	 */
 	virtual float64_t get_sparse_variable(float64_t variable, float64_t penalty_weight);
 
+	/** Does the penalty support lazy updates?
+	 *
+	 * @return true
+	 */
+	virtual bool supports_lazy_update() { return true; }
+
+	/** Get the scale of a variable without gradient in one step
+	 *
+	 * @param penalty_weight weight of the penalty
+	 * @param learning_rate learning rate of the step
+	 * @return scale
+	 */
+	virtual float64_t get_lazy_scale(float64_t penalty_weight,
+		float64_t learning_rate);
+
+	/** Get the shrinkage of a variable without gradient in one step
+	 *
+	 * @param penalty_weight weight of the penalty
+	 * @param learning_rate learning rate of the step
+	 * @return shrinkage
+	 */
+	virtual float64_t get_lazy_shrinkage(float64_t penalty_weight,
+		float64_t learning_rate);
+
 protected:
 
 	/** check l1_ratio */
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) The Shogun Machine Learning Toolbox
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of the Shogun Development Team.
+ *
+ */
+
+#include <shogun/optimization/FirstOrderShardedCostFunction.h>
+#include <shogun/base/Parameter.h>
+#include <shogun/base/Parallel.h>
+#include <shogun/mathematics/Math.h>
+#include <algorithm>
+using namespace shogun;
+
+FirstOrderShardedCostFunction::FirstOrderShardedCostFunction()
+	:FirstOrderCostFunction()
+{
+	init();
+}
+
+void FirstOrderShardedCostFunction::init()
+{
+	m_num_shards=16;
+	SG_ADD(&m_num_shards, "FirstOrderShardedCostFunction__m_num_shards",
+		"num_shards in FirstOrderShardedCostFunction", MS_NOT_AVAILABLE);
+}
+
+void FirstOrderShardedCostFunction::set_num_shards(int32_t num_shards)
+{
+	REQUIRE(num_shards>0, "Number of shards (%d) must be positive\n", num_shards);
+	m_num_shards=num_shards;
+}
+
+float64_t FirstOrderShardedCostFunction::get_cost()
+{
+	SGVector<float64_t> variable=obtain_variable_reference();
+	if (m_cached_gradient.vlen!=variable.vlen)
+		m_cached_gradient=SGVector<float64_t>(variable.vlen);
+
+	float64_t cost=evaluate(m_cached_gradient);
+	m_cached_variable=variable.clone();
+	return cost;
+}
+
+SGVector<float64_t> FirstOrderShardedCostFunction::get_gradient()
+{
+	SGVector<float64_t> variable=obtain_variable_reference();
+	if (m_cached_variable.vlen!=variable.vlen ||
+		!std::equal(variable.vector, variable.vector+variable.vlen,
+			m_cached_variable.vector))
+	{
+		get_cost();
+	}
+
+	return m_cached_gradient.clone();
+}
+
+float64_t FirstOrderShardedCostFunction::evaluate(SGVector<float64_t> gradient)
+{
+	index_t num_terms=get_num_terms();
+	int32_t num_shards=CMath::max(1, CMath::min(m_num_shards, num_terms));
+	index_t dim=gradient.vlen;
+
+	begin_evaluation();
+
+	if (m_shard_gradients.num_rows!=dim || m_shard_gradients.num_cols!=num_shards)
+		m_shard_gradients=SGMatrix<float64_t>(dim, num_shards);
+	SGVector<float64_t> shard_costs(num_shards);
+
+	int32_t num_threads=CMath::min(parallel->get_num_threads(), num_shards);
+#pragma omp parallel for num_threads(num_threads)
+	for (int32_t s=0; s<num_shards; s++)
+	{
+		SGVector<float64_t> shard_gradient(
+			m_shard_gradients.get_column_vector(s), dim, false);
+		shard_gradient.zero();
+		index_t begin=index_t(int64_t(num_terms)*s/num_shards);
+		index_t end=index_t(int64_t(num_terms)*(s+1)/num_shards);
+		shard_costs[s]=evaluate_shard(begin, end, shard_gradient);
+	}
+
+	// sum up the shards in order
+	float64_t cost=0;
+	gradient.zero();
+	for (int32_t s=0; s<num_shards; s++)
+	{
+		cost+=shard_costs[s];
+		float64_t* shard_gradient=m_shard_gradients.get_column_vector(s);
+		for (index_t i=0; i<dim; i++)
+			gradient[i]+=shard_gradient[i];
+	}
+
+	return end_evaluation(cost, gradient);
+}
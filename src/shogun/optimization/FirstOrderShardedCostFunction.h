@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) The Shogun Machine Learning Toolbox
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of the Shogun Development Team.
+ *
+ */
+
+#ifndef FIRSTORDERSHARDEDCOSTFUNCTION_H
+#define FIRSTORDERSHARDEDCOSTFUNCTION_H
+#include <shogun/lib/config.h>
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/optimization/FirstOrderCostFunction.h>
+namespace shogun
+{
+/** @brief The first order cost function base class for costs that are sums
+ * over terms, usually training examples, evaluated in parallel.
+ *
+ * The cost function must be written as
+ * \f[
+ * f(w)=g\left(\sum_i{f_i(w)}\right)
+ * \f]
+ * where \f$g\f$ is applied by end_evaluation(), e.g. a scaling or a
+ * regularizer. The terms are split into a fixed number of contiguous shards
+ * that are evaluated by the threads given by parallel. Every shard has its
+ * own gradient accumulator and the shards are summed up in order, so the
+ * result does not depend on the number of threads.
+ *
+ * get_cost() computes the gradient as well, get_gradient() returns it if
+ * the variables did not change in between.
+ */
+class FirstOrderShardedCostFunction: public FirstOrderCostFunction
+{
+public:
+	/** default constructor */
+	FirstOrderShardedCostFunction();
+
+	virtual ~FirstOrderShardedCostFunction() {};
+
+	/** Get the cost given current target variables
+	 *
+	 * @return cost
+	 */
+	virtual float64_t get_cost();
+
+	/** Get the gradient value wrt target variables
+	 *
+	 * @return gradient of variables
+	 */
+	virtual SGVector<float64_t> get_gradient();
+
+	/** Compute cost and gradient given current target variables
+	 *
+	 * @param gradient vector to store the gradient in, of the length of the
+	 * variables
+	 * @return cost
+	 */
+	virtual float64_t evaluate(SGVector<float64_t> gradient);
+
+	/** Set the number of shards the terms are split into
+	 *
+	 * @param num_shards number of shards
+	 */
+	virtual void set_num_shards(int32_t num_shards);
+
+	/** Get the number of shards the terms are split into
+	 *
+	 * @return number of shards
+	 */
+	virtual int32_t get_num_shards() const { return m_num_shards; }
+
+protected:
+	/** Get the number of terms of the sum
+	 *
+	 * @return number of terms
+	 */
+	virtual index_t get_num_terms()=0;
+
+	/** Prepare an evaluation at the current variables, e.g. compute
+	 * quantities shared by all terms. Called before the shards are
+	 * evaluated.
+	 */
+	virtual void begin_evaluation() {}
+
+	/** Compute the sum of the terms [begin,end) and add their gradient to
+	 * gradient. Called concurrently for different shards, so it must not
+	 * modify shared state.
+	 *
+	 * @param begin first term
+	 * @param end term after the last one
+	 * @param gradient gradient accumulator of the shard
+	 * @return sum of the costs of the terms
+	 */
+	virtual float64_t evaluate_shard(index_t begin, index_t end,
+		SGVector<float64_t> gradient)=0;
+
+	/** Finish an evaluation given the sum of all terms, e.g. scale the
+	 * cost and gradient or add a regularizer
+	 *
+	 * @param cost sum of the costs of all terms
+	 * @param gradient sum of the gradients of all terms, modified in place
+	 * @return cost
+	 */
+	virtual float64_t end_evaluation(float64_t cost,
+		SGVector<float64_t> gradient) { return cost; }
+
+private:
+	/** init */
+	void init();
+
+	/** number of shards */
+	int32_t m_num_shards;
+
+	/** gradient accumulators of the shards */
+	SGMatrix<float64_t> m_shard_gradients;
+
+	/** variables of the last evaluation */
+	SGVector<float64_t> m_cached_variable;
+
+	/** gradient of the last evaluation */
+	SGVector<float64_t> m_cached_gradient;
+};
+
+}
+
+#endif
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) The Shogun Machine Learning Toolbox
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of the Shogun Development Team.
+ *
+ */
+
+#ifndef FIRSTORDERSPARSESTOCHASTICCOSTFUNCTION_H
+#define FIRSTORDERSPARSESTOCHASTICCOSTFUNCTION_H
+#include <shogun/lib/config.h>
+#include <shogun/lib/SGSpan.h>
+#include <shogun/optimization/FirstOrderStochasticCostFunction.h>
+namespace shogun
+{
+/** @brief The first order stochastic cost function base class for sparse
+ * sample gradients.
+ *
+ * The gradient of a sample is written as index/value pairs into buffers
+ * owned by the caller (eg, SGDMinimizer), so that a sample of a sparse,
+ * high dimensional problem costs time in the number of its nonzero entries
+ * only, and nothing is allocated per sample.
+ *
+ * Samples are addressed by their index, so that several threads can compute
+ * sample gradients concurrently (see SGDMinimizer::set_hogwild()).
+ * get_sample_indices() and get_sparse_gradient() must therefore be
+ * thread-safe and only read the target variables, which may be updated by other threads meanwhile.
+ *
+ * The sample sequence of begin_sample() and next_sample() visits all samples
+ * in order and the dense get_gradient() is derived from the sparse
+ * gradient, so these cost functions also work with minimizers which do not
+ * support sparse gradients.
+ */
+class FirstOrderSparseStochasticCostFunction: public FirstOrderStochasticCostFunction
+{
+public:
+	/** Constructor */
+	FirstOrderSparseStochasticCostFunction()
+		:FirstOrderStochasticCostFunction(), m_sample_idx(-1) {}
+
+	virtual ~FirstOrderSparseStochasticCostFunction() {};
+
+	/** Get the sample size
+	 *
+	 * @return the sample size
+	 */
+	virtual int32_t get_sample_size()=0;
+
+	/** Get the maximal number of nonzero entries of a sample gradient, which
+	 * is the size of the buffers passed to get_sample_indices() and
+	 * get_sparse_gradient()
+	 *
+	 * @return maximal number of nonzero entries
+	 */
+	virtual index_t get_max_gradient_nnz()=0;
+
+	/** Get the indices of the target variables which the cost of a sample
+	 * depends on, which are the possibly nonzero entries of its gradient
+	 *
+	 * Every index may occur at most once.
+	 *
+	 * @param idx index of the sample
+	 * @param indices buffer for the indices
+	 * @return number of indices written to the buffer
+	 */
+	virtual index_t get_sample_indices(index_t idx, SGSpan<index_t> indices)=0;
+
+	/** Get the SAMPLE gradient of a sample wrt target variables at the
+	 * indices given by get_sample_indices()
+	 *
+	 * The minimizer may update the target variables at these indices in
+	 * between, eg, to apply a lazy penalty.
+	 *
+	 * @param idx index of the sample
+	 * @param indices the indices returned by get_sample_indices()
+	 * @param values buffer for the gradient at these indices
+	 */
+	virtual void get_sparse_gradient(index_t idx, SGSpan<index_t> indices,
+		SGSpan<float64_t> values)=0;
+
+	/** Initialize to generate a sample sequence */
+	virtual void begin_sample() { m_sample_idx=-1; }
+
+	/** Get next sample
+	 *
+	 * @return false if reach the end of the sample sequence
+	 */
+	virtual bool next_sample() { return ++m_sample_idx<get_sample_size(); }
+
+	/** Get the index of the current sample
+	 *
+	 * @return index of the sample obtained by next_sample()
+	 */
+	virtual index_t get_current_sample() { return m_sample_idx; }
+
+	/** Get the dense SAMPLE gradient of the current sample
+	 *
+	 * @return sample gradient of variables
+	 */
+	virtual SGVector<float64_t> get_gradient()
+	{
+		SGVector<float64_t> grad(obtain_variable_reference().vlen);
+		grad.zero();
+
+		SGVector<index_t> indices(get_max_gradient_nnz());
+		SGVector<float64_t> values(indices.vlen);
+		index_t nnz=get_sample_indices(get_current_sample(), indices);
+		get_sparse_gradient(get_current_sample(), SGSpan<index_t>(indices.vector, nnz),
+			SGSpan<float64_t>(values.vector, nnz));
+		for (index_t k=0; k<nnz; k++)
+			grad[indices[k]]=values[k];
+
+		return grad;
+	}
+
+protected:
+	/** index of the current sample */
+	index_t m_sample_idx;
+};
+
+}
+
+#endif
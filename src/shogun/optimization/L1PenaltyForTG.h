@@ -70,6 +70,14 @@ public:
 	virtual void update_variable_for_proximity(SGVector<float64_t> variable,
 		float64_t proximal_weight);
 
+	/** Does the penalty support lazy updates?
+	 *
+	 * The cumulative penalty depends on the order of the updates.
+	 *
+	 * @return false
+	 */
+	virtual bool supports_lazy_update() { return false; }
+
 protected:
 	/** u is defined in Figure 2 of the reference */
 	float64_t m_u;
@@ -81,6 +81,21 @@ public:
 	virtual float64_t get_penalty_gradient(float64_t variable,
 		float64_t gradient_of_variable) {return variable;}
 
+	/** Does the penalty support lazy updates?
+	 *
+	 * @return true
+	 */
+	virtual bool supports_lazy_update() { return true; }
+
+	/** Get the scale of a variable without gradient in one step
+	 *
+	 * @param penalty_weight weight of the penalty
+	 * @param learning_rate learning rate of the step
+	 * @return scale
+	 */
+	virtual float64_t get_lazy_scale(float64_t penalty_weight,
+		float64_t learning_rate) { return 1.0-learning_rate*penalty_weight; }
+
 };
 
 }
@@ -77,6 +77,37 @@ public:
 	virtual float64_t get_penalty_gradient(float64_t variable,
 		float64_t gradient)=0;
 
+	/** Does the penalty support lazy updates?
+	 *
+	 * A minimizer with sparse updates only touches the variables with a
+	 * nonzero gradient. The penalty steps of the other variables are caught
+	 * up when they are touched next, which requires that one step changes a
+	 * variable without gradient to
+	 * \f$sign(w)\max(0, scale |w| - shrinkage)\f$,
+	 * see get_lazy_scale() and get_lazy_shrinkage().
+	 *
+	 * @return whether the penalty supports lazy updates
+	 */
+	virtual bool supports_lazy_update() { return false; }
+
+	/** Get the scale of a variable without gradient in one step
+	 *
+	 * @param penalty_weight weight of the penalty
+	 * @param learning_rate learning rate of the step
+	 * @return scale
+	 */
+	virtual float64_t get_lazy_scale(float64_t penalty_weight,
+		float64_t learning_rate) { return 1.0; }
+
+	/** Get the shrinkage of a variable without gradient in one step
+	 *
+	 * @param penalty_weight weight of the penalty
+	 * @param learning_rate learning rate of the step
+	 * @return shrinkage
+	 */
+	virtual float64_t get_lazy_shrinkage(float64_t penalty_weight,
+		float64_t learning_rate) { return 0.0; }
+
 };
 
 }
@@ -102,6 +102,28 @@ float64_t RmsPropUpdater::get_negative_descend_direction(float64_t variable,
 	return res;
 }
 
+float64_t RmsPropUpdater::get_sparse_negative_descend_direction(float64_t variable,
+	float64_t gradient, index_t idx, float64_t learning_rate,
+	int64_t iteration, int64_t last_iteration)
+{
+	if(iteration-last_iteration>1)
+	{
+		m_gradient_accuracy[idx]*=CMath::pow(m_decay_factor,
+			(float64_t)(iteration-last_iteration-1));
+	}
+	return get_negative_descend_direction(variable, gradient, idx, learning_rate);
+}
+
+void RmsPropUpdater::init_sparse_update(index_t len)
+{
+	DescendUpdaterWithCorrection::init_sparse_update(len);
+	if(m_gradient_accuracy.vlen!=len)
+	{
+		m_gradient_accuracy=SGVector<float64_t>(len);
+		m_gradient_accuracy.set_const(0.0);
+	}
+}
+
 void RmsPropUpdater::update_variable(SGVector<float64_t> variable_reference,
 	SGVector<float64_t> raw_negative_descend_direction, float64_t learning_rate)
 {
@@ -30,9 +30,33 @@
  */
 #include <shogun/optimization/SGDMinimizer.h>
 #include <shogun/optimization/GradientDescendUpdater.h>
+#include <shogun/optimization/SparsePenalty.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/base/Parallel.h>
+#include <shogun/base/Parameter.h>
 #include <shogun/lib/config.h>
 using namespace shogun;
 
+/* applies the penalty steps from..to to a variable without gradient, where
+ * one step scales the magnitude by a and then shrinks it by b, so the steps
+ * are given by the products of a and the sums of b divided by these */
+static inline float64_t catch_up_penalty(float64_t variable,
+	SparsePenalty* sparse_penalty, const SGVector<float64_t>& scales,
+	const SGVector<float64_t>& shrinkages, index_t from, index_t to)
+{
+	if (from>=to || variable==0.0)
+		return variable;
+
+	float64_t magnitude=CMath::abs(variable)/scales[from]-(shrinkages[to]-shrinkages[from]);
+	if (magnitude<=0.0)
+		return 0.0;
+
+	variable=CMath::sign(variable)*magnitude*scales[to];
+	if (sparse_penalty)
+		variable=sparse_penalty->get_sparse_variable(variable, 0.0);
+	return variable;
+}
+
 SGDMinimizer::SGDMinimizer()
 	:FirstOrderStochasticMinimizer()
 {
@@ -54,6 +78,14 @@ float64_t SGDMinimizer::minimize()
 	init_minimization();
 
 	SGVector<float64_t> variable_reference=m_fun->obtain_variable_reference();
+	FirstOrderSparseStochasticCostFunction *sparse_fun=
+		dynamic_cast<FirstOrderSparseStochasticCostFunction *>(m_fun);
+	if(sparse_fun && m_gradient_updater->supports_sparse_update() &&
+		(!m_penalty_type || m_penalty_type->supports_lazy_update()))
+		return minimize_sparse(sparse_fun, variable_reference);
+
+	REQUIRE(!m_hogwild, "Hogwild needs a cost function with sparse gradients, "
+		"a descend updater with sparse updates and a penalty with lazy updates\n");
 	FirstOrderStochasticCostFunction *fun=dynamic_cast<FirstOrderStochasticCostFunction *>(m_fun);
 	REQUIRE(fun,"the cost function must be a stochastic cost function\n");
 	for(;m_cur_passes<m_num_passes;m_cur_passes++)
@@ -76,8 +108,152 @@ float64_t SGDMinimizer::minimize()
 	return cost+get_penalty(variable_reference);
 }
 
+float64_t SGDMinimizer::minimize_sparse(FirstOrderSparseStochasticCostFunction *fun,
+	SGVector<float64_t> variable_reference)
+{
+	const index_t num_samples=fun->get_sample_size();
+	const index_t max_nnz=fun->get_max_gradient_nnz();
+	const index_t len=variable_reference.vlen;
+	REQUIRE(num_samples>0, "The sample size (%d) must be positive\n", num_samples);
+	REQUIRE(max_nnz>0, "The number of nonzero entries (%d) must be positive\n", max_nnz);
+
+	Penalty* penalty=m_penalty_type;
+	SparsePenalty* sparse_penalty=dynamic_cast<SparsePenalty*>(m_penalty_type);
+	if(penalty)
+		REQUIRE(m_penalty_weight>0,"The weight of penalty must be set first\n");
+	if(sparse_penalty)
+		REQUIRE(m_learning_rate, "Learning rate must set when Sparse Penalty (eg, L1) is used\n");
+
+	m_gradient_updater->init_sparse_update(len);
+	const int32_t num_threads=m_hogwild ? parallel->get_num_threads() : 1;
+
+	/* learning rates and penalty steps of the samples of a segment, the
+	 * position of an entry's last update within the segment */
+	SGVector<float64_t> rates(num_samples+1);
+	SGVector<float64_t> scales;
+	SGVector<float64_t> shrinkages;
+	SGVector<index_t> last_update;
+	if(penalty)
+	{
+		scales=SGVector<float64_t>(num_samples+1);
+		shrinkages=SGVector<float64_t>(num_samples+1);
+		last_update=SGVector<index_t>(len);
+		last_update.zero();
+	}
+
+	for(;m_cur_passes<m_num_passes;m_cur_passes++)
+	{
+		/* a pass is split into segments when the products of the scales
+		 * underflow */
+		for(index_t begin=0; begin<num_samples;)
+		{
+			index_t seg_len=0;
+			if(penalty)
+			{
+				scales[0]=1.0;
+				shrinkages[0]=0.0;
+			}
+			do
+			{
+				seg_len++;
+				float64_t learning_rate=1.0;
+				if(m_learning_rate)
+					learning_rate=m_learning_rate->get_learning_rate(m_iter_counter+seg_len);
+				rates[seg_len]=learning_rate;
+
+				if(penalty)
+				{
+					float64_t scale=penalty->get_lazy_scale(m_penalty_weight, learning_rate);
+					REQUIRE(scale>0, "The penalty scales the variables by %f, "
+						"the learning rate (%f) is too large\n", scale, learning_rate);
+					scales[seg_len]=scales[seg_len-1]*scale;
+					shrinkages[seg_len]=shrinkages[seg_len-1]+
+						penalty->get_lazy_shrinkage(m_penalty_weight, learning_rate)/scales[seg_len];
+				}
+			}
+			while(begin+seg_len<num_samples && (!penalty || scales[seg_len]>=1e-100));
+
+#pragma omp parallel num_threads(num_threads)
+			{
+				SGVector<index_t> indices(max_nnz);
+				SGVector<float64_t> values(max_nnz);
+
+#pragma omp for schedule(dynamic, 64)
+				for(index_t pos=1; pos<=seg_len; pos++)
+				{
+					const index_t sample=begin+pos-1;
+					index_t nnz=fun->get_sample_indices(sample, indices);
+					SGSpan<index_t> sample_indices(indices.vector, nnz);
+					SGSpan<float64_t> sample_values(values.vector, nnz);
+
+					/* the gradient needs the penalty steps of the entries
+					 * before this sample */
+					if(penalty)
+					{
+						for(index_t k=0; k<nnz; k++)
+						{
+							index_t idx=indices[k];
+							/* with Hogwild, a later sample may have been first */
+							if(last_update[idx]<pos)
+							{
+								variable_reference[idx]=catch_up_penalty(variable_reference[idx],
+									sparse_penalty, scales, shrinkages, last_update[idx], pos-1);
+								last_update[idx]=pos;
+							}
+						}
+					}
+
+					fun->get_sparse_gradient(sample, sample_indices, sample_values);
+					if(penalty)
+					{
+						for(index_t k=0; k<nnz; k++)
+						{
+							values[k]+=m_penalty_weight*penalty->get_penalty_gradient(
+								variable_reference[indices[k]], values[k]);
+						}
+					}
+
+					m_gradient_updater->update_variable_sparse(variable_reference,
+						sample_indices, sample_values, rates[pos], int64_t(m_iter_counter)+pos);
+
+					if(sparse_penalty)
+					{
+						float64_t proximal_weight=m_penalty_weight*rates[pos];
+						for(index_t k=0; k<nnz; k++)
+						{
+							index_t idx=indices[k];
+							variable_reference[idx]=sparse_penalty->get_sparse_variable(
+								variable_reference[idx], proximal_weight);
+						}
+					}
+				}
+			}
+
+			if(penalty)
+			{
+#pragma omp parallel for num_threads(num_threads)
+				for(index_t idx=0; idx<len; idx++)
+				{
+					variable_reference[idx]=catch_up_penalty(variable_reference[idx],
+						sparse_penalty, scales, shrinkages, last_update[idx], seg_len);
+					last_update[idx]=0;
+				}
+			}
+
+			m_iter_counter+=seg_len;
+			begin+=seg_len;
+		}
+	}
+
+	float64_t cost=m_fun->get_cost();
+	return cost+get_penalty(variable_reference);
+}
+
 void SGDMinimizer::init()
 {
+	m_hogwild=false;
+	SG_ADD(&m_hogwild, "SGDMinimizer__m_hogwild",
+		"hogwild in SGDMinimizer", MS_NOT_AVAILABLE);
 }
 
 void SGDMinimizer::init_minimization()
@@ -32,6 +32,7 @@
 #ifndef SGDMINIMIZER_H
 #define SGDMINIMIZER_H
 #include <shogun/optimization/FirstOrderStochasticMinimizer.h>
+#include <shogun/optimization/FirstOrderSparseStochasticCostFunction.h>
 
 namespace shogun
 {
@@ -40,6 +41,22 @@ namespace shogun
  *
  * A good introduction to SGD can be found at
  * http://cs231n.github.io/neural-networks-3/#sgd
+ *
+ * If the cost function provides sparse sample gradients (see
+ * FirstOrderSparseStochasticCostFunction), the gradient updater supports
+ * sparse updates and the penalty (if any) supports lazy updates, a step only
+ * touches the nonzero entries of the sample gradient. The penalty steps of
+ * the other entries are accumulated and applied when an entry is touched
+ * next, and to all entries at the end of a pass. For GradientDescendUpdater,
+ * the result is the same as that of dense steps. Adaptive updaters keep
+ * their state per entry; the L2 part of a penalty only goes through the
+ * updater for touched entries, and is applied as plain weight decay
+ * otherwise.
+ *
+ * With set_hogwild(), the samples of a pass are processed by several
+ * threads without any locking, see
+ * Niu, F., Recht, B., Re, C. and Wright, S. J. (2011). Hogwild!: A Lock-Free
+ * Approach to Parallelizing Stochastic Gradient Descent. NIPS.
  */
 
 class SGDMinimizer: public FirstOrderStochasticMinimizer
@@ -69,10 +86,35 @@ public:
 	 */
 	virtual float64_t minimize();
 
+	/** Set whether the samples are processed by several threads without
+	 * locking (Hogwild), which needs sparse updates
+	 *
+	 * @param hogwild whether to process samples concurrently
+	 */
+	virtual void set_hogwild(bool hogwild) { m_hogwild=hogwild; }
+
+	/** Are the samples processed by several threads?
+	 *
+	 * @return whether Hogwild is used
+	 */
+	virtual bool get_hogwild() const { return m_hogwild; }
+
 protected:
 	/*  init the minimization process */
 	virtual void init_minimization();
 
+	/** Do minimization with sparse updates
+	 *
+	 * @param fun cost function with sparse sample gradients
+	 * @param variable_reference a reference of the target variable
+	 * @return optimal value
+	 */
+	virtual float64_t minimize_sparse(FirstOrderSparseStochasticCostFunction *fun,
+		SGVector<float64_t> variable_reference);
+
+	/** whether the samples are processed by several threads */
+	bool m_hogwild;
+
 private:
 	  /* Init */
 	void init();
@@ -89,14 +89,28 @@ void CTron::tron(float64_t *w, float64_t max_train_time)
 	double *w_new = SG_MALLOC(double, n);
 	double *g = SG_MALLOC(double, n);
 
+	// the stopping criterion is relative to the gradient at zero, also when
+	// starting from given weights
+	bool warm_start = false;
 	for (i=0; i<n; i++)
-		w[i] = 0;
+		warm_start = warm_start || w[i] != 0;
+
+	float64_t gnorm1;
+	if (warm_start)
+	{
+		for (i=0; i<n; i++)
+			w_new[i] = 0;
+		fun_obj->fun(w_new);
+		fun_obj->grad(w_new, g);
+		gnorm1 = tron_dnrm2(n, g, inc);
+	}
 
 	f = fun_obj->fun(w);
 	fun_obj->grad(w, g);
 	delta = tron_dnrm2(n, g, inc);
-	float64_t gnorm1 = delta;
-	float64_t gnorm = gnorm1;
+	if (!warm_start)
+		gnorm1 = delta;
+	float64_t gnorm = delta;
 
 	if (gnorm <= eps*gnorm1)
 		search = 0;
@@ -68,7 +68,7 @@ public:
 
 	/** tron
 	 *
-	 * @param w w
+	 * @param w w, the optimization starts from the given weights
 	 * @param max_train_time maximum training time
 	 */
 	void tron(float64_t *w, float64_t max_train_time);
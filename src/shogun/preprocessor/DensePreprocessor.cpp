@@ -1,5 +1,7 @@
 #include <shogun/preprocessor/DensePreprocessor.h>
 
+#include <string.h>
+
 namespace shogun
 {
 template <class ST>
@@ -98,6 +100,30 @@ CFeatures* CDensePreprocessor<ST>::apply(CFeatures* features)
 	return preprocessed;
 }
 
+template <class ST>
+SGMatrix<ST> CDensePreprocessor<ST>::apply_to_feature_block(SGMatrix<ST> block)
+{
+	SGMatrix<ST> result;
+
+	for (index_t i=0; i<block.num_cols; i++)
+	{
+		SGVector<ST> vec=apply_to_feature_vector(
+			SGVector<ST>(block.get_column_vector(i), block.num_rows, false));
+
+		if (i==0)
+		{
+			if (vec.vlen==block.num_rows)
+				result=block;
+			else
+				result=SGMatrix<ST>(vec.vlen, block.num_cols);
+		}
+
+		memcpy(result.get_column_vector(i), vec.vector, sizeof(ST)*vec.vlen);
+	}
+
+	return result;
+}
+
 template class CDensePreprocessor<bool>;
 template class CDensePreprocessor<char>;
 template class CDensePreprocessor<int8_t>;
@@ -54,6 +54,27 @@ template <class ST> class CDensePreprocessor : public CPreprocessor
 		/// result in feature matrix
 		virtual SGVector<ST> apply_to_feature_vector(SGVector<ST> vector)=0;
 
+		/** apply preproc on a block of feature vectors (one per column).
+		 * Gives the same result as apply_to_feature_vector() on every
+		 * column. The block may be overwritten, and is returned if the
+		 * dimension does not change.
+		 *
+		 * The default implementation calls apply_to_feature_vector() on
+		 * every column.
+		 *
+		 * @param block feature vectors
+		 * @return preprocessed feature vectors
+		 */
+		virtual SGMatrix<ST> apply_to_feature_block(SGMatrix<ST> block);
+
+		/** whether apply_to_feature_block() may be called concurrently on
+		 * different blocks, i.e. whether the preprocessor can be used in
+		 * the parallel preprocessing pipeline of CDenseFeatures
+		 *
+		 * @return false by default
+		 */
+		virtual bool supports_parallel_blocks() const { return false; }
+
 		/// return that we are dense features (just fixed size matrices)
 		virtual EFeatureClass get_feature_class();
 		/// return feature type
@@ -22,8 +22,11 @@
 #include <shogun/preprocessor/DimensionReductionPreprocessor.h>
 #include <shogun/features/Features.h>
 #include <shogun/io/SGIO.h>
+#include <shogun/mathematics/eigen3.h>
+#include <shogun/mathematics/linalg/eigsolver/RandomizedEigenSolver.h>
 
 using namespace shogun;
+using namespace Eigen;
 
 CKernelPCA::CKernelPCA() : CDimensionReductionPreprocessor()
 {
@@ -42,11 +45,21 @@ void CKernelPCA::init()
 	m_init_features = NULL;
 	m_transformation_matrix = SGMatrix<float64_t>();
 	m_bias_vector = SGVector<float64_t>();
+	m_method = AUTO;
+	m_oversampling = 10;
+	m_power_iterations = 2;
 
 	SG_ADD(&m_transformation_matrix, "transformation_matrix",
 		"matrix used to transform data", MS_NOT_AVAILABLE);
 	SG_ADD(&m_bias_vector, "bias_vector",
 		"bias vector used to transform data", MS_NOT_AVAILABLE);
+	SG_ADD((machine_int_t*) &m_method, "method",
+		"method used to decompose the kernel matrix", MS_NOT_AVAILABLE);
+	SG_ADD(&m_oversampling, "oversampling",
+		"number of additional vectors sketched by the randomized method",
+		MS_NOT_AVAILABLE);
+	SG_ADD(&m_power_iterations, "power_iterations",
+		"number of power iterations of the randomized method", MS_NOT_AVAILABLE);
 }
 
 void CKernelPCA::cleanup()
@@ -87,30 +100,40 @@ bool CKernelPCA::init(CFeatures* features)
 
 		SGMatrix<float64_t>::center_matrix(kernel_matrix.matrix, n, m);
 
-		float64_t* eigenvalues=SGMatrix<float64_t>::compute_eigenvectors(kernel_matrix.matrix, n, n);
+		// eigenvectors are stored in ascending order of their eigenvalues
+		SGVector<float64_t> eigenvalues;
+		if (m_method == RANDOMIZED)
+		{
+			m_transformation_matrix = compute_randomized_eigenvectors(kernel_matrix,
+					eigenvalues);
+		}
+		else
+		{
+			eigenvalues = SGVector<float64_t>(
+					SGMatrix<float64_t>::compute_eigenvectors(kernel_matrix.matrix, n, n), n);
+			m_transformation_matrix = SGMatrix<float64_t>(kernel_matrix.matrix,n,n);
+			kernel_matrix.matrix = NULL;
+		}
+		int32_t num_components = m_transformation_matrix.num_cols;
 
-		for (int32_t i=0; i<n; i++)
+		for (int32_t i=0; i<num_components; i++)
 		{
 			//normalize and trap divide by zero and negative eigenvalues
 			for (int32_t j=0; j<n; j++)
-				kernel_matrix.matrix[i*n+j]/=CMath::sqrt(CMath::max(1e-16,eigenvalues[i]));
+				m_transformation_matrix.matrix[i*n+j]/=CMath::sqrt(CMath::max(1e-16,eigenvalues[i]));
 		}
 
-		SG_FREE(eigenvalues);
-
-		m_transformation_matrix = SGMatrix<float64_t>(kernel_matrix.matrix,n,n);
-		kernel_matrix.matrix = NULL;
-		m_bias_vector = SGVector<float64_t>(n);
+		m_bias_vector = SGVector<float64_t>(num_components);
 		SGVector<float64_t>::fill_vector(m_bias_vector.vector, m_bias_vector.vlen, 0.0);
 
 		cblas_dgemv(CblasColMajor, CblasTrans,
-				n, n, 1.0, m_transformation_matrix.matrix, n,
+				n, num_components, 1.0, m_transformation_matrix.matrix, n,
 				bias_tmp, 1, 0.0, m_bias_vector.vector, 1);
 
-		float64_t* rowsum = SGMatrix<float64_t>::get_row_sum(m_transformation_matrix.matrix, n, n);
-		SGVector<float64_t>::scale_vector(1.0/n, rowsum, n);
+		float64_t* rowsum = SGMatrix<float64_t>::get_row_sum(m_transformation_matrix.matrix, n, num_components);
+		SGVector<float64_t>::scale_vector(1.0/n, rowsum, num_components);
 
-		for (int32_t i=0; i<n; i++)
+		for (int32_t i=0; i<num_components; i++)
 		{
 			for (int32_t j=0; j<n; j++)
 				m_transformation_matrix.matrix[j+n*i] -= rowsum[i];
@@ -125,6 +148,76 @@ bool CKernelPCA::init(CFeatures* features)
 	return false;
 }
 
+SGMatrix<float64_t> CKernelPCA::compute_randomized_eigenvectors(
+		SGMatrix<float64_t> kernel_matrix, SGVector<float64_t>& eigenvalues)
+{
+	int32_t n = kernel_matrix.num_cols;
+	REQUIRE(m_target_dim>0 && m_target_dim<=n, "Target dimension (%d) has to "
+		"be in [1, %d]\n", m_target_dim, n)
+	REQUIRE(m_oversampling>=0, "Oversampling (%d) has to be non-negative\n",
+		m_oversampling)
+
+	Map<MatrixXd> k(kernel_matrix.matrix, n, n);
+	RandomizedEigenSolver::MatrixProduct kernel_product =
+		[&k](SGMatrix<float64_t> vectors, SGMatrix<float64_t> result)
+	{
+		Map<MatrixXd> v(vectors.matrix, vectors.num_rows, vectors.num_cols);
+		Map<MatrixXd> r(result.matrix, result.num_rows, result.num_cols);
+		r.noalias() = k.selfadjointView<Lower>()*v;
+	};
+
+	int32_t num_sketch = CMath::min(n, m_target_dim+m_oversampling);
+	SG_INFO("Computing %d randomized eigenvectors of the kernel matrix\n",
+		num_sketch)
+
+	SGVector<float64_t> sketch_eigenvalues;
+	SGMatrix<float64_t> sketch_eigenvectors;
+	RandomizedEigenSolver::compute(n, num_sketch, m_power_iterations,
+		kernel_product, sketch_eigenvalues, sketch_eigenvectors);
+
+	// keep the target dimension, reversed to ascending order
+	eigenvalues = SGVector<float64_t>(m_target_dim);
+	SGMatrix<float64_t> eigenvectors(n, m_target_dim);
+	for (int32_t i=0; i<m_target_dim; i++)
+	{
+		eigenvalues[i] = sketch_eigenvalues[m_target_dim-i-1];
+		memcpy(eigenvectors.get_column_vector(i),
+			sketch_eigenvectors.get_column_vector(m_target_dim-i-1),
+			n*sizeof(float64_t));
+	}
+
+	return eigenvectors;
+}
+
+void CKernelPCA::set_method(EPCAMethod method)
+{
+	m_method = method;
+}
+
+EPCAMethod CKernelPCA::get_method() const
+{
+	return m_method;
+}
+
+void CKernelPCA::set_oversampling(int32_t oversampling)
+{
+	m_oversampling = oversampling;
+}
+
+int32_t CKernelPCA::get_oversampling() const
+{
+	return m_oversampling;
+}
+
+void CKernelPCA::set_power_iterations(int32_t power_iterations)
+{
+	m_power_iterations = power_iterations;
+}
+
+int32_t CKernelPCA::get_power_iterations() const
+{
+	return m_power_iterations;
+}
 
 SGMatrix<float64_t> CKernelPCA::apply_to_feature_matrix(CFeatures* features)
 {
@@ -133,7 +226,8 @@ SGMatrix<float64_t> CKernelPCA::apply_to_feature_matrix(CFeatures* features)
 
 	int32_t num_vectors = simple_features->get_num_vectors();
 	int32_t i,j,k;
-	int32_t n = m_transformation_matrix.num_cols;
+	int32_t n = m_transformation_matrix.num_rows;
+	int32_t num_components = m_transformation_matrix.num_cols;
 
 	m_kernel->init(features,m_init_features);
 
@@ -142,14 +236,14 @@ SGMatrix<float64_t> CKernelPCA::apply_to_feature_matrix(CFeatures* features)
 	for (i=0; i<num_vectors; i++)
 	{
 		for (j=0; j<m_target_dim; j++)
-			new_feature_matrix[i*m_target_dim+j] = m_bias_vector.vector[j];
+			new_feature_matrix[i*m_target_dim+j] = m_bias_vector.vector[num_components-j-1];
 
 		for (j=0; j<n; j++)
 		{
 			float64_t kij = m_kernel->kernel(i,j);
 
 			for (k=0; k<m_target_dim; k++)
-				new_feature_matrix[k+i*m_target_dim] += kij*m_transformation_matrix.matrix[(n-k-1)*n+j];
+				new_feature_matrix[k+i*m_target_dim] += kij*m_transformation_matrix.matrix[(num_components-k-1)*n+j];
 		}
 	}
 
@@ -166,17 +260,18 @@ SGVector<float64_t> CKernelPCA::apply_to_feature_vector(SGVector<float64_t> vect
 	               m_init_features);
 
 	int32_t j,k;
-	int32_t n = m_transformation_matrix.num_cols;
+	int32_t n = m_transformation_matrix.num_rows;
+	int32_t num_components = m_transformation_matrix.num_cols;
 
 	for (j=0; j<m_target_dim; j++)
-		result.vector[j] = m_bias_vector.vector[j];
+		result.vector[j] = m_bias_vector.vector[num_components-j-1];
 
 	for (j=0; j<n; j++)
 	{
 		float64_t kj = m_kernel->kernel(0,j);
 
 		for (k=0; k<m_target_dim; k++)
-			result.vector[k] += kj*m_transformation_matrix.matrix[(n-k-1)*n+j];
+			result.vector[k] += kj*m_transformation_matrix.matrix[(num_components-k-1)*n+j];
 	}
 
 	m_kernel->cleanup();
@@ -189,7 +284,8 @@ CDenseFeatures<float64_t>* CKernelPCA::apply_to_string_features(CFeatures* featu
 
 	int32_t num_vectors = features->get_num_vectors();
 	int32_t i,j,k;
-	int32_t n = m_transformation_matrix.num_cols;
+	int32_t n = m_transformation_matrix.num_rows;
+	int32_t num_components = m_transformation_matrix.num_cols;
 
 	m_kernel->init(features,m_init_features);
 
@@ -198,14 +294,14 @@ CDenseFeatures<float64_t>* CKernelPCA::apply_to_string_features(CFeatures* featu
 	for (i=0; i<num_vectors; i++)
 	{
 		for (j=0; j<m_target_dim; j++)
-			new_feature_matrix[i*m_target_dim+j] = m_bias_vector.vector[j];
+			new_feature_matrix[i*m_target_dim+j] = m_bias_vector.vector[num_components-j-1];
 
 		for (j=0; j<n; j++)
 		{
 			float64_t kij = m_kernel->kernel(i,j);
 
 			for (k=0; k<m_target_dim; k++)
-				new_feature_matrix[k+i*m_target_dim] += kij*m_transformation_matrix.matrix[(n-k-1)*n+j];
+				new_feature_matrix[k+i*m_target_dim] += kij*m_transformation_matrix.matrix[(num_components-k-1)*n+j];
 		}
 	}
 
@@ -14,6 +14,7 @@
 #ifdef HAVE_LAPACK
 
 #include <shogun/preprocessor/DimensionReductionPreprocessor.h>
+#include <shogun/preprocessor/PCA.h>
 #include <shogun/features/Features.h>
 #include <shogun/kernel/Kernel.h>
 #include <shogun/lib/common.h>
@@ -31,6 +32,12 @@ class CKernel;
  * Advances in kernel methods support vector learning, 1327(3), 327-352. MIT Press.
  * Retrieved from http://citeseerx.ist.psu.edu/viewdoc/summary?doi=10.1.1.32.8744
  *
+ * By default, the centered kernel matrix is fully eigendecomposed. With the
+ * RANDOMIZED method (see set_method), only the target dimension plus an
+ * oversampling of eigenvectors are approximated with randomized subspace
+ * iteration, see RandomizedEigenSolver. This reduces the time complexity of
+ * the decomposition from O(N^3) to O(N^2 L) and only the approximated
+ * eigenvectors are kept.
  */
 class CKernelPCA: public CDimensionReductionPreprocessor
 {
@@ -81,6 +88,32 @@ public:
 			return m_bias_vector;
 		}
 
+		/** set method used to decompose the kernel matrix
+		 * @param method RANDOMIZED, any other method decomposes the full
+		 * kernel matrix
+		 */
+		void set_method(EPCAMethod method);
+
+		/** @return method used to decompose the kernel matrix */
+		EPCAMethod get_method() const;
+
+		/** set number of vectors sketched in addition to the target dimension
+		 * by the RANDOMIZED method
+		 * @param oversampling number of additional vectors
+		 */
+		void set_oversampling(int32_t oversampling=10);
+
+		/** @return number of oversampling vectors of the RANDOMIZED method */
+		int32_t get_oversampling() const;
+
+		/** set number of power iterations of the RANDOMIZED method
+		 * @param power_iterations number of power iterations
+		 */
+		void set_power_iterations(int32_t power_iterations=2);
+
+		/** @return number of power iterations of the RANDOMIZED method */
+		int32_t get_power_iterations() const;
+
 		/** @return object name */
 		virtual const char* get_name() const { return "KernelPCA"; }
 
@@ -92,6 +125,15 @@ public:
 		/** default init */
 		void init();
 
+		/** compute the eigenvectors of the centered kernel matrix with
+		 * the RANDOMIZED method
+		 * @param kernel_matrix centered kernel matrix
+		 * @param eigenvalues eigenvalues of the target dimension, ascending
+		 * @return eigenvectors of the target dimension, ascending
+		 */
+		SGMatrix<float64_t> compute_randomized_eigenvectors(
+				SGMatrix<float64_t> kernel_matrix, SGVector<float64_t>& eigenvalues);
+
 	protected:
 
 		/** features used by init. needed for apply */
@@ -106,6 +148,15 @@ public:
 		/** true when already initialized */
 		bool m_initialized;
 
+		/** method used to decompose the kernel matrix */
+		EPCAMethod m_method;
+
+		/** oversampling of the RANDOMIZED method */
+		int32_t m_oversampling;
+
+		/** power iterations of the RANDOMIZED method */
+		int32_t m_power_iterations;
+
 };
 }
 #endif
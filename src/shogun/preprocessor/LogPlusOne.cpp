@@ -12,8 +12,10 @@
 #include <shogun/preprocessor/DensePreprocessor.h>
 #include <shogun/features/Features.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/eigen3.h>
 
 using namespace shogun;
+using namespace Eigen;
 
 CLogPlusOne::CLogPlusOne()
 : CDensePreprocessor<float64_t>()
@@ -83,3 +85,11 @@ SGVector<float64_t> CLogPlusOne::apply_to_feature_vector(SGVector<float64_t> vec
 
 	return SGVector<float64_t>(log_vec,vector.vlen);
 }
+
+SGMatrix<float64_t> CLogPlusOne::apply_to_feature_block(SGMatrix<float64_t> block)
+{
+	Map<ArrayXXd> vectors(block.matrix, block.num_rows, block.num_cols);
+	vectors=(vectors+1.0).log();
+
+	return block;
+}
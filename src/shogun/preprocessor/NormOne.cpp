@@ -12,8 +12,10 @@
 #include <shogun/preprocessor/DensePreprocessor.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/features/Features.h>
+#include <shogun/mathematics/eigen3.h>
 
 using namespace shogun;
+using namespace Eigen;
 
 CNormOne::CNormOne()
 : CDensePreprocessor<float64_t>()
@@ -82,3 +84,13 @@ SGVector<float64_t> CNormOne::apply_to_feature_vector(SGVector<float64_t> vector
 
 	return SGVector<float64_t>(normed_vec,vector.vlen);
 }
+
+SGMatrix<float64_t> CNormOne::apply_to_feature_block(SGMatrix<float64_t> block)
+{
+	Map<MatrixXd> vectors(block.matrix, block.num_rows, block.num_cols);
+
+	for (index_t i=0; i<block.num_cols; i++)
+		vectors.col(i)/=vectors.col(i).norm();
+
+	return block;
+}
@@ -18,6 +18,10 @@
 #include <shogun/features/Features.h>
 #include <shogun/io/SGIO.h>
 #include <shogun/mathematics/eigen3.h>
+#include <shogun/mathematics/linalg/eigsolver/RandomizedEigenSolver.h>
+
+/* number of feature vectors streamed at once by the RANDOMIZED method */
+#define RANDOMIZED_PCA_BLOCK_SIZE 1024
 
 using namespace shogun;
 using namespace Eigen;
@@ -55,6 +59,8 @@ void CPCA::init()
 	m_mem_mode = MEM_REALLOCATE;
 	m_method = AUTO;
 	m_eigenvalue_zero_tolerance=1e-15;
+	m_oversampling=10;
+	m_power_iterations=2;
 
 	SG_ADD(&m_transformation_matrix, "transformation_matrix",
 	    "Transformation matrix (Eigenvectors of covariance matrix).",
@@ -74,6 +80,10 @@ void CPCA::init()
 		"Method used for PCA calculation", MS_NOT_AVAILABLE);
 	SG_ADD(&m_eigenvalue_zero_tolerance, "eigenvalue_zero_tolerance", "zero tolerance"
 	" for determining zero eigenvalues during whitening to avoid numerical issues", MS_NOT_AVAILABLE);
+	SG_ADD(&m_oversampling, "oversampling", "Number of additional vectors "
+	"sketched by the randomized method", MS_NOT_AVAILABLE);
+	SG_ADD(&m_power_iterations, "power_iterations", "Number of power "
+	"iterations of the randomized method", MS_NOT_AVAILABLE);
 }
 
 CPCA::~CPCA()
@@ -87,6 +97,13 @@ bool CPCA::init(CFeatures* features)
 		REQUIRE(features->get_feature_class()==C_DENSE, "PCA only works with dense features")
 		REQUIRE(features->get_feature_type()==F_DREAL, "PCA only works with real features")
 
+		if (m_method == RANDOMIZED)
+		{
+			init_randomized((CDenseFeatures<float64_t>*) features);
+			m_initialized = true;
+			return true;
+		}
+
 		SGMatrix<float64_t> feature_matrix = ((CDenseFeatures<float64_t>*)features)
 									->get_feature_matrix();
 		int32_t num_vectors = feature_matrix.num_cols;
@@ -266,6 +283,168 @@ bool CPCA::init(CFeatures* features)
 	return false;
 }
 
+void CPCA::init_randomized(CDenseFeatures<float64_t>* features)
+{
+	int32_t num_vectors = features->get_num_vectors();
+	int32_t num_features = features->get_num_features();
+	SG_INFO("num_examples: %ld num_features: %ld \n", num_vectors, num_features)
+
+	int32_t max_dim_allowed = CMath::min(num_vectors, num_features);
+	REQUIRE(m_target_dim<=max_dim_allowed,
+		 "target dimension should be less or equal to than minimum of N and D")
+	REQUIRE(m_oversampling>=0, "oversampling (%d) has to be non-negative\n",
+		m_oversampling)
+
+	int32_t num_blocks = (num_vectors+RANDOMIZED_PCA_BLOCK_SIZE-1)/
+		RANDOMIZED_PCA_BLOCK_SIZE;
+
+	/* copies the centered vectors of a block into buffer */
+	auto fetch_block = [&](int32_t block, SGMatrix<float64_t>& buffer) -> int32_t
+	{
+		int32_t start = block*RANDOMIZED_PCA_BLOCK_SIZE;
+		int32_t num = CMath::min(RANDOMIZED_PCA_BLOCK_SIZE, num_vectors-start);
+		if (buffer.num_cols != num)
+			buffer = SGMatrix<float64_t>(num_features, num);
+
+		for (int32_t i=0; i<num; i++)
+		{
+			int32_t len;
+			bool do_free;
+			float64_t* vec = features->get_feature_vector(start+i, len, do_free);
+			memcpy(buffer.get_column_vector(i), vec, num_features*sizeof(float64_t));
+			features->free_feature_vector(vec, start+i, do_free);
+		}
+
+		if (m_mean_vector.vector)
+		{
+			Map<MatrixXd> vectors(buffer.matrix, num_features, num);
+			Map<VectorXd> mean(m_mean_vector.vector, num_features);
+			vectors = vectors.colwise()-mean;
+		}
+		return num;
+	};
+
+	// mean pass
+	m_mean_vector = SGVector<float64_t>();
+	VectorXd sum = VectorXd::Zero(num_features);
+	SGMatrix<float64_t> buffer;
+	for (int32_t b=0; b<num_blocks; b++)
+	{
+		int32_t num = fetch_block(b, buffer);
+		sum += Map<MatrixXd>(buffer.matrix, num_features, num).rowwise().sum();
+	}
+	m_mean_vector = SGVector<float64_t>(num_features);
+	Map<VectorXd>(m_mean_vector.vector, num_features) = sum/num_vectors;
+
+	// product with the covariance matrix, one pass over the data
+	RandomizedEigenSolver::MatrixProduct covariance_product =
+		[&](SGMatrix<float64_t> vectors, SGMatrix<float64_t> result)
+	{
+		Map<MatrixXd> v(vectors.matrix, vectors.num_rows, vectors.num_cols);
+		Map<MatrixXd> r(result.matrix, result.num_rows, result.num_cols);
+		r.setZero();
+
+#pragma omp parallel
+		{
+			SGMatrix<float64_t> block;
+			MatrixXd partial = MatrixXd::Zero(r.rows(), r.cols());
+#pragma omp for schedule(dynamic)
+			for (int32_t b=0; b<num_blocks; b++)
+			{
+				// out-of-core features are not thread-safe, only the products are parallel
+				int32_t num;
+#pragma omp critical (randomized_pca_fetch)
+				num = fetch_block(b, block);
+				Map<MatrixXd> x(block.matrix, num_features, num);
+				partial.noalias() += x*(x.transpose()*v);
+			}
+#pragma omp critical
+			r += partial;
+		}
+		r /= (num_vectors-1);
+	};
+
+	int32_t num_sketch = CMath::min(max_dim_allowed, m_target_dim+m_oversampling);
+	SGMatrix<float64_t> eigenvectors;
+	SG_INFO("Computing %d randomized Eigenvalues ... ", num_sketch)
+	RandomizedEigenSolver::compute(num_features, num_sketch, m_power_iterations,
+		covariance_product, m_eigenvalues_vector, eigenvectors);
+
+	// target dimension
+	num_dim = 0;
+	switch (m_mode)
+	{
+		case FIXED_NUMBER :
+			num_dim = m_target_dim;
+			break;
+
+		case VARIANCE_EXPLAINED :
+			{
+				// the total variance is the trace of the covariance matrix
+				float64_t eig_sum = 0;
+				for (int32_t b=0; b<num_blocks; b++)
+				{
+					int32_t num = fetch_block(b, buffer);
+					eig_sum += Map<MatrixXd>(buffer.matrix, num_features, num).squaredNorm();
+				}
+				eig_sum /= (num_vectors-1);
+
+				float64_t com_sum = 0;
+				for (int32_t i=0; i<num_sketch; i++)
+				{
+					num_dim++;
+					com_sum += m_eigenvalues_vector.vector[i];
+					if (com_sum/eig_sum>=m_thresh)
+						break;
+				}
+				if (com_sum/eig_sum<m_thresh)
+				{
+					SG_WARNING("%d approximated components explain only %f of "
+						"the variance. Consider increasing the target dimension "
+						"or the oversampling.", num_sketch, com_sum/eig_sum)
+				}
+			}
+			break;
+
+		case THRESHOLD :
+			for (int32_t i=0; i<num_sketch; i++)
+			{
+				if (m_eigenvalues_vector.vector[i]>m_thresh)
+					num_dim++;
+				else
+					break;
+			}
+			break;
+	};
+	SG_INFO("Done\nReducing from %i to %i features..", num_features, num_dim)
+
+	m_transformation_matrix = SGMatrix<float64_t>(num_features,num_dim);
+	Map<MatrixXd> transformMatrix(m_transformation_matrix.matrix, num_features, num_dim);
+	num_old_dim = num_features;
+	transformMatrix = Map<MatrixXd>(eigenvectors.matrix, num_features, num_sketch)
+		.leftCols(num_dim);
+	if (m_whitening)
+	{
+		for (int32_t i=0; i<num_dim; i++)
+		{
+			if (CMath::fequals_abs<float64_t>(0.0, m_eigenvalues_vector[i],
+						m_eigenvalue_zero_tolerance))
+			{
+				SG_WARNING("Covariance matrix has almost zero Eigenvalue (ie "
+					"Eigenvalue within a tolerance of %E around 0) at "
+					"dimension %d. Consider reducing its dimension.",
+					m_eigenvalue_zero_tolerance, i+1)
+
+				transformMatrix.col(i) = MatrixXd::Zero(num_features,1);
+				continue;
+			}
+
+			transformMatrix.col(i) /=
+				CMath::sqrt(m_eigenvalues_vector[i]*(num_vectors-1));
+		}
+	}
+}
+
 void CPCA::cleanup()
 {
 	m_transformation_matrix=SGMatrix<float64_t>();
@@ -292,7 +471,7 @@ SGMatrix<float64_t> CPCA::apply_to_feature_matrix(CFeatures* features)
 		{
 			SG_INFO("Preprocessing feature matrix\n")
 			Map<MatrixXd> feature_matrix(m.matrix, num_features, num_vectors);
-			VectorXd data_mean = feature_matrix.rowwise().sum()/(float64_t) num_vectors;
+			Map<VectorXd> data_mean(m_mean_vector.vector, m_mean_vector.vlen);
 			feature_matrix = feature_matrix.colwise()-data_mean;
 
 			feature_matrix.block(0,0,num_dim,num_vectors) =
@@ -319,7 +498,7 @@ SGMatrix<float64_t> CPCA::apply_to_feature_matrix(CFeatures* features)
 		{
 			SG_INFO("Preprocessing feature matrix\n")
 			Map<MatrixXd> feature_matrix(m.matrix, num_features, num_vectors);
-			VectorXd data_mean = feature_matrix.rowwise().sum()/(float64_t) num_vectors;
+			Map<VectorXd> data_mean(m_mean_vector.vector, m_mean_vector.vlen);
 			feature_matrix = feature_matrix.colwise()-data_mean;
 
 			ret_matrix = transform_matrix.transpose()*feature_matrix;
@@ -346,6 +525,42 @@ SGVector<float64_t> CPCA::apply_to_feature_vector(SGVector<float64_t> vector)
 	return result;
 }
 
+SGMatrix<float64_t> CPCA::apply_to_feature_block(SGMatrix<float64_t> block)
+{
+	ASSERT(m_initialized)
+
+	Map<MatrixXd> vectors(block.matrix, block.num_rows, block.num_cols);
+
+	Map<VectorXd> mean(m_mean_vector.vector, m_mean_vector.vlen);
+	Map<MatrixXd> transform_matrix(m_transformation_matrix.matrix,
+		m_transformation_matrix.num_rows, m_transformation_matrix.num_cols);
+
+	vectors=vectors.colwise()-mean;
+
+	if (m_mem_mode == MEM_IN_PLACE)
+	{
+		/* the projection of a column only overwrites columns which have
+		 * already been projected */
+		VectorXd projected(num_dim);
+		for (index_t col=0; col<block.num_cols; col++)
+		{
+			projected.noalias()=transform_matrix.transpose()*vectors.col(col);
+			memcpy(block.matrix+int64_t(col)*num_dim, projected.data(),
+				sizeof(float64_t)*num_dim);
+		}
+
+		SGMatrix<float64_t> result=block;
+		result.num_rows=num_dim;
+		return result;
+	}
+
+	SGMatrix<float64_t> result(num_dim, block.num_cols);
+	Map<MatrixXd> result_matrix(result.matrix, num_dim, block.num_cols);
+	result_matrix.noalias()=transform_matrix.transpose()*vectors;
+
+	return result;
+}
+
 SGMatrix<float64_t> CPCA::get_transformation_matrix()
 {
 	return m_transformation_matrix;
@@ -381,3 +596,24 @@ float64_t CPCA::get_eigenvalue_zero_tolerance() const
 	return m_eigenvalue_zero_tolerance;
 }
 
+
+
+void CPCA::set_oversampling(int32_t oversampling)
+{
+	m_oversampling = oversampling;
+}
+
+int32_t CPCA::get_oversampling() const
+{
+	return m_oversampling;
+}
+
+void CPCA::set_power_iterations(int32_t power_iterations)
+{
+	m_power_iterations = power_iterations;
+}
+
+int32_t CPCA::get_power_iterations() const
+{
+	return m_power_iterations;
+}
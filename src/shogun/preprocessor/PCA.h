@@ -34,7 +34,13 @@ enum EPCAMethod
 	/** Eigenvalue decomposition of covariance matrix.
 	 * Time complexity ~10d^3 (d-dimensions n-number of vectors)
 	 */
-	EVD = 30
+	EVD = 30,
+	/** Randomized truncated eigenvalue decomposition of the covariance
+	 * matrix, the data is streamed block-wise through the feature vectors.
+	 * Time complexity ~(q+2)2dnl (l-target dims plus oversampling,
+	 * q-power iterations)
+	 */
+	RANDOMIZED = 40
 };
 
 /** mode of pca */
@@ -74,7 +80,7 @@ enum EPCAMemoryMode
  * transformation matrix is essentially a DxT matrix, the columns of which correspond
  * to the eigenvectors of the covariance matrix(XX') having top T eigenvalues.
  *
- * This class provides 3 method options to compute the transformation matrix :
+ * This class provides 4 method options to compute the transformation matrix :
  * <em>EVD</em> : Eigen Value Decomposition of Covariance Matrix (\f$XX^T\f$)
  * The covariance matrix \f$XX^T\f$ is first formed internally and then
  * its eigenvectors and eigenvalues are computed.
@@ -88,6 +94,16 @@ enum EPCAMemoryMode
  * using the formula \f$e_i = \frac{\sqrt{d_i}}{N-1}\f$.
  * The time complexity of this method is \f$~14DN^2\f$ and should be used when N < D.
  *
+ * <em>RANDOMIZED</em> : Randomized truncated decomposition of the covariance matrix
+ * The covariance matrix is never formed. Instead, products of it with a block of
+ * \f$L=T+P\f$ vectors (P oversampling vectors, see set_oversampling) are computed
+ * by streaming the feature vectors in blocks, so out-of-core features such as
+ * CMemoryMappedDenseFeatures or CHDF5DenseFeatures are never loaded at once. A
+ * random sketch of the range of the covariance matrix is refined by Q power
+ * iterations (see set_power_iterations), see RandomizedEigenSolver.
+ * The time complexity of this method is \f$~2(Q+2)DNL\f$ and should be used when
+ * only few components of large data are needed. In VARIANCE_EXPLAINED and THRESHOLD
+ * modes, T is chosen among the L approximated components.
  * <em>AUTO</em> : This mode automagically chooses one of the above modes for the user
  * based on whether N > D (chooses EVD) or N < D (chooses SVD).
  *
@@ -118,7 +134,7 @@ class CPCA: public CDimensionReductionPreprocessor
 		 * @param do_whitening normalize columns(eigenvectors) in transformation matrix
 		 * @param mode mode of pca : FIXED_NUMBER/VARIANCE_EXPLAINED/THRESHOLD
 		 * @param thresh threshold value for VARIANCE_EXPLAINED or THRESHOLD mode
-		 * @param method Matrix decomposition method used : SVD/EVD/AUTO[default]
+		 * @param method Matrix decomposition method used : SVD/EVD/RANDOMIZED/AUTO[default]
 		 * @param mem_mode memory usage mode of PCA : MEM_REALLOCATE/MEM_IN_PLACE
 		 */
 		CPCA(bool do_whitening=false, EPCAMode mode=FIXED_NUMBER, float64_t thresh=1e-6,
@@ -126,7 +142,7 @@ class CPCA: public CDimensionReductionPreprocessor
 
 		/** special constructor for FIXED_NUMBER mode
 		 *
-		 * @param method Matrix decomposition method used : SVD/EVD/AUTO[default]
+		 * @param method Matrix decomposition method used : SVD/EVD/RANDOMIZED/AUTO[default]
 		 * @param do_whitening normalize columns(eigenvectors) in transformation matrix
 		 * @param mem memory usage mode of PCA : MEM_REALLOCATE/MEM_IN_PLACE
 		 */
@@ -143,7 +159,9 @@ class CPCA: public CDimensionReductionPreprocessor
 		/** cleanup */
 		virtual void cleanup();
 
-		/** apply preprocessor to feature matrix
+		/** apply preprocessor to feature matrix. As in
+		 * apply_to_feature_vector, the mean of the data given to init() is
+		 * subtracted.
 		 * @param features features
 		 * @return processed feature matrix
 		 */
@@ -155,6 +173,25 @@ class CPCA: public CDimensionReductionPreprocessor
 		 */
 		virtual SGVector<float64_t> apply_to_feature_vector(SGVector<float64_t> vector);
 
+		/** apply preprocessor to a block of feature vectors. As in
+		 * apply_to_feature_vector, the mean of the data given to init() is
+		 * subtracted. The block is overwritten. With MEM_IN_PLACE, the
+		 * result is stored in the memory of the block.
+		 *
+		 * @param block feature vectors, one per column
+		 * @return processed feature vectors
+		 */
+		virtual SGMatrix<float64_t> apply_to_feature_block(SGMatrix<float64_t> block);
+
+		/** @return whether blocks can be processed in parallel, which is
+		 * not the case with MEM_IN_PLACE, since the parallel pipeline
+		 * allocates a new feature matrix when the dimension changes
+		 */
+		virtual bool supports_parallel_blocks() const
+		{
+			return m_mem_mode != MEM_IN_PLACE;
+		}
+
 		/** get transformation matrix, i.e. eigenvectors (potentially scaled if
 		 * do_whitening is true)
 		 */
@@ -192,10 +229,33 @@ class CPCA: public CDimensionReductionPreprocessor
 		 */
 		float64_t get_eigenvalue_zero_tolerance() const;
 
+		/** set number of vectors sketched in addition to the target dimension
+		 * by the RANDOMIZED method
+		 * @param oversampling number of additional vectors
+		 */
+		void set_oversampling(int32_t oversampling=10);
+
+		/** @return number of oversampling vectors of the RANDOMIZED method */
+		int32_t get_oversampling() const;
+
+		/** set number of power iterations of the RANDOMIZED method, each one
+		 * is a pass over the data
+		 * @param power_iterations number of power iterations
+		 */
+		void set_power_iterations(int32_t power_iterations=2);
+
+		/** @return number of power iterations of the RANDOMIZED method */
+		int32_t get_power_iterations() const;
+
 	protected:
 
 		void init();
 
+		/** compute the transformation matrix with the RANDOMIZED method
+		 * @param features real valued dense features
+		 */
+		void init_randomized(CDenseFeatures<float64_t>* features);
+
 	protected:
 
 		/** transformation matrix */
@@ -225,6 +285,10 @@ class CPCA: public CDimensionReductionPreprocessor
 		 * whitening to tackle numerical issues
 		 */
 		float64_t m_eigenvalue_zero_tolerance;
+		/** oversampling of the RANDOMIZED method */
+		int32_t m_oversampling;
+		/** power iterations of the RANDOMIZED method */
+		int32_t m_power_iterations;
 };
 }
 #endif // PCA_H_
@@ -187,6 +187,32 @@ SGVector<float64_t> CPruneVarSubMean::apply_to_feature_vector(SGVector<float64_t
 	return SGVector<float64_t>(ret,m_num_idx);
 }
 
+SGMatrix<float64_t> CPruneVarSubMean::apply_to_feature_block(SGMatrix<float64_t> block)
+{
+	ASSERT(m_initialized)
+
+	SGMatrix<float64_t> result(m_num_idx, block.num_cols);
+
+	for (index_t vec=0; vec<block.num_cols; vec++)
+	{
+		float64_t* v_src=block.get_column_vector(vec);
+		float64_t* v_dst=result.get_column_vector(vec);
+
+		if (m_divide_by_std)
+		{
+			for (int32_t feat=0; feat<m_num_idx; feat++)
+				v_dst[feat]=(v_src[m_idx[feat]]-m_mean[feat])/m_std[feat];
+		}
+		else
+		{
+			for (int32_t feat=0; feat<m_num_idx; feat++)
+				v_dst[feat]=(v_src[m_idx[feat]]-m_mean[feat]);
+		}
+	}
+
+	return result;
+}
+
 void CPruneVarSubMean::init()
 {
 	m_initialized = false;
@@ -54,6 +54,13 @@ class CPruneVarSubMean : public CDensePreprocessor<float64_t>
 		/// result in feature matrix
 		virtual SGVector<float64_t> apply_to_feature_vector(SGVector<float64_t> vector);
 
+		/// apply preproc on a block of feature vectors
+		/// result in a new matrix of the pruned dimension
+		virtual SGMatrix<float64_t> apply_to_feature_block(SGMatrix<float64_t> block);
+
+		/// @return true, blocks can be processed in parallel
+		virtual bool supports_parallel_blocks() const { return true; }
+
 		/** @return object name */
 		virtual const char* get_name() const { return "PruneVarSubMean"; }
 
@@ -9,8 +9,10 @@
  */
 
 #include <shogun/preprocessor/RescaleFeatures.h>
+#include <shogun/mathematics/eigen3.h>
 
 using namespace shogun;
+using namespace Eigen;
 
 CRescaleFeatures::CRescaleFeatures()
  : CDensePreprocessor<float64_t>(),
@@ -112,6 +114,21 @@ SGVector<float64_t> CRescaleFeatures::apply_to_feature_vector(SGVector<float64_t
 	return SGVector<float64_t>(ret,vector.vlen);
 }
 
+SGMatrix<float64_t> CRescaleFeatures::apply_to_feature_block(SGMatrix<float64_t> block)
+{
+	ASSERT(m_initialized);
+	ASSERT(m_min.vlen == block.num_rows);
+
+	Map<ArrayXXd> vectors(block.matrix, block.num_rows, block.num_cols);
+	Map<ArrayXd> min(m_min.vector, m_min.vlen);
+	Map<ArrayXd> range(m_range.vector, m_range.vlen);
+
+	vectors.colwise() -= min;
+	vectors.colwise() *= range;
+
+	return block;
+}
+
 void CRescaleFeatures::register_parameters()
 {
 	SG_ADD(&m_min, "min", "minimum values of each feature", MS_NOT_AVAILABLE);
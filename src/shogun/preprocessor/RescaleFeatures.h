@@ -61,6 +61,14 @@ namespace shogun
 			 */
 			virtual SGVector<float64_t> apply_to_feature_vector(SGVector<float64_t> vector);
 
+			/**
+			 * Apply preproc on a block of feature vectors, in place
+			 */
+			virtual SGMatrix<float64_t> apply_to_feature_block(SGMatrix<float64_t> block);
+
+			/** @return true, blocks can be processed in parallel */
+			virtual bool supports_parallel_blocks() const { return true; }
+
 			/** @return object name */
 			virtual const char* get_name() const { return "RescaleFeatures"; }
 
@@ -0,0 +1,684 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <shogun/regression/ElasticNetRegression.h>
+#include <shogun/features/DotFeatures.h>
+#include <shogun/labels/RegressionLabels.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/lib/Signal.h>
+#include <shogun/lib/Metrics.h>
+#include <shogun/base/Parameter.h>
+
+#include <string.h>
+
+using namespace shogun;
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace shogun
+{
+/** Coordinate descent for the elastic net on centered and scaled features,
+ * which are stored by feature. The solver is warm started: solve() starts
+ * from the solution of the previous regularization constant. */
+class ElasticNetSolver
+{
+public:
+	ElasticNetSolver(CDotFeatures* features, SGVector<float64_t> labels,
+			bool standardize, EElasticNetUpdate update)
+	{
+		n=features->get_num_vectors();
+		p=features->get_dim_feature_space();
+
+		init_columns(features);
+		init_statistics(labels, standardize);
+
+		covariance=(update==ENU_COVARIANCE || (update==ENU_AUTO && p<=500));
+
+		beta=SGVector<float64_t>(p);
+		beta.zero();
+		grad=SGVector<float64_t>(p);
+		memcpy(grad.vector, xty.vector, sizeof(float64_t)*p);
+
+		in_working=SGVector<bool>(p);
+		SGVector<bool>::fill_vector(in_working.vector, p, false);
+
+		if (covariance)
+		{
+			cov_slot=SGVector<int32_t>(p);
+			cov_slot.set_const(-1);
+			cov_grad=SGVector<float64_t>(p);
+			memcpy(cov_grad.vector, xty.vector, sizeof(float64_t)*p);
+		}
+		else
+		{
+			residual=SGVector<float64_t>(n);
+			memcpy(residual.vector, yc.vector, sizeof(float64_t)*n);
+			residual_sum=0;
+		}
+
+		sweeps=0;
+		kkt_violations=0;
+	}
+
+	/** @return smallest regularization constant with all weights zero */
+	float64_t lambda_max(float64_t alpha) const
+	{
+		float64_t result=0;
+		for (int32_t j=0; j<p; j++)
+		{
+			if (!constant[j])
+				result=CMath::max(result, CMath::abs(xty[j]));
+		}
+
+		return result/alpha;
+	}
+
+	/** solve for a regularization constant
+	 *
+	 * @return false if the maximal number of sweeps was reached
+	 */
+	bool solve(float64_t lambda, float64_t lambda_prev, float64_t lambda_max,
+			float64_t alpha, float64_t epsilon, int32_t max_sweeps)
+	{
+		const float64_t l1=lambda*alpha;
+		const float64_t l2=lambda*(1-alpha);
+		const float64_t threshold=epsilon*(null_variance>0 ? null_variance : 1);
+
+		/* the SAFE rule holds for the lasso only */
+		SGVector<bool> discarded(p);
+		const float64_t safe_slack=alpha==1 && lambda_max>0 ?
+			CMath::sqrt(1.0/n)*y_norm*(lambda_max-lambda)/lambda_max : -1;
+
+		for (int32_t j=0; j<p; j++)
+		{
+			discarded[j]=constant[j] || (safe_slack>=0 && beta[j]==0 &&
+					CMath::abs(xty[j])<l1-CMath::sqrt(var[j])*safe_slack);
+		}
+
+		/* sequential strong rule, features which were nonzero once stay */
+		const float64_t strong=alpha*(2*lambda-lambda_prev);
+		for (int32_t j=0; j<p; j++)
+		{
+			if (!in_working[j] && !discarded[j] && CMath::abs(grad[j])>=strong)
+				add_to_working_set(j);
+		}
+
+		while (true)
+		{
+			if (!descend(l1, l2, threshold, max_sweeps))
+				return false;
+
+			compute_gradient(discarded);
+
+			int32_t num_violations=0;
+			for (int32_t j=0; j<p; j++)
+			{
+				if (!in_working[j] && !discarded[j] && CMath::abs(grad[j])>l1)
+				{
+					add_to_working_set(j);
+					num_violations++;
+				}
+			}
+
+			kkt_violations+=num_violations;
+			if (!num_violations)
+				return true;
+		}
+	}
+
+	/** weights and bias of the current solution for the original features */
+	SGSparseVector<float64_t> get_w(float64_t& bias) const
+	{
+		int32_t nnz=0;
+		for (int32_t j=0; j<p; j++)
+			nnz+=(beta[j]!=0);
+
+		SGSparseVector<float64_t> w(nnz);
+		bias=y_mean;
+		for (int32_t j=0, k=0; j<p; j++)
+		{
+			if (beta[j]!=0)
+			{
+				w.features[k].feat_index=j;
+				w.features[k].entry=beta[j]/scale[j];
+				bias-=w.features[k].entry*mean[j];
+				k++;
+			}
+		}
+
+		return w;
+	}
+
+	/** number of coordinate descent sweeps so far */
+	int32_t sweeps;
+
+	/** number of features which were added by the optimality check */
+	int32_t kkt_violations;
+
+private:
+	/** store the features by feature */
+	void init_columns(CDotFeatures* features)
+	{
+		col_start=SGVector<int64_t>(p+1);
+		col_start.zero();
+
+		int32_t index;
+		float64_t value;
+		for (int32_t i=0; i<n; i++)
+		{
+			void* it=features->get_feature_iterator(i);
+			REQUIRE(it, "%s does not provide a feature iterator\n",
+					features->get_name())
+
+			while (features->get_next_feature(index, value, it))
+			{
+				if (value!=0)
+					col_start[index+1]++;
+			}
+			features->free_feature_iterator(it);
+		}
+
+		for (int32_t j=0; j<p; j++)
+			col_start[j+1]+=col_start[j];
+
+		rows=SGVector<int32_t>(col_start[p]);
+		values=SGVector<float64_t>(col_start[p]);
+
+		SGVector<int64_t> pos(p);
+		memcpy(pos.vector, col_start.vector, sizeof(int64_t)*p);
+
+		for (int32_t i=0; i<n; i++)
+		{
+			void* it=features->get_feature_iterator(i);
+			while (features->get_next_feature(index, value, it))
+			{
+				if (value!=0)
+				{
+					rows[pos[index]]=i;
+					values[pos[index]++]=value;
+				}
+			}
+			features->free_feature_iterator(it);
+		}
+	}
+
+	/** means and scales of the features, centered labels */
+	void init_statistics(SGVector<float64_t> labels, bool standardize)
+	{
+		mean=SGVector<float64_t>(p);
+		scale=SGVector<float64_t>(p);
+		var=SGVector<float64_t>(p);
+		constant=SGVector<bool>(p);
+
+		y_mean=0;
+		for (int32_t i=0; i<n; i++)
+			y_mean+=labels[i];
+		y_mean/=n;
+
+		yc=SGVector<float64_t>(n);
+		y_norm=0;
+		for (int32_t i=0; i<n; i++)
+		{
+			yc[i]=labels[i]-y_mean;
+			y_norm+=yc[i]*yc[i];
+		}
+		null_variance=y_norm/n;
+		y_norm=CMath::sqrt(y_norm);
+
+		xty=SGVector<float64_t>(p);
+
+#pragma omp parallel for schedule(dynamic, 64)
+		for (int32_t j=0; j<p; j++)
+		{
+			float64_t sum=0, sum_sq=0, dot=0;
+			for (int64_t k=col_start[j]; k<col_start[j+1]; k++)
+			{
+				sum+=values[k];
+				sum_sq+=values[k]*values[k];
+				dot+=values[k]*yc[rows[k]];
+			}
+
+			mean[j]=sum/n;
+			const float64_t variance=sum_sq/n-mean[j]*mean[j];
+			constant[j]=variance<=1e-14*CMath::max(1.0, sum_sq/n);
+
+			scale[j]=standardize && !constant[j] ? CMath::sqrt(variance) : 1;
+			var[j]=constant[j] ? 0 : variance/(scale[j]*scale[j]);
+
+			/* the labels are centered, so centering the feature is void */
+			xty[j]=constant[j] ? 0 : dot/(n*scale[j]);
+		}
+	}
+
+	/** sum of the nonzeros of feature j times a dense vector */
+	inline float64_t column_dot(int32_t j, const float64_t* vec) const
+	{
+		float64_t result=0;
+		for (int64_t k=col_start[j]; k<col_start[j+1]; k++)
+			result+=values[k]*vec[rows[k]];
+
+		return result;
+	}
+
+	/** gradient of the loss in direction of feature j */
+	inline float64_t gradient(int32_t j) const
+	{
+		if (covariance)
+		{
+			float64_t result=xty[j];
+			for (size_t s=0; s<cov_features.size(); s++)
+				result-=cov_columns[s][j]*beta[cov_features[s]];
+
+			return result;
+		}
+
+		/* the mean of the residual cancels out since the feature is centered */
+		return (column_dot(j, residual.vector)-mean[j]*residual_sum)/(n*scale[j]);
+	}
+
+	/** compute the gradient of all features which were not discarded */
+	void compute_gradient(const SGVector<bool>& discarded)
+	{
+#pragma omp parallel for schedule(dynamic, 64)
+		for (int32_t j=0; j<p; j++)
+			grad[j]=discarded[j] ? 0 : gradient(j);
+	}
+
+	void add_to_working_set(int32_t j)
+	{
+		in_working[j]=true;
+		working.push_back(j);
+
+		if (covariance)
+			cov_grad[j]=gradient(j);
+	}
+
+	/** inner products of all features with feature j, divided by n */
+	void add_covariance_column(int32_t j)
+	{
+		SGVector<float64_t> x(n);
+		x.zero();
+		for (int64_t k=col_start[j]; k<col_start[j+1]; k++)
+			x[rows[k]]=values[k];
+
+		SGVector<float64_t> column(p);
+#pragma omp parallel for schedule(dynamic, 64)
+		for (int32_t l=0; l<p; l++)
+		{
+			column[l]=constant[l] ? 0 : (column_dot(l, x.vector)-n*mean[l]*mean[j])/
+				(n*scale[l]*scale[j]);
+		}
+
+		cov_slot[j]=cov_features.size();
+		cov_features.push_back(j);
+		cov_columns.push_back(column);
+	}
+
+	/** change weight j by delta and update the residual or gradients */
+	void update(int32_t j, float64_t delta)
+	{
+		beta[j]+=delta;
+
+		if (covariance)
+		{
+			if (cov_slot[j]<0)
+				add_covariance_column(j);
+
+			const float64_t* column=cov_columns[cov_slot[j]].vector;
+			for (size_t w=0; w<working.size(); w++)
+				cov_grad[working[w]]-=column[working[w]]*delta;
+		}
+		else
+		{
+			const float64_t factor=delta/scale[j];
+			for (int64_t k=col_start[j]; k<col_start[j+1]; k++)
+				residual[rows[k]]-=factor*values[k];
+
+			residual_sum-=factor*n*mean[j];
+		}
+	}
+
+	/** one sweep over the working set or only its nonzero weights
+	 *
+	 * @return largest change of the loss due to a single update
+	 */
+	float64_t sweep(float64_t l1, float64_t l2, bool only_active)
+	{
+		float64_t max_change=0;
+		for (size_t w=0; w<working.size(); w++)
+		{
+			const int32_t j=working[w];
+			if (only_active && beta[j]==0)
+				continue;
+
+			const float64_t z=(covariance ? cov_grad[j] : gradient(j))+var[j]*beta[j];
+			const float64_t shrunk=CMath::sign(z)*CMath::max(0.0, CMath::abs(z)-l1);
+			const float64_t delta=shrunk/(var[j]+l2)-beta[j];
+
+			if (delta!=0)
+			{
+				update(j, delta);
+				max_change=CMath::max(max_change, var[j]*delta*delta);
+			}
+		}
+
+		sweeps++;
+		return max_change;
+	}
+
+	/** cycle over the working set until the nonzero weights do not change,
+	 * then over the nonzero weights until convergence, and repeat until a
+	 * sweep over the working set does not change anything
+	 *
+	 * @return false if the maximal number of sweeps was reached
+	 */
+	bool descend(float64_t l1, float64_t l2, float64_t threshold,
+			int32_t max_sweeps)
+	{
+		while (sweeps<max_sweeps && !CSignal::cancel_computations())
+		{
+			if (sweep(l1, l2, false)<threshold)
+				return true;
+
+			while (sweeps<max_sweeps && sweep(l1, l2, true)>=threshold);
+		}
+
+		return false;
+	}
+
+private:
+	/** number of vectors */
+	int32_t n;
+	/** number of features */
+	int32_t p;
+
+	/** start of every feature in rows and values */
+	SGVector<int64_t> col_start;
+	/** vector indices of the nonzeros */
+	SGVector<int32_t> rows;
+	/** nonzero values */
+	SGVector<float64_t> values;
+
+	/** feature means */
+	SGVector<float64_t> mean;
+	/** feature scales */
+	SGVector<float64_t> scale;
+	/** variances of the scaled features */
+	SGVector<float64_t> var;
+	/** whether a feature is constant */
+	SGVector<bool> constant;
+
+	/** mean of the labels */
+	float64_t y_mean;
+	/** centered labels */
+	SGVector<float64_t> yc;
+	/** norm of the centered labels */
+	float64_t y_norm;
+	/** variance of the labels */
+	float64_t null_variance;
+	/** inner products of the scaled features with the labels, divided by n */
+	SGVector<float64_t> xty;
+
+	/** weights of the scaled features */
+	SGVector<float64_t> beta;
+	/** gradient of all features at the last optimality check */
+	SGVector<float64_t> grad;
+
+	/** features the coordinate descent works on */
+	std::vector<int32_t> working;
+	/** whether a feature is in the working set */
+	SGVector<bool> in_working;
+
+	/** whether covariance updates are used */
+	bool covariance;
+	/** residual without the mean of the features, for naive updates */
+	SGVector<float64_t> residual;
+	/** sum of the residual */
+	float64_t residual_sum;
+	/** gradient of the working set, for covariance updates */
+	SGVector<float64_t> cov_grad;
+	/** features with covariance columns */
+	std::vector<int32_t> cov_features;
+	/** covariance columns of the features which were nonzero once */
+	std::vector<SGVector<float64_t> > cov_columns;
+	/** slot of every feature in cov_columns, -1 if none */
+	SGVector<int32_t> cov_slot;
+};
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+CElasticNetRegression::CElasticNetRegression()
+: CLinearMachine()
+{
+	init();
+}
+
+CElasticNetRegression::CElasticNetRegression(float64_t alpha,
+		CDotFeatures* data, CLabels* lab)
+: CLinearMachine()
+{
+	init();
+
+	set_alpha(alpha);
+	set_labels(lab);
+	set_features(data);
+}
+
+CElasticNetRegression::~CElasticNetRegression()
+{
+}
+
+void CElasticNetRegression::init()
+{
+	m_alpha=1;
+	m_num_lambdas=100;
+	m_lambda_min_ratio=0;
+	m_epsilon=1e-7;
+	m_max_iterations=100000;
+	m_max_non_zero=0;
+	m_standardize=true;
+	m_update_type=ENU_AUTO;
+
+	/* the bias is part of every solution on the path */
+	set_compute_bias(false);
+
+	SG_ADD(&m_alpha, "alpha", "Mixing of L1 and L2 penalty", MS_AVAILABLE);
+	SG_ADD(&m_num_lambdas, "num_lambdas", "Number of regularization constants",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_lambda_min_ratio, "lambda_min_ratio",
+			"Smallest regularization constant relative to the largest",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_lambdas, "lambdas", "Regularization constants", MS_NOT_AVAILABLE);
+	SG_ADD(&m_epsilon, "epsilon", "Convergence tolerance", MS_NOT_AVAILABLE);
+	SG_ADD(&m_max_iterations, "max_iterations", "Maximal number of sweeps",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_max_non_zero, "max_non_zero", "Maximal number of nonzero weights",
+			MS_NOT_AVAILABLE);
+	SG_ADD(&m_standardize, "standardize", "Whether features are scaled",
+			MS_NOT_AVAILABLE);
+	SG_ADD((machine_int_t*) &m_update_type, "update_type",
+			"How gradients are computed", MS_NOT_AVAILABLE);
+	SG_ADD(&m_path_lambdas, "path_lambdas",
+			"Regularization constants of the path", MS_NOT_AVAILABLE);
+	SG_ADD(&m_path_bias, "path_bias", "Biases of the regularization path",
+			MS_NOT_AVAILABLE);
+}
+
+void CElasticNetRegression::set_alpha(float64_t alpha)
+{
+	REQUIRE(alpha>0 && alpha<=1, "Alpha (%f) has to be in (0,1]\n", alpha)
+	m_alpha=alpha;
+}
+
+void CElasticNetRegression::set_num_lambdas(int32_t num)
+{
+	REQUIRE(num>0, "Number of regularization constants (%d) has to be "
+			"positive\n", num)
+	m_num_lambdas=num;
+}
+
+void CElasticNetRegression::set_lambda_min_ratio(float64_t ratio)
+{
+	REQUIRE(ratio>=0 && ratio<1, "Ratio (%f) has to be in [0,1)\n", ratio)
+	m_lambda_min_ratio=ratio;
+}
+
+void CElasticNetRegression::set_lambdas(SGVector<float64_t> lambdas)
+{
+	for (index_t i=0; i<lambdas.vlen; i++)
+	{
+		REQUIRE(lambdas[i]>=0 && (i==0 || lambdas[i]<=lambdas[i-1]),
+				"Regularization constants have to be non-negative and "
+				"decreasing\n")
+	}
+
+	m_lambdas=lambdas;
+}
+
+void CElasticNetRegression::set_epsilon(float64_t epsilon)
+{
+	REQUIRE(epsilon>0, "Epsilon (%f) has to be positive\n", epsilon)
+	m_epsilon=epsilon;
+}
+
+void CElasticNetRegression::set_max_iterations(int32_t max_iter)
+{
+	REQUIRE(max_iter>0, "Maximal number of sweeps (%d) has to be positive\n",
+			max_iter)
+	m_max_iterations=max_iter;
+}
+
+SGVector<float64_t> CElasticNetRegression::get_path_w(int32_t index) const
+{
+	REQUIRE(index>=0 && index<get_path_size(), "Index (%d) is not on the "
+			"path of %d solutions\n", index, get_path_size())
+
+	SGVector<float64_t> result(w.vlen);
+	result.zero();
+
+	const SGSparseVector<float64_t>& sparse=m_path_w[index];
+	for (index_t k=0; k<sparse.num_feat_entries; k++)
+		result[sparse.features[k].feat_index]=sparse.features[k].entry;
+
+	return result;
+}
+
+float64_t CElasticNetRegression::get_path_bias(int32_t index) const
+{
+	REQUIRE(index>=0 && index<get_path_size(), "Index (%d) is not on the "
+			"path of %d solutions\n", index, get_path_size())
+
+	return m_path_bias[index];
+}
+
+SGSparseVector<float64_t> CElasticNetRegression::get_path_sparse_w(
+		int32_t index) const
+{
+	REQUIRE(index>=0 && index<get_path_size(), "Index (%d) is not on the "
+			"path of %d solutions\n", index, get_path_size())
+
+	return m_path_w[index];
+}
+
+void CElasticNetRegression::switch_w(int32_t index)
+{
+	set_w(get_path_w(index));
+	set_bias(get_path_bias(index));
+}
+
+bool CElasticNetRegression::train_machine(CFeatures* data)
+{
+	REQUIRE(m_labels, "No labels set\n")
+	REQUIRE(m_labels->get_label_type()==LT_REGRESSION,
+			"Labels have to be of type RegressionLabels\n")
+
+	if (data)
+	{
+		REQUIRE(data->has_property(FP_DOT), "Specified features are not of "
+				"type CDotFeatures\n")
+		set_features((CDotFeatures*) data);
+	}
+	REQUIRE(features, "No features provided and no features previously set\n")
+
+	const int32_t num_vec=features->get_num_vectors();
+	const int32_t num_feat=features->get_dim_feature_space();
+	REQUIRE(num_vec==m_labels->get_num_labels(), "Number of training vectors "
+			"(%d) does not match number of labels (%d)\n", num_vec,
+			m_labels->get_num_labels())
+
+	ElasticNetSolver solver(features,
+			((CRegressionLabels*) m_labels)->get_labels(), m_standardize,
+			m_update_type);
+
+	const float64_t lambda_max=solver.lambda_max(m_alpha);
+	SGVector<float64_t> lambdas=m_lambdas;
+	if (!lambdas.vlen)
+	{
+		float64_t ratio=m_lambda_min_ratio;
+		if (ratio==0)
+			ratio=num_vec>num_feat ? 1e-4 : 1e-2;
+
+		lambdas=SGVector<float64_t>(m_num_lambdas);
+		for (int32_t k=0; k<m_num_lambdas; k++)
+		{
+			lambdas[k]=m_num_lambdas>1 ?
+				lambda_max*CMath::pow(ratio, float64_t(k)/(m_num_lambdas-1)) :
+				lambda_max;
+		}
+	}
+
+	m_path_w.clear();
+	m_path_bias=SGVector<float64_t>(lambdas.vlen);
+	w=SGVector<float64_t>(num_feat);
+
+	float64_t lambda_prev=lambda_max;
+	int32_t k;
+	for (k=0; k<lambdas.vlen; k++)
+	{
+		const int32_t sweeps=solver.sweeps;
+		const int32_t violations=solver.kkt_violations;
+		const bool converged=solver.solve(lambdas[k],
+				CMath::max(lambda_prev, lambdas[k]), lambda_max, m_alpha,
+				m_epsilon, m_max_iterations);
+
+		SG_METRIC_ADD(this, "elasticnet_sweeps", solver.sweeps-sweeps)
+		SG_METRIC_ADD(this, "elasticnet_kkt_violations",
+				solver.kkt_violations-violations)
+
+		if (!converged)
+		{
+			if (!CSignal::cancel_computations())
+			{
+				SG_WARNING("Maximal number of sweeps (%d) reached at "
+						"regularization constant %f, stopping the path\n",
+						m_max_iterations, lambdas[k])
+			}
+			break;
+		}
+
+		m_path_w.push_back(solver.get_w(m_path_bias[k]));
+		lambda_prev=lambdas[k];
+
+		SG_DEBUG("lambda %d: %f, %d nonzero weights, %d sweeps so far\n", k,
+				lambdas[k], m_path_w.back().num_feat_entries, solver.sweeps)
+
+		if (m_max_non_zero>0 && m_path_w.back().num_feat_entries>m_max_non_zero)
+		{
+			k++;
+			break;
+		}
+	}
+
+	m_path_lambdas=SGVector<float64_t>(k);
+	memcpy(m_path_lambdas.vector, lambdas.vector, sizeof(float64_t)*k);
+	m_path_bias.resize_vector(k);
+
+	if (get_path_size()==0)
+		return false;
+
+	switch_w(get_path_size()-1);
+	return true;
+}
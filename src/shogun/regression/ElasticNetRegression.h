@@ -0,0 +1,267 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef ELASTICNETREGRESSION_H__
+#define ELASTICNETREGRESSION_H__
+
+#include <shogun/lib/config.h>
+
+#include <vector>
+#include <shogun/machine/LinearMachine.h>
+#include <shogun/lib/SGSparseVector.h>
+
+namespace shogun
+{
+
+class CFeatures;
+class CDotFeatures;
+
+/** how the coordinate descent of CElasticNetRegression computes gradients */
+enum EElasticNetUpdate
+{
+	/** covariance updates for at most 500 features, naive updates else */
+	ENU_AUTO,
+	/** keep the residual, every update touches the nonzeros of a feature */
+	ENU_NAIVE,
+	/** keep the inner products of all features with the active features,
+	 * every update touches a column of these, memory grows with the number
+	 * of features times the number of active features */
+	ENU_COVARIANCE
+};
+
+/** @brief Elastic net and lasso regression by pathwise coordinate descent.
+ *
+ * For a decreasing sequence of regularization constants \f$\lambda\f$,
+ * solves
+ * \f[
+ * \min_{b,w} \frac{1}{2n}\sum_{i=1}^n (y_i - b - w^\top x_i)^2
+ * + \lambda \left(\alpha\|w\|_1 + \frac{1-\alpha}{2}\|w\|_2^2\right),
+ * \f]
+ * which is the lasso for \f$\alpha=1\f$. The sequence starts at the
+ * smallest \f$\lambda\f$ for which all weights are zero, and every solution
+ * is the warm start of the next.
+ *
+ * Only few features are considered for every \f$\lambda\f$: features which
+ * the sequential strong rule predicts to be zero are skipped, and for the
+ * lasso, features which the SAFE rule proves to be zero are not even
+ * checked. Coordinate descent cycles over the active features until
+ * convergence, and the optimality conditions of all other features are
+ * checked in parallel afterwards; violators are added and the solution is
+ * refined.
+ *
+ * The features are centered and, by default, scaled to unit variance
+ * internally, without densifying sparse features; the returned weights and
+ * bias refer to the original features. Any CDotFeatures which provide a
+ * feature iterator, e.g. CDenseFeatures and CSparseFeatures, can be used.
+ * The whole regularization path is kept in sparse form, see get_path_w()
+ * and switch_w().
+ *
+ * For more details, see
+ * Friedman, J., Hastie, T. and Tibshirani, R. (2010). Regularization Paths
+ * for Generalized Linear Models via Coordinate Descent. Journal of
+ * Statistical Software, 33(1).
+ * Tibshirani, R., Bien, J., Friedman, J., Hastie, T., Simon, N., Taylor, J.
+ * and Tibshirani, R. (2012). Strong rules for discarding predictors in
+ * lasso-type problems. JRSS B, 74(2).
+ */
+class CElasticNetRegression : public CLinearMachine
+{
+public:
+	/** problem type */
+	MACHINE_PROBLEM_TYPE(PT_REGRESSION);
+
+	/** default constructor */
+	CElasticNetRegression();
+
+	/** constructor
+	 *
+	 * @param alpha mixing of L1 (1) and L2 (0) penalty, in (0,1]
+	 * @param data training data
+	 * @param lab regression labels
+	 */
+	CElasticNetRegression(float64_t alpha, CDotFeatures* data, CLabels* lab);
+
+	/** destructor */
+	virtual ~CElasticNetRegression();
+
+	/** set mixing of L1 and L2 penalty
+	 *
+	 * @param alpha 1 for the lasso, towards 0 for ridge regression
+	 */
+	void set_alpha(float64_t alpha);
+
+	/** @return mixing of L1 and L2 penalty */
+	float64_t get_alpha() const { return m_alpha; }
+
+	/** set number of regularization constants of the generated path
+	 *
+	 * @param num number of regularization constants
+	 */
+	void set_num_lambdas(int32_t num);
+
+	/** @return number of regularization constants of the generated path */
+	int32_t get_num_lambdas() const { return m_num_lambdas; }
+
+	/** set smallest regularization constant of the generated path relative
+	 * to the largest one
+	 *
+	 * @param ratio ratio in (0,1), or 0 for 1e-4 if there are more vectors
+	 * than features and 1e-2 else
+	 */
+	void set_lambda_min_ratio(float64_t ratio);
+
+	/** @return smallest regularization constant relative to the largest */
+	float64_t get_lambda_min_ratio() const { return m_lambda_min_ratio; }
+
+	/** set the regularization constants instead of generating them
+	 *
+	 * @param lambdas decreasing regularization constants, or an empty vector
+	 * to generate them
+	 */
+	void set_lambdas(SGVector<float64_t> lambdas);
+
+	/** @return regularization constants of the solutions on the trained
+	 * path */
+	SGVector<float64_t> get_lambdas() const { return m_path_lambdas; }
+
+	/** set convergence tolerance, relative to the variance of the labels
+	 *
+	 * @param epsilon tolerance of the weighted squared weight changes
+	 */
+	void set_epsilon(float64_t epsilon);
+
+	/** @return convergence tolerance */
+	float64_t get_epsilon() const { return m_epsilon; }
+
+	/** set maximal number of coordinate descent sweeps of the whole path
+	 *
+	 * @param max_iter maximal number of sweeps
+	 */
+	void set_max_iterations(int32_t max_iter);
+
+	/** @return maximal number of coordinate descent sweeps */
+	int32_t get_max_iterations() const { return m_max_iterations; }
+
+	/** stop the path early once more weights are nonzero
+	 *
+	 * @param n maximal number of nonzero weights, 0 means no constraint
+	 */
+	void set_max_non_zero(int32_t n) { m_max_non_zero=n; }
+
+	/** @return maximal number of nonzero weights */
+	int32_t get_max_non_zero() const { return m_max_non_zero; }
+
+	/** set whether features are scaled to unit variance internally
+	 *
+	 * @param standardize whether to scale
+	 */
+	void set_standardize(bool standardize) { m_standardize=standardize; }
+
+	/** @return whether features are scaled to unit variance internally */
+	bool get_standardize() const { return m_standardize; }
+
+	/** set how gradients are computed
+	 *
+	 * @param update update type
+	 */
+	void set_update_type(EElasticNetUpdate update) { m_update_type=update; }
+
+	/** @return how gradients are computed */
+	EElasticNetUpdate get_update_type() const { return m_update_type; }
+
+	/** @return number of solutions on the regularization path */
+	int32_t get_path_size() const { return m_path_w.size(); }
+
+	/** get the weights of a solution on the path
+	 *
+	 * @param index index of the solution, its constant is get_lambdas()[index]
+	 * @return the weights
+	 */
+	SGVector<float64_t> get_path_w(int32_t index) const;
+
+	/** get the bias of a solution on the path
+	 *
+	 * @param index index of the solution
+	 * @return the bias
+	 */
+	float64_t get_path_bias(int32_t index) const;
+
+	/** get the nonzero weights of a solution on the path
+	 *
+	 * @param index index of the solution
+	 * @return the nonzero weights
+	 */
+	SGSparseVector<float64_t> get_path_sparse_w(int32_t index) const;
+
+	/** use a solution on the path as weights and bias of the machine
+	 *
+	 * @param index index of the solution
+	 */
+	void switch_w(int32_t index);
+
+	/** @return classifier type ELASTICNETREGRESSION */
+	virtual EMachineType get_classifier_type()
+	{
+		return CT_ELASTICNETREGRESSION;
+	}
+
+	/** @return object name */
+	virtual const char* get_name() const { return "ElasticNetRegression"; }
+
+protected:
+	/** train the whole regularization path, the weights and bias of the
+	 * machine are set to the last solution
+	 *
+	 * @param data training data, CDotFeatures
+	 * @return whether training was successful
+	 */
+	virtual bool train_machine(CFeatures* data=NULL);
+
+private:
+	/** initialize members */
+	void init();
+
+protected:
+	/** mixing of L1 and L2 penalty */
+	float64_t m_alpha;
+
+	/** number of generated regularization constants */
+	int32_t m_num_lambdas;
+
+	/** smallest generated regularization constant relative to the largest */
+	float64_t m_lambda_min_ratio;
+
+	/** given regularization constants, generated if empty */
+	SGVector<float64_t> m_lambdas;
+
+	/** convergence tolerance */
+	float64_t m_epsilon;
+
+	/** maximal number of coordinate descent sweeps */
+	int32_t m_max_iterations;
+
+	/** maximal number of nonzero weights, 0 means no constraint */
+	int32_t m_max_non_zero;
+
+	/** whether features are scaled to unit variance */
+	bool m_standardize;
+
+	/** how gradients are computed */
+	EElasticNetUpdate m_update_type;
+
+	/** nonzero weights of the solutions on the path */
+	std::vector<SGSparseVector<float64_t> > m_path_w;
+
+	/** regularization constants of the solutions on the path */
+	SGVector<float64_t> m_path_lambdas;
+
+	/** biases of the solutions on the path */
+	SGVector<float64_t> m_path_bias;
+};
+
+}
+#endif // ELASTICNETREGRESSION_H__
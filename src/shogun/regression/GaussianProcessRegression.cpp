@@ -86,6 +86,8 @@ bool CGaussianProcessRegression::train_machine(CFeatures* data)
 			"regression\n",	m_method->get_name(), lik->get_name())
 	SG_UNREF(lik);
 
+	clear_predictive_state();
+
 	if (data)
 	{
 		// set inducing features for FITC inference method
@@ -116,9 +118,16 @@ SGVector<float64_t> CGaussianProcessRegression::get_mean_vector(CFeatures* data)
 			"regression\n",	m_method->get_name(), lik->get_name())
 	SG_UNREF(lik);
 
+	SGVector<float64_t> mu;
+	SGVector<float64_t> s2;
+
 	SG_REF(data);
-	SGVector<float64_t> mu=get_posterior_means(data);
-	SGVector<float64_t> s2=get_posterior_variances(data);
+	// CG inference provides no variances, which the Gaussian likelihood it
+	// requires does not need for the predictive means
+	if (m_method->get_inference_type()==INF_CG)
+		mu=get_posterior_means(data);
+	else
+		get_posterior_means_and_variances(data, mu, s2);
 	SG_UNREF(data);
 
 	// evaluate mean
@@ -139,9 +148,11 @@ SGVector<float64_t> CGaussianProcessRegression::get_variance_vector(
 	REQUIRE(m_method->supports_regression(), "%s with %s doesn't support "
 			"regression\n",	m_method->get_name(), lik->get_name())
 
+	SGVector<float64_t> mu;
+	SGVector<float64_t> s2;
+
 	SG_REF(data);
-	SGVector<float64_t> mu=get_posterior_means(data);
-	SGVector<float64_t> s2=get_posterior_variances(data);
+	get_posterior_means_and_variances(data, mu, s2);
 	SG_UNREF(data);
 
 	// evaluate variance
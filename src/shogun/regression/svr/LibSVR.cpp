@@ -12,6 +12,7 @@
 #include <shogun/regression/svr/LibSVR.h>
 #include <shogun/labels/RegressionLabels.h>
 #include <shogun/io/SGIO.h>
+#include <shogun/lib/Signal.h>
 
 using namespace shogun;
 
@@ -73,14 +74,93 @@ bool CLibSVR::train_machine(CFeatures* data)
 
 	SG_FREE(model);
 
-	struct svm_node* x_space;
+	int32_t weights_label[2]={-1,+1};
+	float64_t weights[2]={1.0,get_C2()/get_C1()};
+	struct svm_node* x_space=init_problem(weights_label, weights);
+
+	model = svm_train(&problem, &param);
+
+	if (model)
+	{
+		ASSERT(model->nr_class==2)
+		ASSERT((model->l==0) || (model->l>0 && model->SV && model->sv_coef && model->sv_coef[0]))
+
+		int32_t num_sv=model->l;
 
+		create_new_model(num_sv);
+
+		CSVM::set_objective(model->objective);
+
+		set_bias(-model->rho[0]);
+
+		for (int32_t i=0; i<num_sv; i++)
+		{
+			set_support_vector(i, (model->SV[i])->index);
+			set_alpha(i, model->sv_coef[0][i]);
+		}
+
+		// support vectors of the model point into x_space
+		free_problem(x_space);
+		svm_destroy_model(model);
+		model=NULL;
+		return true;
+	}
+	else
+	{
+		free_problem(x_space);
+		return false;
+	}
+}
+
+bool CLibSVR::train_path(SGVector<float64_t> C_values,
+		SGVector<float64_t> tube_epsilons, CFeatures* data)
+{
+	if (solver_type!=LIBSVR_EPSILON_SVR)
+		return CSVM::train_path(C_values, tube_epsilons, data);
+
+	REQUIRE(m_labels && m_labels->get_label_type()==LT_REGRESSION,
+		"%s::train_path(): Regression labels required\n", get_name())
+	init_path(C_values, tube_epsilons, data);
+	int32_t num_steps=C_values.vlen;
+
+	SGVector<float64_t> tubes=tube_epsilons;
+	if (!tubes.vlen)
+	{
+		tubes=SGVector<float64_t>(num_steps);
+		tubes.set_const(tube_epsilon);
+	}
+
+	int32_t weights_label[2]={-1,+1};
+	float64_t weights[2]={1.0,get_C2()/get_C1()};
+	struct svm_node* x_space=init_problem(weights_label, weights);
+
+	SGVector<float64_t> rho(num_steps);
+	SGVector<float64_t> objectives(num_steps);
+
+	svm_train_path(&problem, &param, num_steps, C_values.vector, NULL,
+			tubes.vector, m_path_alphas.matrix, rho.vector, objectives.vector);
+	free_problem(x_space);
+
+	for (index_t k=0; k<num_steps; k++)
+		m_path_biases[k]=-rho[k];
+
+	set_C(C_values[num_steps-1], C_values[num_steps-1]*weights[1]);
+	set_tube_epsilon(tubes[num_steps-1]);
+	set_path_solution(num_steps-1);
+	CSVM::set_objective(objectives[num_steps-1]);
+
+	return !CSignal::cancel_computations();
+}
+
+struct svm_node* CLibSVR::init_problem(int32_t* weights_label,
+		float64_t* weights)
+{
 	problem.l=m_labels->get_num_labels();
 	SG_INFO("%d trainlabels\n", problem.l)
 
 	problem.y=SG_MALLOC(float64_t, problem.l);
 	problem.x=SG_MALLOC(struct svm_node*, problem.l);
-	x_space=SG_MALLOC(struct svm_node, 2*problem.l);
+	struct svm_node* x_space=SG_MALLOC(struct svm_node, 2*problem.l);
 
 	for (int32_t i=0; i<problem.l; i++)
 	{
@@ -90,9 +170,6 @@ bool CLibSVR::train_machine(CFeatures* data)
 		x_space[2*i+1].index=-1;
 	}
 
-	int32_t weights_label[2]={-1,+1};
-	float64_t weights[2]={1.0,get_C2()/get_C1()};
-
 	switch (solver_type)
 	{
 	case LIBSVR_EPSILON_SVR:
@@ -128,35 +205,12 @@ bool CLibSVR::train_machine(CFeatures* data)
 	if(error_msg)
 		SG_ERROR("Error: %s\n",error_msg)
 
-	model = svm_train(&problem, &param);
-
-	if (model)
-	{
-		ASSERT(model->nr_class==2)
-		ASSERT((model->l==0) || (model->l>0 && model->SV && model->sv_coef && model->sv_coef[0]))
-
-		int32_t num_sv=model->l;
-
-		create_new_model(num_sv);
-
-		CSVM::set_objective(model->objective);
-
-		set_bias(-model->rho[0]);
-
-		for (int32_t i=0; i<num_sv; i++)
-		{
-			set_support_vector(i, (model->SV[i])->index);
-			set_alpha(i, model->sv_coef[0][i]);
-		}
-
-		SG_FREE(problem.x);
-		SG_FREE(problem.y);
-		SG_FREE(x_space);
+	return x_space;
+}
 
-		svm_destroy_model(model);
-		model=NULL;
-		return true;
-	}
-	else
-		return false;
+void CLibSVR::free_problem(struct svm_node* x_space)
+{
+	SG_FREE(problem.x);
+	SG_FREE(problem.y);
+	SG_FREE(x_space);
 }
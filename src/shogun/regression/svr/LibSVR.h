@@ -98,6 +98,23 @@ class CLibSVR : public CSVM
 		/** @return object name */
 		virtual const char* get_name() const { return "LibSVR"; }
 
+		/** train the SVR for a sequence of regularization constants and
+		 * tube epsilons on the same data, see CSVM::train_path
+		 *
+		 * For epsilon-SVR all steps share one solver whose kernel cache
+		 * stays hot, and every step is warm started from the alphas and the
+		 * gradient of the previous one. nu-SVR retrains every step.
+		 *
+		 * @param C_values regularization constants of the steps
+		 * @param tube_epsilons tube epsilons of the steps (empty to keep the
+		 * current one)
+		 * @param data training data
+		 * @return whether training of all steps was successful
+		 */
+		virtual bool train_path(SGVector<float64_t> C_values,
+				SGVector<float64_t> tube_epsilons=SGVector<float64_t>(),
+				CFeatures* data=NULL);
+
 	protected:
 		/** train regression
 		 *
@@ -108,6 +125,22 @@ class CLibSVR : public CSVM
 		 * @return whether training was successful
 		 */
 		virtual bool train_machine(CFeatures* data=NULL);
+
+		/** set up problem and param for the training data
+		 *
+		 * @param weights_label labels of the class weights
+		 * @param weights class weights
+		 * @return vector indices referenced by problem
+		 */
+		struct svm_node* init_problem(int32_t* weights_label,
+				float64_t* weights);
+
+		/** free the arrays allocated by init_problem
+		 *
+		 * @param x_space vector indices returned by init_problem
+		 */
+		void free_problem(struct svm_node* x_space);
+
 	protected:
 		/** SVM problem */
 		svm_problem problem;
@@ -36,6 +36,7 @@
 #include <shogun/features/CombinedFeatures.h>
 #include <shogun/kernel/CombinedKernel.h>
 #include <shogun/lib/List.h>
+#include <shogun/mathematics/RandomStream.h>
 
 #include <shogun/lib/external/libqp.h>
 
@@ -55,6 +56,20 @@ CLinearTimeMMD::~CLinearTimeMMD()
 {
 }
 
+void CLinearTimeMMD::compute_kernel_diagonal(CKernel* kernel,
+		SGVector<float64_t>& diagonal)
+{
+	REQUIRE(kernel->get_num_vec_lhs()==diagonal.vlen &&
+			kernel->get_num_vec_rhs()==diagonal.vlen,
+			"Blocks of size %d and %d do not match expected size %d!\n",
+			kernel->get_num_vec_lhs(), kernel->get_num_vec_rhs(), diagonal.vlen);
+
+	/* terms are independent, so the block is split among all threads */
+#pragma omp parallel for
+	for (index_t i=0; i<diagonal.vlen; ++i)
+		diagonal[i]=kernel->kernel(i, i);
+}
+
 void CLinearTimeMMD::compute_squared_mmd(CKernel* kernel, CList* data,
 		SGVector<float64_t>& current, SGVector<float64_t>& pp,
 		SGVector<float64_t>& qq, SGVector<float64_t>& pq,
@@ -75,16 +90,16 @@ void CLinearTimeMMD::compute_squared_mmd(CKernel* kernel, CList* data,
 
 	/* compute kernel matrix diagonals */
 	kernel->init(p1, p2);
-	kernel->get_kernel_diagonal(pp);
+	compute_kernel_diagonal(kernel, pp);
 
 	kernel->init(q1, q2);
-	kernel->get_kernel_diagonal(qq);
+	compute_kernel_diagonal(kernel, qq);
 
 	kernel->init(p1, q2);
-	kernel->get_kernel_diagonal(pq);
+	compute_kernel_diagonal(kernel, pq);
 
 	kernel->init(q1, p2);
-	kernel->get_kernel_diagonal(qp);
+	compute_kernel_diagonal(kernel, qp);
 
 	/* cleanup */
 	SG_UNREF(p1);
@@ -173,16 +188,25 @@ void CLinearTimeMMD::compute_statistic_and_variance(
 
 	/* term counter to compute online mean and variance */
 	index_t num_examples_processed=0;
+
+	/* number of example to look at in the first iteration */
+	index_t num_this_run=CMath::min(m_blocksize, m_2);
+	if (num_this_run>0)
+		prefetch_data_blocks(2, num_this_run);
+
 	while (num_examples_processed<m_2)
 	{
-		/* number of example to look at in this iteration */
-		index_t num_this_run=CMath::min(m_blocksize,
-				CMath::max(0, m_2-num_examples_processed));
 		SG_DEBUG("processing %d more examples. %d so far processed. Blocksize "
 				"is %d\n", num_this_run, num_examples_processed, m_blocksize);
 
-		/* stream 2 data blocks from each distribution */
-		CList* data=stream_data_blocks(2, num_this_run);
+		/* 2 data blocks from each distribution */
+		CList* data=get_prefetched_data_blocks();
+
+		/* stream the next blocks while the current ones are processed */
+		index_t num_next_run=CMath::min(m_blocksize,
+				CMath::max(0, m_2-num_examples_processed-num_this_run));
+		if (num_next_run>0)
+			prefetch_data_blocks(2, num_next_run);
 
 		/* if multiple kernels are used, compute all of them on streamed data,
 		 * if multiple kernels flag is false, the above loop will be executed
@@ -227,6 +251,7 @@ void CLinearTimeMMD::compute_statistic_and_variance(
 
 		/* add number of processed examples for this run */
 		num_examples_processed+=num_this_run;
+		num_this_run=num_next_run;
 	}
 	SG_DEBUG("Done compouting statistic, processed 2*%d examples.\n",
 			num_examples_processed);
@@ -317,16 +342,24 @@ void CLinearTimeMMD::compute_statistic_and_Q(
 	term_counters_Q.set_const(1);
 
 	index_t num_examples_processed=0;
+
+	/* number of example to look at in the first iteration */
+	index_t num_this_run=CMath::min(m_blocksize, m_4);
+	prefetch_data_blocks(4, num_this_run);
+
 	while (num_examples_processed<m_4)
 	{
-		/* number of example to look at in this iteration */
-		index_t num_this_run=CMath::min(m_blocksize,
-				CMath::max(0, m_4-num_examples_processed));
 		SG_DEBUG("processing %d more examples. %d so far processed. Blocksize "
 				"is %d\n", num_this_run, num_examples_processed, m_blocksize);
 
-		/* stream 4 data blocks from each distribution */
-		CList* data=stream_data_blocks(4, num_this_run);
+		/* 4 data blocks from each distribution */
+		CList* data=get_prefetched_data_blocks();
+
+		/* stream the next blocks while the current ones are processed */
+		index_t num_next_run=CMath::min(m_blocksize,
+				CMath::max(0, m_4-num_examples_processed-num_this_run));
+		if (num_next_run>0)
+			prefetch_data_blocks(4, num_next_run);
 
 		/* create two sets of data, a and b, from alternative blocks */
 		CList* data_a=new CList(true);
@@ -444,6 +477,7 @@ void CLinearTimeMMD::compute_statistic_and_Q(
 
 		/* add number of processed examples for this run */
 		num_examples_processed+=num_this_run;
+		num_this_run=num_next_run;
 	}
 
 	/* clean up */
@@ -456,3 +490,106 @@ void CLinearTimeMMD::compute_statistic_and_Q(
 	SG_DEBUG("leaving!\n")
 }
 
+
+void CLinearTimeMMD::compute_statistic_and_null_samples(float64_t& statistic,
+		SGVector<float64_t>& null_samples)
+{
+	SG_DEBUG("entering!\n")
+
+	REQUIRE(m_streaming_p, "streaming features p required!\n");
+	REQUIRE(m_streaming_q, "streaming features q required!\n");
+
+	REQUIRE(m_kernel, "kernel needed!\n");
+
+	index_t m_2=m_m/2;
+	REQUIRE(m_2>0, "Need at least m>=2\n");
+
+	statistic=0;
+	null_samples=SGVector<float64_t>(m_num_null_samples);
+	null_samples.zero();
+
+	/* the prefetch thread streams from the global generator, so the signs
+	 * are drawn from a stream which is seeded before it starts */
+	RandomStream sign_stream(CMath::random());
+
+	index_t num_examples_processed=0;
+	index_t num_this_run=CMath::min(m_blocksize, m_2);
+	prefetch_data_blocks(2, num_this_run);
+
+	while (num_examples_processed<m_2)
+	{
+		SG_DEBUG("processing %d more examples. %d so far processed. Blocksize "
+				"is %d\n", num_this_run, num_examples_processed, m_blocksize);
+
+		CList* data=get_prefetched_data_blocks();
+
+		index_t num_next_run=CMath::min(m_blocksize,
+				CMath::max(0, m_2-num_examples_processed-num_this_run));
+		if (num_next_run>0)
+			prefetch_data_blocks(2, num_next_run);
+
+		SGVector<float64_t> current=compute_squared_mmd(m_kernel, data,
+				num_this_run);
+		SG_UNREF(data);
+
+		for (index_t i=0; i<num_this_run; ++i)
+			statistic+=current[i];
+
+		/* draw one random sign per term and null sample in the main thread,
+		 * so that results do not depend on the number of threads */
+		index_t num_words=(num_this_run+63)/64;
+		SGVector<uint64_t> signs(num_words*m_num_null_samples);
+		for (index_t i=0; i<signs.vlen; ++i)
+			signs[i]=sign_stream.random_64();
+
+#pragma omp parallel for
+		for (index_t j=0; j<m_num_null_samples; ++j)
+		{
+			const uint64_t* sample_signs=signs.vector+j*num_words;
+			float64_t sum=0;
+			for (index_t i=0; i<num_this_run; ++i)
+			{
+				if ((sample_signs[i/64]>>(i%64)) & 1)
+					sum+=current[i];
+				else
+					sum-=current[i];
+			}
+			null_samples[j]+=sum;
+		}
+
+		num_examples_processed+=num_this_run;
+		num_this_run=num_next_run;
+	}
+
+	statistic/=m_2;
+	for (index_t j=0; j<m_num_null_samples; ++j)
+		null_samples[j]/=m_2;
+
+	SG_DEBUG("leaving!\n")
+}
+
+SGVector<float64_t> CLinearTimeMMD::sample_null()
+{
+	float64_t statistic;
+	SGVector<float64_t> samples;
+	compute_statistic_and_null_samples(statistic, samples);
+
+	return samples;
+}
+
+float64_t CLinearTimeMMD::perform_test()
+{
+	if (m_null_approximation_method!=PERMUTATION)
+		return CStreamingMMD::perform_test();
+
+	/* statistic and null samples are computed from the same data */
+	float64_t statistic;
+	SGVector<float64_t> values;
+	compute_statistic_and_null_samples(statistic, values);
+
+	/* find out percentile of statistic in null distribution */
+	CMath::qsort(values);
+	float64_t i=values.find_position_to_insert(statistic);
+
+	return 1.0-i/values.vlen;
+}
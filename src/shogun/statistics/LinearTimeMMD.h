@@ -59,6 +59,15 @@ class CFeatures;
  * \f]
  * and \f$ m_2=\lfloor\frac{m}{2} \rfloor\f$.
  *
+ * Blocks are streamed in a background thread while the kernel values of the
+ * previous blocks are computed by all available threads.
+ *
+ * Swapping \f$x_{2i}\f$ and \f$y_{2i}\f$ flips the sign of
+ * \f$h(z_{2i},z_{2i+1})\f$, so samples from the null-distribution are
+ * obtained from the same data as the statistic by multiplying the h-terms
+ * with random signs. Sampling the null-distribution therefore needs a single
+ * pass over the data rather than a new pass for every sample.
+ *
  * [1]: Gretton, A., Borgwardt, K. M., Rasch, M. J., Schoelkopf, B.,
  * & Smola, A. (2012). A Kernel Two-Sample Test. Journal of Machine Learning
  * Research, 13, 671-721.
@@ -114,6 +123,22 @@ public:
 	virtual void compute_statistic_and_Q(
 			SGVector<float64_t>& statistic, SGMatrix<float64_t>& Q);
 
+	/** Samples the null-distribution by flipping the signs of the h-terms
+	 * of newly streamed data at random (see class description).
+	 *
+	 * @return vector of all statistics
+	 */
+	virtual SGVector<float64_t> sample_null();
+
+	/** Performs the complete two-sample test on current data and returns a
+	 * p-value. In case the null-distribution is sampled, the statistic and
+	 * the null samples are computed in the same pass over the data.
+	 *
+	 * @return p-value such that computed statistic is the (1-p) quantile
+	 * of the estimated null distribution
+	 */
+	virtual float64_t perform_test();
+
 	/** returns the statistic type of this test statistic */
 	virtual EStatisticType get_statistic_type() const
 	{
@@ -142,6 +167,16 @@ protected:
 	 virtual SGVector<float64_t> compute_squared_mmd(CKernel* kernel,
 			 CList* data, index_t num_this_run);
 
+	/** computes the statistic for the underlying kernel and
+	 * m_num_null_samples samples from the null-distribution in one pass over
+	 * the streamed data
+	 *
+	 * @param statistic return parameter for the statistic
+	 * @param null_samples return parameter for the null samples
+	 */
+	void compute_statistic_and_null_samples(float64_t& statistic,
+			SGVector<float64_t>& null_samples);
+
 private:
 	/** helper method, same as compute_squared_mmd with an option to use
 	 * preallocated memory for faster processing */
@@ -150,6 +185,11 @@ private:
 			SGVector<float64_t>& qq, SGVector<float64_t>& pq,
 			SGVector<float64_t>& qp, index_t num_this_run);
 
+	/** helper method that computes the diagonal of the kernel matrix of
+	 * the current blocks using all available threads */
+	static void compute_kernel_diagonal(CKernel* kernel,
+			SGVector<float64_t>& diagonal);
+
 };
 
 }
@@ -59,6 +59,10 @@ CStreamingMMD::CStreamingMMD(CKernel* kernel, CStreamingFeatures* p,
 
 CStreamingMMD::~CStreamingMMD()
 {
+	if (m_prefetching)
+		pthread_join(m_prefetch_thread, NULL);
+	SG_UNREF(m_prefetched_data);
+
 	SG_UNREF(m_streaming_p);
 	SG_UNREF(m_streaming_q);
 
@@ -80,6 +84,10 @@ void CStreamingMMD::init()
 	m_streaming_q=NULL;
 	m_blocksize=10000;
 	m_simulate_h0=false;
+	m_prefetching=false;
+	m_prefetch_num_blocks=0;
+	m_prefetch_num_this_run=0;
+	m_prefetched_data=NULL;
 }
 
 float64_t CStreamingMMD::compute_statistic()
@@ -298,6 +306,49 @@ CList* CStreamingMMD::stream_data_blocks(index_t num_blocks,
 	return data;
 }
 
+void CStreamingMMD::prefetch_data_blocks(index_t num_blocks,
+		index_t num_this_run)
+{
+	REQUIRE(!m_prefetching && !m_prefetched_data, "Previously prefetched "
+			"data blocks have not been obtained yet!\n");
+
+	m_prefetch_num_blocks=num_blocks;
+	m_prefetch_num_this_run=num_this_run;
+
+	if (pthread_create(&m_prefetch_thread, NULL,
+			prefetch_data_blocks_helper, this)==0)
+		m_prefetching=true;
+	else
+	{
+		SG_DEBUG("could not start prefetch thread, streaming directly!\n");
+		m_prefetched_data=stream_data_blocks(num_blocks, num_this_run);
+	}
+}
+
+CList* CStreamingMMD::get_prefetched_data_blocks()
+{
+	if (m_prefetching)
+	{
+		pthread_join(m_prefetch_thread, NULL);
+		m_prefetching=false;
+	}
+
+	REQUIRE(m_prefetched_data, "No data blocks were prefetched!\n");
+
+	/* pass the reference on to the caller */
+	CList* data=m_prefetched_data;
+	m_prefetched_data=NULL;
+	return data;
+}
+
+void* CStreamingMMD::prefetch_data_blocks_helper(void* p)
+{
+	CStreamingMMD* mmd=(CStreamingMMD*)p;
+	mmd->m_prefetched_data=mmd->stream_data_blocks(mmd->m_prefetch_num_blocks,
+			mmd->m_prefetch_num_this_run);
+	return NULL;
+}
+
 void CStreamingMMD::set_p_and_q(CFeatures* p_and_q)
 {
 	SG_ERROR("Method not implemented since linear time mmd is based on "
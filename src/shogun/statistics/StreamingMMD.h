@@ -35,6 +35,7 @@
 #include <shogun/lib/config.h>
 
 #include <shogun/statistics/KernelTwoSampleTest.h>
+#include <pthread.h>
 
 namespace shogun
 {
@@ -286,6 +287,23 @@ protected:
 	virtual SGVector<float64_t> compute_squared_mmd(CKernel* kernel,
 			CList* data, index_t num_this_run)=0;
 
+	/** Starts streaming the blocks of the next burst in a background thread
+	 * (see stream_data_blocks()), so that new data is read while the current
+	 * burst is processed. The blocks have to be obtained via
+	 * get_prefetched_data_blocks() before the next call.
+	 *
+	 * @param num_blocks number of blocks to be streamed from each distribution
+	 * @param num_this_run number of data points to be streamed for one block
+	 */
+	void prefetch_data_blocks(index_t num_blocks, index_t num_this_run);
+
+	/** Waits for the blocks requested via prefetch_data_blocks()
+	 *
+	 * @return an ordered list of blocks of data, as returned by
+	 * stream_data_blocks()
+	 */
+	CList* get_prefetched_data_blocks();
+
 	/** Streaming feature objects that are used instead of merged samples */
 	CStreamingFeatures* m_streaming_p;
 
@@ -299,9 +317,27 @@ protected:
 	 * that computes the statistic */
 	bool m_simulate_h0;
 
+	/** Thread that streams the next burst of data */
+	pthread_t m_prefetch_thread;
+
+	/** Whether m_prefetch_thread is running */
+	bool m_prefetching;
+
+	/** Number of blocks for the prefetch thread to stream */
+	index_t m_prefetch_num_blocks;
+
+	/** Number of data points per block for the prefetch thread to stream */
+	index_t m_prefetch_num_this_run;
+
+	/** Blocks of data streamed by the prefetch thread */
+	CList* m_prefetched_data;
+
 private:
 	/** register parameters and initialize with defaults */
 	void init();
+
+	/** entry point of the prefetch thread */
+	static void* prefetch_data_blocks_helper(void* p);
 };
 
 }
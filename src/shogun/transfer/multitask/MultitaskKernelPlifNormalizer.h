@@ -93,6 +93,36 @@ public:
 
 	}
 
+	/** normalize a block of kernel values, the task similarity is only
+	 * looked up again when the pair of tasks changes
+	 * @param values kernel values, normalized in place
+	 * @param idx_lhs indices of left hand side vectors
+	 * @param idx_rhs indices of right hand side vectors
+	 * @param num number of values
+	 */
+	virtual void normalize_block(float64_t* values, const int32_t* idx_lhs,
+			const int32_t* idx_rhs, int32_t num)
+	{
+		int32_t last_task_lhs=-1;
+		int32_t last_task_rhs=-1;
+		float64_t task_similarity=0;
+
+		for (int32_t i=0; i<num; i++)
+		{
+			int32_t task_idx_lhs = task_vector_lhs[idx_lhs[i]];
+			int32_t task_idx_rhs = task_vector_rhs[idx_rhs[i]];
+
+			if (task_idx_lhs!=last_task_lhs || task_idx_rhs!=last_task_rhs)
+			{
+				task_similarity = get_task_similarity(task_idx_lhs, task_idx_rhs);
+				last_task_lhs=task_idx_lhs;
+				last_task_rhs=task_idx_rhs;
+			}
+
+			values[i] = (values[i]/scale) * task_similarity;
+		}
+	}
+
 	/** helper routine
 	 *
 	 * @param vec vector with containing task_id for each example
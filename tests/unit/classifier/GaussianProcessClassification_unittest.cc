@@ -3143,6 +3143,11 @@ TEST(GaussianProcessClassificationUsingMultiLaplace,get_mean_vector)
 	abs_tolerance = CMath::get_abs_tolerance(0.262537147766292, rel_tolerance);
 	EXPECT_NEAR(mean_matrix(1,9),  0.262537147766292,  abs_tolerance);
 
+	// multiclass inference has no predictive state, a failed attempt does
+	// not leave a partial one behind
+	EXPECT_THROW(gpc->compute_predictive_state(), ShogunException);
+	EXPECT_FALSE(gpc->has_predictive_state());
+
 	SG_UNREF(gpc);
 }
 
@@ -0,0 +1,88 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <shogun/lib/config.h>
+
+#ifdef HAVE_PTHREAD
+#include <shogun/classifier/vw/VowpalWabbit.h>
+#include <shogun/features/streaming/StreamingVwFeatures.h>
+#include <shogun/io/streaming/StreamingVwFile.h>
+#include <shogun/mathematics/RandomStream.h>
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+/* examples of 10 features each, the first 10 of which carry the label */
+static void write_examples(const char* fname, int32_t num_examples)
+{
+	RandomStream rng(17);
+	FILE* f=fopen(fname, "w");
+	for (int32_t i=0; i<num_examples; i++)
+	{
+		float64_t label=rng.random_half_open()<0.5 ? -1.0 : 1.0;
+		fprintf(f, "%g |", label);
+		for (int32_t j=0; j<10; j++)
+		{
+			int32_t index=rng.random(0, 99);
+			float64_t value=rng.random_half_open();
+			if (index<10)
+				value+=label;
+			fprintf(f, " %d:%g", index, value);
+		}
+		fprintf(f, "\n");
+	}
+	fclose(f);
+}
+
+/* average squared loss of a single pass */
+static float64_t train_vw(const char* fname, int32_t num_threads)
+{
+	CStreamingVwFile* file=new CStreamingVwFile(fname);
+	CStreamingVwFeatures* features=new CStreamingVwFeatures(file, true, 1024);
+	SG_REF(features);
+
+	CVowpalWabbit* vw=new CVowpalWabbit(features);
+	SG_REF(vw);
+	vw->set_num_learning_threads(num_threads);
+	vw->train_machine();
+
+	CVwEnvironment* env=vw->get_env();
+	EXPECT_EQ(10000, env->weighted_examples);
+	float64_t loss=env->sum_loss/env->weighted_examples;
+	SG_UNREF(env);
+
+	SG_UNREF(vw);
+	SG_UNREF(features);
+	return loss;
+}
+
+TEST(VowpalWabbit, train_machine)
+{
+	const char* fname="VowpalWabbit_train_machine.vw";
+	write_examples(fname, 10000);
+
+	float64_t loss=train_vw(fname, 1);
+	/* predicting zero has a loss of one */
+	EXPECT_LT(loss, 0.5);
+
+	remove(fname);
+}
+
+TEST(VowpalWabbit, train_machine_hogwild)
+{
+	const char* fname="VowpalWabbit_train_machine_hogwild.vw";
+	write_examples(fname, 10000);
+
+	/* the order of the updates differs, but the loss does not */
+	float64_t loss=train_vw(fname, 1);
+	float64_t loss_hogwild=train_vw(fname, 4);
+	EXPECT_NEAR(loss, loss_hogwild, 0.05);
+
+	remove(fname);
+}
+#endif // HAVE_PTHREAD
@@ -1294,4 +1294,80 @@ TEST(LibLinear,simple_set_train_L2R_LR_DUAL_BIAS)
 	SG_UNREF(eval);
 	SG_UNREF(pred);
 }
+
+/* every step of a warm started path has to match training from scratch */
+void check_path(LIBLINEAR_SOLVER_TYPE liblinear_solver_type, bool use_bias)
+{
+	CDenseFeatures<float64_t>* train_feats = NULL;
+	CDenseFeatures<float64_t>* test_feats = NULL;
+	CBinaryLabels* ground_truth = NULL;
+
+	generate_data_l2(train_feats, test_feats, ground_truth);
+
+	SGVector<float64_t> C_values(4);
+	C_values[0] = 0.01;
+	C_values[1] = 0.1;
+	C_values[2] = 1;
+	C_values[3] = 10;
+
+	CLibLinear* path = new CLibLinear(liblinear_solver_type);
+	path->set_bias_enabled(use_bias);
+	path->set_epsilon(1e-8);
+	path->set_labels(ground_truth);
+	EXPECT_TRUE(path->train_path(C_values, train_feats));
+
+	SGMatrix<float64_t> path_weights = path->get_path_weights();
+	SGVector<float64_t> path_biases = path->get_path_biases();
+	ASSERT_EQ(C_values.vlen, path_weights.num_cols);
+	ASSERT_EQ(C_values.vlen, path_biases.vlen);
+
+	for (index_t k = 0; k < C_values.vlen; ++k)
+	{
+		CLibLinear* ll = new CLibLinear(liblinear_solver_type);
+		ll->set_bias_enabled(use_bias);
+		ll->set_epsilon(1e-8);
+		ll->set_C(C_values[k], C_values[k]);
+		ll->set_features(train_feats);
+		ll->set_labels(ground_truth);
+		ll->train();
+
+		SGVector<float64_t> w = ll->get_w();
+		for (index_t i = 0; i < w.vlen; ++i)
+			EXPECT_NEAR(path_weights(i, k), w[i], 1e-4);
+		EXPECT_NEAR(path_biases[k], ll->get_bias(), 1e-4);
+
+		SG_UNREF(ll);
+	}
+
+	/* the machine holds the last step, earlier ones can be loaded */
+	EXPECT_NEAR(path->get_w()[0], path_weights(0, C_values.vlen-1), 1e-12);
+	path->set_path_solution(0);
+	EXPECT_NEAR(path->get_w()[0], path_weights(0, 0), 1e-12);
+	EXPECT_NEAR(path->get_bias(), path_biases[0], 1e-12);
+
+	SG_UNREF(path);
+	SG_UNREF(train_feats);
+	SG_UNREF(test_feats);
+	SG_UNREF(ground_truth);
+}
+
+TEST(LibLinear,train_path_L2R_L1LOSS_SVC_DUAL)
+{
+	check_path(L2R_L1LOSS_SVC_DUAL, true);
+}
+
+TEST(LibLinear,train_path_L2R_L2LOSS_SVC_DUAL)
+{
+	check_path(L2R_L2LOSS_SVC_DUAL, false);
+}
+
+TEST(LibLinear,train_path_L2R_LR)
+{
+	check_path(L2R_LR, true);
+}
+
+TEST(LibLinear,train_path_L2R_L2LOSS_SVC)
+{
+	check_path(L2R_L2LOSS_SVC, false);
+}
 #endif //HAVE_LAPACK
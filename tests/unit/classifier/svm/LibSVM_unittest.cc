@@ -0,0 +1,141 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <shogun/classifier/svm/LibSVM.h>
+#include <shogun/classifier/svm/SVMLight.h>
+#include <shogun/features/DataGenerator.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/kernel/GaussianKernel.h>
+#include <shogun/labels/BinaryLabels.h>
+#include <shogun/mathematics/Math.h>
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+/* two overlapping gaussians, so the solution changes along the path */
+static void generate_data(CDenseFeatures<float64_t>* &features,
+		CBinaryLabels* &labels)
+{
+	index_t num_samples=40;
+	CMath::init_random(7);
+	SGMatrix<float64_t> data(2, 2*num_samples);
+	SGVector<float64_t> lab(2*num_samples);
+	for (index_t i=0; i<2*num_samples; i++)
+	{
+		float64_t offset=i<num_samples ? 1 : -1;
+		data(0, i)=CMath::randn_double()+offset;
+		data(1, i)=CMath::randn_double()+offset;
+		lab[i]=i<num_samples ? 1 : -1;
+	}
+
+	features=new CDenseFeatures<float64_t>(data);
+	labels=new CBinaryLabels(lab);
+	SG_REF(features);
+	SG_REF(labels);
+}
+
+/* every step of a path has to match the SVM trained from scratch */
+static void check_path(CSVM* path, CSVM* svm, CDenseFeatures<float64_t>* features,
+		float64_t tolerance)
+{
+	SGVector<float64_t> C_values(4);
+	C_values[0]=0.05;
+	C_values[1]=0.2;
+	C_values[2]=1;
+	C_values[3]=5;
+
+	SG_REF(path);
+	SG_REF(svm);
+	EXPECT_TRUE(path->train_path(C_values, SGVector<float64_t>(), features));
+	ASSERT_EQ(C_values.vlen, path->get_path_alphas().num_cols);
+	ASSERT_EQ(features->get_num_vectors(), path->get_path_alphas().num_rows);
+	ASSERT_EQ(C_values.vlen, path->get_path_biases().vlen);
+
+	for (index_t k=0; k<C_values.vlen; k++)
+	{
+		svm->set_C(C_values[k], C_values[k]);
+		svm->train(features);
+		CBinaryLabels* expected=svm->apply_binary(features);
+
+		path->set_path_solution(k);
+		CBinaryLabels* outputs=path->apply_binary(features);
+		for (index_t i=0; i<outputs->get_num_labels(); i++)
+			EXPECT_NEAR(expected->get_value(i), outputs->get_value(i), tolerance);
+		SG_UNREF(expected);
+		SG_UNREF(outputs);
+
+		/* the alphas respect the box and the equality constraint */
+		SGMatrix<float64_t> alphas=path->get_path_alphas();
+		float64_t sum=0;
+		for (index_t i=0; i<alphas.num_rows; i++)
+		{
+			EXPECT_LE(CMath::abs(alphas(i, k)), C_values[k]+1e-10);
+			sum+=alphas(i, k);
+		}
+		EXPECT_NEAR(sum, 0, 1e-8);
+	}
+
+	SG_UNREF(path);
+	SG_UNREF(svm);
+}
+
+TEST(LibSVM,train_path)
+{
+	CDenseFeatures<float64_t>* features=NULL;
+	CBinaryLabels* labels=NULL;
+	generate_data(features, labels);
+
+	CLibSVM* path=new CLibSVM(1, new CGaussianKernel(10, 2), labels);
+	CLibSVM* svm=new CLibSVM(1, new CGaussianKernel(10, 2), labels);
+	path->set_epsilon(1e-6);
+	svm->set_epsilon(1e-6);
+	check_path(path, svm, features, 1e-4);
+
+	SG_UNREF(features);
+	SG_UNREF(labels);
+}
+
+TEST(LibSVM,train_path_nu_svc)
+{
+	CDenseFeatures<float64_t>* features=NULL;
+	CBinaryLabels* labels=NULL;
+	generate_data(features, labels);
+
+	/* nu is fixed, so every step yields the same classifier */
+	CLibSVM* svm=new CLibSVM(LIBSVM_NU_SVC);
+	svm->set_kernel(new CGaussianKernel(10, 2));
+	svm->set_labels(labels);
+	svm->set_nu(0.3);
+	SGVector<float64_t> C_values(2);
+	C_values[0]=1;
+	C_values[1]=2;
+	EXPECT_TRUE(svm->train_path(C_values, SGVector<float64_t>(), features));
+	SGVector<float64_t> biases=svm->get_path_biases();
+	EXPECT_EQ(2, biases.vlen);
+
+	SG_UNREF(svm);
+	SG_UNREF(features);
+	SG_UNREF(labels);
+}
+
+#ifdef USE_SVMLIGHT
+TEST(SVMLight,train_path)
+{
+	CDenseFeatures<float64_t>* features=NULL;
+	CBinaryLabels* labels=NULL;
+	generate_data(features, labels);
+
+	CSVMLight* path=new CSVMLight(1, new CGaussianKernel(10, 2), labels);
+	CSVMLight* svm=new CSVMLight(1, new CGaussianKernel(10, 2), labels);
+	path->set_epsilon(1e-6);
+	svm->set_epsilon(1e-6);
+	check_path(path, svm, features, 1e-3);
+
+	SG_UNREF(features);
+	SG_UNREF(labels);
+}
+#endif //USE_SVMLIGHT
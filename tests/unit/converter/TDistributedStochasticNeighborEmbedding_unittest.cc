@@ -1,6 +1,8 @@
 #include <shogun/converter/TDistributedStochasticNeighborEmbedding.h>
 #include <shogun/features/DenseFeatures.h>
 #include <shogun/features/DataGenerator.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/lib/tapkee/external/barnes_hut_sne/interpolation.hpp>
 #include <gtest/gtest.h>
 
 using namespace shogun;
@@ -36,5 +38,118 @@ TEST(TDistributedStochasticNeighborEmbeddingTest,basic)
 	SG_UNREF(high_dimensional_features);
 	SG_UNREF(low_dimensional_features);
 }
+
+/* checks that every embedded vector is closer to the center of its own
+ * gaussian than to the center of the other one */
+TEST(TDistributedStochasticNeighborEmbeddingTest,separates_gaussians)
+{
+	const index_t n_samples = 100;
+	CMath::init_random(17);
+	CDenseFeatures<float64_t>* high_dimensional_features =
+		new CDenseFeatures<float64_t>(CDataGenerator::generate_gaussians(n_samples, 2, 3));
+
+	CTDistributedStochasticNeighborEmbedding* embedder =
+		new CTDistributedStochasticNeighborEmbedding();
+	embedder->set_target_dim(2);
+	embedder->set_perplexity(10);
+
+	CDenseFeatures<float64_t>* low_dimensional_features =
+		embedder->embed(high_dimensional_features);
+	SGMatrix<float64_t> embedding=low_dimensional_features->get_feature_matrix();
+	ASSERT_EQ(2, embedding.num_rows);
+	ASSERT_EQ(2*n_samples, embedding.num_cols);
+
+	float64_t centers[2][2] = {{0, 0}, {0, 0}};
+	for (index_t i=0; i<2*n_samples; i++)
+	{
+		for (index_t d=0; d<2; d++)
+			centers[i/n_samples][d] += embedding(d,i)/n_samples;
+	}
+	for (index_t i=0; i<2*n_samples; i++)
+	{
+		float64_t dist[2];
+		for (index_t c=0; c<2; c++)
+		{
+			dist[c]=CMath::sq(embedding(0,i)-centers[c][0])+
+				CMath::sq(embedding(1,i)-centers[c][1]);
+		}
+		EXPECT_LT(dist[i/n_samples], dist[1-i/n_samples]);
+	}
+
+	SG_UNREF(embedder);
+	SG_UNREF(high_dimensional_features);
+	SG_UNREF(low_dimensional_features);
+}
+
+TEST(TDistributedStochasticNeighborEmbeddingTest,interpolation)
+{
+	const index_t n_samples = 15;
+	CMath::init_random(17);
+	CDenseFeatures<float64_t>* high_dimensional_features =
+		new CDenseFeatures<float64_t>(CDataGenerator::generate_gaussians(n_samples, 1, 3));
+
+	CTDistributedStochasticNeighborEmbedding* embedder =
+		new CTDistributedStochasticNeighborEmbedding();
+	embedder->set_target_dim(2);
+	embedder->set_perplexity(n_samples / 5.0);
+	embedder->set_interpolation(true);
+	EXPECT_TRUE(embedder->get_interpolation());
+
+	CDenseFeatures<float64_t>* low_dimensional_features =
+		embedder->embed(high_dimensional_features);
+	SGMatrix<float64_t> embedding=low_dimensional_features->get_feature_matrix();
+	ASSERT_EQ(2, embedding.num_rows);
+	ASSERT_EQ(n_samples, embedding.num_cols);
+	for (index_t i=0; i<embedding.num_rows*embedding.num_cols; i++)
+		EXPECT_FALSE(CMath::is_nan(embedding.matrix[i]));
+
+	SG_UNREF(embedder);
+	SG_UNREF(high_dimensional_features);
+	SG_UNREF(low_dimensional_features);
+}
 #endif // HAVE_LAPACK
 
+TEST(TDistributedStochasticNeighborEmbeddingTest,interpolated_repulsive_forces)
+{
+	/* large enough for the forces to be interpolated rather than summed */
+	const int N = 2000;
+	CMath::init_random(17);
+	SGVector<float64_t> Y(2*N);
+	for (index_t i=0; i<2*N; i++)
+		Y[i] = CMath::randn_double()*(i<N ? 3 : 10);
+
+	/* exact unnormalized repulsive forces of the t-distribution */
+	SGVector<float64_t> neg_f(2*N);
+	neg_f.zero();
+	float64_t sum_Q = 0;
+	for (index_t i=0; i<N; i++)
+	{
+		for (index_t j=0; j<N; j++)
+		{
+			if (i==j)
+				continue;
+			float64_t dx = Y[2*i]-Y[2*j];
+			float64_t dy = Y[2*i+1]-Y[2*j+1];
+			float64_t q = 1.0/(1.0+dx*dx+dy*dy);
+			sum_Q += q;
+			neg_f[2*i] += q*q*dx;
+			neg_f[2*i+1] += q*q*dy;
+		}
+	}
+
+	tsne::InterpolatedRepulsiveForces interpolation;
+	SGVector<float64_t> interpolated_neg_f(2*N);
+	float64_t interpolated_sum_Q;
+	interpolation.compute(Y.vector, N, interpolated_neg_f.vector, &interpolated_sum_Q);
+
+	/* the interpolation error is relative to the magnitude of the forces */
+	EXPECT_NEAR(sum_Q, interpolated_sum_Q, 1e-3*sum_Q);
+	float64_t error = 0, norm = 0;
+	for (index_t i=0; i<2*N; i++)
+	{
+		error += CMath::sq(neg_f[i]-interpolated_neg_f[i]);
+		norm += CMath::sq(neg_f[i]);
+	}
+	EXPECT_LT(CMath::sqrt(error), 1e-2*CMath::sqrt(norm));
+}
+
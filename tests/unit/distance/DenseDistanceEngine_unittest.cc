@@ -0,0 +1,168 @@
+#include <shogun/lib/config.h>
+#include <shogun/distance/DenseDistanceEngine.h>
+#include <shogun/distance/ManhattanMetric.h>
+#include <shogun/distance/ChebyshewMetric.h>
+#include <shogun/distance/CanberraMetric.h>
+#include <shogun/distance/ChiSquareDistance.h>
+#include <shogun/distance/BrayCurtisDistance.h>
+#include <shogun/distance/JensenMetric.h>
+#include <shogun/distance/MinkowskiMetric.h>
+#include <shogun/distance/TanimotoDistance.h>
+#include <shogun/distance/CosineDistance.h>
+#include <shogun/distance/KernelDistance.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/kernel/PolyKernel.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/linalg/internal/implementation/CPUDispatch.h>
+
+#include <gtest/gtest.h>
+
+using namespace shogun;
+using namespace shogun::linalg;
+
+static SGMatrix<float64_t> generate_data(int32_t dim, int32_t num_vec)
+{
+	SGMatrix<float64_t> data(dim, num_vec);
+	for (index_t i=0; i<dim*num_vec; i++)
+	{
+		/* zeros and negative values hit the special cases of the metrics */
+		if (CMath::random(0, 9)==0)
+			data.matrix[i]=0;
+		else
+			data.matrix[i]=CMath::randn_double()+0.5;
+	}
+
+	return data;
+}
+
+/* compares the distance matrix with distance() for all pairs, which the
+ * scalar instruction set has to reproduce exactly */
+static void check_distance_matrix(CDistance* distance)
+{
+	SGMatrix<float64_t> dm=distance->get_distance_matrix();
+	ASSERT_EQ(distance->get_num_vec_lhs(), dm.num_rows);
+	ASSERT_EQ(distance->get_num_vec_rhs(), dm.num_cols);
+
+	/* symmetric matrices are mirrored from the upper triangle */
+	const bool symmetric=distance->lhs_equals_rhs();
+	const bool exact=get_cpu_instruction_set()==CPUInstructionSet::SCALAR;
+	for (index_t j=0; j<dm.num_cols; j++)
+	{
+		for (index_t i=0; i<dm.num_rows; i++)
+		{
+			float64_t d=symmetric && i>j ? distance->distance(j, i) :
+				distance->distance(i, j);
+			if (exact)
+				EXPECT_EQ(d, dm(i, j));
+			else
+				EXPECT_NEAR(d, dm(i, j), 1e-12*CMath::max(1.0, CMath::abs(d)));
+		}
+	}
+}
+
+TEST(DenseDistanceEngine, distance_matrices)
+{
+	/* a dimension which leaves tails for all register widths */
+	const int32_t dim=13;
+	CMath::init_random(17);
+	CDenseFeatures<float64_t>* feats_lhs=
+		new CDenseFeatures<float64_t>(generate_data(dim, 70));
+	CDenseFeatures<float64_t>* feats_rhs=
+		new CDenseFeatures<float64_t>(generate_data(dim, 45));
+	SG_REF(feats_lhs);
+	SG_REF(feats_rhs);
+
+	CDistance* distances[]={new CManhattanMetric(), new CChebyshewMetric(),
+		new CCanberraMetric(), new CChiSquareDistance(),
+		new CBrayCurtisDistance(), new CJensenMetric(),
+		new CMinkowskiMetric(3), new CTanimotoDistance(),
+		new CCosineDistance()};
+
+	CPUInstructionSet original=get_cpu_instruction_set();
+	for (int32_t isa=0; isa<=int32_t(get_max_cpu_instruction_set()); isa++)
+	{
+		set_cpu_instruction_set(CPUInstructionSet(isa));
+		SCOPED_TRACE(get_cpu_instruction_set_name());
+
+		for (int32_t k=0; k<9; k++)
+		{
+			SCOPED_TRACE(distances[k]->get_name());
+			EXPECT_TRUE(DenseDistanceEngine::supports(
+					distances[k]->get_distance_type()));
+
+			distances[k]->init(feats_lhs, feats_lhs);
+			check_distance_matrix(distances[k]);
+
+			distances[k]->init(feats_lhs, feats_rhs);
+			check_distance_matrix(distances[k]);
+		}
+	}
+	set_cpu_instruction_set(original);
+
+	for (int32_t k=0; k<9; k++)
+		SG_UNREF(distances[k]);
+
+	SG_UNREF(feats_lhs);
+	SG_UNREF(feats_rhs);
+}
+
+TEST(DenseDistanceEngine, distance_block)
+{
+	CMath::init_random(17);
+	CDenseFeatures<float64_t>* feats_lhs=
+		new CDenseFeatures<float64_t>(generate_data(21, 150));
+	CDenseFeatures<float64_t>* feats_rhs=
+		new CDenseFeatures<float64_t>(generate_data(21, 90));
+	CManhattanMetric* distance=new CManhattanMetric(feats_lhs, feats_rhs);
+	SG_REF(distance);
+
+	/* more vectors than fit into one chunk, and a leading dimension */
+	const int32_t ld=140;
+	SGMatrix<float64_t> block(ld, 83);
+	block.set_const(-1);
+	distance->distance_block(3, 137, 5, 83, block.matrix, ld);
+
+	for (index_t j=0; j<83; j++)
+	{
+		for (index_t i=0; i<137; i++)
+		{
+			float64_t d=distance->distance(3+i, 5+j);
+			EXPECT_NEAR(d, block(i, j), 1e-12*d);
+		}
+		for (index_t i=137; i<ld; i++)
+			EXPECT_EQ(-1, block(i, j));
+	}
+
+	/* one lhs vector against several rhs vectors */
+	SGVector<float64_t> row(90);
+	distance->distance_block(7, 1, 0, 90, row.vector, 1);
+	for (index_t j=0; j<90; j++)
+		EXPECT_NEAR(distance->distance(7, j), row[j], 1e-12*row[j]);
+
+	EXPECT_THROW(distance->distance_block(100, 51, 0, 1, row.vector),
+			ShogunException);
+
+	SG_UNREF(distance);
+}
+
+TEST(DenseDistanceEngine, kernel_distance_block)
+{
+	CMath::init_random(17);
+	CDenseFeatures<float64_t>* feats_lhs=
+		new CDenseFeatures<float64_t>(generate_data(5, 40));
+	CDenseFeatures<float64_t>* feats_rhs=
+		new CDenseFeatures<float64_t>(generate_data(5, 30));
+	CKernelDistance* distance=new CKernelDistance(feats_lhs, feats_rhs, 20,
+			new CPolyKernel(10, 2));
+	SG_REF(distance);
+
+	SGMatrix<float64_t> block(40, 30);
+	distance->distance_block(0, 40, 0, 30, block.matrix);
+	for (index_t j=0; j<30; j++)
+	{
+		for (index_t i=0; i<40; i++)
+			EXPECT_EQ(distance->distance(i, j), block(i, j));
+	}
+
+	SG_UNREF(distance);
+}
@@ -8,6 +8,10 @@
  */
 
 #include <shogun/features/DenseFeatures.h>
+#include <shogun/preprocessor/PruneVarSubMean.h>
+#include <shogun/preprocessor/NormOne.h>
+#include <shogun/preprocessor/RescaleFeatures.h>
+#include <shogun/preprocessor/LogPlusOne.h>
 #include <gtest/gtest.h>
 
 #ifdef HAVE_CXX11
@@ -154,3 +158,178 @@ TEST(DenseFeaturesTest, shallow_copy_subset_data)
 	SG_UNREF(features_copy);
 	SG_UNREF(features);
 }
+
+TEST(DenseFeaturesTest, apply_preprocessor_pipeline)
+{
+	index_t dim=5;
+	index_t n=1000;
+
+	SGMatrix<float64_t> data(dim,n);
+	for (index_t i=0; i<dim*n; ++i)
+		data.matrix[i]=CMath::randn_double();
+
+	/* constant feature which is pruned */
+	for (index_t i=0; i<n; ++i)
+		data(2,i)=1.0;
+
+	CDenseFeatures<float64_t>* features=new CDenseFeatures<float64_t>(data.clone());
+	CPruneVarSubMean* prune=new CPruneVarSubMean();
+	CNormOne* norm=new CNormOne();
+	prune->init(features);
+	features->add_preprocessor(prune);
+	features->add_preprocessor(norm);
+
+	/* blocks which do not divide the number of vectors */
+	features->set_preprocessing_block_size(64);
+	features->apply_preprocessor();
+
+	EXPECT_EQ(dim-1, features->get_num_features());
+	EXPECT_EQ(n, features->get_num_vectors());
+
+	for (index_t i=0; i<n; ++i)
+	{
+		SGVector<float64_t> pruned=prune->apply_to_feature_vector(
+				SGVector<float64_t>(data.get_column_vector(i), dim, false));
+		SGVector<float64_t> expected=norm->apply_to_feature_vector(pruned);
+		SGVector<float64_t> v=features->get_feature_vector(i);
+
+		ASSERT_EQ(expected.vlen, v.vlen);
+		for (index_t j=0; j<v.vlen; ++j)
+			EXPECT_NEAR(expected[j], v[j], 1E-14);
+	}
+
+	SG_UNREF(features);
+}
+
+TEST(DenseFeaturesTest, on_the_fly_preprocessing)
+{
+	index_t dim=5;
+	index_t n=1000;
+
+	SGMatrix<float64_t> data(dim,n);
+	for (index_t i=0; i<dim*n; ++i)
+		data.matrix[i]=CMath::randn_double();
+
+	for (index_t i=0; i<n; ++i)
+		data(2,i)=1.0;
+
+	CDenseFeatures<float64_t>* features=new CDenseFeatures<float64_t>(data);
+	CPruneVarSubMean* prune=new CPruneVarSubMean();
+	CRescaleFeatures* rescale=new CRescaleFeatures();
+	CLogPlusOne* log=new CLogPlusOne();
+	SG_REF(prune);
+	SG_REF(rescale);
+	SG_REF(log);
+
+	prune->init(features);
+	SGMatrix<float64_t> pruned_data(dim-1, n);
+	for (index_t i=0; i<n; ++i)
+	{
+		SGVector<float64_t> v=prune->apply_to_feature_vector(
+				features->get_feature_vector(i));
+		memcpy(pruned_data.get_column_vector(i), v.vector, sizeof(float64_t)*v.vlen);
+	}
+	CDenseFeatures<float64_t>* pruned=new CDenseFeatures<float64_t>(pruned_data);
+	SG_REF(pruned);
+	rescale->init(pruned);
+
+	features->add_preprocessor(prune);
+	features->add_preprocessor(rescale);
+	features->add_preprocessor(log);
+	features->set_preprocessing_block_size(64);
+	features->enable_on_the_fly_preprocessing();
+
+	EXPECT_EQ(dim-1, features->get_dim_feature_space());
+
+	SGMatrix<float64_t> result(dim-1, n);
+#pragma omp parallel for
+	for (index_t i=0; i<n; ++i)
+	{
+		SGVector<float64_t> v=features->get_feature_vector(i);
+		ASSERT(v.vlen==dim-1);
+		memcpy(result.get_column_vector(i), v.vector, sizeof(float64_t)*v.vlen);
+		features->free_feature_vector(v, i);
+	}
+
+	/* vectors are not copied from the cached blocks */
+	SGVector<float64_t> first=features->get_feature_vector(0);
+	SGVector<float64_t> again=features->get_feature_vector(0);
+	EXPECT_EQ(first.vector, again.vector);
+	features->free_feature_vector(again, 0);
+	features->free_feature_vector(first, 0);
+
+	for (index_t i=0; i<n; ++i)
+	{
+		SGVector<float64_t> scaled=rescale->apply_to_feature_vector(
+				pruned->get_feature_vector(i));
+		SGVector<float64_t> expected=log->apply_to_feature_vector(scaled);
+
+		for (index_t j=0; j<expected.vlen; ++j)
+			EXPECT_NEAR(expected[j], result(j,i), 1E-14);
+	}
+
+	/* dot products are computed in the preprocessed feature space */
+	EXPECT_EQ(dim-1, features->get_nnz_features_for_vector(0));
+
+	SGVector<float64_t> w(dim-1);
+	for (index_t j=0; j<w.vlen; ++j)
+		w[j]=j+1;
+
+	SGVector<float64_t> sum(dim-1);
+	sum.zero();
+	features->add_to_dense_vec(2.0, 3, sum.vector, sum.vlen);
+
+	float64_t expected_dot=0;
+	for (index_t j=0; j<w.vlen; ++j)
+	{
+		expected_dot+=w[j]*result(j,3);
+		EXPECT_NEAR(2.0*result(j,3), sum[j], 1E-14);
+	}
+	EXPECT_NEAR(expected_dot, features->dense_dot(3, w.vector, w.vlen), 1E-12);
+
+	/* the matrix itself is left untouched */
+	EXPECT_EQ(dim, features->get_num_features());
+	EXPECT_EQ(1.0, features->get_feature_matrix()(2,0));
+
+	features->disable_on_the_fly_preprocessing();
+	EXPECT_EQ(dim, features->get_dim_feature_space());
+
+	SG_UNREF(pruned);
+	SG_UNREF(features);
+	SG_UNREF(log);
+	SG_UNREF(rescale);
+	SG_UNREF(prune);
+}
+
+TEST(DenseFeaturesTest, feature_vector_view)
+{
+	SGMatrix<float64_t> data(3, 4);
+	for (index_t i=0; i<data.num_rows*data.num_cols; ++i)
+		data.matrix[i]=i;
+
+	CDenseFeatures<float64_t>* features=new CDenseFeatures<float64_t>(data);
+	SG_REF(features);
+
+	SGSpan<float64_t> view=features->get_feature_vector_view(2);
+	EXPECT_EQ(3, view.size());
+	EXPECT_EQ(data.get_column_vector(2), view.data());
+
+	SGMatrixView<float64_t> matrix_view=features->get_feature_matrix_view();
+	EXPECT_EQ(data.matrix, matrix_view.data());
+	EXPECT_EQ(4, matrix_view.num_cols());
+
+	/* views follow the subset and write through */
+	SGVector<index_t> subset(2);
+	subset[0]=3;
+	subset[1]=1;
+	features->add_subset(subset);
+
+	view=features->get_feature_vector_view(0);
+	for (index_t j=0; j<view.size(); ++j)
+		EXPECT_EQ(data(j,3), view[j]);
+
+	view[0]=-1;
+	EXPECT_EQ(-1, data(0,3));
+
+	SG_UNREF(features);
+}
@@ -0,0 +1,90 @@
+#include <shogun/features/FastfoodDotFeatures.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/mathematics/Math.h>
+
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+static CDenseFeatures<float64_t>* create_features(int32_t num_dims,
+		int32_t num_vecs)
+{
+	SGMatrix<float64_t> data(num_dims, num_vecs);
+	for (index_t i=0; i<num_vecs; i++)
+	{
+		for (index_t j=0; j<num_dims; j++)
+			data(j,i)=CMath::sin(i+j*0.3)*(i+1)*0.2;
+	}
+
+	return new CDenseFeatures<float64_t>(data);
+}
+
+TEST(FastfoodDotFeatures, approximates_gaussian_kernel)
+{
+	int32_t num_dims=10;
+	int32_t vecs=5;
+	int32_t D=8192;
+	float64_t width=10;
+
+	CMath::init_random(17);
+	CDenseFeatures<float64_t>* d_feats=create_features(num_dims, vecs);
+	CFastfoodDotFeatures* r_feats=new CFastfoodDotFeatures(d_feats, D, width);
+	SG_REF(r_feats);
+
+	EXPECT_EQ(D, r_feats->get_dim_feature_space());
+	EXPECT_EQ(vecs, r_feats->get_num_vectors());
+
+	SGMatrix<float64_t> data=d_feats->get_feature_matrix();
+	for (index_t i=0; i<vecs; i++)
+	{
+		for (index_t j=0; j<vecs; j++)
+		{
+			float64_t dist=0;
+			for (index_t k=0; k<num_dims; k++)
+				dist+=CMath::sq(data(k,i)-data(k,j));
+
+			EXPECT_NEAR(CMath::exp(-dist/width), r_feats->dot(i, r_feats, j), 0.05);
+		}
+	}
+
+	SG_UNREF(r_feats);
+}
+
+TEST(FastfoodDotFeatures, materialization_cache)
+{
+	int32_t num_dims=20;
+	int32_t vecs=30;
+	int32_t D=100;
+
+	CDenseFeatures<float64_t>* d_feats=create_features(num_dims, vecs);
+	CFastfoodDotFeatures* r_feats=new CFastfoodDotFeatures(d_feats, D, 5.0);
+	SG_REF(r_feats);
+
+	SGVector<float64_t> w(D);
+	for (index_t i=0; i<D; i++)
+		w[i]=i%7-3;
+
+	SGVector<float64_t> expected(vecs);
+	for (index_t i=0; i<vecs; i++)
+		expected[i]=r_feats->dense_dot(i, w.vector, w.vlen);
+
+	/* blocks of 4 vectors, at most two of them are cached */
+	r_feats->set_materialization_cache(4, 2*4*D*sizeof(float64_t));
+	for (index_t pass=0; pass<2; pass++)
+	{
+		for (index_t i=0; i<vecs; i++)
+			EXPECT_EQ(expected[i], r_feats->dense_dot(i, w.vector, w.vlen));
+	}
+
+	CFastfoodDotFeatures* copy=(CFastfoodDotFeatures*) r_feats->duplicate();
+	SGVector<float64_t> sum(D);
+	sum.zero();
+	copy->add_to_dense_vec(2.0, 3, sum.vector, sum.vlen);
+	SGVector<float64_t> vec(D);
+	r_feats->compute_features(3, vec.vector);
+	for (index_t i=0; i<D; i++)
+		EXPECT_NEAR(2*vec[i], sum[i], 1e-15);
+
+	SG_UNREF(copy);
+	SG_UNREF(r_feats);
+}
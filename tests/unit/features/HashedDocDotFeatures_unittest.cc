@@ -304,3 +304,78 @@ TEST(HashedDocDotFeaturesTest, quadratic_add_to_dense)
 	SG_UNREF(hddf);
 	SG_FREE(hashes);
 }
+
+TEST(HashedDocDotFeaturesTest, indexed_features_test)
+{
+	const char* docs[] = {
+		"You're never too old to rock and roll, if you're too young to die",
+		"Give me some rope, tie me to dream, give me the hope to run out of steam",
+		"Thank you Jack Daniels, Old Number Seven, Tennessee Whiskey got me drinking in heaven"};
+
+	SGStringList<char> list(3,85);
+	for (index_t i=0; i<3; i++)
+	{
+		int32_t length = strlen(docs[i]);
+		list.strings[i] = SGString<char>(length);
+		for (index_t j=0; j<length; j++)
+			list.strings[i].string[j] = docs[i][j];
+	}
+
+	int32_t dimension = 64;
+	int32_t hash_bits = 6;
+
+	CDelimiterTokenizer* tokenizer = new CDelimiterTokenizer();
+	tokenizer->delimiters[' '] = 1;
+	tokenizer->delimiters['\''] = 1;
+	tokenizer->delimiters[','] = 1;
+
+	CStringFeatures<char>* doc_collection = new CStringFeatures<char>(list, RAWBYTE);
+	CHashedDocDotFeatures* hddf = new CHashedDocDotFeatures(hash_bits, doc_collection,
+			tokenizer, true, 2, 1);
+	CHashedDocDotFeatures* indexed = new CHashedDocDotFeatures(hash_bits, doc_collection,
+			tokenizer, true, 2, 1);
+
+	SGVector<float64_t> vec(dimension);
+	for (index_t i=0; i<dimension; i++)
+		vec[i] = CMath::random(-dimension, dimension);
+
+	EXPECT_EQ(indexed->build_index(), 3);
+	int32_t nnz_first = indexed->get_nnz_features_for_vector(0);
+	for (index_t budget=0; budget<2; budget++)
+	{
+		/** first with every document indexed, then only with the first one */
+		if (budget==1)
+		{
+			EXPECT_EQ(indexed->build_index(nnz_first*2*sizeof(uint32_t)), 1);
+			EXPECT_TRUE(indexed->is_indexed(0));
+			EXPECT_FALSE(indexed->is_indexed(1));
+			EXPECT_FALSE(indexed->is_indexed(2));
+		}
+
+		for (index_t i=0; i<3; i++)
+		{
+			EXPECT_LE(indexed->get_nnz_features_for_vector(i),
+					hddf->get_nnz_features_for_vector(i));
+			EXPECT_NEAR(hddf->dense_dot(i, vec.vector, dimension),
+					indexed->dense_dot(i, vec.vector, dimension), 1E-10);
+
+			SGVector<float64_t> expected(dimension);
+			SGVector<float64_t> result(dimension);
+			expected.zero();
+			result.zero();
+			hddf->add_to_dense_vec(0.5, i, expected.vector, dimension);
+			indexed->add_to_dense_vec(0.5, i, result.vector, dimension);
+			for (index_t j=0; j<dimension; j++)
+				EXPECT_NEAR(expected[j], result[j], 1E-10);
+
+			for (index_t j=0; j<3; j++)
+				EXPECT_NEAR(hddf->dot(i, hddf, j), indexed->dot(i, indexed, j), 1E-10);
+		}
+	}
+
+	indexed->free_index();
+	EXPECT_FALSE(indexed->is_indexed(0));
+
+	SG_UNREF(indexed);
+	SG_UNREF(hddf);
+}
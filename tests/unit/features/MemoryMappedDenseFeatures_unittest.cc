@@ -0,0 +1,148 @@
+#include <shogun/lib/config.h>
+#include <shogun/features/MemoryMappedDenseFeatures.h>
+#include <shogun/features/HDF5DenseFeatures.h>
+#include <shogun/io/HDF5File.h>
+#include <shogun/lib/SGMatrix.h>
+
+#include <cstdio>
+
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+static SGMatrix<float64_t> create_matrix(int32_t num_feat, int32_t num_vec)
+{
+	SGMatrix<float64_t> data(num_feat, num_vec);
+	for (index_t i=0; i<num_feat*num_vec; i++)
+		data.matrix[i]=i*0.5-3;
+
+	return data;
+}
+
+TEST(MemoryMappedDenseFeatures, get_feature_vector)
+{
+	const int32_t num_feat=3;
+	const int32_t num_vec=1000;
+	const char* fname="MemoryMappedDenseFeatures_get_feature_vector.bin";
+
+	/* a header of one element which is skipped */
+	SGMatrix<float64_t> data=create_matrix(num_feat, num_vec);
+	float64_t header=42;
+	FILE* f=fopen(fname, "wb");
+	fwrite(&header, sizeof(float64_t), 1, f);
+	fwrite(data.matrix, sizeof(float64_t), num_feat*num_vec, f);
+	fclose(f);
+
+	CMemoryMappedDenseFeatures<float64_t>* feats=
+		new CMemoryMappedDenseFeatures<float64_t>(fname, num_feat, sizeof(float64_t));
+	SG_REF(feats);
+
+	feats->set_readahead(16);
+	feats->set_memory_budget(3*16*num_feat*sizeof(float64_t));
+
+	EXPECT_EQ(num_feat, feats->get_num_features());
+	EXPECT_EQ(num_vec, feats->get_num_vectors());
+
+	/* two passes, the second one after the first chunks were released */
+	for (index_t pass=0; pass<2; pass++)
+	{
+		for (index_t i=0; i<num_vec; i++)
+		{
+			SGVector<float64_t> vec=feats->get_feature_vector(i);
+			ASSERT_EQ(num_feat, vec.vlen);
+			for (index_t j=0; j<num_feat; j++)
+				EXPECT_EQ(data(j, i), vec[j]);
+			feats->free_feature_vector(vec, i);
+		}
+	}
+
+	CDenseFeatures<float64_t>* copy=(CDenseFeatures<float64_t>*) feats->duplicate();
+	SG_UNREF(feats);
+
+	/* the copy keeps the mapping alive */
+	SGMatrix<float64_t> matrix=copy->get_feature_matrix();
+	for (index_t i=0; i<num_feat*num_vec; i++)
+		EXPECT_EQ(data.matrix[i], matrix.matrix[i]);
+
+	SG_UNREF(copy);
+	remove(fname);
+}
+
+TEST(MemoryMappedDenseFeatures, modify_matrix)
+{
+	const int32_t num_feat=4;
+	const int32_t num_vec=50;
+	const char* fname="MemoryMappedDenseFeatures_modify_matrix.bin";
+
+	SGMatrix<float64_t> data=create_matrix(num_feat, num_vec);
+	FILE* f=fopen(fname, "wb");
+	fwrite(data.matrix, sizeof(float64_t), num_feat*num_vec, f);
+	fclose(f);
+
+	CMemoryMappedDenseFeatures<float64_t>* feats=
+		new CMemoryMappedDenseFeatures<float64_t>(fname, num_feat);
+	SG_REF(feats);
+
+	/* in place, like a preprocessor does */
+	SGMatrix<float64_t> matrix=feats->get_feature_matrix();
+	for (index_t i=0; i<num_feat*num_vec; i++)
+		matrix.matrix[i]*=2;
+
+	SGVector<float64_t> vec=feats->get_feature_vector(num_vec-1);
+	for (index_t j=0; j<num_feat; j++)
+		EXPECT_EQ(2*data(j, num_vec-1), vec[j]);
+	feats->free_feature_vector(vec, num_vec-1);
+	SG_UNREF(feats);
+
+	/* the file itself is not modified */
+	CMemoryMappedDenseFeatures<float64_t>* orig=
+		new CMemoryMappedDenseFeatures<float64_t>(fname, num_feat);
+	SG_REF(orig);
+	matrix=orig->get_feature_matrix();
+	for (index_t i=0; i<num_feat*num_vec; i++)
+		EXPECT_EQ(data.matrix[i], matrix.matrix[i]);
+
+	SG_UNREF(orig);
+	remove(fname);
+}
+
+#ifdef HAVE_HDF5
+TEST(HDF5DenseFeatures, get_feature_vector)
+{
+	/* blocks do not start at row boundaries of the dataset */
+	const int32_t num_feat=7;
+	const int32_t num_vec=100;
+	char fname[]="HDF5DenseFeatures_get_feature_vector.h5";
+
+	SGMatrix<float64_t> data=create_matrix(num_feat, num_vec);
+	CHDF5File* fout=new CHDF5File(fname, 'w', "/data");
+	fout->set_matrix(data.matrix, num_feat, num_vec);
+	SG_UNREF(fout);
+
+	CHDF5DenseFeatures<float64_t>* feats=
+		new CHDF5DenseFeatures<float64_t>(fname, "/data");
+	SG_REF(feats);
+
+	feats->set_block_size(9);
+	feats->set_memory_budget(2*9*num_feat*sizeof(float64_t));
+
+	EXPECT_EQ(num_feat, feats->get_num_features());
+	EXPECT_EQ(num_vec, feats->get_num_vectors());
+
+	for (index_t pass=0; pass<2; pass++)
+	{
+		for (index_t i=0; i<num_vec; i++)
+		{
+			index_t idx=pass ? num_vec-1-i : i;
+			SGVector<float64_t> vec=feats->get_feature_vector(idx);
+			ASSERT_EQ(num_feat, vec.vlen);
+			for (index_t j=0; j<num_feat; j++)
+				EXPECT_EQ(data(j, idx), vec[j]);
+			feats->free_feature_vector(vec, idx);
+		}
+	}
+
+	SG_UNREF(feats);
+	remove(fname);
+}
+#endif // HAVE_HDF5
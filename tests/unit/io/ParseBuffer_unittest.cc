@@ -0,0 +1,171 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <shogun/lib/config.h>
+
+#ifdef HAVE_PTHREAD
+#include <shogun/io/streaming/ParseBuffer.h>
+#include <pthread.h>
+#include <sched.h>
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+static void write_example(CParseBuffer<float64_t>* buffer, int32_t i)
+{
+	Example<float64_t> ex;
+	ex.label=i;
+	ex.fv=SG_MALLOC(float64_t, 1);
+	ex.fv[0]=i;
+	ex.length=1;
+
+	buffer->copy_example(&ex);
+}
+
+static void read_example(CParseBuffer<float64_t>* buffer, int32_t i)
+{
+	Example<float64_t>* ex=buffer->hold_unused_example();
+	ASSERT_TRUE(ex!=NULL);
+	EXPECT_EQ(i, ex->label);
+	EXPECT_EQ(i, ex->fv[0]);
+}
+
+TEST(ParseBuffer, read_until_release)
+{
+	CParseBuffer<float64_t>* buffer=new CParseBuffer<float64_t>(4);
+	SG_REF(buffer);
+
+	EXPECT_TRUE(buffer->get_unused_example()==NULL);
+
+	for (int32_t i=0; i<3; i++)
+		write_example(buffer, i);
+
+	/* the example at the read position is returned until it is released */
+	for (int32_t i=0; i<3; i++)
+	{
+		Example<float64_t>* ex=buffer->get_unused_example();
+		ASSERT_TRUE(ex!=NULL);
+		EXPECT_EQ(i, ex->label);
+		EXPECT_EQ(ex, buffer->get_unused_example());
+		buffer->finalize_example(true);
+	}
+
+	EXPECT_TRUE(buffer->get_unused_example()==NULL);
+
+	SG_UNREF(buffer);
+}
+
+TEST(ParseBuffer, read_release_wrap_around)
+{
+	CParseBuffer<float64_t>* buffer=new CParseBuffer<float64_t>(4);
+	SG_REF(buffer);
+
+	EXPECT_TRUE(buffer->hold_unused_example()==NULL);
+
+	for (int32_t i=0; i<4; i++)
+		write_example(buffer, i);
+
+	/* several examples are held at a time */
+	read_example(buffer, 0);
+	read_example(buffer, 1);
+	read_example(buffer, 2);
+
+	/* releasing frees the oldest slot, which is written next */
+	buffer->finalize_example(true);
+	write_example(buffer, 4);
+
+	read_example(buffer, 3);
+	read_example(buffer, 4);
+
+	/* the read position wrapped around to examples 1 and 2, which are
+	 * still held and must not be returned again */
+	EXPECT_TRUE(buffer->hold_unused_example()==NULL);
+
+	buffer->finalize_example(true);
+	buffer->finalize_example(true);
+	EXPECT_TRUE(buffer->hold_unused_example()==NULL);
+
+	write_example(buffer, 5);
+	write_example(buffer, 6);
+	read_example(buffer, 5);
+	read_example(buffer, 6);
+
+	for (int32_t i=3; i<7; i++)
+		buffer->finalize_example(true);
+
+	for (int32_t i=7; i<10; i++)
+		write_example(buffer, i);
+
+	for (int32_t i=7; i<10; i++)
+	{
+		read_example(buffer, i);
+		buffer->finalize_example(true);
+	}
+
+	EXPECT_TRUE(buffer->hold_unused_example()==NULL);
+
+	SG_UNREF(buffer);
+}
+
+struct SParseBufferWriter
+{
+	CParseBuffer<float64_t>* buffer;
+	int32_t num_examples;
+};
+
+static void* write_examples(void* p)
+{
+	SParseBufferWriter* writer=(SParseBufferWriter*) p;
+	for (int32_t i=0; i<writer->num_examples; i++)
+		write_example(writer->buffer, i);
+
+	return NULL;
+}
+
+TEST(ParseBuffer, held_examples_are_not_overwritten)
+{
+	const int32_t num_examples=1000;
+	const int32_t window=5;
+
+	CParseBuffer<float64_t>* buffer=new CParseBuffer<float64_t>(8);
+	SG_REF(buffer);
+
+	SParseBufferWriter writer;
+	writer.buffer=buffer;
+	writer.num_examples=num_examples;
+
+	pthread_t thread;
+	pthread_create(&thread, NULL, write_examples, &writer);
+
+	Example<float64_t>* held[window];
+	for (int32_t first=0; first<num_examples; first+=window)
+	{
+		for (int32_t j=0; j<window; j++)
+		{
+			while (!(held[j]=buffer->hold_unused_example()))
+				sched_yield();
+
+			EXPECT_EQ(first+j, held[j]->label);
+		}
+
+		/* give the writer a chance to overwrite what it must not */
+		sched_yield();
+
+		for (int32_t j=0; j<window; j++)
+		{
+			EXPECT_EQ(first+j, held[j]->label);
+			EXPECT_EQ(first+j, held[j]->fv[0]);
+			buffer->finalize_example(true);
+		}
+	}
+
+	pthread_join(thread, NULL);
+	EXPECT_TRUE(buffer->hold_unused_example()==NULL);
+
+	SG_UNREF(buffer);
+}
+#endif // HAVE_PTHREAD
@@ -0,0 +1,26 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <shogun/kernel/string/FixedDegreeStringKernel.h>
+#include "PackedStringKernel_unittest.h"
+
+TEST(FixedDegreeStringKernel,packed)
+{
+	CMath::init_random(17);
+	CStringFeatures<char>* lhs=generate_strings(10, 150, "ACGT", 4, DNA);
+	CStringFeatures<char>* rhs=generate_strings(7, 150, "ACGT", 4, DNA);
+	SG_REF(lhs);
+	SG_REF(rhs);
+
+	check_packed(new CFixedDegreeStringKernel(10, 1), lhs, rhs);
+	check_packed(new CFixedDegreeStringKernel(10, 3), lhs, lhs);
+	check_packed(new CFixedDegreeStringKernel(10, 3), lhs, rhs);
+	check_packed(new CFixedDegreeStringKernel(10, 70), lhs, rhs);
+
+	SG_UNREF(lhs);
+	SG_UNREF(rhs);
+}
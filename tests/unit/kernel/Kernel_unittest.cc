@@ -33,6 +33,15 @@
 #include <shogun/lib/SGMatrix.h>
 #include <shogun/features/DenseFeatures.h>
 #include <shogun/kernel/GaussianKernel.h>
+#include <shogun/kernel/PolyKernel.h>
+#include <shogun/kernel/normalizer/SqrtDiagKernelNormalizer.h>
+#include <shogun/kernel/normalizer/AvgDiagKernelNormalizer.h>
+#include <shogun/kernel/normalizer/DiceKernelNormalizer.h>
+#include <shogun/kernel/normalizer/TanimotoKernelNormalizer.h>
+#include <shogun/kernel/normalizer/VarianceKernelNormalizer.h>
+#include <shogun/kernel/normalizer/RidgeKernelNormalizer.h>
+#include <shogun/kernel/normalizer/ZeroMeanCenterKernelNormalizer.h>
+#include <shogun/transfer/multitask/MultitaskKernelNormalizer.h>
 #include <gtest/gtest.h>
 
 using namespace shogun;
@@ -456,4 +465,82 @@ TEST(Kernel, gaussian_kernel_width_constructor)
 	EXPECT_EQ(kernel->get_cache_size(), 10);
 	EXPECT_EQ(kernel->get_width(), width);
 	SG_UNREF(kernel);
-}
\ No newline at end of file
+}
+/* the kernel matrix and rows are computed in blocks, which have to give
+ * exactly the values of single kernel evaluations */
+static void check_kernel_blocks(CKernel* kernel)
+{
+	SGMatrix<float64_t> km=kernel->get_kernel_matrix();
+	ASSERT_EQ(kernel->get_num_vec_lhs(), km.num_rows);
+	ASSERT_EQ(kernel->get_num_vec_rhs(), km.num_cols);
+
+	for (index_t i=0; i<km.num_rows; i++)
+	{
+		for (index_t j=0; j<km.num_cols; j++)
+			EXPECT_EQ(kernel->kernel(i, j), km(i, j));
+	}
+
+	SGVector<float64_t> row(km.num_cols-3);
+	kernel->kernel_row_block(7, 3, row.vlen, row.vector);
+	for (index_t j=0; j<row.vlen; j++)
+		EXPECT_EQ(km(7, j+3), row[j]);
+}
+
+TEST(Kernel, kernel_block_normalizers)
+{
+	const index_t num_lhs=300;
+	const index_t num_rhs=330;
+	const index_t dim=3;
+
+	CMath::init_random(100);
+	SGMatrix<float64_t> data_lhs(dim, num_lhs);
+	SGMatrix<float64_t> data_rhs(dim, num_rhs);
+	for (index_t i=0; i<dim*num_lhs; i++)
+		data_lhs.matrix[i]=CMath::randn_double();
+	for (index_t i=0; i<dim*num_rhs; i++)
+		data_rhs.matrix[i]=CMath::randn_double();
+
+	CDenseFeatures<float64_t>* feats_lhs=new CDenseFeatures<float64_t>(data_lhs);
+	CDenseFeatures<float64_t>* feats_rhs=new CDenseFeatures<float64_t>(data_rhs);
+	SG_REF(feats_lhs);
+	SG_REF(feats_rhs);
+	CPolyKernel* kernel=new CPolyKernel(10, 2);
+	SG_REF(kernel);
+
+	CKernelNormalizer* normalizers[]={new CSqrtDiagKernelNormalizer(),
+		new CAvgDiagKernelNormalizer(), new CDiceKernelNormalizer(),
+		new CTanimotoKernelNormalizer(), new CVarianceKernelNormalizer(),
+		new CRidgeKernelNormalizer(), new CZeroMeanCenterKernelNormalizer()};
+
+	for (index_t k=0; k<7; k++)
+	{
+		kernel->set_normalizer(normalizers[k]);
+
+		/* symmetric kernel matrix */
+		kernel->init(feats_lhs, feats_lhs);
+		check_kernel_blocks(kernel);
+
+		/* lhs and rhs differ */
+		kernel->init(feats_lhs, feats_rhs);
+		check_kernel_blocks(kernel);
+	}
+
+	/* the task similarity is looked up per pair of tasks */
+	std::vector<int32_t> tasks(num_lhs);
+	for (index_t i=0; i<num_lhs; i++)
+		tasks[i]=(i/50)%3;
+
+	CMultitaskKernelNormalizer* multitask=new CMultitaskKernelNormalizer(tasks);
+	for (index_t t1=0; t1<3; t1++)
+	{
+		for (index_t t2=0; t2<3; t2++)
+			multitask->set_task_similarity(t1, t2, 1.0/(1+t1+t2));
+	}
+	kernel->set_normalizer(multitask);
+	kernel->init(feats_lhs, feats_lhs);
+	check_kernel_blocks(kernel);
+
+	SG_UNREF(kernel);
+	SG_UNREF(feats_lhs);
+	SG_UNREF(feats_rhs);
+}
@@ -0,0 +1,66 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef _PACKEDSTRINGKERNEL_UNITTEST_H_
+#define _PACKEDSTRINGKERNEL_UNITTEST_H_
+
+#include <shogun/features/StringFeatures.h>
+#include <shogun/lib/SGStringList.h>
+#include <shogun/mathematics/Math.h>
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+/* random strings over the first num_symbols letters of symbols with a
+ * common prefix, such that there are long runs of matches */
+static CStringFeatures<char>* generate_strings(int32_t num_strings,
+		int32_t len, const char* symbols, int32_t num_symbols, EAlphabet alphabet)
+{
+	SGStringList<char> list(num_strings, len);
+	SGVector<char> prefix(len);
+	for (index_t j=0; j<len; j++)
+		prefix[j]=symbols[CMath::random(0, num_symbols-1)];
+
+	for (index_t i=0; i<num_strings; i++)
+	{
+		list.strings[i]=SGString<char>(len);
+		for (index_t j=0; j<len; j++)
+		{
+			if (CMath::random(0, 3)==0)
+				list.strings[i].string[j]=symbols[CMath::random(0, num_symbols-1)];
+			else
+				list.strings[i].string[j]=prefix[j];
+		}
+	}
+
+	return new CStringFeatures<char>(list, alphabet);
+}
+
+/* kernel matrices with and without packed computation have to agree */
+template <class T>
+static void check_packed(T* kernel, CStringFeatures<char>* lhs,
+		CStringFeatures<char>* rhs)
+{
+	SG_REF(kernel);
+	kernel->set_use_packed_computation(false);
+	kernel->init(lhs, rhs);
+	SGMatrix<float64_t> expected=kernel->get_kernel_matrix();
+
+	kernel->set_use_packed_computation(true);
+	kernel->init(lhs, rhs);
+	SGMatrix<float64_t> packed=kernel->get_kernel_matrix();
+
+	ASSERT_EQ(expected.num_rows, packed.num_rows);
+	ASSERT_EQ(expected.num_cols, packed.num_cols);
+	for (index_t i=0; i<expected.num_rows*expected.num_cols; i++)
+		EXPECT_NEAR(expected[i], packed[i], 1e-10);
+
+	kernel->cleanup();
+	SG_UNREF(kernel);
+}
+
+#endif /* _PACKEDSTRINGKERNEL_UNITTEST_H_ */
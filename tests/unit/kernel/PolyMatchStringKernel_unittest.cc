@@ -0,0 +1,44 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <shogun/kernel/string/PolyMatchStringKernel.h>
+#include "PackedStringKernel_unittest.h"
+
+TEST(PolyMatchStringKernel,packed)
+{
+	CMath::init_random(17);
+	CStringFeatures<char>* lhs=generate_strings(10, 150, "ACGT", 4, DNA);
+	CStringFeatures<char>* rhs=generate_strings(7, 150, "ACGT", 4, DNA);
+	SG_REF(lhs);
+	SG_REF(rhs);
+
+	check_packed(new CPolyMatchStringKernel(10, 2, false), lhs, rhs);
+	check_packed(new CPolyMatchStringKernel(10, 3, true), lhs, lhs);
+
+	CPolyMatchStringKernel* kernel=new CPolyMatchStringKernel(10, 2, true);
+	kernel->set_rescaling_enabled(true);
+	check_packed(kernel, lhs, rhs);
+
+	SG_UNREF(lhs);
+	SG_UNREF(rhs);
+}
+
+TEST(PolyMatchStringKernel,packed_dna_rna)
+{
+	// the same strings, T in DNA is U in RNA and both are encoded as 3
+	CMath::init_random(17);
+	CStringFeatures<char>* dna=generate_strings(10, 150, "ACGT", 4, DNA);
+	CMath::init_random(17);
+	CStringFeatures<char>* rna=generate_strings(10, 150, "ACGU", 4, RNA);
+	SG_REF(dna);
+	SG_REF(rna);
+
+	check_packed(new CPolyMatchStringKernel(10, 1, false), dna, rna);
+
+	SG_UNREF(dna);
+	SG_UNREF(rna);
+}
@@ -0,0 +1,99 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <shogun/kernel/string/WeightedDegreeStringKernel.h>
+#include "PackedStringKernel_unittest.h"
+
+TEST(WeightedDegreeStringKernel,packed_dna)
+{
+	CMath::init_random(17);
+	CStringFeatures<char>* lhs=generate_strings(10, 150, "ACGT", 4, DNA);
+	CStringFeatures<char>* rhs=generate_strings(7, 150, "ACGT", 4, DNA);
+	SG_REF(lhs);
+	SG_REF(rhs);
+
+	check_packed(new CWeightedDegreeStringKernel(8), lhs, lhs);
+	check_packed(new CWeightedDegreeStringKernel(8), lhs, rhs);
+	check_packed(new CWeightedDegreeStringKernel(80), lhs, rhs);
+
+	CWeightedDegreeStringKernel* kernel=new CWeightedDegreeStringKernel(6);
+	kernel->set_use_block_computation(false);
+	check_packed(kernel, lhs, rhs);
+
+	SG_UNREF(lhs);
+	SG_UNREF(rhs);
+}
+
+TEST(WeightedDegreeStringKernel,packed_mismatch)
+{
+	CMath::init_random(17);
+	CStringFeatures<char>* lhs=generate_strings(10, 70, "ACGT", 4, DNA);
+	CStringFeatures<char>* rhs=generate_strings(7, 70, "ACGT", 4, DNA);
+	SG_REF(lhs);
+	SG_REF(rhs);
+
+	for (int32_t max_mismatch=1; max_mismatch<=3; max_mismatch++)
+	{
+		CWeightedDegreeStringKernel* kernel=new CWeightedDegreeStringKernel(10);
+		kernel->set_max_mismatch(max_mismatch);
+		check_packed(kernel, lhs, rhs);
+	}
+
+	SG_UNREF(lhs);
+	SG_UNREF(rhs);
+}
+
+TEST(WeightedDegreeStringKernel,packed_position_weights)
+{
+	CMath::init_random(17);
+	int32_t len=100;
+	int32_t degree=5;
+	CStringFeatures<char>* lhs=generate_strings(10, len, "ACGT", 4, DNA);
+	CStringFeatures<char>* rhs=generate_strings(7, len, "ACGT", 4, DNA);
+	SG_REF(lhs);
+	SG_REF(rhs);
+
+	SGVector<float64_t> pws(len);
+	for (index_t i=0; i<len; i++)
+		pws[i]=CMath::random(0.0, 1.0);
+
+	SGMatrix<float64_t> ws(degree, len);
+	for (index_t i=0; i<degree*len; i++)
+		ws[i]=CMath::random(0.0, 1.0);
+
+	for (int32_t max_mismatch=0; max_mismatch<=1; max_mismatch++)
+	{
+		CWeightedDegreeStringKernel* kernel=new CWeightedDegreeStringKernel(degree);
+		kernel->set_max_mismatch(max_mismatch);
+		kernel->init(lhs, rhs);
+		kernel->set_position_weights(pws.vector, len);
+		check_packed(kernel, lhs, rhs);
+	}
+
+	CWeightedDegreeStringKernel* kernel=new CWeightedDegreeStringKernel(degree);
+	kernel->set_weights(ws);
+	check_packed(kernel, lhs, rhs);
+
+	SG_UNREF(lhs);
+	SG_UNREF(rhs);
+}
+
+TEST(WeightedDegreeStringKernel,packed_raw)
+{
+	CMath::init_random(17);
+	const char* symbols="ACDEFGHIKLMNPQRSTVWYacgt.-";
+	CStringFeatures<char>* lhs=generate_strings(8, 130, symbols, 26, RAWBYTE);
+	CStringFeatures<char>* protein=generate_strings(8, 130, symbols, 20, PROTEIN);
+	SG_REF(lhs);
+	SG_REF(protein);
+
+	check_packed(new CWeightedDegreeStringKernel(10), lhs, lhs);
+	check_packed(new CWeightedDegreeStringKernel(10), protein, protein);
+
+	SG_UNREF(lhs);
+	SG_UNREF(protein);
+}
@@ -0,0 +1,83 @@
+#include <shogun/lib/config.h>
+#include <shogun/lib/Metrics.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/kernel/GaussianKernel.h>
+
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+#ifdef USE_METRICS
+TEST(Metrics, counters_of_parallel_threads)
+{
+	CDenseFeatures<float64_t>* feats=new CDenseFeatures<float64_t>();
+	SG_REF(feats);
+
+	const int32_t num=10000;
+#pragma omp parallel for
+	for (int32_t i=0; i<num; i++)
+	{
+		SG_METRIC_INC(feats, "test_events")
+		SG_METRIC_ADD(feats, "test_sum", i)
+	}
+
+	Metrics* metrics=feats->get_metrics();
+	EXPECT_EQ(num, metrics->find("test_events")->get_sum());
+	EXPECT_EQ(num, metrics->find("test_events")->get_count());
+	EXPECT_EQ(int64_t(num)*(num-1)/2, metrics->find("test_sum")->get_sum());
+	EXPECT_EQ(NULL, metrics->find("not_used"));
+
+	feats->reset_metrics();
+	EXPECT_EQ(0, metrics->find("test_events")->get_sum());
+
+	SG_UNREF(feats);
+}
+
+TEST(Metrics, timers)
+{
+	CDenseFeatures<float64_t>* feats=new CDenseFeatures<float64_t>();
+	SG_REF(feats);
+
+	for (int32_t i=0; i<3; i++)
+	{
+		SG_METRIC_TIMER(feats, "test_timer")
+	}
+
+	Metric* timer=feats->get_metrics()->find("test_timer");
+	EXPECT_EQ(3, timer->get_count());
+	EXPECT_GE(timer->get_sum(), 0);
+
+	SG_UNREF(feats);
+}
+
+TEST(Metrics, kernel_evaluations_to_json)
+{
+	SGMatrix<float64_t> data(2, 5);
+	for (index_t i=0; i<data.num_rows*data.num_cols; i++)
+		data.matrix[i]=i;
+
+	CDenseFeatures<float64_t>* feats=new CDenseFeatures<float64_t>(data);
+	CGaussianKernel* kernel=new CGaussianKernel(feats, feats, 2.0);
+	SG_REF(kernel);
+
+	EXPECT_EQ("{}", kernel->get_metrics_json());
+
+	/* only the upper triangle of the symmetric matrix is computed */
+	kernel->get_kernel_matrix();
+
+	EXPECT_EQ("{\"kernel_evaluations\": 15}", kernel->get_metrics_json());
+
+	SG_UNREF(kernel);
+}
+#else
+TEST(Metrics, disabled)
+{
+	CDenseFeatures<float64_t>* feats=new CDenseFeatures<float64_t>();
+	SG_REF(feats);
+
+	SG_METRIC_INC(feats, "test_events")
+	EXPECT_EQ("{}", feats->get_metrics_json());
+
+	SG_UNREF(feats);
+}
+#endif
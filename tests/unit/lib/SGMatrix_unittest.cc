@@ -5,6 +5,8 @@
 
 #include <shogun/mathematics/eigen3.h>
 
+#include <utility>
+
 using namespace shogun;
 
 TEST(SGMatrixTest,ctor_zero_const)
@@ -519,3 +521,27 @@ TEST(SGMatrixTest, from_eigen3)
 	for (int32_t i=0; i<nrows*ncols; i++)
 		EXPECT_EQ(eigen_mat(i), sg_mat[i]);
 }
+
+#if defined(HAVE_CXX0X) || defined(HAVE_CXX11)
+TEST(SGMatrixTest, move)
+{
+	SGMatrix<float64_t> a(3, 4);
+	float64_t* data=a.matrix;
+
+	SGMatrix<float64_t> b(std::move(a));
+	EXPECT_EQ(data, b.matrix);
+	EXPECT_EQ(3, b.num_rows);
+	EXPECT_EQ(4, b.num_cols);
+	EXPECT_EQ(1, b.ref_count());
+	EXPECT_EQ(NULL, a.matrix);
+	EXPECT_EQ(0, a.num_rows);
+	EXPECT_EQ(0, a.num_cols);
+
+	SGMatrix<float64_t> c(2, 2);
+	c=std::move(b);
+	EXPECT_EQ(data, c.matrix);
+	EXPECT_EQ(3, c.num_rows);
+	EXPECT_EQ(1, c.ref_count());
+	EXPECT_EQ(NULL, b.matrix);
+}
+#endif
@@ -0,0 +1,77 @@
+#include <shogun/lib/SGSpan.h>
+#include <shogun/lib/SGMatrixView.h>
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+TEST(SGSpanTest, view_of_vector)
+{
+	SGVector<float64_t> vec(5);
+	vec.range_fill();
+
+	SGSpan<float64_t> span=vec;
+	EXPECT_EQ(vec.vector, span.data());
+	EXPECT_EQ(5, span.size());
+	EXPECT_FALSE(span.empty());
+
+	/* no reference is taken */
+	EXPECT_EQ(1, vec.ref_count());
+
+	span[1]=10;
+	EXPECT_EQ(10, vec[1]);
+
+	float64_t sum=0;
+	for (float64_t* it=span.begin(); it!=span.end(); ++it)
+		sum+=*it;
+	EXPECT_EQ(0+10+2+3+4, sum);
+
+	SGSpan<float64_t> part=span.subspan(2, 3);
+	EXPECT_EQ(3, part.size());
+	EXPECT_EQ(2, part[0]);
+
+	SGVector<float64_t> wrapped=part.as_vector();
+	EXPECT_EQ(-1, wrapped.ref_count());
+	EXPECT_EQ(part.data(), wrapped.vector);
+
+	SGVector<float64_t> copy=part.clone();
+	EXPECT_NE(part.data(), copy.vector);
+	for (index_t i=0; i<part.size(); i++)
+		EXPECT_EQ(part[i], copy[i]);
+
+	EXPECT_TRUE(SGSpan<float64_t>().empty());
+}
+
+TEST(SGMatrixViewTest, view_of_matrix)
+{
+	SGMatrix<float64_t> mat(3, 4);
+	for (index_t i=0; i<mat.num_rows*mat.num_cols; i++)
+		mat.matrix[i]=i;
+
+	SGMatrixView<float64_t> view=mat;
+	EXPECT_EQ(3, view.num_rows());
+	EXPECT_EQ(4, view.num_cols());
+	EXPECT_EQ(1, mat.ref_count());
+
+	for (index_t j=0; j<mat.num_cols; j++)
+	{
+		for (index_t i=0; i<mat.num_rows; i++)
+			EXPECT_EQ(mat(i,j), view(i,j));
+	}
+
+	SGSpan<float64_t> col=view.col(2);
+	EXPECT_EQ(3, col.size());
+	EXPECT_EQ(mat.get_column_vector(2), col.data());
+
+	SGMatrixView<float64_t> block=view.cols(1, 2);
+	EXPECT_EQ(2, block.num_cols());
+	EXPECT_EQ(mat(0,1), block(0,0));
+	EXPECT_EQ(mat(2,2), block(2,1));
+
+	SGMatrix<float64_t> copy=block.clone();
+	EXPECT_NE(block.data(), copy.matrix);
+	EXPECT_EQ(mat(1,2), copy(1,1));
+
+	SGMatrix<float64_t> wrapped=block.as_matrix();
+	EXPECT_EQ(block.data(), wrapped.matrix);
+	EXPECT_EQ(-1, wrapped.ref_count());
+}
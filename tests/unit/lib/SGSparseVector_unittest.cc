@@ -13,6 +13,7 @@
 #include <gtest/gtest.h>
 
 #include <vector>
+#include <utility>
 
 using namespace shogun;
 
@@ -506,3 +507,29 @@ TEST(SGSparseVector, sparse_dot_not_sorted_features_different_length_last_index_
 	EXPECT_EQ(4, SGSparseVector<int32_t>::sparse_dot(v1, v2));
 	EXPECT_EQ(4, SGSparseVector<int32_t>::sparse_dot(v2, v1));
 }
+
+#if defined(HAVE_CXX0X) || defined(HAVE_CXX11)
+TEST(SGSparseVector, move)
+{
+	SGSparseVector<float64_t> a(2);
+	a.features[0].feat_index=1;
+	a.features[0].entry=2;
+	a.features[1].feat_index=4;
+	a.features[1].entry=3;
+	SGSparseVectorEntry<float64_t>* features=a.features;
+
+	SGSparseVector<float64_t> b(std::move(a));
+	EXPECT_EQ(features, b.features);
+	EXPECT_EQ(2, b.num_feat_entries);
+	EXPECT_EQ(1, b.ref_count());
+	EXPECT_EQ(NULL, a.features);
+	EXPECT_EQ(0, a.num_feat_entries);
+
+	SGSparseVector<float64_t> c;
+	c=std::move(b);
+	EXPECT_EQ(features, c.features);
+	EXPECT_EQ(3, c.get_feature(4));
+	EXPECT_EQ(1, c.ref_count());
+	EXPECT_EQ(NULL, b.features);
+}
+#endif
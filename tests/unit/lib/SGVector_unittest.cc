@@ -5,6 +5,8 @@
 
 #include <shogun/mathematics/eigen3.h>
 
+#include <utility>
+
 
 using namespace shogun;
 
@@ -326,3 +328,40 @@ TEST(SGVectorTest, from_eigen3_row_vector)
 	for (int32_t i=0; i<n; i++)
 		EXPECT_EQ(eigen_vec[i], sg_vec[i]);
 }
+
+#if defined(HAVE_CXX0X) || defined(HAVE_CXX11)
+TEST(SGVectorTest, move)
+{
+	SGVector<float64_t> a(10);
+	a.range_fill();
+	float64_t* data=a.vector;
+	EXPECT_EQ(1, a.ref_count());
+
+	/* the reference is taken over, not shared */
+	SGVector<float64_t> b(std::move(a));
+	EXPECT_EQ(data, b.vector);
+	EXPECT_EQ(10, b.vlen);
+	EXPECT_EQ(1, b.ref_count());
+	EXPECT_EQ(NULL, a.vector);
+	EXPECT_EQ(0, a.vlen);
+
+	SGVector<float64_t> c(5);
+	SGVector<float64_t> d=c;
+	EXPECT_EQ(2, c.ref_count());
+
+	/* the old data of d is released, b is left empty */
+	d=std::move(b);
+	EXPECT_EQ(data, d.vector);
+	EXPECT_EQ(1, d.ref_count());
+	EXPECT_EQ(1, c.ref_count());
+	EXPECT_EQ(NULL, b.vector);
+
+	for (index_t i=0; i<d.vlen; i++)
+		EXPECT_EQ(i, d[i]);
+
+	/* copy assignment still shares */
+	b=d;
+	EXPECT_EQ(2, d.ref_count());
+	EXPECT_EQ(data, b.vector);
+}
+#endif
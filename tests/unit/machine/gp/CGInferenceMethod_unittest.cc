@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) The Shogun Machine Learning Toolbox
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of the Shogun Development Team.
+ *
+ */
+#include <shogun/lib/config.h>
+
+#include <shogun/labels/RegressionLabels.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/kernel/GaussianKernel.h>
+#include <shogun/machine/gp/CGInferenceMethod.h>
+#include <shogun/machine/gp/ExactInferenceMethod.h>
+#include <shogun/machine/gp/ZeroMean.h>
+#include <shogun/machine/gp/GaussianLikelihood.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/regression/GaussianProcessRegression.h>
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+/* noisy sine wave on random 2d inputs */
+static void generate_data(index_t n, SGMatrix<float64_t>& X,
+		SGVector<float64_t>& y)
+{
+	X=SGMatrix<float64_t>(2, n);
+	y=SGVector<float64_t>(n);
+
+	for (index_t i=0; i<n; ++i)
+	{
+		X(0,i)=CMath::random(-2.0, 2.0);
+		X(1,i)=CMath::random(-2.0, 2.0);
+		y[i]=CMath::sin(X(0,i))+CMath::cos(X(1,i))+CMath::normal_random(0.0, 0.1);
+	}
+}
+
+TEST(CGInferenceMethod,get_alpha_and_posterior_mean)
+{
+	CMath::init_random(17);
+
+	index_t n=50;
+	SGMatrix<float64_t> X;
+	SGVector<float64_t> y;
+	generate_data(n, X, y);
+
+	CDenseFeatures<float64_t>* features=new CDenseFeatures<float64_t>(X);
+	CRegressionLabels* labels=new CRegressionLabels(y);
+	CGaussianKernel* kernel=new CGaussianKernel(10, 2.0);
+	CZeroMean* mean=new CZeroMean();
+	CGaussianLikelihood* lik=new CGaussianLikelihood(0.1);
+
+	CExactInferenceMethod* exact=new CExactInferenceMethod(kernel, features,
+		mean, labels, lik);
+	exact->set_scale(1.5);
+	SG_REF(exact);
+
+	CCGInferenceMethod* cg=new CCGInferenceMethod(kernel, features, mean,
+		labels, lik);
+	cg->set_scale(1.5);
+	// tiles which do not divide the number of vectors
+	cg->set_tile_size(16);
+	cg->set_preconditioner_rank(5);
+	cg->set_tolerance(1E-12);
+	SG_REF(cg);
+
+	SGVector<float64_t> alpha_exact=exact->get_alpha();
+	SGVector<float64_t> alpha_cg=cg->get_alpha();
+
+	SGVector<float64_t> mu_exact=exact->get_posterior_mean();
+	SGVector<float64_t> mu_cg=cg->get_posterior_mean();
+
+	for (index_t i=0; i<n; ++i)
+	{
+		EXPECT_NEAR(alpha_cg[i], alpha_exact[i], 1E-6);
+		EXPECT_NEAR(mu_cg[i], mu_exact[i], 1E-6);
+	}
+
+	// without preconditioner
+	cg->set_preconditioner_rank(0);
+	alpha_cg=cg->get_alpha();
+
+	for (index_t i=0; i<n; ++i)
+		EXPECT_NEAR(alpha_cg[i], alpha_exact[i], 1E-6);
+
+	SG_UNREF(cg);
+	SG_UNREF(exact);
+}
+
+TEST(CGInferenceMethod,apply_regression)
+{
+	CMath::init_random(17);
+
+	index_t n=40;
+	SGMatrix<float64_t> X;
+	SGVector<float64_t> y;
+	generate_data(n, X, y);
+
+	SGMatrix<float64_t> X_test;
+	SGVector<float64_t> y_test;
+	generate_data(10, X_test, y_test);
+
+	CDenseFeatures<float64_t>* features=new CDenseFeatures<float64_t>(X);
+	CDenseFeatures<float64_t>* features_test=new CDenseFeatures<float64_t>(X_test);
+	SG_REF(features_test);
+	CRegressionLabels* labels=new CRegressionLabels(y);
+	CGaussianKernel* kernel=new CGaussianKernel(10, 2.0);
+	CZeroMean* mean=new CZeroMean();
+	CGaussianLikelihood* lik=new CGaussianLikelihood(0.1);
+
+	CGaussianProcessRegression* gpr_exact=new CGaussianProcessRegression(
+		new CExactInferenceMethod(kernel, features, mean, labels, lik));
+	SG_REF(gpr_exact);
+
+	CCGInferenceMethod* cg=new CCGInferenceMethod(kernel, features, mean,
+		labels, lik);
+	cg->set_tile_size(16);
+	cg->set_tolerance(1E-12);
+	CGaussianProcessRegression* gpr_cg=new CGaussianProcessRegression(cg);
+	SG_REF(gpr_cg);
+
+	gpr_exact->train();
+	gpr_cg->train();
+
+	// predictive means do not need the posterior covariance
+	CRegressionLabels* result_exact=gpr_exact->apply_regression(features_test);
+	CRegressionLabels* result_cg=gpr_cg->apply_regression(features_test);
+
+	for (index_t i=0; i<result_exact->get_num_labels(); ++i)
+		EXPECT_NEAR(result_cg->get_label(i), result_exact->get_label(i), 1E-6);
+
+	SG_UNREF(result_cg);
+	SG_UNREF(result_exact);
+	SG_UNREF(gpr_cg);
+	SG_UNREF(gpr_exact);
+	SG_UNREF(features_test);
+}
+
+TEST(CGInferenceMethod,get_negative_log_marginal_likelihood_derivatives)
+{
+	CMath::init_random(17);
+
+	index_t n=30;
+	SGMatrix<float64_t> X;
+	SGVector<float64_t> y;
+	generate_data(n, X, y);
+
+	CDenseFeatures<float64_t>* features=new CDenseFeatures<float64_t>(X);
+	CRegressionLabels* labels=new CRegressionLabels(y);
+	CGaussianKernel* kernel=new CGaussianKernel(10, 2.0);
+	CZeroMean* mean=new CZeroMean();
+	CGaussianLikelihood* lik=new CGaussianLikelihood(0.5);
+
+	CExactInferenceMethod* exact=new CExactInferenceMethod(kernel, features,
+		mean, labels, lik);
+	SG_REF(exact);
+
+	CCGInferenceMethod* cg=new CCGInferenceMethod(kernel, features, mean,
+		labels, lik);
+	cg->set_tile_size(8);
+	cg->set_num_probes(2000);
+	SG_REF(cg);
+
+	CMap<TParameter*, CSGObject*>* parameter_dictionary=new CMap<TParameter*, CSGObject*>();
+	exact->build_gradient_parameter_dictionary(parameter_dictionary);
+
+	CMap<TParameter*, SGVector<float64_t> >* gradient_exact=
+		exact->get_negative_log_marginal_likelihood_derivatives(parameter_dictionary);
+	SG_UNREF(parameter_dictionary);
+
+	parameter_dictionary=new CMap<TParameter*, CSGObject*>();
+	cg->build_gradient_parameter_dictionary(parameter_dictionary);
+
+	CMap<TParameter*, SGVector<float64_t> >* gradient_cg=
+		cg->get_negative_log_marginal_likelihood_derivatives(parameter_dictionary);
+	SG_UNREF(parameter_dictionary);
+
+	TParameter* width_param=kernel->m_gradient_parameters->get_parameter("log_width");
+	TParameter* sigma_param=lik->m_gradient_parameters->get_parameter("log_sigma");
+	TParameter* scale_exact=exact->m_gradient_parameters->get_parameter("log_scale");
+	TParameter* scale_cg=cg->m_gradient_parameters->get_parameter("log_scale");
+
+	// the traces are estimated with random probe vectors
+	EXPECT_NEAR((gradient_cg->get_element(width_param))[0],
+		(gradient_exact->get_element(width_param))[0], 0.5);
+	EXPECT_NEAR((gradient_cg->get_element(sigma_param))[0],
+		(gradient_exact->get_element(sigma_param))[0], 0.5);
+	EXPECT_NEAR((gradient_cg->get_element(scale_cg))[0],
+		(gradient_exact->get_element(scale_exact))[0], 0.5);
+
+	// the kernel is initialized on all training features again
+	EXPECT_EQ(kernel->get_num_vec_lhs(), n);
+	EXPECT_EQ(kernel->get_num_vec_rhs(), n);
+
+	SG_UNREF(gradient_cg);
+	SG_UNREF(gradient_exact);
+	SG_UNREF(cg);
+	SG_UNREF(exact);
+}
+
+#ifdef HAVE_LAPACK
+TEST(CGInferenceMethod,get_negative_marginal_likelihood)
+{
+	CMath::init_random(17);
+
+	index_t n=30;
+	SGMatrix<float64_t> X;
+	SGVector<float64_t> y;
+	generate_data(n, X, y);
+
+	CDenseFeatures<float64_t>* features=new CDenseFeatures<float64_t>(X);
+	CRegressionLabels* labels=new CRegressionLabels(y);
+	CGaussianKernel* kernel=new CGaussianKernel(10, 2.0);
+	CZeroMean* mean=new CZeroMean();
+	CGaussianLikelihood* lik=new CGaussianLikelihood(1.0);
+
+	CExactInferenceMethod* exact=new CExactInferenceMethod(kernel, features,
+		mean, labels, lik);
+	exact->set_scale(0.5);
+	SG_REF(exact);
+
+	CCGInferenceMethod* cg=new CCGInferenceMethod(kernel, features, mean,
+		labels, lik);
+	cg->set_scale(0.5);
+	cg->set_num_log_det_estimates(200);
+	SG_REF(cg);
+
+	float64_t nlZ_exact=exact->get_negative_log_marginal_likelihood();
+	float64_t nlZ_cg=cg->get_negative_log_marginal_likelihood();
+
+	// the log-determinant is estimated with random trace vectors
+	EXPECT_NEAR(nlZ_cg, nlZ_exact, 0.5);
+
+	SG_UNREF(cg);
+	SG_UNREF(exact);
+}
+#endif /* HAVE_LAPACK */
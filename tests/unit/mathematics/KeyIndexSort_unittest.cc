@@ -0,0 +1,149 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <shogun/mathematics/KeyIndexSort.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/base/Parallel.h>
+#include <shogun/base/init.h>
+#include <shogun/lib/SGVector.h>
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+/* keys with negative numbers, zeros, infinities and many ties */
+template <class T>
+static SGVector<T> generate_keys(index_t size)
+{
+	SGVector<T> keys(size);
+	for (index_t i=0; i<size; i++)
+		keys[i]=(T) CMath::random(-1000, 1000)/8;
+	if (size>2 && (T) 0.5!=0)
+	{
+		keys[0]=-CMath::INFTY;
+		keys[1]=CMath::INFTY;
+	}
+	return keys;
+}
+
+/* sorted keys have to be a stable permutation of keys */
+template <class T>
+static void check_sorted(SGVector<T> keys, SGVector<T> sorted,
+		SGVector<index_t> index, bool descending, index_t k)
+{
+	for (index_t i=0; i<k; i++)
+		EXPECT_EQ(keys[index[i]], sorted[i]);
+
+	for (index_t i=1; i<k; i++)
+	{
+		if (sorted[i-1]==sorted[i])
+			EXPECT_LT(index[i-1], index[i]);
+		else if (descending)
+			EXPECT_GT(sorted[i-1], sorted[i]);
+		else
+			EXPECT_LT(sorted[i-1], sorted[i]);
+	}
+
+	/* the rest is not before the first k */
+	for (index_t i=k; i<sorted.vlen; i++)
+	{
+		EXPECT_EQ(keys[index[i]], sorted[i]);
+		if (descending)
+			EXPECT_LE(sorted[i], sorted[k-1]);
+		else
+			EXPECT_GE(sorted[i], sorted[k-1]);
+	}
+}
+
+template <class T>
+static void check_sort(index_t size)
+{
+	SGVector<T> keys=generate_keys<T>(size);
+
+	for (int32_t descending=0; descending<2; descending++)
+	{
+		SGVector<T> sorted=keys.clone();
+		SGVector<index_t> index(size);
+		index.range_fill();
+		if (descending)
+			CKeyIndexSort::sort_backward(sorted.vector, index.vector, size);
+		else
+			CKeyIndexSort::sort(sorted.vector, index.vector, size);
+		check_sorted(keys, sorted, index, descending, size);
+	}
+}
+
+TEST(KeyIndexSort,sort_float64)
+{
+	CMath::init_random(17);
+	check_sort<float64_t>(0);
+	check_sort<float64_t>(1);
+	check_sort<float64_t>(50);
+	check_sort<float64_t>(1000);
+}
+
+TEST(KeyIndexSort,sort_other_types)
+{
+	CMath::init_random(17);
+	check_sort<float32_t>(1000);
+	check_sort<int32_t>(1000);
+	check_sort<int64_t>(1000);
+}
+
+TEST(KeyIndexSort,sort_parallel)
+{
+	CMath::init_random(17);
+	Parallel* parallel=get_global_parallel();
+	int32_t num_threads=parallel->get_num_threads();
+	parallel->set_num_threads(4);
+
+	check_sort<float64_t>(100000);
+
+	/* the result does not depend on the number of threads */
+	SGVector<float64_t> keys=generate_keys<float64_t>(100000);
+	SGVector<float64_t> sorted=keys.clone();
+	SGVector<index_t> index(keys.vlen);
+	index.range_fill();
+	CKeyIndexSort::sort_backward(sorted.vector, index.vector, keys.vlen);
+
+	parallel->set_num_threads(1);
+	SGVector<float64_t> sorted_serial=keys.clone();
+	SGVector<index_t> index_serial(keys.vlen);
+	index_serial.range_fill();
+	CKeyIndexSort::sort_backward(sorted_serial.vector, index_serial.vector,
+			keys.vlen);
+
+	for (index_t i=0; i<keys.vlen; i++)
+	{
+		EXPECT_EQ(sorted_serial[i], sorted[i]);
+		EXPECT_EQ(index_serial[i], index[i]);
+	}
+
+	parallel->set_num_threads(num_threads);
+	SG_UNREF(parallel);
+}
+
+TEST(KeyIndexSort,sort_smallest_largest)
+{
+	CMath::init_random(17);
+	index_t size=1000;
+	SGVector<float64_t> keys=generate_keys<float64_t>(size);
+
+	index_t ks[]={1, 7, 100, 1000};
+	for (index_t j=0; j<4; j++)
+	{
+		SGVector<float64_t> sorted=keys.clone();
+		SGVector<index_t> index(size);
+		index.range_fill();
+		CKeyIndexSort::sort_smallest(sorted.vector, index.vector, size, ks[j]);
+		check_sorted(keys, sorted, index, false, ks[j]);
+
+		sorted=keys.clone();
+		index.range_fill();
+		CKeyIndexSort::sort_largest(sorted.vector, index.vector, size, ks[j]);
+		check_sorted(keys, sorted, index, true, ks[j]);
+	}
+}
@@ -0,0 +1,159 @@
+#include <shogun/lib/config.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/mathematics/RandomStream.h>
+#include <shogun/mathematics/Math.h>
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+TEST(RandomStream, philox_known_answer)
+{
+	// known answer test of the Random123 reference implementation
+	uint32_t counter[4]={0, 0, 0, 0};
+	uint32_t key[2]={0, 0};
+	uint32_t result[4];
+
+	RandomStream::philox4x32(counter, key, result);
+
+	EXPECT_EQ(0x6627e8d5U, result[0]);
+	EXPECT_EQ(0xe169c58dU, result[1]);
+	EXPECT_EQ(0xbc57ac4cU, result[2]);
+	EXPECT_EQ(0x9b00dbd8U, result[3]);
+}
+
+TEST(RandomStream, fill_array_matches_scalar)
+{
+	const index_t size=103;
+
+	RandomStream rng(12345, 7);
+	SGVector<uint32_t> bulk(size);
+	rng.fill_array(bulk.vector, size);
+
+	RandomStream rng2(12345, 7);
+	for (index_t i=0; i<size; ++i)
+		EXPECT_EQ(rng2.random_32(), bulk[i]);
+}
+
+TEST(RandomStream, set_counter)
+{
+	RandomStream rng(42, 3);
+	for (index_t i=0; i<40; ++i)
+		rng.random_32();
+
+	uint32_t expected=rng.random_32();
+
+	// word 40 is the first word of block 10
+	RandomStream rng2(42, 3);
+	rng2.set_counter(10);
+	EXPECT_EQ(expected, rng2.random_32());
+}
+
+TEST(RandomStream, streams_differ)
+{
+	RandomStream rng1(42, 0);
+	RandomStream rng2(42, 1);
+	RandomStream rng3(43, 0);
+
+	uint64_t r1=rng1.random_64();
+	EXPECT_NE(r1, rng2.random_64());
+	EXPECT_NE(r1, rng3.random_64());
+}
+
+TEST(RandomStream, reproducible_across_threads)
+{
+	const index_t num_tasks=64;
+	const index_t size=100;
+
+	SGVector<float64_t> serial(num_tasks*size);
+	for (index_t t=0; t<num_tasks; ++t)
+	{
+		RandomStream rng(17, t);
+		rng.fill_normal(serial.vector+t*size, size);
+	}
+
+	SGVector<float64_t> parallel(num_tasks*size);
+#pragma omp parallel for schedule(dynamic)
+	for (index_t t=0; t<num_tasks; ++t)
+	{
+		RandomStream rng(17, t);
+		rng.fill_normal(parallel.vector+t*size, size);
+	}
+
+	for (index_t i=0; i<serial.vlen; ++i)
+		EXPECT_EQ(serial[i], parallel[i]);
+}
+
+TEST(RandomStream, fill_uniform)
+{
+	const index_t size=100001;
+	SGVector<float64_t> v(size);
+
+	RandomStream rng(1, 0);
+	rng.fill_uniform(v.vector, size, -2.0, 3.0);
+
+	float64_t mean=0;
+	for (index_t i=0; i<size; ++i)
+	{
+		EXPECT_GE(v[i], -2.0);
+		EXPECT_LT(v[i], 3.0);
+		mean+=v[i];
+	}
+	mean/=size;
+
+	EXPECT_NEAR(0.5, mean, 0.02);
+}
+
+TEST(RandomStream, fill_normal)
+{
+	const index_t size=100001;
+	SGVector<float64_t> v(size);
+
+	RandomStream rng(1, 0);
+	rng.fill_normal(v.vector, size, 1.0, 2.0);
+
+	float64_t mean=0;
+	for (index_t i=0; i<size; ++i)
+		mean+=v[i];
+	mean/=size;
+
+	float64_t var=0;
+	for (index_t i=0; i<size; ++i)
+		var+=CMath::sq(v[i]-mean);
+	var/=size-1;
+
+	EXPECT_NEAR(1.0, mean, 0.02);
+	EXPECT_NEAR(4.0, var, 0.1);
+}
+
+TEST(RandomStream, random_integer)
+{
+	RandomStream rng(5, 0);
+	SGVector<index_t> counts(5);
+	counts.zero();
+
+	for (index_t i=0; i<50000; ++i)
+	{
+		index_t r=rng.random(3, 7);
+		ASSERT_GE(r, 3);
+		ASSERT_LE(r, 7);
+		counts[r-3]++;
+	}
+
+	for (index_t i=0; i<counts.vlen; ++i)
+		EXPECT_NEAR(10000, counts[i], 500);
+}
+
+TEST(RandomStream, permute)
+{
+	SGVector<index_t> v(50);
+	v.range_fill();
+
+	RandomStream rng(9, 0);
+	rng.permute(v.vector, v.vlen);
+
+	SGVector<index_t> sorted=v.clone();
+	CMath::qsort(sorted.vector, sorted.vlen);
+
+	for (index_t i=0; i<v.vlen; ++i)
+		EXPECT_EQ(i, sorted[i]);
+}
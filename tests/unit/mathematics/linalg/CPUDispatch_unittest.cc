@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2016, Shogun Toolbox Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <shogun/lib/config.h>
+
+#if defined(HAVE_CXX0X) || defined(HAVE_CXX11)
+
+#include <shogun/mathematics/linalg/linalg.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/lib/SGMatrix.h>
+#include <gtest/gtest.h>
+
+using namespace shogun;
+using namespace linalg;
+
+/** Runs the checks once for every instruction set supported by the host */
+template <class Checks>
+void for_each_instruction_set(Checks checks)
+{
+	CPUInstructionSet original=get_cpu_instruction_set();
+	CPUInstructionSet isa=CPUInstructionSet::SCALAR;
+	while (isa<=get_max_cpu_instruction_set())
+	{
+		EXPECT_EQ(set_cpu_instruction_set(isa), isa);
+		SCOPED_TRACE(get_cpu_instruction_set_name());
+		checks();
+		isa=static_cast<CPUInstructionSet>(static_cast<int>(isa)+1);
+		if (isa>CPUInstructionSet::AVX512)
+			break;
+	}
+	set_cpu_instruction_set(original);
+}
+
+/** sizes which exercise the unrolled loops as well as the remainders */
+const index_t sizes[]={1, 3, 8, 17, 64, 1031};
+
+TEST(CPUDispatch, selection)
+{
+	CPUInstructionSet original=get_cpu_instruction_set();
+	EXPECT_LE(original, get_max_cpu_instruction_set());
+	EXPECT_TRUE(get_cpu_instruction_set_name()!=NULL);
+
+	EXPECT_EQ(set_cpu_instruction_set(CPUInstructionSet::AVX512),
+		get_max_cpu_instruction_set());
+	EXPECT_EQ(set_cpu_instruction_set(CPUInstructionSet::SCALAR),
+		CPUInstructionSet::SCALAR);
+	EXPECT_STREQ(get_cpu_instruction_set_name(), "scalar");
+
+	set_cpu_instruction_set(original);
+}
+
+TEST(CPUDispatch, dot_float64)
+{
+	for_each_instruction_set([]()
+	{
+		for (auto size : sizes)
+		{
+			SGVector<float64_t> a(size), b(size);
+			float64_t expected=0;
+			for (index_t i=0; i<size; ++i)
+			{
+				a[i]=CMath::sin(i);
+				b[i]=0.5*i;
+				expected+=a[i]*b[i];
+			}
+			EXPECT_NEAR(dot<Backend::CPU>(a, b), expected, 1E-10);
+		}
+	});
+}
+
+TEST(CPUDispatch, dot_float32)
+{
+	for_each_instruction_set([]()
+	{
+		for (auto size : sizes)
+		{
+			SGVector<float32_t> a(size), b(size);
+			float64_t expected=0;
+			for (index_t i=0; i<size; ++i)
+			{
+				a[i]=CMath::sin(i);
+				b[i]=0.25*(i%7);
+				expected+=a[i]*b[i];
+			}
+			EXPECT_NEAR(dot<Backend::CPU>(a, b), expected, 1E-3);
+		}
+	});
+}
+
+TEST(CPUDispatch, dot_int32)
+{
+	SGVector<int32_t> a(5), b(5);
+	a.range_fill(1);
+	b.set_const(2);
+
+	EXPECT_EQ(dot<Backend::CPU>(a, b), 30);
+}
+
+TEST(CPUDispatch, add_vector)
+{
+	for_each_instruction_set([]()
+	{
+		for (auto size : sizes)
+		{
+			SGVector<float64_t> a(size), b(size);
+			a.range_fill(0);
+			b.set_const(3.0);
+
+			SGVector<float64_t> c=add<Backend::CPU>(a, b, 0.5, 2.0);
+			for (index_t i=0; i<size; ++i)
+				EXPECT_NEAR(c[i], 0.5*i+6.0, 1E-15);
+		}
+	});
+}
+
+TEST(CPUDispatch, add_matrix_in_place)
+{
+	for_each_instruction_set([]()
+	{
+		SGMatrix<float32_t> A(7, 5), B(7, 5);
+		for (index_t i=0; i<A.num_rows*A.num_cols; ++i)
+		{
+			A[i]=i;
+			B[i]=2*i;
+		}
+
+		add<Backend::CPU>(A, B, A, 2.0f, -1.0f);
+		for (index_t i=0; i<A.num_rows*A.num_cols; ++i)
+			EXPECT_NEAR(A[i], 0.0, 1E-6);
+	});
+}
+
+TEST(CPUDispatch, scale)
+{
+	for_each_instruction_set([]()
+	{
+		for (auto size : sizes)
+		{
+			SGVector<float64_t> a(size), b(size);
+			a.range_fill(1);
+
+			scale<Backend::CPU>(a, b, -0.5);
+			for (index_t i=0; i<size; ++i)
+				EXPECT_NEAR(b[i], -0.5*(i+1), 1E-15);
+		}
+	});
+}
+
+TEST(CPUDispatch, elementwise_product)
+{
+	for_each_instruction_set([]()
+	{
+		SGMatrix<float64_t> A(13, 11), B(13, 11);
+		for (index_t i=0; i<A.num_rows*A.num_cols; ++i)
+		{
+			A[i]=i;
+			B[i]=0.5*i;
+		}
+
+		SGMatrix<float64_t> C=elementwise_product<Backend::CPU>(A, B);
+		for (index_t i=0; i<C.num_rows*C.num_cols; ++i)
+			EXPECT_NEAR(C[i], 0.5*i*i, 1E-15);
+	});
+}
+
+TEST(CPUDispatch, sum)
+{
+	for_each_instruction_set([]()
+	{
+		SGMatrix<float64_t> m(23, 19);
+		float64_t expected=0, diag=0;
+		for (index_t j=0; j<m.num_cols; ++j)
+		{
+			for (index_t i=0; i<m.num_rows; ++i)
+			{
+				m(i,j)=CMath::cos(i+j);
+				expected+=m(i,j);
+			}
+			diag+=m(j,j);
+		}
+
+		EXPECT_NEAR(sum<Backend::CPU>(m), expected, 1E-12);
+		EXPECT_NEAR(sum<Backend::CPU>(m, true), expected-diag, 1E-12);
+	});
+}
+
+TEST(CPUDispatch, vector_sum)
+{
+	for_each_instruction_set([]()
+	{
+		for (auto size : sizes)
+		{
+			SGVector<float32_t> a(size);
+			a.range_fill(0);
+
+			EXPECT_NEAR(vector_sum<Backend::CPU>(a), 0.5*size*(size-1), 1E-6*size*size);
+		}
+	});
+}
+
+TEST(CPUDispatch, sum_block)
+{
+	for_each_instruction_set([]()
+	{
+		SGMatrix<float64_t> m(9, 9);
+		for (index_t i=0; i<m.num_rows*m.num_cols; ++i)
+			m[i]=i;
+
+		float64_t expected=0;
+		for (index_t j=2; j<6; ++j)
+			for (index_t i=1; i<8; ++i)
+				expected+=m(i,j);
+
+		EXPECT_NEAR(sum<Backend::CPU>(block(m, 1, 2, 7, 4)), expected, 1E-12);
+	});
+}
+
+TEST(CPUDispatch, max)
+{
+	for_each_instruction_set([]()
+	{
+		for (auto size : sizes)
+		{
+			SGVector<float32_t> a(size);
+			float32_t expected=-CMath::INFTY;
+			for (index_t i=0; i<size; ++i)
+			{
+				a[i]=-CMath::abs(i-size/3.0f);
+				expected=CMath::max(expected, a[i]);
+			}
+
+			EXPECT_NEAR(max<Backend::CPU>(a), expected, 1E-6);
+		}
+	});
+}
+
+TEST(CPUDispatch, fallback)
+{
+	const index_t n=5;
+	SGMatrix<float64_t> A(n, n);
+	SGMatrix<float64_t> B(n, n);
+	for (index_t i=0; i<n*n; ++i)
+	{
+		A[i]=CMath::sin(i);
+		B[i]=0.1*i;
+	}
+
+	SGMatrix<float64_t> C=matrix_product<Backend::CPU>(A, B);
+	SGMatrix<float64_t> C_eigen=matrix_product<Backend::EIGEN3>(A, B);
+	for (index_t i=0; i<n*n; ++i)
+		EXPECT_NEAR(C[i], C_eigen[i], 1E-12);
+
+	SGMatrix<float64_t> S=elementwise_square<Backend::CPU>(A);
+	SGVector<float64_t> cs=colwise_sum<Backend::CPU>(A);
+	for (index_t j=0; j<n; ++j)
+	{
+		float64_t expected=0;
+		for (index_t i=0; i<n; ++i)
+		{
+			EXPECT_NEAR(S(i,j), A(i,j)*A(i,j), 1E-12);
+			expected+=A(i,j);
+		}
+		EXPECT_NEAR(cs[j], expected, 1E-12);
+	}
+
+	SGMatrix<float64_t> L(n, n);
+	special_purpose::logistic<Backend::CPU>(A, L);
+	SGMatrix<float64_t> sines=elementwise_sin<Backend::CPU>(A);
+	for (index_t i=0; i<n*n; ++i)
+	{
+		EXPECT_NEAR(L[i], 1.0/(1.0+CMath::exp(-A[i])), 1E-12);
+		EXPECT_NEAR(sines[i], CMath::sin(A[i]), 1E-12);
+	}
+}
+
+#endif // defined(HAVE_CXX0X) || defined(HAVE_CXX11)
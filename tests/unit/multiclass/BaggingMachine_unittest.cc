@@ -4,6 +4,7 @@
 #include <shogun/features/DenseFeatures.h>
 #include <shogun/lib/SGMatrix.h>
 #include <shogun/multiclass/tree/CARTree.h>
+#include <shogun/multiclass/tree/RandomCARTree.h>
 #include <shogun/lib/config.h>
 #include <shogun/machine/BaggingMachine.h>
 #include <shogun/evaluation/MulticlassAccuracy.h>
@@ -229,14 +230,60 @@ TEST(BaggingMachine,classify_CART)
 	EXPECT_EQ(0.0,res_vector[1]);
 	EXPECT_EQ(0.0,res_vector[2]);
 	EXPECT_EQ(1.0,res_vector[3]);
-	EXPECT_EQ(1.0,res_vector[4]);
+	EXPECT_EQ(0.0,res_vector[4]);
 
 	CMulticlassAccuracy* eval=new CMulticlassAccuracy();
-	EXPECT_NEAR(0.642857,c->get_oob_error(eval),1e-6);
+	EXPECT_NEAR(0.615385,c->get_oob_error(eval),1e-6);
 
 	SG_UNREF(test_feats);
 	SG_UNREF(result);
 	SG_UNREF(c);
 	SG_UNREF(eval);
 }
+
+TEST(BaggingMachine,random_cart_multithreaded)
+{
+	int32_t num_vectors=60;
+	SGMatrix<float64_t> data(5,num_vectors);
+	SGVector<float64_t> lab(num_vectors);
+	sg_rand->set_seed(7);
+	for (index_t j=0; j<num_vectors; j++)
+	{
+		for (index_t i=0; i<data.num_rows; i++)
+			data(i,j)=CMath::random(-1.0,1.0);
+		lab[j]=data(0,j)+data(1,j)>0 ? 1.0 : 0.0;
+	}
+
+	CDenseFeatures<float64_t>* feats=new CDenseFeatures<float64_t>(data);
+	CMulticlassLabels* labels=new CMulticlassLabels(lab);
+	SG_REF(feats);
+	SG_REF(labels);
+
+	SGVector<float64_t> outputs[2];
+	for (index_t k=0; k<2; k++)
+	{
+		CRandomCARTree* cart=new CRandomCARTree();
+		cart->set_feature_subset_size(2);
+		CBaggingMachine* c=new CBaggingMachine(feats,labels);
+		c->parallel->set_num_threads(4);
+		c->set_machine(cart);
+		c->set_bag_size(num_vectors);
+		c->set_num_bags(16);
+		c->set_combination_rule(new CMajorityVote());
+
+		sg_rand->set_seed(1);
+		c->train(feats);
+
+		CMulticlassLabels* result=c->apply_multiclass(feats);
+		outputs[k]=result->get_labels();
+		SG_UNREF(result);
+		SG_UNREF(c);
+	}
+
+	for (index_t i=0; i<num_vectors; i++)
+		EXPECT_EQ(outputs[0][i],outputs[1][i]);
+
+	SG_UNREF(feats);
+	SG_UNREF(labels);
+}
 #endif
@@ -0,0 +1,90 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <shogun/multiclass/ShareBoost.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/features/DenseSubsetFeatures.h>
+#include <shogun/labels/MulticlassLabels.h>
+#include <shogun/base/Parallel.h>
+#include <shogun/base/init.h>
+#include <shogun/mathematics/Math.h>
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+/* three gaussian classes, separated along the first three of ten features */
+static void generate_data(CDenseFeatures<float64_t>* &features,
+		CMulticlassLabels* &labels)
+{
+	index_t num_vectors=300;
+	index_t dim=10;
+	CMath::init_random(17);
+	SGMatrix<float64_t> data(dim, num_vectors);
+	SGVector<float64_t> lab(num_vectors);
+	for (index_t i=0; i<num_vectors; i++)
+	{
+		lab[i]=i%3;
+		for (index_t j=0; j<dim; j++)
+			data(j,i)=0.3*CMath::randn_double();
+		data(i%3,i)+=2;
+	}
+
+	features=new CDenseFeatures<float64_t>(data);
+	labels=new CMulticlassLabels(lab);
+	SG_REF(features);
+	SG_REF(labels);
+}
+
+static SGVector<float64_t> train_and_apply(CDenseFeatures<float64_t>* features,
+		CMulticlassLabels* labels)
+{
+	CShareBoost* machine=new CShareBoost(features, labels, 3);
+	SG_REF(machine);
+	machine->train();
+
+	SGVector<int32_t> activeset=machine->get_activeset();
+	EXPECT_EQ(3, activeset.vlen);
+
+	/* the machine is applied to the selected features */
+	CDenseSubsetFeatures<float64_t>* subset_features=
+		new CDenseSubsetFeatures<float64_t>(features, activeset);
+	CMulticlassLabels* outputs=machine->apply_multiclass(subset_features);
+	SGVector<float64_t> result=outputs->get_labels().clone();
+	SG_UNREF(outputs);
+	SG_UNREF(machine);
+	return result;
+}
+
+TEST(ShareBoost,train)
+{
+	CDenseFeatures<float64_t>* features=NULL;
+	CMulticlassLabels* labels=NULL;
+	generate_data(features, labels);
+
+	Parallel* parallel=get_global_parallel();
+	int32_t num_threads=parallel->get_num_threads();
+
+	parallel->set_num_threads(1);
+	SGVector<float64_t> outputs_serial=train_and_apply(features, labels);
+	parallel->set_num_threads(4);
+	SGVector<float64_t> outputs=train_and_apply(features, labels);
+	parallel->set_num_threads(num_threads);
+	SG_UNREF(parallel);
+
+	/* the objective is summed up in the same order for any number of
+	 * threads */
+	index_t num_correct=0;
+	for (index_t i=0; i<outputs.vlen; i++)
+	{
+		EXPECT_EQ(outputs_serial[i], outputs[i]);
+		num_correct+=outputs[i]==labels->get_label(i);
+	}
+	EXPECT_GT(num_correct, 0.9*outputs.vlen);
+
+	SG_UNREF(features);
+	SG_UNREF(labels);
+}
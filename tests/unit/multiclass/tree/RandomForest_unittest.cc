@@ -202,7 +202,7 @@ TEST(RandomForest,classify_nominal_test)
 	EXPECT_EQ(1.0,res_vector[4]);
 
 	CMulticlassAccuracy* eval=new CMulticlassAccuracy();
-	EXPECT_NEAR(0.642857,c->get_oob_error(eval),1e-6);
+	EXPECT_NEAR(0.571429,c->get_oob_error(eval),1e-6);
 
 	SG_UNREF(test_feats);
 	SG_UNREF(result);
@@ -272,7 +272,7 @@ TEST(RandomForest,classify_non_nominal_test)
 	EXPECT_EQ(1.0,res_vector[4]);
 
 	CMulticlassAccuracy* eval=new CMulticlassAccuracy();
-	EXPECT_NEAR(0.571428,c->get_oob_error(eval),1e-6);
+	EXPECT_NEAR(0.642857,c->get_oob_error(eval),1e-6);
 
 	SG_UNREF(test_feats);
 	SG_UNREF(result);
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2016, Shogun Toolbox Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <shogun/neuralnets/NeuralConvolutionalLayer.h>
+#include <shogun/neuralnets/NeuralInputLayer.h>
+#include <shogun/neuralnets/NeuralLinearLayer.h>
+#include <shogun/neuralnets/NeuralNetwork.h>
+#include <shogun/lib/DynamicObjectArray.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/mathematics/Math.h>
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+/** Runs forward and backward propagation through two input layers feeding a
+ * convolutional layer with 3 maps, followed by a convolutional layer with 2
+ * maps and pooling. Returns the activations of the last layer, the parameter
+ * gradients of both convolutional layers and the activation gradients of the
+ * first one.
+ */
+static void convolutional_forward_backward(bool use_im2col,
+	EConvMapActivationFunction function, int32_t stride_x, int32_t stride_y,
+	SGMatrix<float64_t>& activations, SGVector<float64_t>& gradients,
+	SGMatrix<float64_t>& input_gradients)
+{
+	const int32_t w = 12;
+	const int32_t h = 8;
+	const int32_t b = 5;
+
+	CMath::init_random(10);
+
+	SGMatrix<float64_t> x1(w*h,b);
+	SGMatrix<float64_t> x2(w*h,b);
+	for (int32_t i=0; i<x1.num_rows*x1.num_cols; i++)
+	{
+		x1[i] = CMath::random(-1.0,1.0);
+		x2[i] = CMath::random(-1.0,1.0);
+	}
+
+	CDynamicObjectArray* layers = new CDynamicObjectArray();
+	layers->append_element(new CNeuralInputLayer(w,h));
+	layers->append_element(new CNeuralInputLayer(w,h));
+
+	CNeuralConvolutionalLayer* conv1 = new CNeuralConvolutionalLayer(
+		function, 3, 2, 1, 1, 1, stride_x, stride_y);
+	CNeuralConvolutionalLayer* conv2 = new CNeuralConvolutionalLayer(
+		function, 2, 1, 1, 2, 2);
+	conv1->set_use_im2col(use_im2col);
+	conv2->set_use_im2col(use_im2col);
+	layers->append_element(conv1);
+	layers->append_element(conv2);
+
+	SGVector<int32_t> input_indices1(2);
+	input_indices1[0] = 0;
+	input_indices1[1] = 1;
+	SGVector<int32_t> input_indices2(1);
+	input_indices2[0] = 2;
+
+	conv1->initialize_neural_layer(layers, input_indices1);
+	conv2->initialize_neural_layer(layers, input_indices2);
+
+	for (int32_t i=0; i<4; i++)
+	{
+		CNeuralLayer* layer = (CNeuralLayer*)layers->element(i);
+		layer->set_batch_size(b);
+		SG_UNREF(layer);
+	}
+
+	SGVector<float64_t> params1(conv1->get_num_parameters());
+	SGVector<float64_t> params2(conv2->get_num_parameters());
+	SGVector<bool> regularizable1(params1.vlen);
+	SGVector<bool> regularizable2(params2.vlen);
+	conv1->initialize_parameters(params1, regularizable1, 0.3);
+	conv2->initialize_parameters(params2, regularizable2, 0.3);
+
+	CNeuralInputLayer* input1 = (CNeuralInputLayer*)layers->element(0);
+	CNeuralInputLayer* input2 = (CNeuralInputLayer*)layers->element(1);
+	input1->compute_activations(x1);
+	input2->compute_activations(x2);
+	SG_UNREF(input1);
+	SG_UNREF(input2);
+
+	conv1->compute_activations(params1, layers);
+	conv2->compute_activations(params2, layers);
+
+	activations = SGMatrix<float64_t>(conv2->get_num_neurons(), b);
+	for (int32_t i=0; i<activations.num_rows*activations.num_cols; i++)
+		activations[i] = conv2->get_activations()[i];
+
+	SGMatrix<float64_t> targets(conv2->get_num_neurons(), b);
+	for (int32_t i=0; i<targets.num_rows*targets.num_cols; i++)
+		targets[i] = CMath::random(0.0,1.0);
+
+	gradients = SGVector<float64_t>(params1.vlen+params2.vlen);
+	SGVector<float64_t> gradients1(gradients.vector, params1.vlen, false);
+	SGVector<float64_t> gradients2(gradients.vector+params1.vlen,
+		params2.vlen, false);
+
+	conv1->get_activation_gradients().zero();
+	conv2->compute_gradients(params2, targets, layers, gradients2);
+
+	input_gradients = SGMatrix<float64_t>(conv1->get_num_neurons(), b);
+	for (int32_t i=0; i<input_gradients.num_rows*input_gradients.num_cols; i++)
+		input_gradients[i] = conv1->get_activation_gradients()[i];
+
+	conv1->compute_gradients(params1, SGMatrix<float64_t>(), layers, gradients1);
+
+	SG_UNREF(layers);
+}
+
+static void compare_with_reference(EConvMapActivationFunction function,
+	int32_t stride_x, int32_t stride_y)
+{
+	SGMatrix<float64_t> A, A_ref, IG, IG_ref;
+	SGVector<float64_t> PG, PG_ref;
+
+	convolutional_forward_backward(true, function, stride_x, stride_y,
+		A, PG, IG);
+	convolutional_forward_backward(false, function, stride_x, stride_y,
+		A_ref, PG_ref, IG_ref);
+
+	ASSERT_EQ(A_ref.num_rows*A_ref.num_cols, A.num_rows*A.num_cols);
+	for (int32_t i=0; i<A.num_rows*A.num_cols; i++)
+		EXPECT_NEAR(A_ref[i], A[i], 1e-12);
+
+	ASSERT_EQ(IG_ref.num_rows*IG_ref.num_cols, IG.num_rows*IG.num_cols);
+	for (int32_t i=0; i<IG.num_rows*IG.num_cols; i++)
+		EXPECT_NEAR(IG_ref[i], IG[i], 1e-12);
+
+	ASSERT_EQ(PG_ref.vlen, PG.vlen);
+	for (int32_t i=0; i<PG.vlen; i++)
+		EXPECT_NEAR(PG_ref[i], PG[i], 1e-10);
+}
+
+TEST(NeuralConvolutionalLayer, im2col_identity)
+{
+	compare_with_reference(CMAF_IDENTITY, 1, 1);
+}
+
+TEST(NeuralConvolutionalLayer, im2col_logistic)
+{
+	compare_with_reference(CMAF_LOGISTIC, 1, 1);
+}
+
+TEST(NeuralConvolutionalLayer, im2col_rectified_linear)
+{
+	compare_with_reference(CMAF_RECTIFIED_LINEAR, 1, 1);
+}
+
+TEST(NeuralConvolutionalLayer, im2col_with_stride)
+{
+	compare_with_reference(CMAF_RECTIFIED_LINEAR, 3, 2);
+}
+
+/** Tests the input gradients of a strided convolution, which the direct
+ * convolution does not support, against numerical approximation
+ */
+TEST(NeuralConvolutionalLayer, im2col_backpropagation_with_stride)
+{
+	float64_t tolerance = 1e-9;
+
+	CMath::init_random(10);
+
+	CDynamicObjectArray* layers = new CDynamicObjectArray();
+	layers->append_element(new CNeuralInputLayer(8,6));
+	layers->append_element(new CNeuralConvolutionalLayer(
+		CMAF_LOGISTIC, 2, 1, 1, 1, 1, 1, 1));
+	layers->append_element(new CNeuralConvolutionalLayer(
+		CMAF_LOGISTIC, 2, 2, 1, 1, 1, 2, 3));
+	layers->append_element(new CNeuralLinearLayer(3));
+	CNeuralNetwork* network = new CNeuralNetwork(layers);
+
+	network->quick_connect();
+	network->initialize_neural_network();
+	EXPECT_NEAR(network->check_gradients(), 0.0, tolerance);
+	SG_UNREF(network);
+}
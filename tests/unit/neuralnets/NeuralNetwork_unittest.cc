@@ -465,3 +465,139 @@ TEST(NeuralNetwork, gradient_descent)
 	SG_UNREF(features);
 	SG_UNREF(predictions);
 }
+
+/** Tests that splitting the mini-batches between threads gives the same
+ * parameters as single-threaded gradient descent
+ */
+TEST(NeuralNetwork, gradient_descent_multithreaded)
+{
+	CMath::init_random(100);
+
+	int32_t num_features = 3;
+	int32_t num_vectors = 40;
+
+	SGMatrix<float64_t> inputs_matrix(num_features, num_vectors);
+	SGVector<float64_t> targets_vector(num_vectors);
+	for (int32_t j=0; j<num_vectors; j++)
+	{
+		float64_t sum = 0;
+		for (int32_t i=0; i<num_features; i++)
+		{
+			inputs_matrix(i,j) = CMath::random(-1.0, 1.0);
+			sum += inputs_matrix(i,j);
+		}
+		targets_vector[j] = sum > 0 ? 1.0 : -1.0;
+	}
+
+	CDenseFeatures<float64_t>* features =
+		new CDenseFeatures<float64_t>(inputs_matrix);
+	CBinaryLabels* labels = new CBinaryLabels(targets_vector);
+
+	CDynamicObjectArray* layers = new CDynamicObjectArray();
+	layers->append_element(new CNeuralInputLayer(num_features));
+	layers->append_element(new CNeuralLogisticLayer(4));
+	layers->append_element(new CNeuralLogisticLayer(1));
+
+	CNeuralNetwork* network = new CNeuralNetwork(layers);
+	network->quick_connect();
+	network->initialize_neural_network(0.1);
+
+	network->set_optimization_method(NNOM_GRADIENT_DESCENT);
+	network->set_gd_mini_batch_size(7);
+	network->set_gd_learning_rate(0.5);
+	network->set_l2_coefficient(0.01);
+	network->set_epsilon(0.0);
+	network->set_max_num_epochs(20);
+	network->set_labels(labels);
+
+	CNeuralNetwork* network_parallel = (CNeuralNetwork*)network->clone();
+
+	int32_t num_threads = network->parallel->get_num_threads();
+
+	network->parallel->set_num_threads(1);
+	network->train(features);
+
+	network_parallel->parallel->set_num_threads(3);
+	network_parallel->train(features);
+
+	network->parallel->set_num_threads(num_threads);
+
+	SGVector<float64_t> params = network->get_parameters();
+	SGVector<float64_t> params_parallel = network_parallel->get_parameters();
+	ASSERT_EQ(params.vlen, params_parallel.vlen);
+	for (int32_t i=0; i<params.vlen; i++)
+		EXPECT_NEAR(params[i], params_parallel[i], 1e-10);
+
+	SG_UNREF(network);
+	SG_UNREF(network_parallel);
+	SG_UNREF(features);
+}
+
+TEST(NeuralNetwork, gradient_descent_dropout_multithreaded)
+{
+	CMath::init_random(100);
+
+	int32_t num_features = 3;
+	int32_t num_vectors = 40;
+
+	SGMatrix<float64_t> inputs_matrix(num_features, num_vectors);
+	SGVector<float64_t> targets_vector(num_vectors);
+	for (int32_t j=0; j<num_vectors; j++)
+	{
+		float64_t sum = 0;
+		for (int32_t i=0; i<num_features; i++)
+		{
+			inputs_matrix(i,j) = CMath::random(-1.0, 1.0);
+			sum += inputs_matrix(i,j);
+		}
+		targets_vector[j] = sum > 0 ? 1.0 : -1.0;
+	}
+
+	CDenseFeatures<float64_t>* features =
+		new CDenseFeatures<float64_t>(inputs_matrix);
+	CBinaryLabels* labels = new CBinaryLabels(targets_vector);
+
+	CDynamicObjectArray* layers = new CDynamicObjectArray();
+	layers->append_element(new CNeuralInputLayer(num_features));
+	layers->append_element(new CNeuralLogisticLayer(4));
+	layers->append_element(new CNeuralLogisticLayer(1));
+
+	CNeuralNetwork* network = new CNeuralNetwork(layers);
+	network->quick_connect();
+	network->initialize_neural_network(0.1);
+
+	network->set_optimization_method(NNOM_GRADIENT_DESCENT);
+	network->set_gd_mini_batch_size(7);
+	network->set_gd_learning_rate(0.5);
+	network->set_l2_coefficient(0.01);
+	network->set_epsilon(0.0);
+	network->set_max_num_epochs(20);
+	network->set_dropout_hidden(0.5);
+	network->set_dropout_input(0.2);
+	network->set_labels(labels);
+
+	CNeuralNetwork* network_parallel = (CNeuralNetwork*)network->clone();
+
+	int32_t num_threads = network->parallel->get_num_threads();
+
+	/* the dropout masks do not depend on the number of threads */
+	CMath::init_random(100);
+	network->parallel->set_num_threads(1);
+	network->train(features);
+
+	CMath::init_random(100);
+	network_parallel->parallel->set_num_threads(3);
+	network_parallel->train(features);
+
+	network->parallel->set_num_threads(num_threads);
+
+	SGVector<float64_t> params = network->get_parameters();
+	SGVector<float64_t> params_parallel = network_parallel->get_parameters();
+	ASSERT_EQ(params.vlen, params_parallel.vlen);
+	for (int32_t i=0; i<params.vlen; i++)
+		EXPECT_NEAR(params[i], params_parallel[i], 1e-10);
+
+	SG_UNREF(network);
+	SG_UNREF(network_parallel);
+	SG_UNREF(features);
+}
@@ -182,3 +182,51 @@ TEST(RBM, pseudo_likelihood_binary)
 	// generated using scikit-learn
 	EXPECT_NEAR(-3.3698, pl, 0.02);
 }
+
+TEST(RBM, contrastive_divergence_multithreaded)
+{
+	int32_t num_visible = 5;
+	int32_t num_hidden = 6;
+	int32_t num_vectors = 40;
+
+	CMath::init_random(100);
+	SGMatrix<float64_t> inputs(num_visible, num_vectors);
+	for (int32_t i=0; i<inputs.num_rows*inputs.num_cols; i++)
+		inputs[i] = CMath::random(0.0,1.0) < 0.3;
+
+	CDenseFeatures<float64_t>* features = new CDenseFeatures<float64_t>(inputs);
+	SG_REF(features);
+
+	CRBM rbm(num_hidden, num_visible, RBMVUT_BINARY);
+	CRBM rbm_parallel(num_hidden, num_visible, RBMVUT_BINARY);
+	CRBM* rbms[] = {&rbm, &rbm_parallel};
+	for (int32_t k=0; k<2; k++)
+	{
+		CMath::init_random(10);
+		rbms[k]->initialize_neural_network();
+		rbms[k]->cd_num_steps = 3;
+		rbms[k]->cd_sample_visible = true;
+		rbms[k]->gd_mini_batch_size = 7;
+		rbms[k]->max_num_epochs = 5;
+	}
+
+	int32_t num_threads = rbm.parallel->get_num_threads();
+
+	CMath::init_random(20);
+	rbm.parallel->set_num_threads(1);
+	rbm.train(features);
+
+	CMath::init_random(20);
+	rbm_parallel.parallel->set_num_threads(3);
+	rbm_parallel.train(features);
+
+	rbm.parallel->set_num_threads(num_threads);
+
+	SGVector<float64_t> params = rbm.get_parameters();
+	SGVector<float64_t> params_parallel = rbm_parallel.get_parameters();
+	ASSERT_EQ(params.vlen, params_parallel.vlen);
+	for (int32_t i=0; i<params.vlen; i++)
+		EXPECT_NEAR(params[i], params_parallel[i], 1e-10);
+
+	SG_UNREF(features);
+}
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) The Shogun Machine Learning Toolbox
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of the Shogun Development Team.
+ *
+ */
+#include <gtest/gtest.h>
+#include <shogun/optimization/FirstOrderShardedCostFunction.h>
+#include <shogun/optimization/lbfgs/LBFGSMinimizer.h>
+#include <shogun/base/Parallel.h>
+#include <shogun/base/init.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/eigen3.h>
+#include <shogun/lib/SGMatrix.h>
+
+using namespace shogun;
+using namespace Eigen;
+
+/* ridge regression f(w)=sum_i (y_i-w^T x_i)^2/2 + lambda*w^T w/2 */
+class ShardedLeastSquares: public FirstOrderShardedCostFunction
+{
+public:
+	ShardedLeastSquares(SGMatrix<float64_t> X, SGVector<float64_t> y,
+		float64_t lambda)
+		:FirstOrderShardedCostFunction(), m_X(X), m_y(y), m_lambda(lambda),
+		m_w(X.num_rows)
+	{
+		m_w.zero();
+	}
+
+	virtual SGVector<float64_t> obtain_variable_reference() { return m_w; }
+
+	virtual const char* get_name() const { return "ShardedLeastSquares"; }
+
+protected:
+	virtual index_t get_num_terms() { return m_X.num_cols; }
+
+	virtual float64_t evaluate_shard(index_t begin, index_t end,
+		SGVector<float64_t> gradient)
+	{
+		float64_t cost=0;
+		for (index_t i=begin; i<end; i++)
+		{
+			float64_t residual=-m_y[i];
+			for (index_t j=0; j<m_X.num_rows; j++)
+				residual+=m_w[j]*m_X(j,i);
+			cost+=residual*residual/2;
+			for (index_t j=0; j<m_X.num_rows; j++)
+				gradient[j]+=residual*m_X(j,i);
+		}
+		return cost;
+	}
+
+	virtual float64_t end_evaluation(float64_t cost,
+		SGVector<float64_t> gradient)
+	{
+		for (index_t j=0; j<m_w.vlen; j++)
+		{
+			cost+=m_lambda*m_w[j]*m_w[j]/2;
+			gradient[j]+=m_lambda*m_w[j];
+		}
+		return cost;
+	}
+
+	SGMatrix<float64_t> m_X;
+	SGVector<float64_t> m_y;
+	float64_t m_lambda;
+	SGVector<float64_t> m_w;
+};
+
+static void generate_data(SGMatrix<float64_t>& X, SGVector<float64_t>& y)
+{
+	index_t dim=5;
+	index_t num_vectors=1000;
+	CMath::init_random(17);
+	X=SGMatrix<float64_t>(dim, num_vectors);
+	y=SGVector<float64_t>(num_vectors);
+	for (index_t i=0; i<num_vectors; i++)
+	{
+		y[i]=CMath::randn_double();
+		for (index_t j=0; j<dim; j++)
+		{
+			X(j,i)=CMath::randn_double();
+			y[i]+=(j+1)*X(j,i);
+		}
+	}
+}
+
+TEST(FirstOrderShardedCostFunction,gradient)
+{
+	SGMatrix<float64_t> X;
+	SGVector<float64_t> y;
+	generate_data(X, y);
+	float64_t lambda=0.5;
+
+	ShardedLeastSquares* fun=new ShardedLeastSquares(X, y, lambda);
+	SG_REF(fun);
+	SGVector<float64_t> w=fun->obtain_variable_reference();
+	for (index_t j=0; j<w.vlen; j++)
+		w[j]=0.1*j;
+
+	float64_t cost=fun->get_cost();
+	SGVector<float64_t> gradient=fun->get_gradient();
+
+	Map<MatrixXd> eigen_X(X.matrix, X.num_rows, X.num_cols);
+	Map<VectorXd> eigen_y(y.vector, y.vlen);
+	Map<VectorXd> eigen_w(w.vector, w.vlen);
+	VectorXd residual=eigen_X.transpose()*eigen_w-eigen_y;
+	VectorXd expected=eigen_X*residual+lambda*eigen_w;
+
+	EXPECT_NEAR(residual.squaredNorm()/2+lambda*eigen_w.squaredNorm()/2,
+		cost, 1e-8);
+	for (index_t j=0; j<w.vlen; j++)
+		EXPECT_NEAR(expected[j], gradient[j], 1e-8);
+
+	/* the gradient is recomputed if the variables change */
+	w[0]=1;
+	SGVector<float64_t> gradient_moved=fun->get_gradient();
+	residual=eigen_X.transpose()*eigen_w-eigen_y;
+	expected=eigen_X*residual+lambda*eigen_w;
+	for (index_t j=0; j<w.vlen; j++)
+		EXPECT_NEAR(expected[j], gradient_moved[j], 1e-8);
+
+	SG_UNREF(fun);
+}
+
+TEST(FirstOrderShardedCostFunction,deterministic_reduction)
+{
+	SGMatrix<float64_t> X;
+	SGVector<float64_t> y;
+	generate_data(X, y);
+
+	ShardedLeastSquares* fun=new ShardedLeastSquares(X, y, 0);
+	SG_REF(fun);
+	fun->set_num_shards(7);
+	SGVector<float64_t> w=fun->obtain_variable_reference();
+	w.set_const(0.3);
+
+	Parallel* parallel=get_global_parallel();
+	int32_t num_threads=parallel->get_num_threads();
+
+	parallel->set_num_threads(1);
+	SGVector<float64_t> gradient_serial(w.vlen);
+	float64_t cost_serial=fun->evaluate(gradient_serial);
+
+	parallel->set_num_threads(4);
+	SGVector<float64_t> gradient(w.vlen);
+	float64_t cost=fun->evaluate(gradient);
+
+	/* bitwise equal */
+	EXPECT_EQ(cost_serial, cost);
+	for (index_t j=0; j<w.vlen; j++)
+		EXPECT_EQ(gradient_serial[j], gradient[j]);
+
+	parallel->set_num_threads(num_threads);
+	SG_UNREF(parallel);
+	SG_UNREF(fun);
+}
+
+TEST(FirstOrderShardedCostFunction,lbfgs_minimize)
+{
+	SGMatrix<float64_t> X;
+	SGVector<float64_t> y;
+	generate_data(X, y);
+	float64_t lambda=2;
+
+	ShardedLeastSquares* fun=new ShardedLeastSquares(X, y, lambda);
+	CLBFGSMinimizer* minimizer=new CLBFGSMinimizer(fun);
+	SG_REF(minimizer);
+	minimizer->minimize();
+
+	/* closed form solution (X X^T + lambda I) w = X y */
+	Map<MatrixXd> eigen_X(X.matrix, X.num_rows, X.num_cols);
+	Map<VectorXd> eigen_y(y.vector, y.vlen);
+	MatrixXd A=eigen_X*eigen_X.transpose()+lambda*MatrixXd::Identity(X.num_rows, X.num_rows);
+	VectorXd expected=A.ldlt().solve(eigen_X*eigen_y);
+
+	SGVector<float64_t> w=fun->obtain_variable_reference();
+	for (index_t j=0; j<w.vlen; j++)
+		EXPECT_NEAR(expected[j], w[j], 1e-5);
+
+	SG_UNREF(minimizer);
+}
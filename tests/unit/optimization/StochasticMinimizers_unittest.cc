@@ -51,6 +51,8 @@
 #include <shogun/optimization/ElasticNetPenalty.h>
 #include <shogun/optimization/SMIDASMinimizer.h>
 #include <shogun/optimization/PNormMappingFunction.h>
+#include <shogun/optimization/AdaGradUpdater.h>
+#include <shogun/mathematics/Math.h>
 using namespace shogun;
 using namespace Eigen;
 
@@ -417,6 +419,212 @@ void ClassificationFixture::init()
 }
 
 
+void SparseRegressionForTestCostFunction::set_data(SGMatrix<float64_t> features,
+	SGVector<float64_t> labels)
+{
+	m_features=features;
+	m_labels=labels;
+	m_weight=SGVector<float64_t>(features.num_rows);
+	m_weight.zero();
+}
+
+float64_t SparseRegressionForTestCostFunction::get_cost()
+{
+	float64_t cost=0;
+	for(index_t i=0; i<m_labels.vlen; i++)
+	{
+		float64_t residual=-m_labels[i];
+		for(index_t j=0; j<m_features.num_rows; j++)
+			residual+=m_features(j,i)*m_weight[j];
+		cost+=0.5*residual*residual;
+	}
+	return cost;
+}
+
+SGVector<float64_t> SparseRegressionForTestCostFunction::obtain_variable_reference()
+{
+	return m_weight;
+}
+
+int32_t SparseRegressionForTestCostFunction::get_sample_size()
+{
+	return m_labels.vlen;
+}
+
+index_t SparseRegressionForTestCostFunction::get_max_gradient_nnz()
+{
+	return m_features.num_rows;
+}
+
+index_t SparseRegressionForTestCostFunction::get_sample_indices(index_t idx,
+	SGSpan<index_t> indices)
+{
+	index_t nnz=0;
+	for(index_t j=0; j<m_features.num_rows; j++)
+	{
+		if(m_features(j,idx)!=0)
+			indices[nnz++]=j;
+	}
+	return nnz;
+}
+
+void SparseRegressionForTestCostFunction::get_sparse_gradient(index_t idx,
+	SGSpan<index_t> indices, SGSpan<float64_t> values)
+{
+	float64_t residual=-m_labels[idx];
+	for(index_t k=0; k<indices.size(); k++)
+		residual+=m_features(indices[k],idx)*m_weight[indices[k]];
+	for(index_t k=0; k<indices.size(); k++)
+		values[k]=residual*m_features(indices[k],idx);
+}
+
+struct SparseRegressionFixture
+{
+	SparseRegressionFixture() {init();}
+	SGVector<float64_t> y;
+	SGMatrix<float64_t> x;
+	void init();
+};
+
+void SparseRegressionFixture::init()
+{
+	//every sample has about 4 of 40 features, only 5 weights are nonzero
+	const index_t num_feat=40;
+	const index_t num_vec=300;
+	CMath::init_random(17);
+	x=SGMatrix<float64_t>(num_feat, num_vec);
+	y=SGVector<float64_t>(num_vec);
+	x.zero();
+	for(index_t i=0; i<num_vec; i++)
+	{
+		for(index_t k=0; k<4; k++)
+			x(CMath::random(0, num_feat-1), i)=CMath::randn_double();
+		y[i]=1.5*x(0,i)-2.0*x(3,i)+x(7,i)+0.5*x(20,i)-x(33,i)+0.01*CMath::randn_double();
+	}
+}
+
+/* runs SGD on the sparse cost function and on a copy which hides the
+ * sparse gradients, returns the largest difference of the weights */
+static float64_t sparse_dense_difference(DescendUpdater* sparse_updater,
+	DescendUpdater* dense_updater, Penalty* penalty)
+{
+	SparseRegressionFixture data;
+	SG_REF(penalty);
+	SGVector<float64_t> w[2];
+	float64_t cost[2];
+	for(index_t run=0; run<2; run++)
+	{
+		SparseRegressionForTestCostFunction* fun=new SparseRegressionForTestCostFunction();
+		fun->set_data(data.x, data.y);
+		SGDMinimizer* opt;
+		if(run==0)
+			opt=new SGDMinimizer(fun);
+		else
+			opt=new SGDMinimizer(new DenseWrapperForTestCostFunction(fun));
+
+		InverseScalingLearningRate* rate=new InverseScalingLearningRate();
+		rate->set_initial_learning_rate(0.05);
+		rate->set_exponent(0.5);
+		rate->set_slope(1.0);
+		rate->set_intercept(1.0);
+		opt->set_learning_rate(rate);
+		opt->set_gradient_updater(run==0 ? sparse_updater : dense_updater);
+		if(penalty)
+		{
+			opt->set_penalty_type(penalty);
+			opt->set_penalty_weight(0.01);
+		}
+		opt->set_number_passes(2);
+		cost[run]=opt->minimize();
+		w[run]=fun->obtain_variable_reference();
+		delete opt;
+	}
+
+	SG_UNREF(penalty);
+
+	EXPECT_NEAR(cost[0], cost[1], 1e-8);
+	float64_t result=0;
+	for(index_t j=0; j<w[0].vlen; j++)
+		result=CMath::max(result, CMath::abs(w[0][j]-w[1][j]));
+	return result;
+}
+
+TEST(SGDMinimizer,sparse_gradient_no_penalty)
+{
+	EXPECT_LE(sparse_dense_difference(new GradientDescendUpdater(),
+		new GradientDescendUpdater(), NULL), 1e-10);
+}
+
+TEST(SGDMinimizer,sparse_gradient_l2_penalty)
+{
+	EXPECT_LE(sparse_dense_difference(new GradientDescendUpdater(),
+		new GradientDescendUpdater(), new L2Penalty()), 1e-10);
+}
+
+TEST(SGDMinimizer,sparse_gradient_l1_penalty)
+{
+	EXPECT_LE(sparse_dense_difference(new GradientDescendUpdater(),
+		new GradientDescendUpdater(), new L1Penalty()), 1e-10);
+}
+
+TEST(SGDMinimizer,sparse_gradient_elastic_net_penalty)
+{
+	ElasticNetPenalty* penalty=new ElasticNetPenalty();
+	penalty->set_l1_ratio(0.3);
+	EXPECT_LE(sparse_dense_difference(new GradientDescendUpdater(),
+		new GradientDescendUpdater(), penalty), 1e-10);
+}
+
+TEST(SGDMinimizer,sparse_gradient_adaptive_updaters)
+{
+	//entries without gradient do not change the state of these updaters
+	EXPECT_LE(sparse_dense_difference(new AdaGradUpdater(),
+		new AdaGradUpdater(), new L1Penalty()), 1e-10);
+
+	RmsPropUpdater* sparse_rms=new RmsPropUpdater();
+	RmsPropUpdater* dense_rms=new RmsPropUpdater();
+	sparse_rms->set_decay_factor(0.9);
+	dense_rms->set_decay_factor(0.9);
+	EXPECT_LE(sparse_dense_difference(sparse_rms, dense_rms, NULL), 1e-10);
+}
+
+TEST(SGDMinimizer,hogwild)
+{
+	SparseRegressionFixture data;
+	SparseRegressionForTestCostFunction* fun=new SparseRegressionForTestCostFunction();
+	fun->set_data(data.x, data.y);
+	SGDMinimizer* opt=new SGDMinimizer(fun);
+	opt->parallel->set_num_threads(4);
+	opt->set_hogwild(true);
+
+	ConstLearningRate* rate=new ConstLearningRate();
+	rate->set_const_learning_rate(0.05);
+	opt->set_learning_rate(rate);
+	opt->set_gradient_updater(new GradientDescendUpdater());
+	opt->set_penalty_type(new L1Penalty());
+	opt->set_penalty_weight(1e-4);
+	opt->set_number_passes(30);
+	float64_t cost=opt->minimize()/data.y.vlen;
+
+	EXPECT_LE(cost, 0.01);
+	SGVector<float64_t> w=fun->obtain_variable_reference();
+	EXPECT_NEAR(w[0], 1.5, 0.05);
+	EXPECT_NEAR(w[3], -2.0, 0.05);
+	EXPECT_NEAR(w[7], 1.0, 0.05);
+	EXPECT_NEAR(w[20], 0.5, 0.05);
+	EXPECT_NEAR(w[33], -1.0, 0.05);
+
+	//dense steps can not be taken concurrently
+	SGDMinimizer* dense_opt=new SGDMinimizer(new DenseWrapperForTestCostFunction(fun));
+	dense_opt->set_hogwild(true);
+	dense_opt->set_gradient_updater(new GradientDescendUpdater());
+	dense_opt->set_number_passes(1);
+	EXPECT_THROW(dense_opt->minimize(), ShogunException);
+
+	delete opt;
+	delete dense_opt;
+}
+
 struct RegressionFixture
 {
 	RegressionFixture() {init();}
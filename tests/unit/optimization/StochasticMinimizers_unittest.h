@@ -33,6 +33,7 @@
 #ifndef STOCHASTICMINIMIZERS_UNITTEST_H
 #define STOCHASTICMINIMIZERS_UNITTEST_H
 #include <shogun/optimization/FirstOrderSAGCostFunction.h>
+#include <shogun/optimization/FirstOrderSparseStochasticCostFunction.h>
 #include <shogun/lib/SGMatrix.h>
 #include <shogun/lib/SGVector.h>
 #include <shogun/base/SGObject.h>
@@ -98,6 +99,43 @@ public:
 	virtual const char* get_name() const { return "ClassificationForTestCostFunction2"; }
 };
 
+class SparseRegressionForTestCostFunction: public FirstOrderSparseStochasticCostFunction
+{
+public:
+	SparseRegressionForTestCostFunction(){}
+	virtual ~SparseRegressionForTestCostFunction(){}
+	virtual void set_data(SGMatrix<float64_t> features, SGVector<float64_t> labels);
+	virtual float64_t get_cost();
+	virtual SGVector<float64_t> obtain_variable_reference();
+	virtual int32_t get_sample_size();
+	virtual index_t get_max_gradient_nnz();
+	virtual index_t get_sample_indices(index_t idx, SGSpan<index_t> indices);
+	virtual void get_sparse_gradient(index_t idx, SGSpan<index_t> indices,
+		SGSpan<float64_t> values);
+	virtual const char* get_name() const { return "SparseRegressionForTestCostFunction"; }
+protected:
+	SGVector<float64_t> m_labels;
+	SGMatrix<float64_t> m_features;
+	SGVector<float64_t> m_weight;
+};
+
+/* hides the sparse gradients from the minimizer */
+class DenseWrapperForTestCostFunction: public FirstOrderStochasticCostFunction
+{
+public:
+	DenseWrapperForTestCostFunction(FirstOrderSparseStochasticCostFunction* fun)
+		:FirstOrderStochasticCostFunction(), m_fun(fun) { SG_REF(m_fun); }
+	virtual ~DenseWrapperForTestCostFunction() { SG_UNREF(m_fun); }
+	virtual float64_t get_cost() { return m_fun->get_cost(); }
+	virtual SGVector<float64_t> obtain_variable_reference() { return m_fun->obtain_variable_reference(); }
+	virtual SGVector<float64_t> get_gradient() { return m_fun->get_gradient(); }
+	virtual void begin_sample() { m_fun->begin_sample(); }
+	virtual bool next_sample() { return m_fun->next_sample(); }
+	virtual const char* get_name() const { return "DenseWrapperForTestCostFunction"; }
+protected:
+	FirstOrderSparseStochasticCostFunction* m_fun;
+};
+
 class CRegressionExample: public CSGObject
 {
 friend class RegressionForTestCostFunction;
@@ -1,5 +1,7 @@
 #include <shogun/preprocessor/KernelPCA.h>
 #include <shogun/kernel/GaussianKernel.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/mathematics/Math.h>
 #include <shogun/lib/SGMatrix.h>
 
 #include <gtest/gtest.h>
@@ -40,4 +42,64 @@ TEST(KernelPCA, DISABLED_apply_to_feature_matrix_input)
 	for (index_t i = 0; i < num_features * num_vectors; ++i)
 		EXPECT_LE(CMath::abs(embedding.matrix[i] - s * resdata[i]), 1E-6);
 }
+
+TEST(KernelPCA, RANDOMIZED_matches_exact)
+{
+	CMath::init_random(17);
+	const int32_t num_features=3;
+	const int32_t num_vectors=120;
+	const int32_t target_dim=3;
+	SGMatrix<float64_t> data(num_features, num_vectors);
+	for (index_t i=0; i<num_features*num_vectors; i++)
+		data.matrix[i]=CMath::randn_double();
+
+	CDenseFeatures<float64_t>* feats=new CDenseFeatures<float64_t>(data);
+	CDenseFeatures<float64_t>* embedded=new CDenseFeatures<float64_t>(data.clone());
+	CDenseFeatures<float64_t>* randomized_embedded=
+		new CDenseFeatures<float64_t>(data.clone());
+	SG_REF(feats);
+	SG_REF(embedded);
+	SG_REF(randomized_embedded);
+
+	CKernelPCA* kpca=new CKernelPCA(new CGaussianKernel(10, 4));
+	kpca->set_target_dim(target_dim);
+	kpca->init(feats);
+	SGMatrix<float64_t> embedding=kpca->apply_to_feature_matrix(embedded);
+
+	CKernelPCA* randomized=new CKernelPCA(new CGaussianKernel(10, 4));
+	randomized->set_method(RANDOMIZED);
+	randomized->set_power_iterations(4);
+	randomized->set_target_dim(target_dim);
+	randomized->init(feats);
+	EXPECT_EQ(target_dim, randomized->get_transformation_matrix().num_cols);
+	EXPECT_EQ(target_dim, randomized->get_bias_vector().vlen);
+	SGMatrix<float64_t> randomized_embedding=
+		randomized->apply_to_feature_matrix(randomized_embedded);
+
+	ASSERT_EQ(target_dim, embedding.num_rows);
+	ASSERT_EQ(target_dim, randomized_embedding.num_rows);
+	for (index_t k=0; k<target_dim; k++)
+	{
+		/* the training data is centered in feature space */
+		float64_t mean=0;
+		float64_t sign=0;
+		for (index_t i=0; i<num_vectors; i++)
+		{
+			mean+=embedding(k,i)/num_vectors;
+			sign+=embedding(k,i)*randomized_embedding(k,i);
+		}
+		EXPECT_NEAR(0, mean, 1e-10);
+
+		/* components are unique up to their sign */
+		sign=sign>0 ? 1 : -1;
+		for (index_t i=0; i<num_vectors; i++)
+			EXPECT_NEAR(embedding(k,i), sign*randomized_embedding(k,i), 1e-5);
+	}
+
+	SG_UNREF(kpca);
+	SG_UNREF(randomized);
+	SG_UNREF(feats);
+	SG_UNREF(embedded);
+	SG_UNREF(randomized_embedded);
+}
 #endif // HAVE_LAPACK
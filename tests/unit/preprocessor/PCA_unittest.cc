@@ -443,6 +443,83 @@ TEST(PCA, PCA_MEM_IN_PLACE)
 	SG_UNREF(features);
 }
 
+TEST(PCA, PCA_MEM_IN_PLACE_apply_to_feature_block)
+{
+	index_t dim=5;
+	index_t n=20;
+
+	SGMatrix<float64_t> data(dim, n);
+	for (index_t i=0; i<dim*n; i++)
+		data.matrix[i]=CMath::randn_double();
+
+	CDenseFeatures<float64_t>* features=new CDenseFeatures<float64_t>(data);
+	CPCA* pca=new CPCA(EVD, false, MEM_IN_PLACE);
+	pca->set_target_dim(2);
+	pca->init(features);
+	EXPECT_FALSE(pca->supports_parallel_blocks());
+
+	SGMatrix<float64_t> block=data.clone();
+	SGMatrix<float64_t> result=pca->apply_to_feature_block(block);
+
+	EXPECT_EQ(block.matrix, result.matrix);
+	EXPECT_EQ(2, result.num_rows);
+	EXPECT_EQ(n, result.num_cols);
+
+	for (index_t i=0; i<n; i++)
+	{
+		SGVector<float64_t> expected=pca->apply_to_feature_vector(
+			SGVector<float64_t>(data.get_column_vector(i), dim, false));
+
+		for (index_t j=0; j<expected.vlen; j++)
+			EXPECT_NEAR(expected[j], result(j,i), 1E-12);
+	}
+
+	SG_UNREF(pca);
+	SG_UNREF(features);
+}
+
+TEST(PCA, PCA_apply_to_feature_matrix_training_mean)
+{
+	index_t dim=5;
+	index_t n=20;
+
+	SGMatrix<float64_t> data(dim, n);
+	SGMatrix<float64_t> test_data(dim, n);
+	for (index_t i=0; i<dim*n; i++)
+	{
+		data.matrix[i]=CMath::randn_double();
+		test_data.matrix[i]=CMath::randn_double()+1;
+	}
+
+	CDenseFeatures<float64_t>* features=new CDenseFeatures<float64_t>(data);
+	for (index_t mem_mode=0; mem_mode<2; mem_mode++)
+	{
+		CPCA* pca=new CPCA(EVD, false,
+			mem_mode ? MEM_IN_PLACE : MEM_REALLOCATE);
+		pca->set_target_dim(2);
+		pca->init(features);
+
+		/* the test data is centered with the mean of the training data, in
+		 * the same way as single vectors */
+		CDenseFeatures<float64_t>* test_features=
+			new CDenseFeatures<float64_t>(test_data.clone());
+		SGMatrix<float64_t> result=pca->apply_to_feature_matrix(test_features);
+
+		for (index_t i=0; i<n; i++)
+		{
+			SGVector<float64_t> expected=pca->apply_to_feature_vector(
+				SGVector<float64_t>(test_data.get_column_vector(i), dim, false));
+
+			for (index_t j=0; j<expected.vlen; j++)
+				EXPECT_NEAR(expected[j], result(j,i), 1E-12);
+		}
+
+		SG_UNREF(test_features);
+		SG_UNREF(pca);
+	}
+	SG_UNREF(features);
+}
+
 TEST(PCA, PCA_apply_to_feature_vector_methodTest)
 {
 	SGMatrix<float64_t> data(5,3);
@@ -607,3 +684,97 @@ TEST(PCA, PCA_WHITEN_EVD)
 	SG_UNREF(pca);
 	SG_UNREF(features);
 }
+
+static SGMatrix<float64_t> generate_decaying_data(int32_t dim, int32_t num_vectors)
+{
+	SGMatrix<float64_t> data(dim, num_vectors);
+	for (index_t j=0; j<num_vectors; j++)
+	{
+		for (index_t i=0; i<dim; i++)
+			data(i,j)=CMath::randn_double()*CMath::pow(0.7, i)+i;
+	}
+	return data;
+}
+
+TEST(PCA, PCA_RANDOMIZED_matches_EVD)
+{
+	CMath::init_random(17);
+	const int32_t dim=30;
+	const int32_t num_vectors=2500;
+	const int32_t target_dim=4;
+	SGMatrix<float64_t> data=generate_decaying_data(dim, num_vectors);
+
+	CDenseFeatures<float64_t>* features=new CDenseFeatures<float64_t>(data.clone());
+	CPCA* pca=new CPCA(EVD);
+	pca->set_target_dim(target_dim);
+	pca->init(features);
+
+	CDenseFeatures<float64_t>* streamed=new CDenseFeatures<float64_t>(data);
+	CPCA* randomized=new CPCA(RANDOMIZED);
+	randomized->set_target_dim(target_dim);
+	randomized->set_power_iterations(3);
+	randomized->init(streamed);
+
+	SGVector<float64_t> mean=pca->get_mean();
+	SGVector<float64_t> randomized_mean=randomized->get_mean();
+	for (index_t i=0; i<dim; i++)
+		EXPECT_NEAR(mean[i], randomized_mean[i], 1e-12);
+
+	/* EVD eigenvalues are ascending, randomized ones descending */
+	SGVector<float64_t> eigenvalues=pca->get_eigenvalues();
+	SGVector<float64_t> randomized_eigenvalues=randomized->get_eigenvalues();
+	EXPECT_EQ(target_dim+randomized->get_oversampling(), randomized_eigenvalues.vlen);
+	for (index_t i=0; i<target_dim; i++)
+		EXPECT_NEAR(eigenvalues[dim-i-1], randomized_eigenvalues[i], 1e-8);
+
+	/* eigenvectors are unique up to their sign */
+	SGMatrix<float64_t> transmat=pca->get_transformation_matrix();
+	SGMatrix<float64_t> randomized_transmat=randomized->get_transformation_matrix();
+	ASSERT_EQ(dim, randomized_transmat.num_rows);
+	ASSERT_EQ(target_dim, randomized_transmat.num_cols);
+	for (index_t j=0; j<target_dim; j++)
+	{
+		float64_t* exact=transmat.get_column_vector(target_dim-j-1);
+		float64_t* approx=randomized_transmat.get_column_vector(j);
+		float64_t sign=CMath::dot(exact, approx, dim)>0 ? 1 : -1;
+		for (index_t i=0; i<dim; i++)
+			EXPECT_NEAR(exact[i], sign*approx[i], 1e-6);
+	}
+
+	SG_UNREF(pca);
+	SG_UNREF(randomized);
+	SG_UNREF(features);
+	SG_UNREF(streamed);
+}
+
+TEST(PCA, PCA_RANDOMIZED_THRESHOLD_WHITEN)
+{
+	CMath::init_random(17);
+	const int32_t dim=20;
+	SGMatrix<float64_t> data=generate_decaying_data(dim, 1500);
+
+	CDenseFeatures<float64_t>* features=new CDenseFeatures<float64_t>(data);
+	CPCA* pca=new CPCA(true, THRESHOLD, 0.2, RANDOMIZED);
+	pca->set_target_dim(5);
+	pca->init(features);
+
+	/* variances 0.7^(2i) above the threshold */
+	SGVector<float64_t> eigenvalues=pca->get_eigenvalues();
+	SGMatrix<float64_t> transmat=pca->get_transformation_matrix();
+	ASSERT_EQ(3, transmat.num_cols);
+	for (index_t i=0; i<transmat.num_cols; i++)
+		EXPECT_GT(eigenvalues[i], 0.2);
+	EXPECT_LE(eigenvalues[transmat.num_cols], 0.2);
+
+	SGMatrix<float64_t> finalmat=pca->apply_to_feature_matrix(features);
+	SGMatrix<float64_t> covariance_mat=
+		SGMatrix<float64_t>::matrix_multiply(finalmat,finalmat,false,true);
+	for (index_t j=0; j<covariance_mat.num_cols; j++)
+	{
+		for (index_t i=0; i<covariance_mat.num_rows; i++)
+			EXPECT_NEAR(i==j ? 1.0 : 0.0, covariance_mat(i,j), 1e-6);
+	}
+
+	SG_UNREF(pca);
+	SG_UNREF(features);
+}
@@ -0,0 +1,192 @@
+#include <shogun/lib/config.h>
+#include <shogun/regression/ElasticNetRegression.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/features/SparseFeatures.h>
+#include <shogun/labels/RegressionLabels.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/Statistics.h>
+
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+static void generate_data(SGMatrix<float64_t>& X, SGVector<float64_t>& y)
+{
+	const int32_t num_feat=30;
+	const int32_t num_vec=200;
+
+	CMath::init_random(3);
+	X=SGMatrix<float64_t>(num_feat, num_vec);
+	y=SGVector<float64_t>(num_vec);
+
+	for (index_t i=0; i<num_vec; i++)
+	{
+		for (index_t j=0; j<num_feat; j++)
+		{
+			/* every third feature is sparse */
+			if (j%3==0)
+				X(j,i)=CMath::random(0,9)<3 ? CMath::randn_double() : 0;
+			else
+				X(j,i)=CMath::randn_double()+0.1*j;
+		}
+
+		y[i]=2*X(0,i)-3*X(1,i)+0.5*X(5,i)+4+0.1*CMath::randn_double();
+	}
+}
+
+/* largest violation of the optimality conditions of a solution in terms of
+ * the standardized features */
+static float64_t kkt_violation(SGMatrix<float64_t> X, SGVector<float64_t> y,
+		SGVector<float64_t> w, float64_t bias, float64_t lambda, float64_t alpha)
+{
+	const index_t num_feat=X.num_rows;
+	const index_t num_vec=X.num_cols;
+
+	SGVector<float64_t> residual(num_vec);
+	for (index_t i=0; i<num_vec; i++)
+	{
+		residual[i]=y[i]-bias;
+		for (index_t j=0; j<num_feat; j++)
+			residual[i]-=w[j]*X(j,i);
+	}
+
+	float64_t result=0;
+	for (index_t j=0; j<num_feat; j++)
+	{
+		float64_t mean=0, sq=0;
+		for (index_t i=0; i<num_vec; i++)
+		{
+			mean+=X(j,i);
+			sq+=X(j,i)*X(j,i);
+		}
+		mean/=num_vec;
+		const float64_t scale=CMath::sqrt(sq/num_vec-mean*mean);
+
+		float64_t grad=0;
+		for (index_t i=0; i<num_vec; i++)
+			grad+=(X(j,i)-mean)/scale*residual[i];
+		grad/=num_vec;
+
+		const float64_t beta=w[j]*scale;
+		if (beta!=0)
+		{
+			result=CMath::max(result, CMath::abs(grad-lambda*(1-alpha)*beta-
+					lambda*alpha*CMath::sign(beta)));
+		}
+		else
+			result=CMath::max(result, grad-lambda*alpha);
+	}
+
+	return result;
+}
+
+TEST(ElasticNetRegression, lasso_path)
+{
+	SGMatrix<float64_t> X;
+	SGVector<float64_t> y;
+	generate_data(X, y);
+
+	CElasticNetRegression* enet=new CElasticNetRegression(1.0,
+			new CDenseFeatures<float64_t>(X), new CRegressionLabels(y));
+	SG_REF(enet);
+	enet->set_epsilon(1e-12);
+	enet->train();
+
+	SGVector<float64_t> lambdas=enet->get_lambdas();
+	ASSERT_EQ(100, enet->get_path_size());
+	ASSERT_EQ(100, lambdas.vlen);
+
+	/* the path starts with the empty model */
+	EXPECT_EQ(0, enet->get_path_sparse_w(0).num_feat_entries);
+	EXPECT_NEAR(CStatistics::mean(y), enet->get_path_bias(0), 1e-12);
+
+	for (index_t k=1; k<lambdas.vlen; k++)
+		EXPECT_LT(lambdas[k], lambdas[k-1]);
+
+	for (index_t k=0; k<enet->get_path_size(); k+=7)
+	{
+		EXPECT_LE(kkt_violation(X, y, enet->get_path_w(k),
+				enet->get_path_bias(k), lambdas[k], 1.0), 1e-5);
+	}
+
+	/* the machine uses the last solution */
+	SGVector<float64_t> w=enet->get_w();
+	EXPECT_NEAR(2, w[0], 0.05);
+	EXPECT_NEAR(-3, w[1], 0.05);
+	EXPECT_NEAR(0.5, w[5], 0.05);
+	EXPECT_NEAR(4, enet->get_bias(), 0.1);
+
+	SG_UNREF(enet);
+}
+
+TEST(ElasticNetRegression, elastic_net_sparse_and_covariance_updates)
+{
+	SGMatrix<float64_t> X;
+	SGVector<float64_t> y;
+	generate_data(X, y);
+
+	CElasticNetRegression* dense=new CElasticNetRegression(0.5,
+			new CDenseFeatures<float64_t>(X), new CRegressionLabels(y));
+	SG_REF(dense);
+	dense->set_update_type(ENU_NAIVE);
+	dense->set_epsilon(1e-12);
+	dense->train();
+
+	CElasticNetRegression* sparse=new CElasticNetRegression(0.5,
+			new CSparseFeatures<float64_t>(X), new CRegressionLabels(y));
+	SG_REF(sparse);
+	sparse->set_update_type(ENU_COVARIANCE);
+	sparse->set_epsilon(1e-12);
+	sparse->train();
+
+	ASSERT_EQ(dense->get_path_size(), sparse->get_path_size());
+	SGVector<float64_t> lambdas=dense->get_lambdas();
+
+	for (index_t k=0; k<dense->get_path_size(); k+=9)
+	{
+		SGVector<float64_t> w_dense=dense->get_path_w(k);
+		SGVector<float64_t> w_sparse=sparse->get_path_w(k);
+		for (index_t j=0; j<w_dense.vlen; j++)
+			EXPECT_NEAR(w_dense[j], w_sparse[j], 1e-6);
+
+		EXPECT_NEAR(dense->get_path_bias(k), sparse->get_path_bias(k), 1e-6);
+		EXPECT_LE(kkt_violation(X, y, w_sparse, sparse->get_path_bias(k),
+				lambdas[k], 0.5), 1e-5);
+	}
+
+	SG_UNREF(dense);
+	SG_UNREF(sparse);
+}
+
+TEST(ElasticNetRegression, given_lambdas_and_early_stopping)
+{
+	SGMatrix<float64_t> X;
+	SGVector<float64_t> y;
+	generate_data(X, y);
+
+	SGVector<float64_t> lambdas(3);
+	lambdas[0]=1;
+	lambdas[1]=0.1;
+	lambdas[2]=0.01;
+
+	CElasticNetRegression* enet=new CElasticNetRegression(1.0,
+			new CDenseFeatures<float64_t>(X), new CRegressionLabels(y));
+	SG_REF(enet);
+	enet->set_lambdas(lambdas);
+	enet->train();
+
+	EXPECT_EQ(3, enet->get_path_size());
+	EXPECT_EQ(lambdas[1], enet->get_lambdas()[1]);
+
+	/* stop once more than one weight is nonzero */
+	enet->set_lambdas(SGVector<float64_t>());
+	enet->set_max_non_zero(1);
+	enet->train();
+
+	const int32_t size=enet->get_path_size();
+	EXPECT_LT(size, 100);
+	EXPECT_GT(enet->get_path_sparse_w(size-1).num_feat_entries, 1);
+	EXPECT_LE(enet->get_path_sparse_w(size-2).num_feat_entries, 1);
+
+	SG_UNREF(enet);
+}
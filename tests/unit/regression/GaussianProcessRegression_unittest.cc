@@ -613,6 +613,145 @@ TEST(GaussianProcessRegression,var_dtc_regression)
 	SG_UNREF(inducing_features_train);
 }
 
+TEST(GaussianProcessRegression, predictive_state)
+{
+	CMath::init_random(17);
+
+	index_t n=40;
+	index_t n_test=25;
+
+	SGMatrix<float64_t> X(1, n);
+	SGMatrix<float64_t> X_test(1, n_test);
+	SGVector<float64_t> Y(n);
+
+	for (index_t i=0; i<n; ++i)
+	{
+		X[i]=CMath::random(-3.0, 3.0);
+		Y[i]=CMath::sin(X[i])+CMath::normal_random(0.0, 0.1);
+	}
+
+	for (index_t i=0; i<n_test; ++i)
+		X_test[i]=CMath::random(-3.0, 3.0);
+
+	CDenseFeatures<float64_t>* feat_train=new CDenseFeatures<float64_t>(X);
+	CDenseFeatures<float64_t>* feat_test=new CDenseFeatures<float64_t>(X_test);
+	SG_REF(feat_test);
+	CRegressionLabels* label_train=new CRegressionLabels(Y);
+
+	CGaussianKernel* kernel=new CGaussianKernel(10, 2.0);
+	CConstMean* mean=new CConstMean(0.5);
+	CGaussianLikelihood* lik=new CGaussianLikelihood(0.2);
+	CExactInferenceMethod* inf=new CExactInferenceMethod(kernel, feat_train,
+			mean, label_train, lik);
+	inf->set_scale(1.3);
+
+	CGaussianProcessRegression* gpr=new CGaussianProcessRegression(inf);
+	gpr->train();
+
+	SGVector<float64_t> mu=gpr->get_posterior_means(feat_test);
+	SGVector<float64_t> s2=gpr->get_posterior_variances(feat_test);
+
+	// predict in blocks which do not divide the number of testing vectors
+	gpr->compute_predictive_state();
+	gpr->set_prediction_tile_size(7);
+	EXPECT_TRUE(gpr->has_predictive_state());
+
+	SGVector<float64_t> mu_cached;
+	SGVector<float64_t> s2_cached;
+	gpr->get_posterior_means_and_variances(feat_test, mu_cached, s2_cached);
+
+	for (index_t i=0; i<n_test; ++i)
+	{
+		EXPECT_NEAR(mu_cached[i], mu[i], 1E-12);
+		EXPECT_NEAR(s2_cached[i], s2[i], 1E-12);
+	}
+
+	// training discards the state
+	gpr->train();
+	EXPECT_FALSE(gpr->has_predictive_state());
+
+	SG_UNREF(feat_test);
+	SG_UNREF(gpr);
+}
+
+TEST(GaussianProcessRegression, append_training_data)
+{
+	CMath::init_random(17);
+
+	index_t n=30;
+	index_t k=8;
+	index_t n_test=10;
+
+	SGMatrix<float64_t> X(1, n+k);
+	SGMatrix<float64_t> X_test(1, n_test);
+	SGVector<float64_t> Y(n+k);
+
+	for (index_t i=0; i<n+k; ++i)
+	{
+		X[i]=CMath::random(-3.0, 3.0);
+		Y[i]=CMath::sin(X[i])+CMath::normal_random(0.0, 0.1);
+	}
+
+	for (index_t i=0; i<n_test; ++i)
+		X_test[i]=CMath::random(-3.0, 3.0);
+
+	SGMatrix<float64_t> X_old(1, n);
+	SGMatrix<float64_t> X_new(1, k);
+	SGVector<float64_t> Y_old(n);
+	SGVector<float64_t> Y_new(k);
+	memcpy(X_old.matrix, X.matrix, sizeof(float64_t)*n);
+	memcpy(X_new.matrix, X.matrix+n, sizeof(float64_t)*k);
+	memcpy(Y_old.vector, Y.vector, sizeof(float64_t)*n);
+	memcpy(Y_new.vector, Y.vector+n, sizeof(float64_t)*k);
+
+	CDenseFeatures<float64_t>* feat_test=new CDenseFeatures<float64_t>(X_test);
+	SG_REF(feat_test);
+
+	// GP trained on all data at once
+	CExactInferenceMethod* inf_full=new CExactInferenceMethod(
+			new CGaussianKernel(10, 2.0), new CDenseFeatures<float64_t>(X),
+			new CConstMean(0.5), new CRegressionLabels(Y),
+			new CGaussianLikelihood(0.2));
+	CGaussianProcessRegression* gpr_full=new CGaussianProcessRegression(inf_full);
+	gpr_full->train();
+
+	SGVector<float64_t> mu;
+	SGVector<float64_t> s2;
+	gpr_full->get_posterior_means_and_variances(feat_test, mu, s2);
+
+	// GP trained on the first part, updated with the second one
+	CExactInferenceMethod* inf=new CExactInferenceMethod(
+			new CGaussianKernel(10, 2.0), new CDenseFeatures<float64_t>(X_old),
+			new CConstMean(0.5), new CRegressionLabels(Y_old),
+			new CGaussianLikelihood(0.2));
+	CGaussianProcessRegression* gpr=new CGaussianProcessRegression(inf);
+	gpr->train();
+	gpr->compute_predictive_state();
+	gpr->append_training_data(new CDenseFeatures<float64_t>(X_new),
+		new CRegressionLabels(Y_new));
+
+	SGVector<float64_t> mu_updated;
+	SGVector<float64_t> s2_updated;
+	gpr->get_posterior_means_and_variances(feat_test, mu_updated, s2_updated);
+
+	for (index_t i=0; i<n_test; ++i)
+	{
+		EXPECT_NEAR(mu_updated[i], mu[i], 1E-10);
+		EXPECT_NEAR(s2_updated[i], s2[i], 1E-10);
+	}
+
+	// the inference method got the merged data, so a refit gives the same
+	gpr->train();
+	SGVector<float64_t> mu_refit=gpr->get_posterior_means(feat_test);
+
+	for (index_t i=0; i<n_test; ++i)
+		EXPECT_NEAR(mu_refit[i], mu[i], 1E-10);
+
+	SG_UNREF(feat_test);
+	SG_UNREF(gpr);
+	SG_UNREF(gpr_full);
+}
+
 #ifdef HAVE_LINALG_LIB
 TEST(GaussianProcessRegression,fitc_regression)
 {
@@ -145,3 +145,58 @@ TEST(LibSVR,nu_svr_apply)
 	SG_UNREF(predicted_labels);
 	SG_UNREF(svm);
 }
+
+TEST(LibSVR,epsilon_svr_train_path)
+{
+	/* noisy sine wave */
+	index_t n=30;
+	CMath::init_random(3);
+	SGMatrix<float64_t> feat_train(1, n);
+	SGVector<float64_t> lab_train(n);
+	for (index_t i=0; i<n; i++)
+	{
+		feat_train[i]=6.0*i/n;
+		lab_train[i]=CMath::sin(feat_train[i])+0.2*CMath::randn_double();
+	}
+
+	CRegressionLabels* labels_train=new CRegressionLabels(lab_train);
+	CDenseFeatures<float64_t>* features_train=new CDenseFeatures<float64_t>(
+			feat_train);
+	SG_REF(features_train);
+
+	/* both regularization constant and tube change along the path */
+	SGVector<float64_t> C_values(4);
+	SGVector<float64_t> tube_epsilons(4);
+	C_values[0]=0.1;	tube_epsilons[0]=0.3;
+	C_values[1]=1;		tube_epsilons[1]=0.1;
+	C_values[2]=10;		tube_epsilons[2]=0.2;
+	C_values[3]=100;	tube_epsilons[3]=0.05;
+
+	CLibSVR* path=new CLibSVR(1, 0.1, new CGaussianKernel(10, 1),
+			labels_train, LIBSVR_EPSILON_SVR);
+	path->set_epsilon(1e-6);
+	EXPECT_TRUE(path->train_path(C_values, tube_epsilons, features_train));
+	ASSERT_EQ(n, path->get_path_alphas().num_rows);
+	ASSERT_EQ(C_values.vlen, path->get_path_alphas().num_cols);
+
+	for (index_t k=0; k<C_values.vlen; k++)
+	{
+		CLibSVR* svm=new CLibSVR(C_values[k], tube_epsilons[k],
+				new CGaussianKernel(10, 1), labels_train, LIBSVR_EPSILON_SVR);
+		svm->set_epsilon(1e-6);
+		svm->train(features_train);
+		CRegressionLabels* expected=svm->apply_regression(features_train);
+
+		path->set_path_solution(k);
+		CRegressionLabels* outputs=path->apply_regression(features_train);
+		for (index_t i=0; i<n; i++)
+			EXPECT_NEAR(expected->get_label(i), outputs->get_label(i), 1E-4);
+
+		SG_UNREF(expected);
+		SG_UNREF(outputs);
+		SG_UNREF(svm);
+	}
+
+	SG_UNREF(path);
+	SG_UNREF(features_train);
+}
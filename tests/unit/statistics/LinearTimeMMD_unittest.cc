@@ -12,6 +12,7 @@
 #include <shogun/kernel/CombinedKernel.h>
 #include <shogun/features/DenseFeatures.h>
 #include <shogun/features/streaming/StreamingDenseFeatures.h>
+#include <shogun/mathematics/Statistics.h>
 #include <gtest/gtest.h>
 
 using namespace shogun;
@@ -282,3 +283,63 @@ TEST(LinearTimeMMD,test_linear_mmd_statistic_and_variance_fixed)
 
 	SG_UNREF(mmd);
 }
+
+/** tests that null samples from sign flipped h-terms match the Gaussian
+ * approximation of the null-distribution and that the test which computes
+ * statistic and null samples in one pass rejects for shifted data */
+TEST(LinearTimeMMD,test_linear_mmd_sample_null_sign_flips)
+{
+	index_t m=2000;
+	index_t d=2;
+	index_t num_passes=3;
+	float64_t difference=1;
+
+	CMath::init_random(1);
+
+	/* p and q from the same distribution for the first two passes, q shifted
+	 * for the last one */
+	SGMatrix<float64_t> data_p(d, num_passes*m);
+	SGMatrix<float64_t> data_q(d, num_passes*m);
+	for (index_t i=0; i<d*num_passes*m; ++i)
+	{
+		data_p.matrix[i]=CMath::randn_double();
+		data_q.matrix[i]=CMath::randn_double();
+		if (i>=d*(num_passes-1)*m)
+			data_q.matrix[i]+=difference;
+	}
+
+	CDenseFeatures<float64_t>* features_p=new CDenseFeatures<float64_t>(data_p);
+	CDenseFeatures<float64_t>* features_q=new CDenseFeatures<float64_t>(data_q);
+
+	CStreamingFeatures* streaming_p=new CStreamingDenseFeatures<float64_t>(
+			features_p);
+	CStreamingFeatures* streaming_q=new CStreamingDenseFeatures<float64_t>(
+			features_q);
+
+	CGaussianKernel* kernel=new CGaussianKernel(10, 2);
+	CLinearTimeMMD* mmd=new CLinearTimeMMD(kernel, streaming_p, streaming_q, m,
+			300);
+	mmd->set_num_null_samples(500);
+	mmd->set_null_approximation_method(PERMUTATION);
+
+	streaming_p->start_parser();
+	streaming_q->start_parser();
+
+	float64_t variance=mmd->compute_variance_estimate();
+	SGVector<float64_t> null_samples=mmd->sample_null();
+	EXPECT_EQ(null_samples.vlen, 500);
+
+	/* null samples have zero mean and the estimated variance */
+	float64_t null_mean=CStatistics::mean(null_samples);
+	float64_t null_variance=CStatistics::variance(null_samples);
+	EXPECT_LE(CMath::abs(null_mean), 4*CMath::sqrt(variance/500));
+	EXPECT_GE(null_variance, 0.7*variance);
+	EXPECT_LE(null_variance, 1.3*variance);
+
+	EXPECT_LT(mmd->perform_test(), 0.01);
+
+	streaming_p->end_parser();
+	streaming_q->end_parser();
+
+	SG_UNREF(mmd);
+}